@@ -62,12 +62,14 @@
 #include "CEGUI/HorizontalAlignment.h"
 #include "CEGUI/Image.h"
 #include "CEGUI/ImageCodec.h"
+#include "CEGUI/ImageHandle.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/KeyFrame.h"
 #include "CEGUI/LinkedEvent.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/OcclusionCuller.h"
 #include "CEGUI/Property.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/PropertySet.h"
@@ -75,6 +77,7 @@
 #include "CEGUI/Rectf.h"
 #include "CEGUI/URect.h"
 #include "CEGUI/RegexMatcher.h"
+#include "CEGUI/RenderCachePolicy.h"
 #include "CEGUI/RenderEffect.h"
 #include "CEGUI/RenderEffectManager.h"
 #include "CEGUI/Renderer.h"
@@ -92,6 +95,10 @@
 #include "CEGUI/StringTranscoder.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Texture.h"
+#include "CEGUI/TextureDecompressor.h"
+#include "CEGUI/TextureFilter.h"
+#include "CEGUI/TextureFilterEffect.h"
+#include "CEGUI/TextureResidencyManager.h"
 #include "CEGUI/TextureTarget.h"
 #include "CEGUI/text/TextUtils.h"
 #include "CEGUI/TplInterpolators.h"
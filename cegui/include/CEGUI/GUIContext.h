@@ -29,6 +29,8 @@
 
 #include "CEGUI/RenderingSurface.h"
 #include "CEGUI/InjectedInputReceiver.h"
+#include "CEGUI/RenderCachePolicy.h"
+#include "CEGUI/OcclusionCuller.h"
 #include "CEGUI/URect.h"
 #include <chrono>
 
@@ -40,6 +42,7 @@
 namespace CEGUI
 {
 class WindowNavigator;
+class LayoutContainer;
 
 //! EventArgs class passed to subscribers for (most) GUIContext events.
 class CEGUIEXPORT GUIContextEventArgs : public EventArgs
@@ -108,6 +111,50 @@ public:
     bool isDirty() const { return d_dirtyDrawModeMask != 0; }
     std::uint32_t getDirtyDrawModeMask() const { return d_dirtyDrawModeMask; }
 
+    /*!
+    \brief
+        Schedule \a container to be laid out by the next layout pass of this
+        context. LayoutContainer calls this itself when it gets marked as
+        needing layouting, so there is normally no need to call it directly.
+    */
+    void requestLayout(LayoutContainer* container);
+
+    /*!
+    \brief
+        Lay out all layout containers scheduled via requestLayout.
+
+        Containers are processed deepest first, so nested containers have
+        their final size before their parents arrange them. Layouts requested
+        while the pass runs (e.g. by a parent of a container that was resized)
+        are processed by the same call. This is done automatically by
+        injectTimePulse and draw, but may be called at any time when up to date
+        window areas are required.
+
+    \return
+        true if any layout was performed.
+    */
+    bool performPendingLayouts();
+
+    //! Return whether any layout containers are waiting to be laid out.
+    bool hasPendingLayouts() const { return !d_pendingLayouts.empty(); }
+
+    /*!
+    \brief
+        Return the policy that automatically renders static parts of the
+        window tree through cached texture surfaces. It is disabled unless
+        enabled via RenderCachePolicy::setEnabled.
+    */
+    RenderCachePolicy& getRenderCachePolicy() { return d_renderCachePolicy; }
+    const RenderCachePolicy& getRenderCachePolicy() const { return d_renderCachePolicy; }
+
+    /*!
+    \brief
+        Return the culler that skips drawing windows hidden behind opaque
+        windows. It is disabled unless enabled via OcclusionCuller::setEnabled.
+    */
+    OcclusionCuller& getOcclusionCuller() { return d_occlusionCuller; }
+    const OcclusionCuller& getOcclusionCuller() const { return d_occlusionCuller; }
+
     /*!
     \brief
         Function to inject time pulses into the context.
@@ -394,6 +441,14 @@ protected:
     const Image* d_defaultCursorImage = nullptr;
     std::vector<GeometryBuffer*> d_cursorGeometry;
 
+    //! layout containers waiting for the next layout pass.
+    std::vector<LayoutContainer*> d_pendingLayouts;
+    //! containers being laid out by the running layout pass.
+    std::vector<LayoutContainer*> d_layoutBatch;
+
+    RenderCachePolicy d_renderCachePolicy;
+    OcclusionCuller d_occlusionCuller;
+
     String d_defaultTooltipType;
     std::map<String, Window*> d_tooltips;
 
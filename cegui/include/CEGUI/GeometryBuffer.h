@@ -83,6 +83,28 @@ enum class PolygonFillRule : uint8_t
 
 //----------------------------------------------------------------------------//
 
+/*!
+\brief
+    Enumerated type describing how the vertex data of a GeometryBuffer can be
+    represented in the compact vertex layout (see
+    GeometryBuffer::getCompactVertexData).
+*/
+enum class CompactVertexLayout : uint8_t
+{
+    //! The vertices can't be represented in the compact layout.
+    None,
+    //! The compact vertices form a triangle list, like the float data.
+    Triangles,
+    /*!
+        Every 6 vertices of the float data form a quad, and only its 4 distinct
+        vertices are stored. The triangle list is rebuilt by drawing with
+        GeometryBuffer::QuadIndices.
+    */
+    Quads
+};
+
+//----------------------------------------------------------------------------//
+
 /*!
 \brief
     Abstract class defining the interface for objects that buffer geometry for
@@ -95,6 +117,11 @@ public:
     static constexpr size_t COLORED_VERTEX_FLOAT_COUNT = sizeof(ColouredVertex) / sizeof(float);
     static constexpr size_t TEXTURED_VERTEX_FLOAT_COUNT = sizeof(TexturedColouredVertex) / sizeof(float);
 
+    //! Index pattern that turns the 4 compact vertices of a quad into 2 triangles.
+    static const uint16_t QuadIndices[6];
+    //! Maximum number of quads that can be addressed with 16 bit indices.
+    static constexpr size_t MaxCompactQuadCount = 65536 / 4;
+
     virtual ~GeometryBuffer();
 
     void clear();
@@ -168,6 +195,9 @@ public:
     */
     void setCustomTransform(const glm::mat4x4& transformation);
 
+    //! \brief Gets the custom transformation matrix set for this buffer.
+    const glm::mat4x4& getCustomTransform() const { return d_customTransform; }
+
     /*!
     \brief
         Set the clipping region to be used when rendering this buffer. The
@@ -191,6 +221,9 @@ public:
     */
     void setStencilRenderingActive(PolygonFillRule fill_rule) { d_polygonFillRule = fill_rule; }
 
+    //! \brief Gets the fill rule used when rendering the geometry.
+    PolygonFillRule getPolygonFillRule() const { return d_polygonFillRule; }
+
     /*!
     \brief
         Sets the number of vertices that should be rendered after the stencil buffer was filled.
@@ -200,6 +233,9 @@ public:
     */
     void setStencilPostRenderingVertexCount(unsigned int vertex_count) { d_postStencilVertexCount = vertex_count; }
 
+    //! \brief Gets the number of vertices rendered after the stencil buffer was filled.
+    unsigned int getStencilPostRenderingVertexCount() const { return d_postStencilVertexCount; }
+
     /*!
     \brief
         Append the geometry data to the existing data
@@ -350,6 +386,44 @@ public:
     */
     virtual int getVertexAttributeElementCount() const;
 
+    /*!
+    \brief
+        Returns the vertex data of this GeometryBuffer quantised to the compact
+        vertex layout, which renderers may upload instead of the float data to
+        reduce memory bandwidth. Every vertex is stored as a 2D float position,
+        an RGBA8 colour and, for textured geometry, two 16 bit normalised
+        texture coordinates: 12 or 16 bytes instead of 28 or 36.
+
+        Geometry made only of quads in the order emitted by appendSolidRect and
+        the Image classes is stored with 4 instead of 6 vertices per quad, see
+        CompactVertexLayout::Quads. The data is built on first use after the
+        geometry changed and cached until the next change.
+
+    \return
+        The packed vertices. The data is empty if getCompactVertexLayout returns
+        CompactVertexLayout::None.
+    */
+    const std::vector<uint8_t>& getCompactVertexData() const;
+
+    /*!
+    \brief
+        Returns how the vertex data of this GeometryBuffer is represented in
+        the compact layout. Geometry that uses a z coordinate, texture
+        coordinates outside [0, 1] or a custom vertex layout can't be
+        represented and returns CompactVertexLayout::None.
+    */
+    CompactVertexLayout getCompactVertexLayout() const;
+
+    //! Returns the size in bytes of a vertex in the compact layout.
+    size_t getCompactVertexStride() const;
+
+    /*!
+    \brief
+        Writes \a quadCount repetitions of QuadIndices, each offset by 4
+        vertices from the previous one, to \a out.
+    */
+    static void fillQuadIndices(uint16_t* out, size_t quadCount);
+
     /*!
     \brief
         Set the RenderEffect to be used by this GeometryBuffer.
@@ -568,6 +642,16 @@ protected:
     */
     mutable bool    d_matrixValid = false;
 
+private:
+    //! Rebuilds d_compactVertexData from d_vertexData.
+    void updateCompactVertexData() const;
+
+    //! Cache of the vertex data in the compact layout.
+    mutable std::vector<uint8_t> d_compactVertexData;
+    //! How d_compactVertexData represents the vertices.
+    mutable CompactVertexLayout d_compactVertexLayout = CompactVertexLayout::None;
+    //! Whether d_compactVertexData is up to date with d_vertexData.
+    mutable bool d_compactVertexDataValid = false;
 };
 
 }
@@ -0,0 +1,90 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CompressedImageCodec_h_
+#define _CompressedImageCodec_h_
+#include "../../ImageCodec.h"
+#include "../../Texture.h"
+#include <cstdint>
+#include <cstddef>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUICOMPRESSEDIMAGECODEC_EXPORTS
+#       define CEGUICOMPRESSEDIMAGECODEC_API __declspec(dllexport)
+#   else
+#       define CEGUICOMPRESSEDIMAGECODEC_API __declspec(dllimport)
+#   endif
+#else
+#   define CEGUICOMPRESSEDIMAGECODEC_API
+#endif
+
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of ImageCodec interface for loading GPU compressed texture
+    containers (DDS and KTX2 files).
+
+    BC1, BC2, BC3 and BC7 (DDS and KTX2) as well as ETC2 (KTX2) payloads are
+    passed to the Texture without being decoded when the Texture reports
+    support for the format. Otherwise the data is decoded to 32 bit RGBA on the
+    CPU via TextureDecompressor, which is not possible for BC7. Only the top
+    mip level of a container is loaded.
+*/
+class CEGUICOMPRESSEDIMAGECODEC_API CompressedImageCodec : public ImageCodec
+{
+public:
+    CompressedImageCodec();
+    ~CompressedImageCodec();
+
+    Texture* load(const RawDataContainer& data, Texture* result) override;
+
+protected:
+    //! Description of the top mip level of a texture container.
+    struct ContainerLevel
+    {
+        Texture::PixelFormat d_format;
+        std::uint32_t d_width;
+        std::uint32_t d_height;
+        const std::uint8_t* d_data;
+        std::size_t d_dataSize;
+    };
+
+    //! Parse a DDS file held in \a buffer.
+    static bool parseDDS(const std::uint8_t* buffer, std::size_t size,
+                         ContainerLevel& level);
+    //! Parse a KTX2 file held in \a buffer.
+    static bool parseKTX2(const std::uint8_t* buffer, std::size_t size,
+                          ContainerLevel& level);
+    //! Load the given level into \a result, decoding it if required.
+    static Texture* loadLevel(const ContainerLevel& level, Texture* result);
+};
+
+} // End of CEGUI namespace section 
+
+#endif // end of guard _CompressedImageCodec_h_
@@ -0,0 +1,165 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Lightweight references to images owned by ImageManager
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIImageHandle_h_
+#define _CEGUIImageHandle_h_
+
+#include "CEGUI/String.h"
+#include <cstdint>
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class Image;
+class Window;
+
+/*!
+\brief
+    Stable reference to an Image registered with the ImageManager.
+
+    A handle is an index into ImageManager's image table plus the generation
+    of that table slot. Resolving a handle with ImageManager::getImage is a
+    constant time operation that does not touch the image name. Once the
+    referenced image is destroyed the handle resolves to 0, even if a new
+    image later reuses the same slot.
+*/
+class CEGUIEXPORT ImageHandle
+{
+public:
+    //! Construct a null handle.
+    ImageHandle() :
+        d_index(InvalidIndex),
+        d_generation(0)
+    {}
+
+    //! Return whether this is a null handle that never referenced an Image.
+    bool isNull() const { return d_index == InvalidIndex; }
+
+    //! Return the index of the ImageManager slot referenced by this handle.
+    std::uint32_t getIndex() const { return d_index; }
+
+    //! Return the generation of the slot at the time the handle was created.
+    std::uint32_t getGeneration() const { return d_generation; }
+
+    bool operator==(const ImageHandle& rhs) const
+    {
+        return d_index == rhs.d_index && d_generation == rhs.d_generation;
+    }
+
+    bool operator!=(const ImageHandle& rhs) const
+    {
+        return !operator==(rhs);
+    }
+
+    //! Index value used by null handles.
+    static const std::uint32_t InvalidIndex = 0xFFFFFFFF;
+
+private:
+    friend class ImageManager;
+
+    ImageHandle(std::uint32_t index, std::uint32_t generation) :
+        d_index(index),
+        d_generation(generation)
+    {}
+
+    std::uint32_t d_index;
+    std::uint32_t d_generation;
+};
+
+/*!
+\brief
+    Refers to an Image by name, caching the resolved ImageHandle.
+
+    The name is hashed once when it is set. The ImageManager is only searched
+    again when its generation has changed (see ImageManager::getGeneration),
+    that is after some image was created or destroyed. This makes it suitable
+    for code that resolves the same image name on every redraw.
+*/
+class CEGUIEXPORT ImageReference
+{
+public:
+    ImageReference();
+    explicit ImageReference(const String& name);
+
+    //! Set the name of the referenced image.
+    void setName(const String& name);
+
+    //! Return the name of the referenced image.
+    const String& getName() const { return d_name; }
+
+    /*!
+    \brief
+        Return the referenced Image, or 0 if no image of that name is
+        currently defined.
+    */
+    Image* get() const;
+
+    /*!
+    \brief
+        Return the Image named by the value of the property \a property_name
+        of \a wnd.
+
+        Image properties backed by a Falagard PropertyDefinition store the
+        name of the image as a string. This resolves that name through the
+        cache held by this object, so that repeatedly fetching the same image
+        does not search the ImageManager. Other Image properties are fetched
+        natively.
+
+    \exception UnknownObjectException
+        thrown if \a wnd has no property named \a property_name.
+
+    \exception InvalidRequestException
+        thrown if the property names an image that does not exist.
+    */
+    const Image* getFromProperty(const Window& wnd, const String& property_name);
+
+    bool operator==(const ImageReference& rhs) const { return d_name == rhs.d_name; }
+    bool operator!=(const ImageReference& rhs) const { return d_name != rhs.d_name; }
+
+private:
+    String d_name;
+    std::size_t d_nameHash;
+    mutable ImageHandle d_handle;
+    //! ImageManager generation when d_handle was resolved.
+    mutable std::uint32_t d_generation;
+    //! whether d_handle was resolved, it is null when the name was not found.
+    mutable bool d_resolved;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUIImageHandle_h_
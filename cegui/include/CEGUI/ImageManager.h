@@ -34,7 +34,12 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/ImageFactory.h"
+#include "CEGUI/ImageHandle.h"
+#include "CEGUI/Sizef.h"
+#include "CEGUI/Rectf.h"
 #include <unordered_map>
+#include <vector>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -44,6 +49,22 @@
 namespace CEGUI
 {
 class ImageFactory;
+class TextureAtlas;
+
+/*!
+\brief
+    Enumerated type describing which images ImageManager packs into shared
+    atlas textures.
+*/
+enum class ImageAtlasingMode : int
+{
+    //! Every image file gets its own Texture.
+    Disabled,
+    //! Images loaded by addBitmapImageFromFile are packed into atlases.
+    LooseImages,
+    //! As LooseImages, and BitmapImage imagesets with a small enough source image are packed too.
+    LooseImagesAndImagesets
+};
 
 class CEGUIEXPORT ImageManager :
         public Singleton<ImageManager>,
@@ -139,6 +160,46 @@ public:
     Image& get(const String& name) const;
     bool isDefined(const String& name) const;
 
+    /*!
+    \brief
+        Return a handle for the image named \a name, or a null handle if no
+        such image is defined.
+    */
+    ImageHandle getHandle(const String& name) const;
+
+    /*!
+    \brief
+        Return a handle for the image named \a name, using a hash previously
+        obtained from hashImageName.
+    */
+    ImageHandle getHandle(const String& name, std::size_t name_hash) const;
+
+    /*!
+    \brief
+        Return the Image referenced by \a handle, or 0 if the handle is null or
+        the image it referenced has since been destroyed.
+    */
+    Image* getImage(ImageHandle handle) const
+    {
+        if (handle.d_index >= d_imageSlots.size())
+            return nullptr;
+
+        const ImageSlot& slot = d_imageSlots[handle.d_index];
+        return slot.d_generation == handle.d_generation ? slot.d_image : nullptr;
+    }
+
+    /*!
+    \brief
+        Return a counter that changes whenever an image is created or
+        destroyed. Code caching the result of a lookup by name only needs to
+        repeat the lookup when this value has changed.
+    */
+    std::uint32_t getGeneration() const { return d_generation; }
+
+    //! Return the hash used to look up image names.
+    static std::size_t hashImageName(const String& name)
+        { return std::hash<String>()(name); }
+
     unsigned int getImageCount() const;
 
     void loadImageset(const String& filename, const String& resource_group = "");
@@ -147,10 +208,73 @@ public:
     void destroyImageCollection(const String& prefix,
                                 const bool delete_texture = true);
 
+    /*!
+    \brief
+        Create a BitmapImage named \a name covering the whole of the image
+        file \a filename.
+
+        When atlasing is enabled (see setAtlasingMode) and the image is not
+        larger than the atlas image size limit, the image is packed into a
+        shared atlas texture instead of getting a Texture of its own. The
+        created image is a normal BitmapImage either way.
+    */
     void addBitmapImageFromFile(const String& name,
                           const String& filename,
                           const String& resource_group = "");
 
+    /*!
+    \brief
+        Set which images are packed into shared atlas textures as they are
+        loaded. Images that were already loaded are not affected.
+    */
+    void setAtlasingMode(ImageAtlasingMode mode) { d_atlasingMode = mode; }
+
+    //! Return which images are packed into shared atlas textures.
+    ImageAtlasingMode getAtlasingMode() const { return d_atlasingMode; }
+
+    /*!
+    \brief
+        Set the size of atlas textures created from now on. The size is
+        clamped to the maximum texture size of the Renderer.
+    */
+    void setAtlasSize(const Sizef& size) { d_atlasSize = size; }
+
+    //! Return the size used for new atlas textures.
+    const Sizef& getAtlasSize() const { return d_atlasSize; }
+
+    /*!
+    \brief
+        Set the largest source image that will be packed into an atlas. Bigger
+        images get a Texture of their own.
+    */
+    void setAtlasMaxImageSize(const Sizef& size) { d_atlasMaxImageSize = size; }
+
+    //! Return the largest source image that will be packed into an atlas.
+    const Sizef& getAtlasMaxImageSize() const { return d_atlasMaxImageSize; }
+
+    //! Return the number of atlas textures currently in use.
+    std::size_t getAtlasCount() const { return d_atlases.size(); }
+
+    /*!
+    \brief
+        Return the atlas at \a index, which can be queried for its Texture
+        and occupancy.
+
+    \exception InvalidRequestException
+        thrown if \a index is out of range.
+    */
+    const TextureAtlas& getAtlas(std::size_t index) const;
+
+    /*!
+    \brief
+        Return the fraction (0 - 1) of all atlas texture space that is covered
+        by live images, or 0 if no atlas exists.
+    */
+    float getAtlasOccupancy() const;
+
+    //! Return whether the image named \a name lives in an atlas texture.
+    bool isImageAtlased(const String& name) const;
+
     /*!
     \brief
         Notify the ImageManager that the display size may have changed.
@@ -212,6 +336,15 @@ private:
     //! helper to delete an image given an map iterator.
     void destroy(ImageMap::iterator& iter);
 
+    //! add \a image to the handle table.
+    void addImageSlot(Image& image);
+    //! remove the image named \a name from the handle table.
+    void removeImageSlot(const String& name);
+    //! return index of the slot holding the image \a name, or ImageHandle::InvalidIndex.
+    std::uint32_t findImageSlot(const String& name, std::size_t name_hash) const;
+    //! rebuild the open addressing lookup table with \a capacity buckets.
+    void rebuildImageLookup(std::size_t capacity);
+
     // XML parsing helper functions.
     void elementImagesetStart(const XMLAttributes& attributes);
 
@@ -222,6 +355,31 @@ private:
     void retrieveImagesetSVGData(const String& name, const String& filename, const String &resource_group);
 
     void elementImageStart(const XMLAttributes& attributes);
+
+    /*!
+    \brief
+        Load an image file and pack it into an atlas, creating a new atlas if
+        needed.
+
+    \return
+        The atlas holding the image, or 0 if the image is not eligible for
+        atlasing. If 0 is returned and \a pixels is not empty, it holds the
+        decoded RGBA image data of size \a size.
+    */
+    TextureAtlas* packImageFile(const String& filename,
+                                const String& resource_group,
+                                std::vector<std::uint8_t>& pixels,
+                                Sizef& size, Rectf& area);
+
+    //! Record that image \a image_name uses the atlas allocation \a allocation_name.
+    void addAtlasReference(const String& image_name, const String& allocation_name);
+
+    //! Drop the atlas reference held by \a image_name, if any.
+    void releaseAtlasReference(const String& image_name);
+
+    //! Release the allocation and destroy its atlas when it becomes empty.
+    void releaseAtlasAllocation(const String& allocation_name);
+
     //! throw exception if file version is not supported.
     void validateImagesetFileVersion(const XMLAttributes& attrs);
 
@@ -232,6 +390,52 @@ private:
     ImageFactoryRegistry d_factories;
     //! container holding the images.
     ImageMap d_images;
+
+    //! An entry in the handle table.
+    struct ImageSlot
+    {
+        //! the image, or 0 if the slot is free.
+        Image* d_image;
+        //! hash of the image name.
+        std::size_t d_nameHash;
+        //! incremented each time the slot is freed, invalidating handles.
+        std::uint32_t d_generation;
+    };
+
+    //! images indexed by ImageHandle.
+    std::vector<ImageSlot> d_imageSlots;
+    //! indices of free entries in d_imageSlots.
+    std::vector<std::uint32_t> d_freeImageSlots;
+    //! open addressing (linear probing) table of indices into d_imageSlots.
+    std::vector<std::uint32_t> d_imageLookup;
+    //! number of d_imageLookup buckets that are not empty (includes deleted).
+    std::size_t d_imageLookupUsed;
+    //! changed whenever an image is created or destroyed.
+    std::uint32_t d_generation;
+
+    //! Space taken in an atlas by one image file.
+    struct AtlasAllocation
+    {
+        TextureAtlas* d_atlas;
+        Rectf d_area;
+        //! Number of images using this allocation.
+        unsigned int d_refCount;
+    };
+
+    //! which images are packed into atlases.
+    ImageAtlasingMode d_atlasingMode;
+    //! size of newly created atlas textures.
+    Sizef d_atlasSize;
+    //! largest image file that will be packed into an atlas.
+    Sizef d_atlasMaxImageSize;
+    //! the atlases currently in use.
+    std::vector<TextureAtlas*> d_atlases;
+    //! counter used to create unique atlas texture names.
+    unsigned int d_atlasNameCounter;
+    //! atlas allocations, keyed by image or imageset name.
+    std::unordered_map<String, AtlasAllocation> d_atlasAllocations;
+    //! maps atlased image names to the allocation they use.
+    std::unordered_map<String, String> d_atlasedImages;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,149 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Skips drawing windows hidden behind opaque windows
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIOcclusionCuller_h_
+#define _CEGUIOcclusionCuller_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Rectf.h"
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class Window;
+class RenderingSurface;
+
+/*!
+\brief
+    Finds the windows of a GUIContext that are completely hidden behind opaque
+    windows drawn after them, so that they can skip submitting their geometry.
+
+    Every time the context is redrawn, the windows are visited front to back.
+    A window is culled when its clipped outer rect is covered by the union of
+    the opaque rects (see Window::getOpaqueRect) of the windows in front of
+    it. Windows learn that they are opaque either from Window::setOpaqueArea
+    or from Falagard StateImagery declared as opaque.
+
+    The pass only considers windows drawn directly to the context in the base
+    render queue. A window rendering through its own RenderingWindow is culled
+    with its whole subtree, unless it is rotated; it occludes other windows
+    only when it has no RenderEffect. Windows in other queues, such as a
+    dragged DragContainer, are never culled and never occlude. Since culled
+    windows are hidden anyway, the rendered result is the same whether the
+    culler is enabled or not. The culler is disabled by default.
+*/
+class CEGUIEXPORT OcclusionCuller
+{
+public:
+    //! Counters of the last pass.
+    struct Statistics
+    {
+        //! number of windows tested for occlusion.
+        std::size_t d_testedWindows = 0;
+        //! number of windows found to be hidden.
+        std::size_t d_culledWindows = 0;
+        //! number of opaque rects used as occluders.
+        std::size_t d_occluders = 0;
+    };
+
+    OcclusionCuller();
+    ~OcclusionCuller();
+
+    OcclusionCuller(const OcclusionCuller&) = delete;
+    OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+    //! Enable or disable the culler. Disabling it draws all windows again.
+    void setEnabled(bool setting);
+    bool isEnabled() const { return d_enabled; }
+
+    /*!
+    \brief
+        Set the maximum number of opaque rects tested against. When more
+        windows are opaque, the largest rects are kept.
+    */
+    void setMaximumOccluderCount(std::size_t count) { d_maxOccluders = count; }
+    std::size_t getMaximumOccluderCount() const { return d_maxOccluders; }
+
+    /*!
+    \brief
+        Mark the windows below \a root that are hidden. Called by GUIContext
+        before the window tree is drawn with \a drawModeMask.
+    */
+    void update(Window* root, std::uint32_t drawModeMask);
+
+    //! Forget about \a window. Called by GUIContext::onWindowDetached.
+    void onWindowDetached(Window* window);
+
+    //! Return the windows culled by the last pass.
+    const std::vector<Window*>& getCulledWindows() const { return d_culled; }
+
+    //! Return the counters of the last pass.
+    const Statistics& getStatistics() const { return d_statistics; }
+
+    /*!
+    \brief
+        Return whether \a rect is completely covered by the union of
+        \a occluders.
+    */
+    static bool isCovered(const Rectf& rect, const std::vector<Rectf>& occluders);
+
+private:
+    //! A window taking part in the pass, in draw order.
+    struct Candidate
+    {
+        Window* d_window;
+        //! whether the window draws through its own RenderingWindow.
+        bool d_hasSurface;
+    };
+
+    void reset();
+    void collect(Window& window, const RenderingSurface* context, std::uint32_t drawModeMask);
+    void addOccluder(const Rectf& rect);
+
+    std::vector<Candidate> d_candidates;
+    std::vector<Rectf> d_occluders;
+    //! windows whose occluded flag is set.
+    std::vector<Window*> d_culled;
+    Statistics d_statistics;
+    std::size_t d_maxOccluders = 32;
+    bool d_enabled = false;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUIOcclusionCuller_h_
@@ -0,0 +1,230 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Automatic render-to-texture caching of static window trees
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIRenderCachePolicy_h_
+#define _CEGUIRenderCachePolicy_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/TextureResidencyManager.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class Window;
+
+/*!
+\brief
+    Decides which windows of a GUIContext render through an automatically
+    created RenderingWindow (see Window::setUsingAutoRenderingSurface).
+
+    The policy counts, for every window, the frames in which that window or
+    any of its descendants was invalidated. Periodically it looks for visible
+    subtrees that have not been invalidated for a while and whose geometry
+    is large enough to be worth caching, and promotes the topmost of them to
+    a texture backed surface, as long as the estimated texture memory stays
+    within the budget. Cached subtrees that start getting invalidated
+    frequently are demoted again, since re-rendering them to a texture every
+    frame costs more than drawing them directly.
+
+    The policy uses its own claim on the surface (see
+    Window::setUsingRenderCacheSurface) and never changes the window's
+    AutoRenderingSurface setting, so it only ever releases the surfaces it
+    created. Windows on which the application enabled the auto rendering
+    surface itself are left alone, and so are their subtrees; if the
+    application enables it on a cached window, the policy hands the surface
+    over. The policy is disabled by default.
+
+    The textures of cached windows can be evicted by the
+    TextureResidencyManager, which demotes the windows. While the manager is
+    enabled, windows are only promoted when their texture fits in its budget.
+*/
+class CEGUIEXPORT RenderCachePolicy : public TextureResidencyManager::Evictor
+{
+public:
+    //! Describes a window currently cached by the policy.
+    struct Entry
+    {
+        Window* d_window;
+        //! smoothed fraction of frames in which the subtree was invalidated.
+        float d_invalidationRate;
+        //! vertices in the subtree when it was promoted.
+        std::size_t d_vertexCount;
+        //! estimated size of the texture backing the surface, in bytes.
+        std::size_t d_textureBytes;
+    };
+
+    RenderCachePolicy();
+    ~RenderCachePolicy() override;
+
+    RenderCachePolicy(const RenderCachePolicy&) = delete;
+    RenderCachePolicy& operator=(const RenderCachePolicy&) = delete;
+
+    /*!
+    \brief
+        Enable or disable the policy. Disabling it releases all surfaces
+        created by the policy and forgets the collected statistics.
+    */
+    void setEnabled(bool setting);
+    bool isEnabled() const { return d_enabled; }
+
+    //! Set the maximum estimated texture memory, in bytes, used for caching.
+    void setMemoryBudget(std::size_t bytes) { d_memoryBudget = bytes; }
+    std::size_t getMemoryBudget() const { return d_memoryBudget; }
+
+    //! Set the number of vertices a subtree needs before it is cached.
+    void setMinimumVertexCount(std::size_t count) { d_minVertexCount = count; }
+    std::size_t getMinimumVertexCount() const { return d_minVertexCount; }
+
+    /*!
+    \brief
+        Set the number of consecutive frames a subtree must go without being
+        invalidated before it is cached.
+    */
+    void setMinimumStaticFrames(std::uint32_t frames) { d_minStaticFrames = frames; }
+    std::uint32_t getMinimumStaticFrames() const { return d_minStaticFrames; }
+
+    /*!
+    \brief
+        Set the invalidation rate (fraction of frames in which a subtree is
+        invalidated, 0 to 1) above which a cached subtree is demoted.
+    */
+    void setMaximumInvalidationRate(float rate) { d_maxInvalidationRate = rate; }
+    float getMaximumInvalidationRate() const { return d_maxInvalidationRate; }
+
+    //! Set the number of frames between two evaluations of the cache.
+    void setEvaluationInterval(std::uint32_t frames) { d_evaluationInterval = frames ? frames : 1; }
+    std::uint32_t getEvaluationInterval() const { return d_evaluationInterval; }
+
+    //! Record that \a window was invalidated in the current frame.
+    void notifyWindowInvalidated(Window& window)
+    {
+        if (d_enabled)
+            recordInvalidation(window);
+    }
+
+    /*!
+    \brief
+        Advance to the next frame and, every evaluation interval, promote and
+        demote windows below \a root. Called by GUIContext::draw.
+    */
+    void update(Window* root);
+
+    /*!
+    \brief
+        Forget about \a window and release the surface the policy created for
+        it. Called by GUIContext::onWindowDetached.
+    */
+    void onWindowDetached(Window* window);
+
+    //! Release all surfaces created by the policy.
+    void clear();
+
+    //! Return whether \a window is currently cached by the policy.
+    bool isCached(const Window* window) const;
+
+    //! Return the windows currently cached by the policy.
+    std::vector<Entry> getCacheEntries() const;
+
+    //! Return the smoothed invalidation rate the policy measured for \a window.
+    float getInvalidationRate(const Window* window) const;
+
+    //! Return the estimated texture memory used by cached windows, in bytes.
+    std::size_t getUsedMemory() const;
+
+    //! Return the number of promotions done since the policy was enabled.
+    std::size_t getPromotionCount() const { return d_promotionCount; }
+
+    //! Return the number of demotions done since the policy was enabled.
+    std::size_t getDemotionCount() const { return d_demotionCount; }
+
+    //! Return the estimated memory needed to cache \a window, in bytes.
+    static std::size_t estimateTextureBytes(const Window& window);
+
+    //! Demote the cached window rendered through \a texture.
+    void evictTexture(Texture& texture) override;
+
+private:
+    struct Record
+    {
+        std::uint64_t d_firstSeenFrame = 0;
+        std::uint64_t d_lastInvalidatedFrame = 0;
+        std::uint32_t d_invalidatedFrames = 0;
+        float d_rate = 0.f;
+        std::size_t d_vertexCount = 0;
+        std::size_t d_textureBytes = 0;
+        bool d_cached = false;
+    };
+
+    typedef std::unordered_map<const Window*, Record> RecordMap;
+
+    Record& getRecord(const Window& window);
+    void recordInvalidation(Window& window);
+    void evaluate(Window& root);
+    void considerForCaching(Window& window, std::size_t& usedMemory);
+    bool isStatic(const Record& record) const;
+    void promote(Window& window, Record& record);
+    void demote(Window& window, Record& record);
+    //! Stop caching \a window, leaving its surface to the application if it uses it.
+    void release(Window& window, Record& record);
+
+    static std::size_t countVertices(Window& window, std::size_t limit);
+    static Texture* getSurfaceTexture(const Window& window);
+
+    RecordMap d_records;
+    //! windows cached by the policy, in promotion order.
+    std::vector<Window*> d_cached;
+
+    std::uint64_t d_frame = 1;
+    std::size_t d_memoryBudget = 32 * 1024 * 1024;
+    std::size_t d_minVertexCount = 256;
+    std::uint32_t d_minStaticFrames = 60;
+    std::uint32_t d_evaluationInterval = 15;
+    float d_maxInvalidationRate = 0.25f;
+
+    std::size_t d_promotionCount = 0;
+    std::size_t d_demotionCount = 0;
+
+    bool d_enabled = false;
+    //! set once the renderer failed to provide a TextureTarget.
+    bool d_texturesUnavailable = false;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUIRenderCachePolicy_h_
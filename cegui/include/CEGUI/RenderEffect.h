@@ -125,6 +125,18 @@ public:
         after the update.
     */
     virtual bool update(const float elapsed, RenderingWindow& window) = 0;
+
+    /*!
+    \brief
+        Function called after the content of the RenderingWindow has been
+        rendered to its TextureTarget, before the RenderingWindow is drawn to
+        its owner.  Effects can process the texture content here; the result
+        is reused until the content is invalidated and rendered again.
+
+    \param window
+        RenderingWindow object that the RenderEffect is being applied to.
+    */
+    virtual void processRenderedContent(RenderingWindow& /*window*/) {}
 };
 
 } // End of  CEGUI namespace section
@@ -102,6 +102,7 @@ public:
     //! Type to use for the GeometryBuffer collection.
     typedef std::vector<GeometryBuffer*> BufferList;
     BufferList& getBuffers()         {return d_buffers;}
+    const BufferList& getBuffers() const {return d_buffers;}
 
 private:
 
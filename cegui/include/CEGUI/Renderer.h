@@ -48,6 +48,7 @@ class ShaderWrapper;
 class RenderMaterial;
 class String;
 class Sizef;
+class TextureFilter;
 
 //----------------------------------------------------------------------------//
 
@@ -522,6 +523,50 @@ public:
          return dpiValue / static_cast<float>(ReferenceDpiValue);
     }
 
+    /*!
+    \brief
+        Returns whether this Renderer can upload geometry in the compact vertex
+        layout, see GeometryBuffer::getCompactVertexData.
+    */
+    virtual bool isCompactVertexFormatSupported() const { return false; }
+
+    /*!
+    \brief
+        Sets whether geometry is uploaded in the compact vertex layout, which
+        quantises colours and texture coordinates and draws quads from 4
+        instead of 6 vertices. Geometry that can't be represented in the
+        compact layout is still uploaded as floats. The setting is ignored if
+        the Renderer does not support the layout. Disabled by default.
+    */
+    void setCompactVertexFormatEnabled(bool setting);
+
+    //! Returns whether geometry is uploaded in the compact vertex layout.
+    bool isCompactVertexFormatEnabled() const { return d_compactVertexFormatEnabled; }
+
+    /*!
+    \brief
+        Apply \a filter, in place, to the content of \a target. Used by the
+        texture filter RenderEffects once the content of a RenderingWindow has
+        been rendered. The default implementation does not support filtering.
+
+    \param target
+        TextureTarget whose content is filtered.
+
+    \param size
+        Size of the area at the top-left of the target that holds the content,
+        in pixels. Pixels outside of it are neither read nor modified.
+
+    \param filter
+        The TextureFilter to apply.
+
+    \return
+        - true if the filter was applied.
+        - false if the Renderer does not support texture filters, the content
+          of \a target is left unchanged.
+    */
+    virtual bool applyTextureFilter(TextureTarget& /*target*/, const Sizef& /*size*/,
+                                    const TextureFilter& /*filter*/) { return false; }
+
 protected:
     /*!
     \brief
@@ -552,6 +597,8 @@ private:
     std::map<const ShaderWrapper*, std::vector<GeometryBuffer*>> d_geomeryBufferPool;
     //! The Font scale factor to be used when rendering Fonts (except Bitmap Fonts).
     float d_fontScale;
+    //! Whether geometry is uploaded in the compact vertex layout.
+    bool d_compactVertexFormatEnabled = false;
 };
 
 }
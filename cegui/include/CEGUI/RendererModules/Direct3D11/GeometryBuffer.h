@@ -88,7 +88,13 @@ protected:
     mutable glm::mat4 d_matrix;
     //! D3D11 input layout describing the vertex format we use.
     ID3D11InputLayout* d_inputLayout = nullptr;
+    //! D3D11 input layout for vertices uploaded in the compact layout.
+    ID3D11InputLayout* d_compactInputLayout = nullptr;
     mutable bool d_geometryDirty = true;
+    //! Layout in which the vertices in d_vertexBuffer were uploaded.
+    mutable CompactVertexLayout d_uploadedLayout = CompactVertexLayout::None;
+    //! Whether the renderer's compact vertex format was enabled for the upload.
+    mutable bool d_uploadedCompactSetting = false;
 };
 
 }
@@ -177,6 +177,13 @@ public:
     */
     void bindRasterizerState(bool scissorEnabled);
 
+    /*!
+    \brief
+        Returns the static index buffer used to draw geometry uploaded as
+        CompactVertexLayout::Quads.
+    */
+    ID3D11Buffer* getQuadIndexBuffer() const { return d_quadIndexBuffer; }
+
     // Implement interface from Renderer
     virtual RenderTarget& getDefaultRenderTarget();
     virtual RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const;
@@ -202,6 +209,7 @@ public:
     virtual unsigned int getMaxTextureSize() const;
     virtual const String& getIdentifierString() const;
     virtual bool isTexCoordSystemFlipped() const;
+    virtual bool isCompactVertexFormatSupported() const;
 
 protected:
     //! constructor
@@ -215,6 +223,8 @@ protected:
     void initialiseDepthStencilState();
     void initialiseRasterizerStates();
     void initialiseBlendStates();
+    //! Initialises the index buffer for compact quads
+    void initialiseQuadIndexBuffer();
 
     //! Initialises the ShaderManager and the required D3D11 shaders
     void initialiseShaders();
@@ -273,6 +283,8 @@ protected:
 
     //! Variable containing the sampler state for CEGUI textures
     ID3D11SamplerState* d_samplerState;
+    //! Static index buffer for geometry uploaded as compact quads
+    ID3D11Buffer* d_quadIndexBuffer;
 };
 
 
@@ -59,6 +59,18 @@
 #define GL_RGB565  0x8D62
 #endif
 
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM  0x8E8C
+#endif
+
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2  0x9274
+#endif
+
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC  0x9278
+#endif
+
 #if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
 #   if defined(CEGUIOPENGLRENDERER_EXPORTS) || defined(CEGUIOPENGLES2RENDERER_EXPORTS)
 #       define OPENGL_GUIRENDERER_API __declspec(dllexport)
@@ -152,6 +164,18 @@ public:
     */
     bool isS3tcSupported() const { return d_isS3tcSupported; }
 
+    /*!
+    \brief
+        Returns true if "BPTC" (BC7) texture compression is supported.
+    */
+    bool isBptcSupported() const { return d_isBptcSupported; }
+
+    /*!
+    \brief
+        Returns true if "ETC2" / "EAC" texture compression is supported.
+    */
+    bool isEtc2Supported() const { return d_isEtc2Supported; }
+
     /*!
     \brief
         Returns true if NPOT (non-power-of-two) textures are supported.
@@ -211,6 +235,8 @@ private:
     GLint d_verMajorForce;
     GLint d_verMinorForce;
     bool d_isS3tcSupported;
+    bool d_isBptcSupported;
+    bool d_isEtc2Supported;
     bool d_isNpotTextureSupported;
     bool d_isReadBufferSupported;
     bool d_isPolygonModeSupported;
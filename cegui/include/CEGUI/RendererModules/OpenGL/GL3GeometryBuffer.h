@@ -51,7 +51,36 @@ public:
     // Implementation/overrides of member functions inherited from OpenGLGeometryBufferBase
     void finaliseVertexAttributes() const override;
 
+    /*!
+    \brief
+        Returns whether the buffer can be drawn as part of a batch: it uses one
+        of the renderer's standard materials, has no RenderEffect, no polygon
+        fill rule and was uploaded in the float vertex layout.
+    */
+    bool isBatchable() const;
+
+    //! Returns whether \a other can be drawn in the same batch as this buffer.
+    bool isBatchCompatible(const OpenGL3GeometryBuffer& other) const;
+
+    /*!
+    \brief
+        Returns the values the batched shaders use in place of the uniforms
+        and the scissor rect set by draw, and marks the matrix as up to date
+        for the active render target.
+
+    \param clipRect
+        Receives the clip rect in window coordinates as left, bottom, right
+        and top. It covers the same pixels as the scissor rect set by draw.
+    */
+    void getBatchUniforms(glm::mat4& matrix, float& alpha, glm::vec4& clipRect) const;
+
     std::size_t d_verticesVBOPosition = 0;
+    //! Layout in which the renderer uploaded the vertices for the current frame.
+    CompactVertexLayout d_uploadedLayout = CompactVertexLayout::None;
+    //! Index of the buffer within its batch, uploaded with each of its vertices.
+    std::uint32_t d_batchSlot = 0;
+    //! Buffers in the batch starting with this buffer, 1 if it is drawn alone, 0 if it is part of an earlier batch.
+    std::uint32_t d_batchLength = 1;
 
 protected:
 
@@ -61,6 +90,8 @@ protected:
     void onGeometryChanged() override;
     //! Draws the vertex data depending on the fill rule that was set for this object.
     void drawDependingOnFillRule() const;
+    //! Draws \a count vertices of the triangle list, starting at \a first.
+    void drawTriangles(GLsizei first, GLsizei count) const;
 
 #ifndef CEGUI_OPENGL_BIG_BUFFER
     //! OpenGL vao used for the vertices
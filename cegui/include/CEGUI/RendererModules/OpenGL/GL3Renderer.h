@@ -39,6 +39,7 @@ namespace CEGUI
     class OpenGLBaseShaderWrapper;
     class OpenGLBaseShaderManager;
     class OpenGLBaseStateChangeWrapper;
+    class ShaderParameterBindings;
 
 /*!
 \brief
@@ -164,7 +165,8 @@ public:
     /*!
     \brief
         Helper to get the wrapper used to check for redundant OpenGL state
-        changes.
+        changes. Its statistics count the state changes done and skipped
+        since the last call to beginRendering.
 
     \return
         The active OpenGL state change wrapper object.
@@ -178,6 +180,49 @@ public:
     void setupRenderingBlendMode(const BlendMode mode,
                                  const bool force = false) override;
     RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const override;
+    bool isCompactVertexFormatSupported() const override;
+    void drawRenderQueue(const RenderQueue& queue, std::uint32_t drawModeMask) override;
+
+    //! Counts of the GeometryBuffers drawn since the last call to beginRendering.
+    struct GeometryBatchStatistics
+    {
+        //! Draw calls that each drew a batch of several GeometryBuffers
+        std::size_t d_batchDrawCalls = 0;
+        //! GeometryBuffers drawn as part of a batch
+        std::size_t d_batchedBuffers = 0;
+        //! GeometryBuffers drawn one by one
+        std::size_t d_unbatchedBuffers = 0;
+    };
+
+    //! The largest number of GeometryBuffers drawn by a single batch.
+    static const std::uint32_t MaxGeometryBatchSize = 32;
+
+    /*!
+    \brief
+        Sets whether consecutive GeometryBuffers of a RenderQueue that share
+        their material, texture and blend mode are drawn with a single draw
+        call. The transforms, alpha values and clip rects of the buffers are
+        passed in uniform arrays indexed by a slot uploaded with every vertex,
+        and clipping is done in the fragment shader instead of with glScissor.
+        Buffers with a RenderEffect or a polygon fill rule, and buffers
+        uploaded in the compact vertex layout, are still drawn one by one.
+
+        Batching costs an extra float per vertex upload. It is ignored if it
+        is not supported, and disabled by default.
+    */
+    void setGeometryBatchingEnabled(bool setting) { d_geometryBatchingEnabled = setting; }
+
+    //! Returns whether geometry batching was enabled, see setGeometryBatchingEnabled.
+    bool isGeometryBatchingEnabled() const { return d_geometryBatchingEnabled; }
+
+    //! Returns whether the OpenGL context supports geometry batching.
+    bool isGeometryBatchingSupported() const;
+
+    //! Returns the batching counts of the last frame.
+    const GeometryBatchStatistics& getGeometryBatchStatistics() const { return d_batchStatistics; }
+
+    //! Returns whether \a wrapper is the wrapper of one of the standard shaders.
+    bool isStandardShaderWrapper(const ShaderWrapper* wrapper) const;
 
 #ifdef CEGUI_OPENGL_BIG_BUFFER
     //! OpenGL vao used for the vertices
@@ -189,6 +234,23 @@ public:
     //! Size of the vertex data buffer that is currently in use
     GLuint d_verticesSolidVBOSize = 0;
     GLuint d_verticesTexturedVBOSize = 0;
+    //! vaos and vbos for geometry uploaded in the compact vertex layout
+    GLuint d_compactSolidVAO = 0;
+    GLuint d_compactTexturedVAO = 0;
+    GLuint d_compactSolidVBO = 0;
+    GLuint d_compactTexturedVBO = 0;
+    GLuint d_compactSolidVBOSize = 0;
+    GLuint d_compactTexturedVBOSize = 0;
+    //! static index buffer drawing compact quads, bound to the compact vaos
+    GLuint d_quadIndexBuffer = 0;
+    //! vaos drawing batches, they combine the vertex vbos with the batch slot vbos
+    GLuint d_batchSolidVAO = 0;
+    GLuint d_batchTexturedVAO = 0;
+    //! vbos containing the batch slot of every vertex in the vertex vbos
+    GLuint d_batchSlotsSolidVBO = 0;
+    GLuint d_batchSlotsTexturedVBO = 0;
+    GLuint d_batchSlotsSolidVBOSize = 0;
+    GLuint d_batchSlotsTexturedVBOSize = 0;
 #endif
 
 protected:
@@ -228,6 +290,10 @@ protected:
 
     void initialiseStandardTexturedVAO();
     void initialiseStandardColouredVAO();
+    //! Creates the vaos, vbos and the quad index buffer of the compact vertex layout
+    void initialiseCompactVAOs();
+    //! Creates the shader wrappers, vaos and vbos used to draw batches, if supported
+    void initialiseBatching();
 
 
 protected:
@@ -245,12 +311,33 @@ private:
     void restoreChangedStatesToDefaults(bool isAfterRendering);
 
     void addGeometry(const std::vector<GeometryBuffer*>& buffers);
-    void uploadVertexData(std::vector<float>& vertex_data, GLuint vbo_id, GLuint& vbo_max_size);
+    void uploadVertexData(const void* data, std::size_t size, GLuint vbo_id, GLuint& vbo_max_size);
+    //! Returns whether buffers are batched in the current frame
+    bool isGeometryBatchingActive() const { return d_geometryBatchingEnabled && d_shaderWrapperBatchedTextured != nullptr; }
+    //! Returns the number of buffers in the batch starting at \a first, 1 if it is not a valid batch
+    std::size_t getBatchLength(const std::vector<GeometryBuffer*>& buffers, std::size_t first) const;
+    //! Draws the \a count buffers starting at \a first with a single draw call
+    void drawBatch(const std::vector<GeometryBuffer*>& buffers, std::size_t first, std::size_t count);
 
     //! Wrapper of the OpenGL shader we will use for textured geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperTextured = nullptr;
     //! Wrapper of the OpenGL shader we will use for solid geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperSolid = nullptr;
+    //! Wrappers of the shaders drawing batches, 0 if batching is not supported
+    OpenGLBaseShaderWrapper* d_shaderWrapperBatchedTextured = nullptr;
+    OpenGLBaseShaderWrapper* d_shaderWrapperBatchedSolid = nullptr;
+    //! Locations of the uniform arrays of the batch shaders, solid and textured
+    GLint d_batchMatricesLocation[2] = { -1, -1 };
+    GLint d_batchAlphaFactorsLocation[2] = { -1, -1 };
+    GLint d_batchClipRectsLocation[2] = { -1, -1 };
+    //! Parameters set by the batch shader wrappers, holding the texture of the batch
+    ShaderParameterBindings* d_batchParameterBindings = nullptr;
+    //! Values of the uniform arrays for the batch being drawn
+    std::vector<glm::mat4> d_batchMatrices;
+    std::vector<float> d_batchAlphaFactors;
+    std::vector<glm::vec4> d_batchClipRects;
+    bool d_geometryBatchingEnabled = false;
+    GeometryBatchStatistics d_batchStatistics;
 
     //! The wrapper we use for OpenGL calls, to detect redundant state changes and prevent them
     OpenGLBaseStateChangeWrapper* d_openGLStateChanger = nullptr;
@@ -261,6 +348,10 @@ private:
 
     std::vector<float> d_vertex_data_solid;
     std::vector<float> d_vertex_data_textured;
+    std::vector<std::uint8_t> d_compact_data_solid;
+    std::vector<std::uint8_t> d_compact_data_textured;
+    std::vector<float> d_batch_slots_solid;
+    std::vector<float> d_batch_slots_textured;
 };
 
 }
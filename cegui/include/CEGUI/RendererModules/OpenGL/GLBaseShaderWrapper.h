@@ -32,6 +32,7 @@
 
 #include "CEGUI/ShaderWrapper.h"
 #include <string>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -67,16 +68,21 @@ public:
     GLint getUniformLocation(const std::string& uniformName) const;
 
 protected:
+    //! Stores the location of a uniform variable under the handle of its name
+    void setUniformLocation(const std::string& uniformName, GLint location);
+
     //! The underlying GLSL shader that this class wraps the access to
     OpenGLBaseShader& d_shader;
     //! A map of parameter names and the related uniform variable locations
     std::map<std::string, GLint> d_uniformVariables;
+    //! The uniform variable locations indexed by the parameter handle, -1 for unused handles
+    std::vector<GLint> d_uniformLocations;
     //! A map of parameter names and the related attribute variable locations
     std::map<std::string, GLint> d_attributeVariables;
     //! OpenGL state change wrapper
     OpenGLBaseStateChangeWrapper* d_glStateChangeWrapper;
-    //! Last states of the set shader parameters
-    std::map<std::string, ShaderParameter*> d_shaderParameterStates;
+    //! Last uploaded values of the shader parameters, indexed by the parameter handle
+    std::vector<ShaderParameter*> d_shaderParameterStates;
 };
 
 
@@ -43,6 +43,7 @@ class OPENGL_GUIRENDERER_API GLES2Texture : public OpenGLTexture
 {
 public:
     void blitToMemory(void* targetData) override;
+    bool isPixelFormatSupported(const PixelFormat fmt) const override;
 
     // Friends (to allow construction and destruction)
     friend GLES2Renderer;
@@ -52,6 +52,9 @@ public:
     // implement parts of RenderTarget interface
     void activate() override;
     void updateMatrix() const override;
+    using RenderTarget::draw;
+    void draw(const RenderQueue& queue,
+              std::uint32_t drawModeMask = DrawModeMaskAll) override;
     // implementing the virtual function with a covariant return type
     OpenGLRendererBase& getOwner() override;
 
@@ -51,6 +51,7 @@ namespace CEGUI
 class OpenGLTexture;
 class OpenGLGeometryBufferBase;
 class RenderMaterial;
+class RenderQueue;
 
 //! Common base class used for other OpenGL (desktop or ES) based renderer modules.
 class OPENGL_GUIRENDERER_API OpenGLRendererBase : public Renderer
@@ -172,6 +173,14 @@ public:
     virtual void setupRenderingBlendMode(const BlendMode mode,
                                          const bool force = false) = 0;
 
+    /*!
+    \brief
+        Draw the GeometryBuffers of \a queue to the active render target.
+        Called by OpenGLRenderTarget, the default implementation draws the
+        buffers one by one.
+    */
+    virtual void drawRenderQueue(const RenderQueue& queue, std::uint32_t drawModeMask);
+
     /*!
     \brief
         Helper to get the viewport.
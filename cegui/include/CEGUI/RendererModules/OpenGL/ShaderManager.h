@@ -49,6 +49,9 @@ namespace CEGUI
     {
         StandardTextured,
         StandardSolid,
+        //! Shaders drawing batches of GeometryBuffers, desktop OpenGL only
+        BatchedTextured,
+        BatchedSolid,
 
         Count
     };
@@ -83,6 +83,16 @@ public:
         GLenum d_target;
         GLuint d_texture;
     };
+    //! Counts of the calls made through the wrapper since resetStatistics was called.
+    struct Statistics
+    {
+        //! State changes passed on to OpenGL, including uniform uploads
+        std::size_t d_stateChanges = 0;
+        //! Redundant state changes that were skipped
+        std::size_t d_skippedStateChanges = 0;
+        //! Uniform values uploaded to shader programs
+        std::size_t d_uniformUploads = 0;
+    };
 
 
     OpenGLBaseStateChangeWrapper();
@@ -117,6 +127,29 @@ public:
     */
     void activeTexture(unsigned int texture_position);
 
+    /*
+    \brief
+        Upload a uniform value of the program in use. The values last uploaded
+        depend on the program and are tracked by OpenGLBaseShaderWrapper,
+        which calls skipUniform instead when a value did not change.
+    */
+    void uniform1i(GLint location, GLint value);
+    void uniform1f(GLint location, GLfloat value);
+    void uniform1fv(GLint location, GLsizei count, const GLfloat* value);
+    void uniform4fv(GLint location, GLsizei count, const GLfloat* value);
+    void uniformMatrix4fv(GLint location, GLsizei count, const GLfloat* value);
+    //! Count a uniform upload skipped because the program already has the value.
+    void skipUniform() { ++d_statistics.d_skippedStateChanges; }
+
+    /*
+    \brief
+        Returns the number of state changes done and skipped since the last call
+        to resetStatistics. The renderer resets them in beginRendering, so
+        after rendering they describe the last frame.
+    */
+    const Statistics& getStatistics() const { return d_statistics; }
+    void resetStatistics() { d_statistics = Statistics(); }
+
     /*
     \brief
         Returns the number representing the last active texture's position. This value is the one that was last
@@ -223,6 +256,8 @@ protected:
     unsigned int                d_activeTexturePosition;
     //! List of bound textures, the position in the vector defines the active texture it is bound to
     std::vector<BoundTexture>   d_boundTextures;
+    //! Calls counted since the last resetStatistics
+    Statistics                  d_statistics;
 };
 
 } // End of  CEGUI namespace section
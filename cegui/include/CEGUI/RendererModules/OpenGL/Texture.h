@@ -123,6 +123,7 @@ public:
     void blitFromMemory(const void* sourceData, const Rectf& area) override;
     void blitToMemory(void* targetData) override = 0;
     bool isPixelFormatSupported(const PixelFormat fmt) const override;
+    bool releaseData() override;
 
 protected:
 
@@ -0,0 +1,135 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    RGBA8 pixel storage used by the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareFrameBuffer_h_
+#define _CEGUISoftwareFrameBuffer_h_
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Colour.h"
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Pixel storage of the software renderer, used for render targets as well
+    as for textures.
+
+    Pixels are stored as 4 bytes (red, green, blue, alpha), row by row, the
+    first row being the top of the image. A frame buffer may additionally own
+    an 8 bit stencil buffer of the same size.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareFrameBuffer
+{
+public:
+    //! Result of comparing two frame buffers, see compare.
+    struct Difference
+    {
+        //! number of pixels where some channel differs by more than the tolerance.
+        std::size_t d_differingPixels = 0;
+        //! largest difference found in any channel of any pixel.
+        int d_maxChannelDifference = 0;
+    };
+
+    SoftwareFrameBuffer();
+    SoftwareFrameBuffer(unsigned int width, unsigned int height, bool withStencil = false);
+
+    //! Resize the buffer. The content is undefined afterwards.
+    void resize(unsigned int width, unsigned int height);
+
+    //! Add or remove the stencil buffer.
+    void setStencilEnabled(bool setting);
+    bool isStencilEnabled() const { return d_withStencil; }
+
+    unsigned int getWidth() const { return d_width; }
+    unsigned int getHeight() const { return d_height; }
+
+    //! Return the pixel data, 4 bytes per pixel.
+    std::uint8_t* getPixels() { return d_pixels.data(); }
+    const std::uint8_t* getPixels() const { return d_pixels.data(); }
+
+    //! Return the stencil data, or 0 if there is no stencil buffer.
+    std::uint8_t* getStencil() { return d_withStencil ? d_stencil.data() : nullptr; }
+
+    //! Return the pixel at \a x, \a y as a packed 0xAARRGGBB value.
+    argb_t getPixel(unsigned int x, unsigned int y) const;
+
+    //! Set every pixel to \a colour and the stencil to 0.
+    void clear(const Colour& colour = Colour(0.f, 0.f, 0.f, 0.f));
+
+    //! Set the stencil values in the given pixel rectangle to 0.
+    void clearStencil(int left, int top, int right, int bottom);
+
+    /*!
+    \brief
+        Compare this frame buffer with \a other.
+
+    \param tolerance
+        Largest per channel difference (0 - 255) that is not counted as a
+        difference.
+
+    \return
+        A Difference describing the result. When the sizes do not match,
+        every pixel of the larger buffer is reported as different.
+    */
+    Difference compare(const SoftwareFrameBuffer& other, int tolerance = 0) const;
+
+    /*!
+    \brief
+        Write the content of the frame buffer to the file \a filename, as an
+        uncompressed RGBA PNG image.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void savePNG(const String& filename) const;
+
+    //! Write the content of the frame buffer to \a data as PNG image.
+    void encodePNG(std::vector<std::uint8_t>& data) const;
+
+protected:
+    std::vector<std::uint8_t> d_pixels;
+    std::vector<std::uint8_t> d_stencil;
+    unsigned int d_width;
+    unsigned int d_height;
+    bool d_withStencil;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareFrameBuffer_h_
@@ -0,0 +1,199 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Triangle rasteriser of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRasteriser_h_
+#define _CEGUISoftwareRasteriser_h_
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../GeometryBuffer.h"
+#include "../../Rectf.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Rasterises the triangles of a GeometryBuffer into a SoftwareFrameBuffer.
+
+    Triangles are set up once per draw and then rasterised tile by tile, each
+    tile being a band of frame buffer rows. Every operation done on a pixel
+    (stencil, blending) only depends on earlier operations on the same pixel,
+    so tiles are independent and large draws are spread over a pool of worker
+    threads without affecting the result.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRasteriser
+{
+public:
+    //! Everything needed to rasterise the vertices of one GeometryBuffer.
+    struct DrawCall
+    {
+        SoftwareFrameBuffer* d_target = nullptr;
+        const float* d_vertices = nullptr;
+        std::size_t d_vertexCount = 0;
+        //! number of floats per vertex.
+        int d_stride = 0;
+        //! offsets of the attributes in a vertex, -1 when not present.
+        int d_positionOffset = 0;
+        int d_colourOffset = -1;
+        int d_texCoordOffset = -1;
+        //! texture sampled when there are texture coordinates, may be 0.
+        const SoftwareFrameBuffer* d_texture = nullptr;
+        //! model view projection matrix.
+        glm::mat4 d_matrix;
+        //! area of the render target, in frame buffer pixels.
+        Rectf d_viewport;
+        bool d_clippingActive = false;
+        //! scissor rectangle, relative to the viewport.
+        Rectf d_clippingRegion;
+        float d_alpha = 1.f;
+        BlendMode d_blendMode = BlendMode::Normal;
+        PolygonFillRule d_fillRule = PolygonFillRule::NoFilling;
+        //! vertices drawn after the stencil pass of a fill rule.
+        std::size_t d_postStencilVertexCount = 0;
+    };
+
+    //! Work done by a draw.
+    struct Result
+    {
+        std::size_t d_triangles = 0;
+        std::size_t d_fragments = 0;
+    };
+
+    SoftwareRasteriser();
+    ~SoftwareRasteriser();
+
+    SoftwareRasteriser(const SoftwareRasteriser&) = delete;
+    SoftwareRasteriser& operator=(const SoftwareRasteriser&) = delete;
+
+    /*!
+    \brief
+        Set the number of threads rasterising tiles, including the calling
+        thread. 0 uses the number of hardware threads.
+    */
+    void setThreadCount(unsigned int count);
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(d_workers.size()) + 1; }
+
+    //! Rasterise \a call into its target.
+    Result draw(const DrawCall& call);
+
+    //! Height in rows of the tiles draws are split into.
+    static const int TileHeight = 32;
+
+private:
+    //! Vertex in frame buffer pixel coordinates.
+    struct Vertex
+    {
+        float d_x, d_y;
+        //! 1 / clip space w, for perspective correct interpolation.
+        float d_invW;
+        float d_colour[4];
+        float d_uv[2];
+    };
+
+    //! What a pass does with the pixels covered by its triangles.
+    enum class PassOp
+    {
+        //! shade, test the stencil (when d_stencilFunc is set) and blend.
+        Colour,
+        //! invert the stencil value (even-odd rule).
+        StencilInvert,
+        //! increment or decrement the stencil depending on facing (non-zero rule).
+        StencilWind
+    };
+
+    enum class StencilFunc
+    {
+        Always,
+        EqualFF,
+        NotEqualZero
+    };
+
+    struct Triangle
+    {
+        //! vertex indices, ordered so that the signed area is positive.
+        std::uint32_t d_index[3];
+        float d_invArea;
+        int d_minX, d_minY, d_maxX, d_maxY;
+        //! whether the vertices had to be reordered.
+        bool d_flipped;
+        bool d_perspective;
+    };
+
+    struct Pass
+    {
+        PassOp d_op;
+        StencilFunc d_stencilFunc;
+        std::size_t d_firstTriangle;
+        std::size_t d_triangleCount;
+        bool d_clearStencil;
+    };
+
+    void setupVertices(const DrawCall& call);
+    void setupTriangles(std::size_t firstVertex, std::size_t vertexCount);
+    void rasteriseTile(int tile);
+    std::size_t rasteriseTriangle(const Triangle& tri, const Pass& pass, int top, int bottom);
+    void runTiles();
+    void workerMain(std::uint64_t generation);
+
+    const DrawCall* d_call;
+    std::vector<Vertex> d_vertices;
+    std::vector<Triangle> d_triangles;
+    std::vector<Pass> d_passes;
+    //! scissor rectangle in frame buffer pixels, right / bottom exclusive.
+    int d_left, d_top, d_right, d_bottom;
+    int d_tileCount;
+
+    std::vector<std::thread> d_workers;
+    std::mutex d_mutex;
+    std::condition_variable d_wakeCondition;
+    std::condition_variable d_doneCondition;
+    std::uint64_t d_generation;
+    std::size_t d_busyWorkers;
+    bool d_stopping;
+    std::atomic<int> d_nextTile;
+    std::atomic<std::size_t> d_fragments;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRasteriser_h_
@@ -0,0 +1,77 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    RenderTarget base of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderTarget_h_
+#define _CEGUISoftwareRenderTarget_h_
+
+#include "../../RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rectf.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! RenderTarget of the software renderer, drawing to a SoftwareFrameBuffer.
+class SOFTWARE_GUIRENDERER_API SoftwareRenderTarget : virtual public RenderTarget
+{
+public:
+    //! Constructor
+    SoftwareRenderTarget(SoftwareRenderer& owner, SoftwareFrameBuffer* frameBuffer);
+
+    //! Destructor
+    virtual ~SoftwareRenderTarget();
+
+    //! Return the frame buffer this target draws to.
+    SoftwareFrameBuffer* getFrameBuffer() const { return d_frameBuffer; }
+
+    // implement parts of CEGUI::RenderTarget interface
+    void activate() override;
+    void updateMatrix() const override;
+    bool isImageryCache() const override;
+    // implementing the virtual function with a covariant return type
+    SoftwareRenderer& getOwner() override;
+
+protected:
+    //! SoftwareRenderer object that owns this RenderTarget
+    SoftwareRenderer& d_owner;
+    //! frame buffer the target draws to.
+    SoftwareFrameBuffer* d_frameBuffer;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderTarget_h_
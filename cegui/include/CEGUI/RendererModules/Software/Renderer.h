@@ -0,0 +1,259 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Renderer that rasterises on the CPU into in-memory frame buffers
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderer_h_
+#define _CEGUISoftwareRenderer_h_
+
+#include "../../Renderer.h"
+#include "../../Sizef.h"
+#include "../../Colour.h"
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUISOFTWARERENDERER_EXPORTS
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define SOFTWARE_GUIRENDERER_API
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareGeometryBuffer;
+class SoftwareTexture;
+class SoftwareShaderWrapper;
+class SoftwareRenderTarget;
+class SoftwareFrameBuffer;
+class SoftwareRasteriser;
+
+/*!
+\brief
+    CEGUI::Renderer implementation that rasterises on the CPU.
+
+    All geometry is rasterised into RGBA8 frame buffers held in memory,
+    following the rules of the OpenGL 3 renderer: pixel centre sampling with
+    a top-left fill convention, bilinear filtered and edge clamped textures,
+    scissor clipping, the same blend equations and the stencil based fill
+    rules. This makes it possible to run pixel comparisons and frame time
+    benchmarks on machines without a GPU. The default render target draws to
+    a frame buffer of the display size, see getFrameBuffer; TextureTargets
+    are supported, and so are texture filters (see TextureFilter).
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderer : public Renderer
+{
+public:
+    //! Counters collected while rendering, reset by beginRendering.
+    struct Statistics
+    {
+        //! number of GeometryBuffer draws, counting each RenderEffect pass.
+        std::size_t d_drawCalls = 0;
+        //! number of triangles submitted, including stencil passes.
+        std::size_t d_triangles = 0;
+        //! number of pixels written to colour buffers.
+        std::size_t d_fragments = 0;
+    };
+
+    /*!
+    \brief
+        Convenience function that creates all the necessary objects
+        then initialises the CEGUI system with them.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::SoftwareRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param displaySize
+        Size of the frame buffer of the default render target.
+
+    \param abi
+        This must be set to CEGUI_VERSION_ABI
+
+    \return
+        Reference to the CEGUI::SoftwareRenderer object that was created.
+    */
+    static SoftwareRenderer& bootstrapSystem(const Sizef& displaySize,
+                                             const int abi = CEGUI_VERSION_ABI);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::SoftwareRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    //! Create a SoftwareRenderer object with the given display size.
+    static SoftwareRenderer& create(const Sizef& displaySize,
+                                    const int abi = CEGUI_VERSION_ABI);
+
+    //! destroy a SoftwareRenderer object.
+    static void destroy(SoftwareRenderer& renderer);
+
+    //! Return the frame buffer the default render target draws to.
+    SoftwareFrameBuffer& getFrameBuffer();
+    const SoftwareFrameBuffer& getFrameBuffer() const;
+
+    /*!
+    \brief
+        Set the colour the frame buffer of the default render target is
+        cleared to by beginRendering.
+    */
+    void setClearColour(const Colour& colour) { d_clearColour = colour; }
+    const Colour& getClearColour() const { return d_clearColour; }
+
+    /*!
+    \brief
+        Set whether beginRendering clears the frame buffer of the default
+        render target. Disable this to draw the GUI over existing content.
+    */
+    void setClearOnBeginRendering(bool setting) { d_clearOnBeginRendering = setting; }
+    bool isClearOnBeginRendering() const { return d_clearOnBeginRendering; }
+
+    /*!
+    \brief
+        Set the number of threads used to rasterise large draws. 0 uses the
+        number of hardware threads. The result does not depend on this.
+    */
+    void setThreadCount(unsigned int count);
+    unsigned int getThreadCount() const;
+
+    //! Return the counters collected since the last call to beginRendering.
+    const Statistics& getStatistics() const { return d_statistics; }
+
+    //! Return the rasteriser used by the geometry buffers of this renderer.
+    SoftwareRasteriser& getRasteriser() { return *d_rasteriser; }
+
+    //! Add to the counters returned by getStatistics.
+    void addStatistics(std::size_t triangles, std::size_t fragments);
+
+    //! Return the frame buffer of the RenderTarget that is currently active.
+    SoftwareFrameBuffer* getActiveFrameBuffer() const { return d_activeFrameBuffer; }
+
+    // implement CEGUI::Renderer interface
+    RenderTarget& getDefaultRenderTarget() override;
+    RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const override;
+    GeometryBuffer& createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial) override;
+    GeometryBuffer& createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial) override;
+    TextureTarget* createTextureTarget(bool addStencilBuffer) override;
+    void destroyTextureTarget(TextureTarget* target) override;
+    void destroyAllTextureTargets() override;
+    Texture& createTexture(const String& name) override;
+    Texture& createTexture(const String& name,
+                           const String& filename,
+                           const String& resourceGroup) override;
+    Texture& createTexture(const String& name, const Sizef& size) override;
+    void destroyTexture(Texture& texture) override;
+    void destroyTexture(const String& name) override;
+    void destroyAllTextures() override;
+    Texture& getTexture(const String& name) const override;
+    bool isTextureDefined(const String& name) const override;
+    void beginRendering() override;
+    void endRendering() override;
+    void setDisplaySize(const Sizef& sz) override;
+    const Sizef& getDisplaySize() const override;
+    unsigned int getMaxTextureSize() const override;
+    const String& getIdentifierString() const override;
+    bool isTexCoordSystemFlipped() const override;
+    void setActiveRenderTarget(RenderTarget* renderTarget) override;
+    bool applyTextureFilter(TextureTarget& target, const Sizef& size,
+                            const TextureFilter& filter) override;
+
+protected:
+    //! constructor.
+    SoftwareRenderer(const Sizef& displaySize);
+    //! destructor.
+    virtual ~SoftwareRenderer();
+
+    //! helper to throw exception if name is already used.
+    void throwIfNameExists(const String& name) const;
+    //! helper to safely log the creation of a named texture
+    static void logTextureCreation(const String& name);
+    //! helper to safely log the destruction of a named texture
+    static void logTextureDestruction(const String& name);
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Sizef d_displaySize;
+    //! Frame buffer drawn to by the default target.
+    SoftwareFrameBuffer* d_frameBuffer;
+    //! The default RenderTarget
+    SoftwareRenderTarget* d_defaultTarget;
+    //! Frame buffer of the active RenderTarget.
+    SoftwareFrameBuffer* d_activeFrameBuffer;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold Textures we create.
+    typedef std::unordered_map<String, SoftwareTexture*> TextureMap;
+    //! Container used to track textures.
+    TextureMap d_textures;
+    //! Rasteriser shared by all geometry buffers.
+    SoftwareRasteriser* d_rasteriser;
+
+    //! Shaderwrapper for textured & coloured vertices
+    SoftwareShaderWrapper* d_shaderWrapperTextured;
+    //! Shaderwrapper for coloured vertices
+    SoftwareShaderWrapper* d_shaderWrapperSolid;
+
+    Statistics d_statistics;
+    Colour d_clearColour;
+    bool d_clearOnBeginRendering;
+};
+
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderer_h_
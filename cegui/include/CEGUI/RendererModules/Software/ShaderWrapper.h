@@ -0,0 +1,67 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    ShaderWrapper implementation of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareShaderWrapper_h_
+#define _CEGUISoftwareShaderWrapper_h_
+
+#include "CEGUI/ShaderWrapper.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class ShaderParameterBindings;
+
+/*!
+\brief
+    ShaderWrapper of the software renderer. The rasteriser has a single fixed
+    shading model, so there are no parameters to prepare.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareShaderWrapper : public ShaderWrapper
+{
+public:
+    SoftwareShaderWrapper();
+
+    ~SoftwareShaderWrapper();
+
+    //Implementation of ShaderWrapper interface
+    void prepareForRendering(const ShaderParameterBindings* shaderParameterBindings) override;
+};
+
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Texture implementation of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareTexture_h_
+#define _CEGUISoftwareTexture_h_
+
+#include "../../Texture.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/FrameBuffer.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Implementation of the CEGUI::Texture class for the software renderer.
+class SOFTWARE_GUIRENDERER_API SoftwareTexture : public Texture
+{
+public:
+    //! Return the pixels of the texture.
+    SoftwareFrameBuffer& getFrameBuffer() { return d_frameBuffer; }
+    const SoftwareFrameBuffer& getFrameBuffer() const { return d_frameBuffer; }
+
+    /*!
+    \brief
+        Resize the texture to \a sz (at least 1 x 1 pixels), clearing its
+        content. Used by SoftwareTextureTarget.
+    */
+    void setSize(const Sizef& sz);
+
+    // implement CEGUI::Texture interface
+    const String& getName() const override;
+    const Sizef& getSize() const override;
+    const Sizef& getOriginalDataSize() const override;
+    const glm::vec2& getTexelScaling() const override;
+    void loadFromFile(const String& filename, const String& resourceGroup) override;
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format) override;
+    void blitFromMemory(const void* sourceData, const Rectf& area) override;
+    void blitToMemory(void* targetData) override;
+    bool isPixelFormatSupported(const PixelFormat fmt) const override;
+    bool releaseData() override;
+
+protected:
+    // we all need a little help from out friends ;)
+    friend Texture& SoftwareRenderer::createTexture(const String&);
+    friend Texture& SoftwareRenderer::createTexture(const String&, const String&, const String&);
+    friend Texture& SoftwareRenderer::createTexture(const String&, const Sizef&);
+    friend void SoftwareRenderer::destroyTexture(Texture&);
+    friend void SoftwareRenderer::destroyTexture(const String&);
+
+    //! standard constructor
+    SoftwareTexture(const String& name);
+    //! construct texture via an image file.
+    SoftwareTexture(const String& name, const String& filename,
+                    const String& resourceGroup);
+    //! construct texture with a specified initial size.
+    SoftwareTexture(const String& name, const Sizef& sz);
+
+    //! destructor.
+    virtual ~SoftwareTexture();
+
+    //! update the cached texel scaling and sizes after a resize.
+    void updateCachedScaleValues();
+
+    //! The pixels of the texture.
+    SoftwareFrameBuffer d_frameBuffer;
+    //! Size of the texture.
+    Sizef d_size;
+    //! original pixel of size data loaded into texture
+    Sizef d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    glm::vec2 d_texelScaling;
+    //! Name this texture was created with.
+    const String d_name;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareTexture_h_
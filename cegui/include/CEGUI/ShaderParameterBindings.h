@@ -31,6 +31,8 @@
 #include "CEGUI/ModuleConfig.h"
 #include <glm/glm.hpp>
 #include <map>
+#include <vector>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -199,8 +201,27 @@ public:
 
     typedef std::map<std::string, ShaderParameter*> ShaderParameterBindingsMap;
 
+    /*!
+    \brief
+        Identifies a shader parameter name. Handles are shared by all bindings
+        and stay valid for the lifetime of the process, so they can be
+        resolved once and used to set and look up parameters without
+        comparing strings.
+    */
+    typedef std::uint32_t ParameterHandle;
+
     ~ShaderParameterBindings();
 
+    /*!
+    \brief
+        Returns the handle of the parameter with the specified name,
+        registering the name if it was not used before.
+    */
+    static ParameterHandle getParameterHandle(const std::string& parameter_name);
+
+    //! Returns the name the specified handle was registered for.
+    static const std::string& getParameterName(ParameterHandle handle);
+
     /*!
     \brief
         Adds a matrix shader parameter to the parameter bindings
@@ -262,6 +283,22 @@ public:
     */
     ShaderParameter* getParameter(const std::string& parameter_name);
 
+    //! Same as the name based setParameter, using a handle from getParameterHandle.
+    void setParameter(ParameterHandle handle, const glm::mat4& matrix);
+    void setParameter(ParameterHandle handle, const Texture* texture);
+    void setParameter(ParameterHandle handle, float fvalue);
+    void setParameter(ParameterHandle handle, int value);
+
+    /*!
+    \brief
+        Returns a pointer to the shader_parameter with the specified handle, or
+        0 if no parameter was set for it.
+    */
+    ShaderParameter* getParameter(ParameterHandle handle) const
+    {
+        return handle < d_parametersByHandle.size() ? d_parametersByHandle[handle] : nullptr;
+    }
+
     /*!
     \brief
         Sets the shader_parameter in the map to 0, which means that the shader parameter
@@ -274,6 +311,13 @@ public:
 
     const std::map<std::string, ShaderParameter*>& getShaderParameterBindings() const { return d_shaderParameterBindings; }
 
+    /*!
+    \brief
+        Returns the same parameters as getShaderParameterBindings, indexed by
+        their handle. Entries of handles without a parameter are 0.
+    */
+    const std::vector<ShaderParameter*>& getParametersByHandle() const { return d_parametersByHandle; }
+
 protected:
 
     /*!
@@ -291,6 +335,8 @@ protected:
 
     //! Map of the names of the shader parameter and the respective shader parameter value
     std::map<std::string, ShaderParameter*> d_shaderParameterBindings;
+    //! The parameters of d_shaderParameterBindings indexed by their handle
+    std::vector<ShaderParameter*> d_parametersByHandle;
 };
 
 }
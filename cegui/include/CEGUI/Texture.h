@@ -78,14 +78,21 @@ public:
         //! S3 DXT1 texture compression (RGBA).
         RgbaDxt3,
         //! S3 DXT1 texture compression (RGBA).
-        RgbaDxt5
+        RgbaDxt5,
+        //! BPTC (BC7) texture compression (RGBA).
+        RgbaBc7,
+        //! ETC2 texture compression (RGB).
+        RgbEtc2,
+        //! ETC2 texture compression with EAC alpha (RGBA).
+        RgbaEtc2
     };
 
     /*!
     \brief
-        Destructor for Texture base class.
+        Destructor for Texture base class. Unregisters the texture from the
+        TextureResidencyManager.
     */
-    virtual ~Texture() = default;
+    virtual ~Texture();
 
     /*!
     \brief
@@ -215,6 +222,19 @@ public:
         - false if the specified PixelFormat is not supported.
     */
     virtual bool isPixelFormatSupported(const PixelFormat fmt) const = 0;
+
+    /*!
+    \brief
+        Release the memory holding the pixels of the texture, while keeping
+        its size. Used by TextureResidencyManager to evict textures, which
+        are restored by loading their content again before they are used.
+        The default implementation does not support releasing the data.
+
+    \return
+        - true if the data was released.
+        - false if the texture can't release its data, it is left unchanged.
+    */
+    virtual bool releaseData() { return false; }
 };
 
 } // End of  CEGUI namespace section
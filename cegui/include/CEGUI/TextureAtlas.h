@@ -0,0 +1,193 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Packs small images into a shared Texture
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureAtlas_h_
+#define _CEGUITextureAtlas_h_
+
+#include "CEGUI/Rectf.h"
+#include "CEGUI/String.h"
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class Texture;
+
+/*!
+\brief
+    A Texture shared by a number of small images.
+
+    Images are placed using a shelf packer: the atlas is divided into
+    horizontal shelves and each image goes onto the shelf that wastes the
+    least height. Every image gets a one pixel gutter filled with copies of its
+    edge pixels, so bilinear filtering at the image border does not pick up
+    neighbouring images.
+
+    The atlas does not reuse space freed by released images. It only tracks
+    them for the occupancy figures. ImageManager destroys an atlas once
+    its last image is released.
+*/
+class CEGUIEXPORT TextureAtlas
+{
+public:
+    /*!
+    \brief
+        Create an atlas and the Texture backing it.
+
+    \param name
+        Name of the Texture that will be created by the Renderer.
+
+    \param size
+        Size of the atlas Texture in pixels.
+    */
+    TextureAtlas(const String& name, const Sizef& size);
+
+    //! Destroys the Texture backing the atlas.
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /*!
+    \brief
+        Copy an image into free space in the atlas.
+
+    \param pixels
+        Pointer to tightly packed 32 bit RGBA pixel data.
+
+    \param size
+        Size of the image described by \a pixels.
+
+    \param area
+        Receives the area of the atlas Texture that now holds the image.
+
+    \return
+        - true if the image was added.
+        - false if there was not enough free space left in the atlas.
+    */
+    bool addImage(const void* pixels, const Sizef& size, Rectf& area);
+
+    /*!
+    \brief
+        Notify the atlas that the image occupying \a area is no longer used.
+    */
+    void releaseImage(const Rectf& area);
+
+    //! Return the Texture holding the atlas.
+    Texture& getTexture() const { return *d_texture; }
+
+    //! Return the name of the Texture holding the atlas.
+    const String& getName() const;
+
+    //! Return the size of the atlas in pixels.
+    const Sizef& getSize() const { return d_size; }
+
+    //! Return the number of images currently held by the atlas.
+    std::uint32_t getImageCount() const { return d_imageCount; }
+
+    /*!
+    \brief
+        Return the fraction (0 - 1) of the atlas area that is covered by the
+        images it currently holds.
+    */
+    float getOccupancy() const;
+
+    /*!
+    \brief
+        Return the fraction (0 - 1) of the atlas area that has been handed out
+        so far, including gutters and space wasted at the end of shelves.
+    */
+    float getAllocatedRatio() const;
+
+    /*!
+    \brief
+        Load an image file through the system ImageCodec and return its
+        pixels as 32 bit RGBA.
+
+    \param filename
+        The image file to load.
+
+    \param resourceGroup
+        Resource group identifier passed to the ResourceProvider.
+
+    \param pixels
+        Receives the RGBA pixel data.
+
+    \param size
+        Receives the size of the image.
+
+    \return
+        - true if the image was loaded.
+        - false if the codec produced a pixel format that cannot be
+          converted to RGBA (for example compressed data that has no CPU
+          decoder).
+    */
+    static bool loadImageData(const String& filename,
+                              const String& resourceGroup,
+                              std::vector<std::uint8_t>& pixels,
+                              Sizef& size);
+
+    //! Width of the gutter around each image, in pixels.
+    static const std::uint32_t ImageGutter = 1;
+
+private:
+    //! A horizontal strip of the atlas holding images of a similar height.
+    struct Shelf
+    {
+        std::uint32_t d_y;
+        std::uint32_t d_height;
+        std::uint32_t d_nextX;
+    };
+
+    //! Return index of the shelf to use for the given size, or the shelf count.
+    std::size_t findShelf(std::uint32_t width, std::uint32_t height) const;
+
+    Texture* d_texture;
+    Sizef d_size;
+    std::vector<Shelf> d_shelves;
+    //! y coordinate below the last shelf.
+    std::uint32_t d_shelfEnd;
+    std::uint32_t d_imageCount;
+    //! number of pixels covered by live images.
+    std::uint64_t d_usedPixels;
+    //! number of pixels handed out from the shelves (includes gutters).
+    std::uint64_t d_allocatedPixels;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUITextureAtlas_h_
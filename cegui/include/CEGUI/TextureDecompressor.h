@@ -0,0 +1,126 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Helpers for block compressed texture data
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureDecompressor_h_
+#define _CEGUITextureDecompressor_h_
+
+#include "CEGUI/Texture.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace CEGUI
+{
+/*!
+\brief
+    Utility class for working with block compressed pixel data.
+
+    Provides size calculations for all Texture::PixelFormat values and a CPU
+    decoder that expands compressed blocks to 32 bit RGBA. ImageCodec modules
+    use this when the Texture they load into does not support a compressed
+    format natively (see Texture::isPixelFormatSupported).
+*/
+class CEGUIEXPORT TextureDecompressor
+{
+public:
+
+    // Must not be constructed
+    TextureDecompressor() = delete;
+
+    //! Return whether \a fmt is a block compressed format.
+    static bool isCompressed(Texture::PixelFormat fmt);
+
+    /*!
+    \brief
+        Return the number of bytes used by a 4x4 block of the given compressed
+        format, or 0 for uncompressed formats.
+    */
+    static std::size_t getBlockSize(Texture::PixelFormat fmt);
+
+    /*!
+    \brief
+        Return the number of bytes needed to hold an image of the given size in
+        the given format.
+
+    \param fmt
+        PixelFormat of the data.
+
+    \param width
+        Width of the image in pixels.
+
+    \param height
+        Height of the image in pixels.
+
+    \return
+        Size of the pixel data in bytes. For block compressed formats the
+        dimensions are rounded up to whole blocks.
+    */
+    static std::size_t getDataSize(Texture::PixelFormat fmt,
+                                   std::uint32_t width, std::uint32_t height);
+
+    /*!
+    \brief
+        Return whether decompress is able to decode data in the given format.
+
+        All S3TC (DXT) formats and the ETC2 formats are supported. BC7 data can
+        only be used on renderers that support it natively.
+    */
+    static bool canDecompress(Texture::PixelFormat fmt);
+
+    /*!
+    \brief
+        Decode block compressed pixel data to 32 bit RGBA.
+
+    \param fmt
+        PixelFormat of the data in \a src.
+
+    \param src
+        Pointer to the compressed data. Must hold at least
+        getDataSize(fmt, width, height) bytes.
+
+    \param width
+        Width of the image in pixels.
+
+    \param height
+        Height of the image in pixels.
+
+    \param dst
+        Buffer that receives the decoded pixels. Must hold at least
+        width * height * 4 bytes.
+
+    \return
+        - true if the data was decoded.
+        - false if \a fmt can not be decoded.
+    */
+    static bool decompress(Texture::PixelFormat fmt, const void* src,
+                           std::uint32_t width, std::uint32_t height,
+                           std::uint8_t* dst);
+};
+
+} // End of  CEGUI namespace section
+
+#endif // end of guard _CEGUITextureDecompressor_h_
@@ -0,0 +1,161 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Description and CPU implementation of texture filters
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureFilter_h_
+#define _CEGUITextureFilter_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Colour.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Describes an image filter that a Renderer applies to the content of a
+    TextureTarget, see Renderer::applyTextureFilter.
+
+    The filters operate on premultiplied colours, which is what TextureTargets
+    contain after rendering. apply is the reference implementation, working on
+    RGBA8 pixels in memory; Renderers that keep their textures in memory use it
+    directly.
+*/
+class CEGUIEXPORT TextureFilter
+{
+public:
+    enum class Type : int
+    {
+        //! Gaussian blur of the colour and alpha.
+        Blur,
+        //! 4 x 5 colour matrix applied to the unpremultiplied colours.
+        ColourMatrix,
+        //! Blurred, offset and tinted copy of the alpha, drawn under the content.
+        DropShadow
+    };
+
+    //! Number of coefficients of a colour matrix: 4 rows of 5 columns.
+    static const int ColourMatrixSize = 20;
+
+    /*!
+    \brief
+        Create a blur filter.
+
+    \param radius
+        Blur radius in pixels, twice the standard deviation of the Gaussian.
+        The image is downsampled before blurring large radii, see
+        getDownsampleFactor.
+    */
+    static TextureFilter createBlur(float radius);
+
+    /*!
+    \brief
+        Create a colour matrix filter.
+
+    \param matrix
+        ColourMatrixSize coefficients, row major. Each row computes one of the
+        red, green, blue and alpha output channels from the red, green, blue
+        and alpha input channels (0 - 1) plus the offset in the fifth column.
+    */
+    static TextureFilter createColourMatrix(const float* matrix);
+
+    /*!
+    \brief
+        Create a drop shadow filter.
+
+    \param offset
+        Offset of the shadow in pixels, rounded to whole pixels.
+
+    \param radius
+        Blur radius of the shadow in pixels, as for createBlur.
+
+    \param colour
+        Colour of the shadow, its alpha scales the shadow opacity.
+    */
+    static TextureFilter createDropShadow(const glm::vec2& offset, float radius,
+                                          const Colour& colour);
+
+    //! Fill \a matrix with the identity colour matrix.
+    static void getIdentityMatrix(float* matrix);
+
+    /*!
+    \brief
+        Fill \a matrix with a colour matrix that changes the saturation:
+        0 gives greyscale, 1 leaves the colours unchanged.
+    */
+    static void getSaturationMatrix(float* matrix, float saturation);
+
+    /*!
+    \brief
+        Return the factor (1, 2, 4 or 8) by which the image is downsampled
+        before applying a blur of \a radius pixels. The factor is chosen so
+        that the standard deviation on the downsampled image stays at 2 pixels
+        or less, which bounds the size of the Gaussian kernel.
+    */
+    static int getDownsampleFactor(float radius);
+
+    Type getType() const { return d_type; }
+    float getRadius() const { return d_radius; }
+    const float* getColourMatrix() const { return d_matrix; }
+    const glm::vec2& getOffset() const { return d_offset; }
+    const Colour& getColour() const { return d_colour; }
+
+    /*!
+    \brief
+        Apply the filter to premultiplied RGBA8 pixels in memory.
+
+    \param pixels
+        Pixel data, 4 bytes (red, green, blue, alpha) per pixel, the first row
+        being the top of the image.
+
+    \param width
+        Width of the filtered area in pixels.
+
+    \param height
+        Height of the filtered area in pixels.
+
+    \param pitch
+        Number of bytes between the starts of two rows.
+    */
+    void apply(std::uint8_t* pixels, unsigned int width, unsigned int height,
+               std::size_t pitch) const;
+
+protected:
+    TextureFilter(Type type);
+
+    Type d_type;
+    float d_radius = 0.f;
+    float d_matrix[ColourMatrixSize];
+    glm::vec2 d_offset = glm::vec2(0.f, 0.f);
+    Colour d_colour;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUITextureFilter_h_
@@ -0,0 +1,168 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Built-in RenderEffects that filter the RenderingWindow texture
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureFilterEffect_h_
+#define _CEGUITextureFilterEffect_h_
+
+#include "CEGUI/RenderEffect.h"
+#include "CEGUI/TextureFilter.h"
+#include "CEGUI/String.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Base class for the built-in RenderEffects that filter the content of a
+    RenderingWindow.
+
+    The filter is applied by the Renderer (see Renderer::applyTextureFilter)
+    to the TextureTarget of the RenderingWindow, right after its content has
+    been rendered. The filtered texture is then drawn like any other
+    RenderingWindow, so the filter only runs again when the content is
+    invalidated, or when a parameter of the effect changes. The effects draw
+    within the area of the window; content that should be blurred or shadowed
+    needs some transparent margin inside the window. If the Renderer does not
+    support texture filters the window is drawn unfiltered.
+*/
+class CEGUIEXPORT TextureFilterEffect : public RenderEffect
+{
+public:
+    TextureFilterEffect(Window* window, const TextureFilter& filter);
+
+    //! Return the TextureFilter applied by the effect.
+    const TextureFilter& getFilter() const { return d_filter; }
+
+    /*!
+    \brief
+        Return the number of times the filter was applied to the content of
+        the RenderingWindow, counting only applications that the Renderer
+        supported.
+    */
+    std::size_t getFilterCount() const { return d_filterCount; }
+
+    /*!
+    \brief
+        Return whether the Renderer applied the filter the last time the
+        content was rendered.
+    */
+    bool isFilterApplied() const { return d_filterApplied; }
+
+    // implement RenderEffect interface
+    int getPassCount() const override;
+    void performPreRenderFunctions(const int pass) override;
+    void performPostRenderFunctions() override;
+    bool realiseGeometry(RenderingWindow& window, GeometryBuffer& geometry) override;
+    bool update(const float elapsed, RenderingWindow& window) override;
+    void processRenderedContent(RenderingWindow& window) override;
+
+protected:
+    /*!
+    \brief
+        Replace the filter and invalidate the window, so that its content is
+        rendered and filtered again. Effects created without a window must be
+        invalidated through the RenderingWindow by the caller.
+    */
+    void setFilter(const TextureFilter& filter);
+
+    //! Window the effect was created for, may be 0.
+    Window* d_window;
+    TextureFilter d_filter;
+    std::size_t d_filterCount = 0;
+    bool d_filterApplied = false;
+};
+
+/*!
+\brief
+    RenderEffect blurring the content of a window with a Gaussian, evaluated
+    on a downsampled copy for large radii. Registered as "Core/Blur".
+*/
+class CEGUIEXPORT BlurEffect : public TextureFilterEffect
+{
+public:
+    //! Name under which the effect is registered with RenderEffectManager.
+    static const String EffectName;
+
+    BlurEffect(Window* window);
+
+    //! Set the blur radius in pixels, see TextureFilter::createBlur.
+    void setRadius(float radius);
+    float getRadius() const { return d_filter.getRadius(); }
+};
+
+/*!
+\brief
+    RenderEffect transforming the colours of the content of a window with a
+    4 x 5 colour matrix. Registered as "Core/ColourMatrix".
+*/
+class CEGUIEXPORT ColourMatrixEffect : public TextureFilterEffect
+{
+public:
+    //! Name under which the effect is registered with RenderEffectManager.
+    static const String EffectName;
+
+    ColourMatrixEffect(Window* window);
+
+    //! Set the colour matrix, see TextureFilter::createColourMatrix.
+    void setMatrix(const float* matrix);
+    const float* getMatrix() const { return d_filter.getColourMatrix(); }
+
+    //! Set a matrix changing the saturation: 0 is greyscale, 1 the original.
+    void setSaturation(float saturation);
+};
+
+/*!
+\brief
+    RenderEffect drawing a blurred, offset and tinted copy of the alpha of
+    the content of a window under that content. Registered as
+    "Core/DropShadow".
+*/
+class CEGUIEXPORT DropShadowEffect : public TextureFilterEffect
+{
+public:
+    //! Name under which the effect is registered with RenderEffectManager.
+    static const String EffectName;
+
+    DropShadowEffect(Window* window);
+
+    //! Set the offset of the shadow, in pixels.
+    void setOffset(const glm::vec2& offset);
+    const glm::vec2& getOffset() const { return d_filter.getOffset(); }
+
+    //! Set the blur radius of the shadow in pixels.
+    void setRadius(float radius);
+    float getRadius() const { return d_filter.getRadius(); }
+
+    //! Set the colour of the shadow.
+    void setColour(const Colour& colour);
+    const Colour& getColour() const { return d_filter.getColour(); }
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUITextureFilterEffect_h_
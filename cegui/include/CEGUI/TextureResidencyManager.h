@@ -0,0 +1,268 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Tracks texture memory and evicts reloadable textures over budget
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureResidencyManager_h_
+#define _CEGUITextureResidencyManager_h_
+
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+#include <unordered_map>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class Texture;
+
+/*!
+\brief
+    Singleton class that keeps track of the memory used by textures and keeps
+    it within a budget.
+
+    Textures are registered by the code creating them together with the
+    category they belong to. The manager records the estimated size of every
+    registered texture and the last frame it was used in; textures are marked
+    as used by RenderingSurface::draw when geometry referencing them is drawn,
+    and frames are advanced by update, which System::renderAllGUIContexts
+    calls once per frame.
+
+    When enabled and the resident textures exceed the budget, update evicts
+    the least recently used textures that can be restored, until the budget is
+    met again. Textures used in the current frame are never evicted. There are
+    two kinds of evictable textures:
+        - textures loaded from a file (see setReloadSource). Their data is
+          released through Texture::releaseData and loaded from the file again
+          the next time they are used. Renderers which can't release texture
+          data leave these textures resident.
+        - textures with an Evictor, which is asked to release the texture and
+          recreates its content by other means when needed again. Used for the
+          surfaces created by RenderCachePolicy.
+
+    The manager is disabled by default, in which case textures are still
+    tracked but never evicted.
+*/
+class CEGUIEXPORT TextureResidencyManager :
+    public Singleton<TextureResidencyManager>
+{
+public:
+    //! Kinds of textures statistics are collected for.
+    enum class Category : int
+    {
+        //! Textures of imagesets and image files, including image atlases.
+        Imageset,
+        //! Glyph textures of fonts.
+        Font,
+        //! Textures of TextureTargets.
+        RenderTarget,
+        //! Textures registered by the application.
+        User,
+        //! Number of categories, not a valid category.
+        Count
+    };
+
+    //! Memory statistics of one Category.
+    struct CategoryStatistics
+    {
+        //! number of registered textures.
+        std::size_t d_textureCount = 0;
+        //! estimated memory used by resident textures, in bytes.
+        std::size_t d_residentBytes = 0;
+        //! estimated memory the currently evicted textures used, in bytes.
+        std::size_t d_evictedBytes = 0;
+        //! number of evictions since the statistics were reset.
+        std::size_t d_evictionCount = 0;
+        //! number of reloads since the statistics were reset.
+        std::size_t d_reloadCount = 0;
+    };
+
+    /*!
+    \brief
+        Interface of objects owning textures that can be released and whose
+        content they are able to recreate when needed.
+    */
+    class CEGUIEXPORT Evictor
+    {
+    public:
+        virtual ~Evictor() = default;
+
+        /*!
+        \brief
+            Release \a texture to save memory. Implementations usually destroy
+            the texture, which unregisters it; if it stays registered, it is
+            considered evicted until it is used again.
+        */
+        virtual void evictTexture(Texture& texture) = 0;
+    };
+
+    TextureResidencyManager();
+    ~TextureResidencyManager();
+
+    TextureResidencyManager(const TextureResidencyManager&) = delete;
+    TextureResidencyManager& operator=(const TextureResidencyManager&) = delete;
+
+    /*!
+    \brief
+        Enable or disable eviction. Disabling it reloads all evicted textures
+        that are still registered.
+    */
+    void setEnabled(bool setting);
+    bool isEnabled() const { return d_enabled; }
+
+    //! Set the estimated memory, in bytes, resident textures may use.
+    void setBudget(std::size_t bytes) { d_budget = bytes; }
+    std::size_t getBudget() const { return d_budget; }
+
+    /*!
+    \brief
+        Start tracking \a texture. Registering a texture again changes its
+        category and keeps everything else.
+    */
+    void registerTexture(Texture& texture, Category category);
+
+    /*!
+    \brief
+        Stop tracking \a texture. Called by the Texture destructor, so
+        textures don't need to be unregistered before they are destroyed.
+    */
+    void unregisterTexture(const Texture& texture);
+
+    //! Return whether \a texture is registered.
+    bool isTextureRegistered(const Texture& texture) const;
+
+    /*!
+    \brief
+        Make \a texture evictable by recording the file its content is loaded
+        from. The texture must be registered.
+    */
+    void setReloadSource(const Texture& texture, const String& filename,
+                         const String& resourceGroup);
+
+    /*!
+    \brief
+        Make \a texture evictable through \a evictor, or not evictable when
+        \a evictor is 0. The texture must be registered.
+    */
+    void setEvictor(const Texture& texture, Evictor* evictor);
+
+    //! Make all textures evictable through \a evictor not evictable.
+    void removeEvictor(const Evictor& evictor);
+
+    /*!
+    \brief
+        Record that \a texture is used in the current frame, reloading it
+        first if it was evicted. Does nothing for unregistered textures or
+        while the manager is disabled.
+    */
+    void notifyTextureUsed(const Texture& texture)
+    {
+        if (d_enabled)
+            markUsed(texture);
+    }
+
+    /*!
+    \brief
+        Evict textures while over budget, then advance to the next frame.
+        Called by System::renderAllGUIContexts.
+    */
+    void update();
+
+    //! Return whether \a texture is registered and currently evicted.
+    bool isEvicted(const Texture& texture) const;
+
+    //! Return the last frame \a texture was used in, 0 if it never was.
+    std::uint64_t getLastUsedFrame(const Texture& texture) const;
+
+    //! Return the current frame number.
+    std::uint64_t getFrame() const { return d_frame; }
+
+    /*!
+    \brief
+        Return whether \a bytes more of resident textures fit in the budget.
+        Always true while the manager is disabled.
+    */
+    bool canAccommodate(std::size_t bytes) const;
+
+    //! Return the estimated memory used by all resident textures, in bytes.
+    std::size_t getResidentBytes() const;
+
+    //! Return the statistics of \a category.
+    CategoryStatistics getStatistics(Category category) const;
+
+    //! Set the eviction and reload counts of all categories to 0.
+    void resetStatistics();
+
+    //! Return the estimated memory used by \a texture, in bytes.
+    static std::size_t estimateTextureBytes(const Texture& texture);
+
+private:
+    struct Entry
+    {
+        Texture* d_texture = nullptr;
+        Category d_category = Category::User;
+        //! estimated size when last seen resident.
+        std::size_t d_bytes = 0;
+        std::uint64_t d_lastUsedFrame = 0;
+        bool d_evicted = false;
+        Evictor* d_evictor = nullptr;
+        String d_filename;
+        String d_resourceGroup;
+    };
+
+    struct Counters
+    {
+        std::size_t d_evictionCount = 0;
+        std::size_t d_reloadCount = 0;
+    };
+
+    typedef std::unordered_map<const Texture*, Entry> EntryMap;
+
+    Entry& getEntry(const Texture& texture);
+    void markUsed(const Texture& texture);
+    void reload(Entry& entry);
+    bool evict(Entry& entry);
+    void enforceBudget();
+
+    EntryMap d_entries;
+    Counters d_counters[static_cast<int>(Category::Count)];
+
+    std::uint64_t d_frame = 1;
+    std::size_t d_budget = 64 * 1024 * 1024;
+    bool d_enabled = false;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUITextureResidencyManager_h_
@@ -180,6 +180,8 @@ public:
     static const String AutoWindowPropertyName;
     //! Name of property to access the DrawMode that is set for this Window, which decides in what draw call it will or will not be drawn.
     static const String DrawModeMaskPropertyName;
+    //! Name of property to access the area of the Window that is covered by opaque pixels.
+    static const String OpaqueAreaPropertyName;
 
     /*************************************************************************
         Event name constants
@@ -1329,6 +1331,15 @@ public:
     */
     bool isUsingAutoRenderingSurface() const { return d_autoRenderingWindow; }
 
+    /*!
+    \brief
+        Returns whether the GUIContext's RenderCachePolicy is caching this
+        window through an automatically created RenderingWindow.
+
+    \see setUsingRenderCacheSurface
+    */
+    bool isUsingRenderCacheSurface() const { return d_renderCacheWindow; }
+
     /*!
     \brief
         Returns whether the Window's texture caching (if enabled) will have a stencil buffer
@@ -2318,6 +2329,22 @@ public:
     */
     void setUsingAutoRenderingSurface(bool setting);
 
+    /*!
+    \brief
+        Sets whether the Window renders through an automatically created
+        RenderingWindow on behalf of the GUIContext's RenderCachePolicy.
+
+        This is kept apart from setUsingAutoRenderingSurface so that the policy
+        never changes the application's setting: the surface exists while
+        either of them is enabled, and disabling one leaves a surface the other
+        still needs. Assigning a different RenderingSurface disables both.
+
+    \param setting
+        - true to render through the automatic RenderingWindow for the policy.
+        - false to release the policy's claim on the automatic RenderingWindow.
+    */
+    void setUsingRenderCacheSurface(bool setting);
+
     /*!
     \brief
         Sets whether the Window's texture caching (if activated) will have a stencil buffer
@@ -2553,6 +2580,46 @@ public:
         return (getDrawModeMask() & drawModeMask) != 0;
     }
 
+    /*!
+    \brief
+        Set the area of the window that is covered by opaque pixels, relative
+        to the outer area of the window. When occlusion culling is enabled in
+        the GUIContext (see OcclusionCuller), windows hidden behind this area
+        are not drawn. An empty area, the default, declares nothing.
+    */
+    void setOpaqueArea(const URect& area);
+
+    //! Return the area declared by setOpaqueArea.
+    const URect& getOpaqueArea() const { return d_opaqueArea; }
+
+    /*!
+    \brief
+        Record that imagery drawn while building the geometry of the window
+        covers \a area with opaque pixels. The area is in pixels, relative to
+        the outer area of the window. Called by Falagard StateImagery declared
+        as opaque; the record is reset whenever the geometry is rebuilt.
+    */
+    void addOpaqueImageryArea(const Rectf& area);
+
+    /*!
+    \brief
+        Return the largest rectangle, in screen pixels, that the window is
+        known to cover with opaque pixels. This is either the declared opaque
+        area or an area recorded by its imagery; the latter is ignored while
+        the geometry is waiting to be rebuilt. The rectangle is empty when
+        nothing is known to be opaque, or when the effective alpha of the
+        window is below 1. It is not clipped.
+    */
+    Rectf getOpaqueRect() const;
+
+    /*!
+    \brief
+        Return whether the OcclusionCuller of the GUIContext found the window
+        to be hidden behind opaque windows the last time the context was drawn.
+        Occluded windows do not submit their geometry.
+    */
+    bool isOccluded() const { return d_occluded; }
+
     Sizef getContentSize() const override;
     UDim getWidthOfAreaReservedForContentLowerBoundAsFuncOfElementWidth() const override;
     UDim getHeightOfAreaReservedForContentLowerBoundAsFuncOfElementHeight() const override;
@@ -2586,6 +2653,7 @@ protected:
     // friend classes for construction / initialisation purposes (for now)
     friend class WindowManager; // FIXME for d_falagardType only
     friend class GUIContext;
+    friend class OcclusionCuller;
 
     /*************************************************************************
         Event trigger methods
@@ -3112,6 +3180,9 @@ protected:
     //! helper to clean up the auto RenderingWindow surface
     void releaseRenderingWindow();
 
+    //! returns whether the application or the RenderCachePolicy wants an auto RenderingWindow
+    bool hasAutoRenderingWindow() const { return d_autoRenderingWindow || d_renderCacheWindow; }
+
     //! \brief Cleanup child windows
     virtual void cleanupChildren();
 
@@ -3271,6 +3342,10 @@ protected:
     //! Margin, only used when the Window is inside LayoutContainer class
     //!!!FIXME: move to LC? Too much memory wasted.
     UBox d_margin = UBox(UDim(0, 0));
+    //! Area declared to be covered by opaque pixels, relative to the outer area.
+    URect d_opaqueArea = URect(UDim(0, 0), UDim(0, 0), UDim(0, 0), UDim(0, 0));
+    //! Largest opaque area recorded by imagery, in pixels relative to the outer area.
+    Rectf d_opaqueImageryArea = Rectf(0.f, 0.f, 0.f, 0.f);
     /*!
         Contains the draw mode mask, for this window, specifying
         a the bit flags that determine if the Window will be drawn or not
@@ -3330,6 +3405,8 @@ protected:
     bool d_needsRedraw : 1;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow : 1;
+    //! holds whether the RenderCachePolicy uses the automatic surface (RenderingWindow)
+    bool d_renderCacheWindow : 1;
     //! holds setting for stencil buffer usage in texture caching
     bool d_autoRenderingSurfaceStencilEnabled : 1;
     //! true if the Window inherits alpha from the parent Window
@@ -3369,6 +3446,9 @@ protected:
     mutable bool d_innerRectClipperValid : 1;
     mutable bool d_hitTestRectValid : 1;
 
+    //! true if the OcclusionCuller found the window hidden behind opaque windows.
+    bool d_occluded : 1;
+
 private:
 
     // For properties
@@ -30,6 +30,12 @@
 #include "CEGUI/WindowRendererSets/Core/Module.h"
 #include "CEGUI/widgets/MultiColumnList.h"
 #include "CEGUI/falagard/WidgetLookFeel.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -90,8 +96,15 @@ namespace CEGUI
 
         Rectf getListRenderArea(void) const override;
         void createRenderGeometry() override;
+
+    protected:
+        //! left edge of each column plus the right edge of the last one, reused between renders.
+        std::vector<float> d_columnOffsets;
     };
 } // End of  CEGUI namespace section
 
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
 
 #endif  // end of guard _FalMultiColumnList_h_
@@ -28,7 +28,7 @@
 #define _CEGUIXMLAttributes_h_
 
 #include "CEGUI/String.h"
-#include <unordered_map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -40,10 +40,25 @@ namespace CEGUI
     /*!
     \brief
         Class representing a block of attributes associated with an XML element.
+
+        Parser modules fill the block with addView, which only records pointers
+        to the UTF-8 strings held in the parser's own buffers. Those strings are
+        converted to String the first time they are requested through getName
+        or getValue; the typed getters (getValueAsBool, getValueAsInteger and
+        getValueAsFloat) and name lookups work on the UTF-8 data directly and
+        never create a String.
+
+        Copying an XMLAttributes block yields a block that owns all of its
+        strings, so a copy may safely outlive the parser callback it was made in.
      */
     class CEGUIEXPORT XMLAttributes final
     {
     public:
+        XMLAttributes() = default;
+        XMLAttributes(const XMLAttributes& other);
+        XMLAttributes& operator=(const XMLAttributes& other);
+        XMLAttributes(XMLAttributes&&) = default;
+        XMLAttributes& operator=(XMLAttributes&&) = default;
 
         /*!
         \brief
@@ -60,6 +75,28 @@ namespace CEGUI
             Nothing.
          */
         void add(const String& attrName, const String& attrValue);
+
+        /*!
+        \brief
+            Adds an attribute to the attribute block without copying its name
+            or value.  If the attribute value already exists, it is replaced
+            with the new value.
+
+            This is intended for XMLParser implementations.  The strings are
+            not copied, so they must stay valid and unchanged for as long as
+            the attribute block is used - usually until the
+            XMLHandler::elementStart call it was built for returns.
+
+        \param attrName
+            Null terminated UTF-8 string holding the name of the attribute.
+
+        \param attrValue
+            Null terminated UTF-8 string holding the value of the attribute.
+         */
+        void addView(const char* attrName, const char* attrValue);
+
+        //! Removes all attributes from the attribute block.
+        void clear();
         
         /*!
         \brief
@@ -100,8 +137,8 @@ namespace CEGUI
             Return the name of an attribute based upon its index within the attribute block.
 
         \note
-            Nothing is specified about the order of elements within the attribute block.  Elements
-            may not, for example, appear in the order they were specified in the XML file.
+            Attributes are kept in the order they were added, which for blocks built by a parser
+            module is normally the order they were specified in the XML file.
 
         \param index
             zero based index of the attribute whos name is to be returned.
@@ -118,8 +155,8 @@ namespace CEGUI
             Return the value string of an attribute based upon its index within the attribute block.
 
         \note
-            Nothing is specified about the order of elements within the attribute block.  Elements
-            may not, for example, appear in the order they were specified in the XML file.
+            Attributes are kept in the order they were added, which for blocks built by a parser
+            module is normally the order they were specified in the XML file.
         
         \param index
             zero based index of the attribute whos value string is to be returned.
@@ -220,8 +257,41 @@ namespace CEGUI
         float getValueAsFloat(const String& attrName, float def = 0.0f) const;
 
     protected:
+        /*!
+        \brief
+            A single attribute. While d_rawName is set the attribute refers
+            to strings owned by the parser and d_name / d_value are only
+            caches, filled on first use.
+        */
+        struct Attribute
+        {
+            const char* d_rawName;
+            const char* d_rawValue;
+            mutable String d_name;
+            mutable String d_value;
+            mutable bool d_nameConverted;
+            mutable bool d_valueConverted;
+        };
+
+        //! Return the attribute named \a attrName or nullptr if there is none.
+        const Attribute* find(const String& attrName) const;
+        Attribute* find(const String& attrName);
+        //! Return the attribute named by the UTF-8 string \a attrName, or nullptr.
+        Attribute* findRaw(const char* attrName);
+
+        const String& getNameString(const Attribute& attr) const;
+        const String& getValueString(const Attribute& attr) const;
+
+        /*!
+        \brief
+            Return the attribute's value as a null terminated UTF-8 string.
+            \a buffer is used to hold the conversion of values that are not
+            already UTF-8.
+        */
+        static const char* getValueUtf8(const Attribute& attr, std::string& buffer);
 
-        std::unordered_map<String, String> d_attrs;
+        //! Attributes in the order they were added.
+        std::vector<Attribute> d_attrs;
     };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,171 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Flat, precompiled form of a Falagard dimension tree
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFalDimensionProgram_h_
+#define _CEGUIFalDimensionProgram_h_
+
+#include "./Enums.h"
+#include "../UDim.h"
+#include "../Rectf.h"
+#include "../String.h"
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class BaseDim;
+class OperatorDim;
+class PropertyDim;
+class Property;
+class Window;
+template<typename T> class TypedProperty;
+template<typename T> class PropertyDefinition;
+
+/*!
+\brief
+    A BaseDim tree compiled into a flat list of stack machine instructions.
+
+    Operands are emitted in post order, so evaluating the program is a single
+    loop over an array with a small fixed size value stack and does not
+    allocate. While compiling:
+        - operators whose operands are both constant are folded, as are
+          AbsoluteDim values and UnifiedDim values without a scale component.
+        - UnifiedDim and OperatorDim nodes become inline instructions rather
+          than virtual calls.
+        - PropertyDim nodes get an accessor that remembers the Property it
+          resolved last, so the dynamic_cast to the typed property is done
+          once, and values of Falagard property definitions are only parsed
+          again when the underlying string changes.
+    Any other BaseDim (including user defined subclasses) is evaluated by
+    calling its getValue from the program.
+
+    The program refers to the BaseDim objects it was compiled from, so it must
+    be recompiled (or cleared) whenever that tree changes or is destroyed.
+    Dimension takes care of this for the trees it owns.
+*/
+class CEGUIEXPORT DimensionProgram
+{
+public:
+    DimensionProgram();
+    ~DimensionProgram();
+
+    DimensionProgram(const DimensionProgram&) = delete;
+    DimensionProgram& operator=(const DimensionProgram&) = delete;
+
+    //! Replace the program with the compiled form of \a dim (may be 0).
+    void compile(const BaseDim* dim);
+
+    //! Remove all instructions.
+    void clear();
+
+    //! Return whether the program contains no instructions.
+    bool isEmpty() const { return d_code.empty(); }
+
+    //! Return whether the whole tree was folded into a single constant.
+    bool isConstant() const;
+
+    //! Return the number of instructions in the program.
+    std::size_t getInstructionCount() const { return d_code.size(); }
+
+    //! Evaluate the program; equivalent to BaseDim::getValue(wnd).
+    float evaluate(const Window& wnd) const;
+
+    //! Evaluate the program; equivalent to BaseDim::getValue(wnd, container).
+    float evaluate(const Window& wnd, const Rectf& container) const;
+
+    //! Deepest operator nesting supported before falling back to the tree.
+    static const std::size_t MaxStackDepth = 32;
+
+private:
+    enum class OpCode : std::uint8_t
+    {
+        Constant,
+        UnifiedWidth,
+        UnifiedHeight,
+        PropertyUDimWidth,
+        PropertyUDimHeight,
+        PropertyScalar,
+        Call,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Max,
+        Min
+    };
+
+    struct Instruction
+    {
+        OpCode d_op;
+        //! index into d_properties or d_calls, depending on d_op.
+        std::uint32_t d_index;
+        //! constant value, or the UDim of a UnifiedDim.
+        UDim d_value;
+    };
+
+    //! Cached resolution of the property read by a PropertyDim.
+    struct PropertyAccessor
+    {
+        const PropertyDim* d_dim;
+        //! Property instance resolved by the previous evaluation.
+        mutable const Property* d_property;
+        mutable const TypedProperty<UDim>* d_udimProperty;
+        mutable const PropertyDefinition<UDim>* d_udimDefinition;
+        mutable bool d_isBool;
+        //! last string parsed for d_udimDefinition and its value.
+        mutable String d_lastString;
+        mutable UDim d_lastValue;
+        mutable bool d_hasLastValue;
+    };
+
+    std::size_t compileNode(const BaseDim* dim);
+    void compileOperator(const OperatorDim& dim);
+    void emitConstant(float value);
+    void emitCall(const BaseDim* dim);
+
+    float run(const Window& wnd, const Rectf* container) const;
+    float readProperty(const Window& wnd, const PropertyAccessor& accessor,
+                       OpCode op) const;
+
+    std::vector<Instruction> d_code;
+    std::vector<PropertyAccessor> d_properties;
+    std::vector<const BaseDim*> d_calls;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUIFalDimensionProgram_h_
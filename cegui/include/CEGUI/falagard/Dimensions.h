@@ -28,8 +28,10 @@
 #define _CEGUIFalDimensions_h_
 
 #include "./Enums.h"
+#include "./DimensionProgram.h"
 #include "../UDim.h"
 #include "../Rectf.h"
+#include "../ImageHandle.h"
 
 namespace CEGUI
 {
@@ -325,8 +327,8 @@ protected:
     void writeXMLElementName_impl(XMLSerializer& xml_stream) const override;
     void writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const override;
 
-    //! name of the Image.
-    String d_imageName;
+    //! the Image, referenced by name.
+    ImageReference d_image;
 };
 
 //! ImageDimBase subclass that accesses an image fetched via a property.
@@ -366,6 +368,8 @@ protected:
 
     //! name of the property from which to fetch the image name.
     String d_propertyName;
+    //! caches the image last fetched via the property.
+    mutable ImageReference d_propertyImage;
 };
 
 /*!
@@ -751,6 +755,11 @@ private:
     The key thing to understand about Dimension is that it contains not just a
     dimensional value, but also a record of what the dimension value is supposed
     to represent. (e.g. a co-ordinate on the x axis, or the height of something).
+
+    The BaseDim tree is compiled into a DimensionProgram whenever it is set, and
+    getValue evaluates that program. Modifying the tree in place (for example
+    through OperatorDim::getLeftOperand) requires calling setBaseDimension again
+    for the change to take effect.
 */
 class CEGUIEXPORT Dimension
 {
@@ -791,6 +800,24 @@ public:
     */
     void setBaseDimension(const BaseDim& dim);
 
+    /*!
+    \brief
+        Return the value of this Dimension for \a wnd; gives the same result as
+        getBaseDimension().getValue(wnd), but uses the compiled program.
+    */
+    float getValue(const Window& wnd) const;
+
+    /*!
+    \brief
+        Return the value of this Dimension for \a wnd within \a container;
+        gives the same result as getBaseDimension().getValue(wnd, container),
+        but uses the compiled program.
+    */
+    float getValue(const Window& wnd, const Rectf& container) const;
+
+    //! Return the compiled form of the BaseDim tree of this Dimension.
+    const DimensionProgram& getProgram() const { return d_program; }
+
     /*!
     \brief
         Return a DimensionType value indicating what this Dimension represents.
@@ -827,6 +854,8 @@ private:
     BaseDim* d_value;
     //! What we represent.
     DimensionType d_type;
+    //! d_value compiled for evaluation.
+    DimensionProgram d_program;
 };
 
 /*!
@@ -30,6 +30,7 @@
 #include "CEGUI/falagard/ComponentBase.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/falagard/FormattingSetting.h"
+#include "CEGUI/ImageHandle.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -367,6 +368,7 @@ protected:
         {
             return d_specified == rhs.d_specified &&
                    d_image == rhs.d_image &&
+                   d_imageReference == rhs.d_imageReference &&
                    d_propertyName == rhs.d_propertyName;
         }
 
@@ -375,9 +377,20 @@ protected:
             return !operator==(rhs);
         }
         
+        //! Return the image when it is not fetched from a property.
+        const Image* getImage() const
+        {
+            return d_imageReference.getName().empty() ?
+                d_image : d_imageReference.get();
+        }
+
         bool d_specified;
         const Image* d_image;
+        //! Image specified by name; resolved through a cached handle.
+        ImageReference d_imageReference;
         String d_propertyName;
+        //! Caches the image last obtained from the property.
+        mutable ImageReference d_propertyImage;
     };
 
     void addImageRenderGeometryToWindow_impl(
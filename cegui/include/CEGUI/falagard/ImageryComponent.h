@@ -30,6 +30,7 @@
 #include "./ComponentBase.h"
 #include "../XMLSerializer.h"
 #include "CEGUI/falagard/FormattingSetting.h"
+#include "CEGUI/ImageHandle.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -230,6 +231,10 @@ namespace CEGUI
             const Rectf* clipper) const override;
 
         const Image*         d_image;           //!< CEGUI::Image to be drawn by this image component.
+        //! Image to be drawn when it was specified by name; resolved as needed.
+        ImageReference d_imageReference;
+        //! Caches the image last obtained from the image property.
+        mutable ImageReference d_propertyImage;
         //! Vertical formatting to be applied when rendering the image component.
         FormattingSetting<VerticalImageFormatting> d_vertFormatting;
         //! Horizontal formatting to be applied when rendering the image component.
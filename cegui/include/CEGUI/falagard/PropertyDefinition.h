@@ -66,6 +66,13 @@ public:
         return new PropertyDefinition<T>(*this);
     }
 
+    //------------------------------------------------------------------------//
+    //! Return the name of the Window user string holding the property value.
+    const String& getUserStringName() const
+    {
+        return d_userStringName;
+    }
+
 protected:
     //------------------------------------------------------------------------//
     typename Helper::safe_method_return_type
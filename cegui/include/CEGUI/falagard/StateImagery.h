@@ -59,7 +59,8 @@ class LayerSpecification;
             Constructor
         */
         StateImagery():
-        	d_clipToDisplay(false)
+        	d_clipToDisplay(false),
+            d_opaque(false)
         {}
 
         /*!
@@ -157,6 +158,25 @@ class LayerSpecification;
         */
         void setClippedToDisplay(bool setting);
 
+        /*!
+        \brief
+            Return whether the imagery for this state covers the whole area of
+            the window with opaque pixels.
+
+            Rendering an opaque StateImagery lets the window occlude windows
+            behind it, see OcclusionCuller.
+        */
+        bool isOpaque() const;
+
+        /*!
+        \brief
+            Set whether the imagery for this state covers the whole area of the
+            window with opaque pixels. This is not verified; declaring imagery
+            with transparent parts as opaque makes windows behind it disappear
+            when occlusion culling is enabled.
+        */
+        void setOpaque(bool setting);
+
         /*!
         \brief
             Writes an xml representation of this StateImagery to \a out_stream.
@@ -191,9 +211,13 @@ class LayerSpecification;
         LayerSpecificationPointerList getLayerSpecificationPointers();
 
     private:
+        //! return whether the modulating colours leave opaque imagery opaque.
+        static bool isOpaqueColours(const ColourRect* modcols);
+
         CEGUI::String               d_stateName;    //!< Name of this state.
         LayerSpecificationList      d_layers;       //!< Collection of LayerSpecification objects to be drawn for this state.
         bool                        d_clipToDisplay; //!< true if Imagery for this state should be clipped to the display instead of winodw (effectively, not clipped).
+        bool                        d_opaque;       //!< true if Imagery for this state covers the window area with opaque pixels.
     };
 
 } // End of  CEGUI namespace section
@@ -167,6 +167,7 @@ namespace CEGUI
         static const String FontAttribute;              //!< Attribute name that stores the name of a font.
         static const String InitialValueAttribute;      //!< Attribute name that stores the initial default value for a property definition.
         static const String ClippedAttribute;           //!< Attribute name that stores whether some component will be clipped.
+        static const String OpaqueAttribute;            //!< Attribute name that stores whether some imagery is opaque.
         static const String OperatorAttribute;          //!< Attribute name that stores the name of an operator.
         static const String PaddingAttribute;           //!< Attribute name that stores some padding value..
         static const String LayoutOnWriteAttribute;     //!< Attribute name that stores whether to layout on write of a property.
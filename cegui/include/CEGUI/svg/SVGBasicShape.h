@@ -288,6 +288,86 @@ public:
     std::vector<glm::vec2> d_points;
 };
 
+
+/*!
+\brief
+    Defines a class for storing the data of the SVG 'path' element based on how it is defined in the SVG standard.
+
+    The 'path' element defines the outline of a shape using straight lines, quadratic and cubic Bézier curves
+    and elliptical arcs. A path may consist of several subpaths, each started by a 'moveto' command.
+    The commands are stored in absolute coordinates, relative commands and the shorthand forms of the
+    SVG path syntax (horizontal and vertical lines, smooth curves) are resolved when the path data is parsed.
+    http://www.w3.org/TR/SVG11/paths.html#PathElement
+*/
+class CEGUIEXPORT SVGPath : public SVGBasicShape
+{
+public:
+    //! Enumerator describing the types of the commands a path consists of
+    enum class CommandType : int
+    {
+        //! Starts a new subpath at d_point
+        MoveTo,
+        //! Draws a straight line to d_point
+        LineTo,
+        //! Draws a quadratic Bézier curve to d_point, using d_control1 as control point
+        QuadraticTo,
+        //! Draws a cubic Bézier curve to d_point, using d_control1 and d_control2 as control points
+        CubicTo,
+        //! Draws an elliptical arc to d_point
+        ArcTo,
+        //! Closes the current subpath by drawing a straight line back to its start
+        ClosePath,
+
+        Count
+    };
+
+    //! A single command of the path, in absolute coordinates
+    struct Command
+    {
+        Command()
+            : d_type(CommandType::MoveTo)
+            , d_point(0.f)
+            , d_control1(0.f)
+            , d_control2(0.f)
+            , d_radii(0.f)
+            , d_xAxisRotation(0.f)
+            , d_largeArc(false)
+            , d_sweep(false)
+        {}
+
+        CommandType d_type;
+        //! The end point of the command. Not used by ClosePath.
+        glm::vec2 d_point;
+        //! The first control point of a Bézier curve
+        glm::vec2 d_control1;
+        //! The second control point of a cubic Bézier curve
+        glm::vec2 d_control2;
+        //! The radii of the ellipse of an arc
+        glm::vec2 d_radii;
+        //! The rotation of the x-axis of the ellipse of an arc, in degrees
+        float d_xAxisRotation;
+        //! Whether the arc spans more than 180 degrees
+        bool d_largeArc;
+        //! Whether the arc is drawn in the direction of increasing angles
+        bool d_sweep;
+    };
+
+    //! Constructor
+    SVGPath(const SVGPaintStyle& paint_style,
+            const glm::mat3x3& transformation,
+            const std::vector<Command>& commands);
+
+    SVGPath()
+    {}
+
+    //! Implementation of SVGBasicShape interface
+    void createRenderGeometry(std::vector<GeometryBuffer*>& out,
+        const SVGImage::SVGImageRenderSettings& render_settings) const override;
+
+    //! The commands defining the path
+    std::vector<Command> d_commands;
+};
+
 }
 
 #if defined(_MSC_VER)
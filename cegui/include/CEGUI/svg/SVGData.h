@@ -31,8 +31,10 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
+#include "CEGUI/svg/SVGBasicShape.h"
 
 #include <vector>
+#include <cstdint>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -42,7 +44,6 @@
 
 namespace CEGUI
 {
-class SVGBasicShape;
 
 /*!
 \brief
@@ -142,6 +143,22 @@ public:
     */
     const std::vector<SVGBasicShape*>& getShapes() const;
 
+    /*!
+    \brief
+        Notifies the SVGData that shapes in its list were modified directly.
+        SVGImages cache the geometry created from the shapes and only update it
+        when this or one of the functions changing the list is called.
+    */
+    void notifyShapesChanged();
+
+    /*!
+    \brief
+        Returns a number identifying the current content of the shape list. It
+        changes whenever the list changes and is never repeated, not even by
+        other SVGData objects.
+    */
+    std::uint64_t getRevision() const { return d_revision; }
+
     /*!
     \brief
         Returns the SVGData's width in pixels.
@@ -245,6 +262,15 @@ protected:
     */
     void elementSVGPolygon(const XMLAttributes& attributes);
 
+    /*!
+    \brief
+        Function that handles opening SVG 'path' elements.
+
+    \note
+        This function processes the SVG 'path' element.
+    */
+    void elementSVGPath(const XMLAttributes& attributes);
+
     //! Name of this SVGData objects
     CEGUI::String d_name;
     /*!
@@ -268,6 +294,8 @@ protected:
 
     //! The basic shapes that were added to the SVGData
     std::vector<SVGBasicShape*> d_svgBasicShapes;
+    //! Identifies the current content of d_svgBasicShapes, see getRevision.
+    std::uint64_t d_revision;
 
 private:
     /*!
@@ -328,6 +356,15 @@ private:
     //! Parses the String value of a 'points' property 
     static void parsePointsString(const String &pointsString, std::vector<glm::vec2>& points);
 
+    /*!
+    \brief
+        Function that parses the path data of a 'path' element ('d' attribute) into a list of
+        absolute path commands.
+
+    \exception SVGParsingException          thrown if the path data is invalid.
+    */
+    static void parsePathData(const String& pathDataString, std::vector<SVGPath::Command>& commands);
+
     /*!
     \brief
         Function that parses a 'transform' attribute and creates a mat3x3 from it.
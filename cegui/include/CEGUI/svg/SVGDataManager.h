@@ -43,6 +43,7 @@
 namespace CEGUI
 {
 class SVGData;
+class SVGRasterCache;
 
 class CEGUIEXPORT SVGDataManager :
         public Singleton<SVGDataManager>
@@ -141,6 +142,12 @@ public:
     */
     bool isSVGDataDefined(const String& name) const;
 
+    /*!
+    \brief
+        Returns the cache holding the rasterised versions of SVGImages that
+        use it (see SVGImage::setUseRasterCache).
+    */
+    SVGRasterCache& getRasterCache() const { return *d_rasterCache; }
 
     //! container type used to hold the SVGData objects.
     typedef std::map<String, SVGData*> SVGDataMap;
@@ -163,6 +170,8 @@ protected:
 
     //! container holding the SVGData objects.
     SVGDataMap d_svgDataMap;
+    //! cache holding rasterised SVGImages.
+    SVGRasterCache* d_rasterCache;
 };
   
 
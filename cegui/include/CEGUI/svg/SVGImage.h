@@ -30,10 +30,17 @@
 #include "CEGUI/Image.h"
 
 #include <glm/glm.hpp>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
 
 namespace CEGUI
 {
 class SVGData;
+enum class PolygonFillRule : uint8_t;
 
 /*!
 \brief
@@ -69,6 +76,7 @@ public:
     SVGImage(const String& name);
     SVGImage(const String& name, SVGData& svg_data);
     SVGImage(const XMLAttributes& attributes);
+    ~SVGImage() override;
 
     void createRenderGeometry(std::vector<GeometryBuffer*>& out, const ImageRenderSettings& renderSettings, size_t canCombineFromIdx) const override;
 
@@ -106,7 +114,90 @@ public:
     */
     void setUseGeometryAntialiasing(bool use_geometry_antialiasing);
 
+    /*!
+    \brief
+        Returns if this Image is drawn from a rasterised version held by the
+        SVGRasterCache instead of as geometry.
+    */
+    bool getUsesRasterCache() const;
+
+    /*!
+    \brief
+        Sets if this Image is drawn from a rasterised version held by the
+        SVGRasterCache of the SVGDataManager instead of as geometry.
+
+        The image is rasterised for every scale level it is drawn with (see
+        SVGRasterCache) and then drawn as a single textured quad. This is
+        much cheaper to draw for complex images, at the cost of texture
+        memory and of some sharpness. If the image can't be rasterised, for
+        example because the renderer does not support TextureTargets or the
+        memory budget of the cache is used up, it is drawn as geometry.
+    \param use_raster_cache
+        The setting for the raster cache that will be applied to this Image.
+    */
+    void setUseRasterCache(bool use_raster_cache);
+
+    /*!
+    \brief
+        Discards the geometry cached for this SVGImage. This happens
+        automatically when the SVGData or its shapes change.
+    */
+    void clearGeometryCache() const;
+
+    //! Returns the number of different geometries cached for this SVGImage.
+    size_t getGeometryCacheEntryCount() const { return d_geometryCache.size(); }
+
+    /*!
+    \brief
+        Sets the memory, in bytes, that the geometry caches of all SVGImages
+        may use together. Setting 0 disables caching.
+
+        The tessellated geometry of an SVGImage is cached for every scale and
+        anti-aliasing setting it is drawn with, so redrawing it, at any
+        position, only copies the vertices into new GeometryBuffers. When the
+        budget is exceeded the least recently used geometry of any SVGImage is
+        discarded, which also happens right away when the budget is lowered.
+    */
+    static void setGeometryCacheBudget(size_t bytes);
+    static size_t getGeometryCacheBudget();
+
+    //! Returns the memory, in bytes, used by the geometry caches of all SVGImages.
+    static size_t getGeometryCacheMemoryUsage();
+
 protected:
+    friend class SVGRasterCache;
+
+    //! Geometry for one GeometryBuffer, with the shape transformations applied.
+    struct CachedBatch
+    {
+        std::vector<float> d_vertices;
+        PolygonFillRule d_fillRule;
+        unsigned int d_postStencilVertexCount;
+    };
+
+    //! Tessellated geometry of all shapes for one scale and anti-aliasing setting.
+    struct CachedGeometry
+    {
+        glm::vec2 d_scaleFactor;
+        bool d_antiAliasing;
+        std::vector<CachedBatch> d_batches;
+        size_t d_bytes;
+        std::uint64_t d_lastUse;
+    };
+
+    //! Tessellates all shapes and merges the results into as few batches as possible.
+    void tessellate(CachedGeometry& geometry,
+                    const SVGImageRenderSettings& svgSettings) const;
+    //! Returns the cached geometry for the settings, tessellating it if needed.
+    const CachedGeometry& getCachedGeometry(const SVGImageRenderSettings& svgSettings) const;
+    //! Removes the least recently used cache entry of all SVGImages.
+    static void evictGeometryCacheEntry();
+    //! Creates GeometryBuffers holding the shapes, using the cached geometry.
+    void createShapeGeometry(std::vector<GeometryBuffer*>& out,
+                             const SVGImageRenderSettings& svgSettings) const;
+    //! Releases the rasterised versions of this image held by the SVGRasterCache.
+    void releaseRasterCache() const;
+
     /*!
         \brief
         Reference to the SVGData used as basis for drawing. The SVGData can be shared
@@ -122,9 +213,23 @@ protected:
         an alpha-blended transition to defeat aliasing artefacts
     */
     bool d_useGeometryAntialiasing;
+
+    //! Determines if the image is drawn from the SVGRasterCache.
+    bool d_useRasterCache;
+
+    //! Geometry cached for the different scales the image was drawn with.
+    mutable std::vector<CachedGeometry> d_geometryCache;
+    //! Temporary entry used when the geometry does not fit the budget.
+    mutable CachedGeometry d_uncachedGeometry;
+    //! SVGData revision the cached geometry was created from.
+    mutable std::uint64_t d_cachedRevision;
 };
 
 }
 
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
 #endif
 
@@ -0,0 +1,214 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Atlas of rasterised SVGImages
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISVGRasterCache_h_
+#define _CEGUISVGRasterCache_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Rectf.h"
+
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class SVGImage;
+class BitmapImage;
+class TextureTarget;
+
+/*!
+\brief
+    Holds SVGImages rasterised into shared atlas textures, so they can be
+    drawn like a BitmapImage instead of as tessellated geometry.
+
+    The atlas is made of pages, each a TextureTarget into which the image
+    geometry is rendered. Images are placed with a shelf packer and get a one
+    pixel transparent gutter. An image is rasterised once for every size it
+    is needed at, rounded up to a scale level: a level is a step of
+    1 / levelsPerOctave octaves, so with 4 levels per octave the rasterised
+    image is at most ~19% larger than the displayed one and is only
+    rasterised again when the display scale crosses into another level. The
+    texture filtering covers the difference.
+
+    Rasterised images can't be moved or discarded while geometry of windows
+    may still refer to them. They are released when their SVGImage is
+    destroyed, stops using the cache or its SVGData changes, and the space of
+    a page is reused once all images on it were released. When the memory
+    budget does not allow another page, SVGImages are drawn as geometry.
+
+    The cache is owned by the SVGDataManager.
+*/
+class CEGUIEXPORT SVGRasterCache
+{
+public:
+    SVGRasterCache();
+    ~SVGRasterCache();
+
+    SVGRasterCache(const SVGRasterCache&) = delete;
+    SVGRasterCache& operator=(const SVGRasterCache&) = delete;
+
+    /*!
+    \brief
+        Return the rasterised version of \a image for the given display scale,
+        rasterising it if needed.
+
+        This switches the active RenderTarget of the Renderer and therefore
+        must not be called between the activation and deactivation of
+        another RenderTarget. Window geometry is created outside of those.
+
+    \param image
+        The SVGImage to return the rasterised version of.
+
+    \param scale
+        The scale from the image area to the area it is displayed in.
+
+    \return
+        The BitmapImage to draw instead of \a image, or nullptr if the image
+        could not be rasterised.
+    */
+    const BitmapImage* getRasterisedImage(const SVGImage& image, const glm::vec2& scale);
+
+    //! Release all rasterised versions of \a image.
+    void releaseImage(const SVGImage& image);
+
+    /*!
+    \brief
+        Release all rasterised images and the textures holding them, and
+        invalidate all cached rendering so that no window keeps using them.
+    */
+    void clear();
+
+    //! Set the maximum memory, in bytes, used by the atlas textures.
+    void setMemoryBudget(std::size_t bytes) { d_memoryBudget = bytes; }
+    std::size_t getMemoryBudget() const { return d_memoryBudget; }
+
+    //! Return the memory, in bytes, used by the atlas textures.
+    std::size_t getUsedMemory() const;
+
+    /*!
+    \brief
+        Set the size of the atlas textures created from now on. Images that
+        are larger than a page, including the gutter, are drawn as geometry.
+    */
+    void setPageSize(const Sizef& size) { d_pageSize = size; }
+    const Sizef& getPageSize() const { return d_pageSize; }
+
+    //! Set the number of scale levels per doubling of the display scale.
+    void setLevelsPerOctave(std::uint32_t levels) { d_levelsPerOctave = levels ? levels : 1; }
+    std::uint32_t getLevelsPerOctave() const { return d_levelsPerOctave; }
+
+    //! Return the number of atlas textures.
+    std::size_t getPageCount() const { return d_pages.size(); }
+
+    //! Return the number of rasterised images held, for all SVGImages.
+    std::size_t getEntryCount() const;
+
+    //! Return the number of rasterised images held for \a image.
+    std::size_t getEntryCount(const SVGImage& image) const;
+
+    //! Return how often an image was rasterised since the cache was created.
+    std::size_t getRasterisationCount() const { return d_rasterisationCount; }
+
+    //! Return the smallest scale level that is at least as large as \a scale.
+    static int getScaleLevel(float scale, std::uint32_t levelsPerOctave);
+
+    //! Return the scale images are rasterised with for the scale \a level.
+    static float getLevelScale(int level, std::uint32_t levelsPerOctave);
+
+    //! Width of the transparent gutter around each image, in pixels.
+    static const std::uint32_t ImageGutter = 1;
+
+private:
+    //! A horizontal strip of a page holding images of a similar height.
+    struct Shelf
+    {
+        std::uint32_t d_y;
+        std::uint32_t d_height;
+        std::uint32_t d_nextX;
+    };
+
+    struct Page
+    {
+        TextureTarget* d_target;
+        std::vector<Shelf> d_shelves;
+        //! y coordinate below the last shelf.
+        std::uint32_t d_shelfEnd;
+        //! number of images on the page that were not released yet.
+        std::size_t d_imageCount;
+        //! set when the content of the target must be cleared before use.
+        bool d_needsClear;
+    };
+
+    struct Entry
+    {
+        int d_levelX;
+        int d_levelY;
+        bool d_antiAliasing;
+        std::uint64_t d_revision;
+        std::size_t d_page;
+        BitmapImage* d_bitmap;
+    };
+
+    typedef std::unordered_map<const SVGImage*, std::vector<Entry>> EntryMap;
+
+    //! Find space for an image on the pages, creating a page if needed.
+    bool allocate(const Sizef& size, std::size_t& page, Rectf& area);
+    //! Find space for an image on \a page.
+    bool allocateOnPage(Page& page, std::uint32_t width, std::uint32_t height, Rectf& area);
+    //! Render the geometry of \a image into \a area of \a page.
+    void rasterise(const SVGImage& image, Page& page, const Rectf& area, bool antiAliasing);
+    //! Release the space of an entry and destroy its BitmapImage.
+    void releaseEntry(const Entry& entry);
+
+    std::vector<Page> d_pages;
+    EntryMap d_entries;
+
+    Sizef d_pageSize;
+    std::size_t d_memoryBudget = 16 * 1024 * 1024;
+    std::uint32_t d_levelsPerOctave = 4;
+
+    std::size_t d_rasterisationCount = 0;
+    //! used to give the BitmapImages unique names.
+    std::uint32_t d_imageCounter = 0;
+    //! set once the renderer failed to provide a TextureTarget.
+    bool d_texturesUnavailable = false;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
+#endif // end of guard _CEGUISVGRasterCache_h_
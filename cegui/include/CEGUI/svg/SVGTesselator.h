@@ -31,6 +31,7 @@
 #include "CEGUI/Vertex.h"
 #include "CEGUI/svg/SVGImage.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
+#include "CEGUI/svg/SVGBasicShape.h"
 
 #include <glm/glm.hpp>
 
@@ -45,6 +46,7 @@ class SVGEllipse;
 class SVGLine;
 class SVGPolyline;
 class SVGPolygon;
+class SVGPath;
 class SVGPaintStyle;
 /*!
 \brief
@@ -220,6 +222,87 @@ public:
         const SVGPolygon* polyline,
         const SVGImage::SVGImageRenderSettings& render_settings);
 
+    /*!
+    \brief
+        Tesselates an SVGPath and returns the created render geometry.
+
+        The curves of the path are flattened so that the resulting polylines
+        deviate from the curves by less than PathFlatteningTolerance pixels at
+        the scale the path is rendered at.
+
+    \param path
+            The SVGPath object that contains the data.
+    \param render_settings
+            The ImageRenderSettings for the geometry that will be created.
+
+    \return
+            Returns the tesselated render geometry for this shape.
+    */
+    static void tesselatePath(std::vector<GeometryBuffer*>& out,
+        const SVGPath* path,
+        const SVGImage::SVGImageRenderSettings& render_settings);
+
+    //! A subpath of an SVGPath, flattened into a polyline
+    struct FlattenedSubpath
+    {
+        FlattenedSubpath()
+            : d_closed(false)
+        {}
+
+        //! The points of the polyline. A closed subpath does not repeat its first point at the end.
+        std::vector<glm::vec2> d_points;
+        //! Whether the subpath was closed by a 'closepath' command
+        bool d_closed;
+    };
+
+    /*!
+    \brief
+        Flattens the curves of an SVGPath into polylines, one per subpath.
+
+    \param path
+            The SVGPath object that contains the data.
+    \param tolerance
+            The maximum distance, in the coordinate system of the path, between
+            the curves and the line segments replacing them.
+    \param subpaths
+            The list the flattened subpaths are appended to.
+    */
+    static void flattenPath(const SVGPath* path,
+                            const float tolerance,
+                            std::vector<FlattenedSubpath>& subpaths);
+
+    //! The maximum distance, in pixels, between a curve of a path and its tesselated form
+    static const float PathFlatteningTolerance;
+
+    //! The maximum number of line segments a single curve of a path is flattened into
+    static const unsigned int MaxPathCurveSegments;
+
+    /*!
+    \brief
+        Triangulates the area that the given fill rule fills inside a set of
+        closed contours, so that it can be drawn without using the stencil.
+
+        The contours can have any orientation and can be nested in any way,
+        for example to cut holes, but they must not intersect or touch each
+        other or themselves. Such contours are rejected and must be filled
+        using the stencil.
+
+    \param contours
+            The contours. The last point of each contour connects to its first point.
+    \param fill_rule
+            The rule that decides which areas are inside. PolygonFillRule::NoFilling
+            is treated like PolygonFillRule::NonZero.
+    \param triangles
+            The list the triangles are appended to, three points per triangle.
+
+    \return
+            Returns true if the contours were triangulated, false if they intersect
+            and nothing was appended.
+    */
+    static bool triangulateFill(const std::vector<std::vector<glm::vec2>>& contours,
+                                const PolygonFillRule fill_rule,
+                                std::vector<glm::vec2>& triangles);
+
 private:
     /*!
 	\brief
@@ -248,6 +331,51 @@ private:
                            const SVGImage::SVGImageRenderSettings& render_settings,
                            const glm::vec2& scale_factors);
 
+    //! Helper function that triangulates the fill of a shape, returns true if the fill needs the stencil instead
+    static bool createFillTriangles(const std::vector<std::vector<glm::vec2>>& contours,
+                                    const SVGPaintStyle& paint_style,
+                                    std::vector<glm::vec2>& triangles);
+
+    //! Helper function for adding fill geometry that was triangulated by createFillTriangles
+    static void addFillTriangles(const std::vector<glm::vec2>& triangles,
+                                 GeometryBuffer& geometry_buffer,
+                                 const SVGPaintStyle& paint_style);
+
+    //! Helper function for creating the fill of all subpaths of a path
+    static void createPathFill(const std::vector<FlattenedSubpath>& subpaths,
+                               GeometryBuffer& geometry_buffer,
+                               const SVGPaintStyle& paint_style);
+
+    //! Path flattening helper that appends a point to the last subpath, starting one if needed
+    static void addPathPoint(std::vector<FlattenedSubpath>& subpaths,
+                             const glm::vec2& point);
+
+    //! Path flattening helper that appends the points of a quadratic Bézier curve, excluding the start point
+    static void flattenQuadraticBezier(const glm::vec2& start_point,
+                                       const glm::vec2& control_point,
+                                       const glm::vec2& end_point,
+                                       const float tolerance,
+                                       std::vector<FlattenedSubpath>& subpaths);
+
+    //! Path flattening helper that appends the points of a cubic Bézier curve, excluding the start point
+    static void flattenCubicBezier(const glm::vec2& start_point,
+                                   const glm::vec2& control_point1,
+                                   const glm::vec2& control_point2,
+                                   const glm::vec2& end_point,
+                                   const float tolerance,
+                                   std::vector<FlattenedSubpath>& subpaths);
+
+    //! Path flattening helper that appends the points of an elliptical arc, excluding the start point
+    static void flattenArc(const glm::vec2& start_point,
+                           const SVGPath::Command& arc,
+                           const float tolerance,
+                           std::vector<FlattenedSubpath>& subpaths);
+
+    //! Returns the number of line segments needed to flatten a curve, based on the length of its second differences
+    static unsigned int calculateCurveSegmentCount(const float second_difference_length,
+                                                   const float degree_factor,
+                                                   const float tolerance);
+
     //! Helper function for creating a stroke based on a list of subsequent points forming the stroke
     static void createStroke(const std::vector<glm::vec2>& points,
                              GeometryBuffer& geometry_buffer,
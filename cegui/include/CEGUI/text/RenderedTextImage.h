@@ -27,6 +27,7 @@
 #pragma once
 #include "CEGUI/text/RenderedTextElement.h"
 #include "CEGUI/ColourRect.h"
+#include "CEGUI/ImageHandle.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -42,6 +43,8 @@ class CEGUIEXPORT RenderedTextImage : public RenderedTextElement
 public:
 
     RenderedTextImage(const Image* image) : d_image(image) {}
+    //! Construct an element drawing the image named \a imageName, resolved through a cached handle.
+    explicit RenderedTextImage(const String& imageName) : d_imageReference(imageName) {}
 
     virtual void setupGlyph(RenderedGlyph& glyph, uint32_t codePoint) const override;
     virtual Sizef updateMetrics(const Window* hostWindow) override;
@@ -58,9 +61,13 @@ public:
     void setSize(const Sizef& size, bool aspectLock = false);
     void setUseModulateColour(bool value) { d_useModColour = value; }
 
+    //! Return the image drawn by this element, or nullptr if it is not (or no longer) defined.
+    const Image* getImage() const { return d_image ? d_image : d_imageReference.get(); }
+
 protected:
 
     const Image* d_image = nullptr;
+    ImageReference d_imageReference; //!< Image specified by name, used when d_image is nullptr
     ColourRect d_colours = ColourRect(0xFFFFFFFF);
     Sizef d_size; //<! target size to render the image at (0.f means natural size at the dimension)
     Sizef d_effectiveSize; //!< An effective size after the last updateMetrics(const Window* hostWindow) call
@@ -27,6 +27,7 @@
 #ifndef _CEGUIAllViews_h_
 #define _CEGUIAllViews_h_
 
+#include "./ItemHeightIndex.h"
 #include "./ItemModel.h"
 #include "./ItemView.h"
 #include "./ListView.h"
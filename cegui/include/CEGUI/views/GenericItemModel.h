@@ -59,12 +59,12 @@ public:
     GenericItem(const String& text, const String& icon);
     virtual ~GenericItem();
 
-    String getText() const { return d_text; }
+    const String& getText() const { return d_text; }
     void setText(const String& val) { d_text = val; }
 
     virtual String getTooltipText() const { return {}; }
 
-    String getIcon() const { return d_icon; }
+    const String& getIcon() const { return d_icon; }
     void setIcon(const String& icon) { d_icon = icon; }
 
     GenericItem* getParent() const { return d_parent; }
@@ -242,6 +242,8 @@ public:
     bool isValidIndex(const ModelIndex& model_index) const override;
     ModelIndex makeIndex(size_t child, const ModelIndex& parent_index) override;
     bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const override;
+    //! Indices point to the items themselves, so they are stable.
+    ModelIndexStability getIndexStability() const override { return ModelIndexStability::Stable; }
     int compareIndices(const ModelIndex& index1, const ModelIndex& index2) const override;
     ModelIndex getParentIndex(const ModelIndex& model_index) const override;
     int getChildId(const ModelIndex& model_index) const override;
@@ -249,7 +251,25 @@ public:
     size_t getChildCount(const ModelIndex& model_index) const override;
     String getData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text) override;
 
+    /*!
+    \brief
+        Returns references to the text and icon name of the item instead of
+        copies of them.
+
+    \remark
+        Views fetch item data through this function. When a subclass overrides
+        getData to provide different data, the data returned by its getData is
+        used instead, so overriding getItemData as well is not required.
+    */
+    ItemData getItemData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text) override;
+
+    void getItemDataRange(const ModelIndex& parent_index, size_t start_id,
+        size_t count, ItemDataRole role, std::vector<ItemData>& data) override;
+
 protected:
+    //! Returns the data of the \a item for the \a role, see getItemData.
+    ItemData getItemDataForItem(GenericItem* item, ItemDataRole role) const;
+
     //! Deletes all children of the specified item, optionally invoking the
     //! EventChildren(WillBe)Removed event
     void deleteChildren(GenericItem* item, bool notify);
@@ -259,6 +279,8 @@ protected:
     ModelIndex makeValidIndex(size_t id, std::vector<T>& vector);
 
     GenericItem* d_root;
+    //! Set while getItemData checks whether getData was overridden.
+    bool d_probingGetData;
 };
 
 //----------------------------------------------------------------------------//
@@ -266,7 +288,8 @@ protected:
 //----------------------------------------------------------------------------//
 template <typename TGenericItem>
 GenericItemModel<TGenericItem>::GenericItemModel(TGenericItem* root) :
-d_root(root)
+d_root(root),
+d_probingGetData(false)
 {
     if (root == nullptr)
         throw InvalidRequestException("Root cannot be null");
@@ -395,6 +418,13 @@ String GenericItemModel<TGenericItem>::getData(const ModelIndex& model_index,
     if (!isValidIndex(model_index))
         return "";
 
+    // reached from getItemData, which will reference the data instead
+    if (d_probingGetData)
+    {
+        d_probingGetData = false;
+        return "";
+    }
+
     GenericItem* item = static_cast<GenericItem*>(model_index.d_modelData);
     if (role == ItemDataRole::Text) return item->getText();
     if (role == ItemDataRole::Icon) return item->getIcon();
@@ -403,6 +433,73 @@ String GenericItemModel<TGenericItem>::getData(const ModelIndex& model_index,
     return "";
 }
 
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+ItemData GenericItemModel<TGenericItem>::getItemData(const ModelIndex& model_index,
+    ItemDataRole role /*= TEXT*/)
+{
+    if (!isValidIndex(model_index))
+        return ItemData();
+
+    // A subclass may override getData. Our getData returns an empty string
+    // and clears d_probingGetData when it is reached while probing, so the
+    // item's data can be referenced when getData wasn't overridden or only
+    // forwards to ours.
+    d_probingGetData = true;
+    String data;
+    try
+    {
+        data = getData(model_index, role);
+    }
+    catch (...)
+    {
+        d_probingGetData = false;
+        throw;
+    }
+
+    // our getData wasn't called, the override provided all of the data.
+    if (d_probingGetData)
+    {
+        d_probingGetData = false;
+        return ItemData(data);
+    }
+
+    // the override changed what our getData returned, ask it again.
+    if (!data.empty())
+        return ItemData(getData(model_index, role));
+
+    return getItemDataForItem(static_cast<GenericItem*>(model_index.d_modelData), role);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+void GenericItemModel<TGenericItem>::getItemDataRange(const ModelIndex& parent_index,
+    size_t start_id, size_t count, ItemDataRole role, std::vector<ItemData>& data)
+{
+    data.clear();
+    data.resize(count);
+
+    if (!isValidIndex(parent_index))
+        return;
+
+    const std::vector<GenericItem*>& children =
+        static_cast<GenericItem*>(parent_index.d_modelData)->getChildren();
+    for (size_t i = 0; i < count && start_id + i < children.size(); ++i)
+        data[i] = getItemData(ModelIndex(children[start_id + i]), role);
+}
+
+//----------------------------------------------------------------------------//
+template <typename TGenericItem>
+ItemData GenericItemModel<TGenericItem>::getItemDataForItem(GenericItem* item,
+    ItemDataRole role) const
+{
+    if (role == ItemDataRole::Text) return ItemData::fromStringRef(item->getText());
+    if (role == ItemDataRole::Icon) return ItemData::fromStringRef(item->getIcon());
+    if (role == ItemDataRole::Tooltip) return ItemData(item->getTooltipText());
+
+    return ItemData();
+}
+
 //----------------------------------------------------------------------------//
 template <typename TGenericItem>
 void GenericItemModel<TGenericItem>::addItem(String text)
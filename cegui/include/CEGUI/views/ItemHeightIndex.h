@@ -0,0 +1,125 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Prefix sums over the heights of view items
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIItemHeightIndex_h_
+#define _CEGUIItemHeightIndex_h_
+
+#include "CEGUI/Base.h"
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+
+/*!
+\brief
+    Keeps the heights of a sequence of items (rows of a view) and answers
+    "where does item N start" and "which item is at offset Y" queries in
+    logarithmic time.
+
+    Changing the height of a single item is also a logarithmic operation, so
+    views can refine estimated row heights as rows get laid out without
+    having to walk all the rows before them.
+*/
+class CEGUIEXPORT ItemHeightIndex
+{
+public:
+    //! Replace the contents of the index with the given item heights.
+    void build(std::vector<float> heights);
+
+    //! Remove all items.
+    void clear();
+
+    //! Return the number of items in the index.
+    size_t size() const { return d_heights.size(); }
+
+    //! Return the height of the item at \a position.
+    float getHeight(size_t position) const { return d_heights[position]; }
+
+    //! Change the height of the item at \a position.
+    void setHeight(size_t position, float height);
+
+    /*!
+    \brief
+        Insert an item of the given \a height before \a position.
+
+        Appending (\a position equal to size()) takes logarithmic time;
+        inserting anywhere else rebuilds the index in linear time.
+    */
+    void insert(size_t position, float height);
+
+    /*!
+    \brief
+        Remove \a count items starting at \a position.
+
+        Removing items from the end takes constant time; removing any other
+        items rebuilds the index in linear time.
+    */
+    void erase(size_t position, size_t count = 1);
+
+    /*!
+    \brief
+        Return the sum of the heights of all items before \a position.
+        \a position may be equal to size(), in which case this is the same as
+        getTotalHeight().
+    */
+    float getOffset(size_t position) const;
+
+    //! Return the sum of the heights of all items.
+    float getTotalHeight() const { return getOffset(d_heights.size()); }
+
+    /*!
+    \brief
+        Return the position of the item covering the vertical \a offset.
+
+        Offsets before the first item return 0 and offsets past the last item
+        return the position of the last item. Returns 0 when the index is
+        empty.
+    */
+    size_t getPositionAtOffset(float offset) const;
+
+private:
+    void rebuildTree();
+    double getPrefixSum(size_t count) const;
+
+    std::vector<float> d_heights;
+    //! Fenwick tree of partial sums, 1-based (element 0 is unused).
+    std::vector<double> d_tree;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif
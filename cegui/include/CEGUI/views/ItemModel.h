@@ -34,6 +34,13 @@
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/EventSet.h"
 #include "CEGUI/String.h"
+#include "CEGUI/ImageHandle.h"
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
 
 namespace CEGUI
 {
@@ -101,6 +108,104 @@ enum class ItemDataRole : int
     User = 0x1000
 };
 
+/*!
+\brief
+    Enumeration that specifies what happens to the indices made by an ItemModel
+    when children are added to or removed from a parent.
+
+    Views keep the indices of the items they display, and use this to decide
+    which of them have to be made again after such a change.
+*/
+enum class ModelIndexStability : int
+{
+    //! Indices keep referring to their item, whatever changes around it.
+    Stable,
+    //! Indices depend on the item's position, so only the ones from the
+    //! first added or removed child onwards become invalid.
+    Positional,
+    //! Any change may invalidate every index of the parent (for example
+    //! pointers into a vector that gets reallocated).
+    Volatile
+};
+
+/*!
+\brief
+    Value of one ItemDataRole of a ModelIndex, as returned by
+    ItemModel::getItemData.
+
+    Unlike ItemModel::getData this does not force the model to produce a
+    String. The value may be:
+        - a String that is owned by the ItemData.
+        - a reference to a String owned by the model. It is only valid until
+          the model item is changed or removed, so it should be used (or
+          copied) right away.
+        - a number.
+        - an Image, referenced by its ImageHandle.
+*/
+class CEGUIEXPORT ItemData
+{
+public:
+    enum class Type
+    {
+        None,
+        String,
+        Number,
+        Image
+    };
+
+    //! Construct an empty value.
+    ItemData();
+    //! Construct a value holding a copy of \a text.
+    ItemData(const String& text);
+    //! Construct a value holding \a number.
+    explicit ItemData(double number);
+    //! Construct a value referencing the Image \a image.
+    explicit ItemData(ImageHandle image);
+
+    /*!
+    \brief
+        Construct a value referencing \a text without copying it. The caller
+        must guarantee that \a text outlives any use of the value.
+    */
+    static ItemData fromStringRef(const String& text);
+
+    Type getType() const { return d_type; }
+    bool isNull() const { return d_type == Type::None; }
+
+    /*!
+    \brief
+        Return the String held or referenced, or an empty String if this is not
+        a String value.
+    */
+    const String& getString() const;
+
+    //! Return the number held, or 0 if this is not a Number value.
+    double getNumber() const { return d_type == Type::Number ? d_number : 0.0; }
+
+    /*!
+    \brief
+        Return the Image referenced by this value. A String value is taken to
+        be the name of the image, as with ItemDataRole::Icon. Returns a null
+        handle if there is no such image.
+    */
+    ImageHandle getImageHandle() const;
+
+    /*!
+    \brief
+        Return the value as text: the String itself, the number formatted by
+        PropertyHelper or the name of the image.
+    */
+    String toString() const;
+
+private:
+    Type d_type;
+    String d_string;
+    //! set when referencing a string owned by the model instead of d_string.
+    const String* d_stringRef;
+    double d_number;
+    ImageHandle d_image;
+};
+
 /*
 TODO: The count thing is very ugly and counter-intuitive to the whole design.
     We should either:
@@ -214,6 +319,19 @@ public:
     */
     virtual bool areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const;
 
+    /*!
+    \brief
+        Returns which indices made by this model become invalid when children
+        are added or removed.
+
+        The default is ModelIndexStability::Volatile, so views make every index
+        again after such a change. Models whose indices refer to the items
+        themselves, or only depend on the item's position, should return
+        ModelIndexStability::Stable or ModelIndexStability::Positional, which
+        lets views skip most of that work.
+    */
+    virtual ModelIndexStability getIndexStability() const;
+
     /*!
     \brief
         Compares semantically the contents of the specified two indices and returns:
@@ -283,6 +401,32 @@ public:
     */
     virtual String getData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text) = 0;
 
+    /*!
+    \brief
+        Returns the value of the specified ModelIndex for the specified role,
+        without requiring it to be converted to a String.
+
+        Models that keep their data in strings can return references to them
+        (see ItemData::fromStringRef), and models backed by native data can
+        return numbers or images as they are, leaving the formatting to the
+        view and only for the items it actually displays. The default
+        implementation returns the result of getData.
+    */
+    virtual ItemData getItemData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text);
+
+    /*!
+    \brief
+        Fetches the values of \a count consecutive children of \a parent_index,
+        starting from the child \a start_id, for the specified role.
+
+        \a data is resized to hold one value per child. Children beyond the
+        end of the parent get empty values. The default implementation calls
+        getItemData for an index made for each child; models can override it
+        to fetch a whole range at once.
+    */
+    virtual void getItemDataRange(const ModelIndex& parent_index, size_t start_id,
+        size_t count, ItemDataRole role, std::vector<ItemData>& data);
+
     /*!
     \brief
         Notifies any listeners of the EventChildrenWillBeAdded event that new children
@@ -394,4 +538,8 @@ public:
 
 }
 
+#if defined (_MSC_VER)
+#   pragma warning(pop)
+#endif
+
 #endif
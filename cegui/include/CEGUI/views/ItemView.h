@@ -33,6 +33,7 @@
 #include "CEGUI/WindowRenderer.h"
 #include "CEGUI/ColourRect.h"
 #include "CEGUI/views/ItemModel.h"
+#include "CEGUI/text/RenderedText.h"
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -146,6 +147,23 @@ struct CEGUIEXPORT ModelIndexSelectionState
 };
 typedef std::vector<ModelIndexSelectionState> SelectionStatesVector;
 
+/*!
+\brief
+    A range of consecutive children of one parent ModelIndex whose data has
+    changed since the view last prepared its rendering state.
+*/
+struct CEGUIEXPORT ModelIndexRange
+{
+    ModelIndexRange() : d_startId(0), d_count(0) {}
+    ModelIndexRange(const ModelIndex& parent_index, size_t start_id, size_t count) :
+        d_parentIndex(parent_index), d_startId(start_id), d_count(count) {}
+
+    ModelIndex d_parentIndex;
+    size_t d_startId;
+    size_t d_count;
+};
+typedef std::vector<ModelIndexRange> ModelIndexRangeVector;
+
 class CEGUIEXPORT ItemViewEventArgs : public WindowEventArgs
 {
 public:
@@ -351,6 +369,32 @@ public:
     //! Setting a new sorting mode will trigger the instant sorting of this view.
     void setSortMode(ViewSortMode sort_mode);
 
+    /*!
+    \brief
+        Specifies whether the view should only lay out the items that are
+        inside or near its visible area.
+
+        When enabled, items get an estimated height (see
+        setEstimatedItemHeight) instead of having their text laid out up
+        front. The real layout of an item is done when it first comes within
+        half a view height of the visible area, and it is dropped again when
+        the item scrolls further away than that. This makes views with many
+        items much cheaper to fill and to scroll, at the cost of the content
+        extents (and therefore the scrollbars) being approximate until the
+        items have been seen.
+    */
+    void setVirtualizationEnabled(bool enabled);
+    bool isVirtualizationEnabled() const;
+
+    /*!
+    \brief
+        Sets the height assumed for items that were not laid out yet, when
+        virtualization is enabled. A value of 0 (the default) uses the line
+        spacing of the view's font, which is exact for single line items.
+    */
+    void setEstimatedItemHeight(float height);
+    float getEstimatedItemHeight() const;
+
     //! Returns the width of the rendered contents.
     float getRenderedMaxWidth() const;
     //! Returns the height of the rendered contents.
@@ -373,6 +417,12 @@ protected:
     ViewSortMode d_sortMode;
     bool d_isAutoResizeHeightEnabled;
     bool d_isAutoResizeWidthEnabled;
+    bool d_isVirtualizationEnabled;
+    float d_estimatedItemHeight;
+    //! Laid out texts of items that left the visible area, kept for reuse.
+    std::vector<RenderedText> d_renderedTextPool;
+    //! Children whose data changed since the last prepareForRender.
+    ModelIndexRangeVector d_dirtyRanges;
 
     //TODO: move this into the renderer instead?
     float d_renderedMaxWidth;
@@ -383,6 +433,13 @@ protected:
     TextParser* getTextParser() const;
 
     void addItemViewProperties();
+
+    //! Returns the height to use for items that were not laid out yet.
+    float getEffectiveEstimatedItemHeight() const;
+    //! Returns a RenderedText to lay out an item's text into, reusing a pooled one if possible.
+    RenderedText acquireRenderedText();
+    //! Gives up the text of an item that is no longer laid out, for later reuse.
+    void releaseRenderedText(RenderedText& text);
     virtual void updateScrollbars();
     void updateScrollbar(Scrollbar* scrollbar, float available_area,
         float rendered_area, ScrollbarDisplayMode display_mode);
@@ -399,6 +456,30 @@ protected:
     virtual bool onChildrenDataWillChange(const EventArgs& args);
     virtual bool onChildrenDataChanged(const EventArgs& args);
 
+    /*!
+    \brief
+        Records that the data of \a count children of \a parent_index,
+        starting from \a start_id, changed. Ranges recorded until the next
+        prepareForRender are merged and passed to updateDirtyRanges once, so
+        many updates of single items only cost one update of the view.
+    */
+    void markRangeDirty(const ModelIndex& parent_index, size_t start_id, size_t count);
+
+    /*!
+    \brief
+        Called by prepareForRender with the sorted and merged ranges of children
+        whose data changed. Not called when the whole view is going to be
+        rendered again anyway.
+
+        The default implementation marks the whole view as dirty. Views able
+        to update single items override it to update only the given ones.
+    */
+    virtual void updateDirtyRanges(const ModelIndexRangeVector& ranges);
+
+    //! Shifts the recorded dirty ranges after children were added or removed.
+    void adjustDirtyRanges(const ModelIndex& parent_index, size_t start_id,
+        size_t count, bool added);
+
     virtual bool onScrollPositionChanged(const EventArgs& args);
     virtual void onSelectionChanged(ItemViewEventArgs& args);
     virtual void onMultiselectModeChanged(WindowEventArgs& args);
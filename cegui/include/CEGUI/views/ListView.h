@@ -30,8 +30,10 @@
 #define _CEGUIListView_h_
 
 #include "CEGUI/views/ItemView.h"
+#include "CEGUI/views/ItemHeightIndex.h"
 #include "CEGUI/falagard/Enums.h"
 #include "CEGUI/text/RenderedText.h"
+#include <memory>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -50,6 +52,10 @@ namespace CEGUI
     is not queries each time rendering is done. That means, the users of ListView
     shouldn't use this struct for interacting with the list, but rather use the
     attached ItemModel.
+
+    When virtualization is enabled on the ListView, only the items in or near
+    the visible area have their text, icon and rendered text filled in; the
+    others only hold their index and their (possibly estimated) size.
 */
 struct CEGUIEXPORT ListViewItemRenderingState final
 {
@@ -65,12 +71,14 @@ struct CEGUIEXPORT ListViewItemRenderingState final
     bool operator >(const ListViewItemRenderingState& other) const;
 
     RenderedText d_renderedText;
-    String d_icon; //!< The name of the image that represents the icon
+    ImageHandle d_icon; //!< The image that represents the icon
     Sizef d_size;
     ModelIndex d_index;
     String d_text;
     ListView* d_attachedListView = nullptr;
     bool d_isSelected = false;
+    //! ListView layout generation this item was laid out in; 0 if it has no layout.
+    std::uint32_t d_layoutGeneration = 0;
 };
 
 /*!
@@ -101,6 +109,20 @@ public:
 
     ModelIndex indexAtLocal(const glm::vec2& localPos) override;
 
+    /*!
+    \brief
+        Returns the vertical offset, from the top of the content, of the item
+        at \a position in the vector returned by getItems().
+    */
+    float getItemOffset(size_t position) const;
+
+    /*!
+    \brief
+        Returns the position, in the vector returned by getItems(), of the item
+        covering the vertical \a offset from the top of the content.
+    */
+    size_t getItemPositionAtOffset(float offset) const;
+
     HorizontalTextFormatting getHorizontalFormatting() const { return d_horzFormatting; }
     void setHorizontalFormatting(HorizontalTextFormatting h_fmt);
 
@@ -110,20 +132,80 @@ public:
 protected:
 
     bool onChildrenAdded(const EventArgs& args) override;
+    bool onChildrenWillBeRemoved(const EventArgs& args) override;
     bool onChildrenRemoved(const EventArgs& args) override;
+    bool onChildrenDataWillChange(const EventArgs& args) override;
+    bool onChildrenDataChanged(const EventArgs& args) override;
+    void updateDirtyRanges(const ModelIndexRangeVector& ranges) override;
+    bool onScrollPositionChanged(const EventArgs& args) override;
 
+    //! Sorts all items again and rebuilds the height index.
     void resortListView();
     void resortView() override;
+    void rebuildHeightIndex();
+
+    /*!
+    \brief
+        Returns the position in d_sortedItems at which \a item, stored at
+        \a model_position in d_items, belongs. Uses a binary search when
+        sorting is enabled.
+    */
+    size_t getSortedInsertPosition(const ListViewItemRenderingState& item,
+        size_t model_position) const;
+
+    //! Returns the position of \a item, stored at \a model_position in
+    //! d_items, within d_sortedItems.
+    size_t getSortedPosition(const ListViewItemRenderingState& item,
+        size_t model_position) const;
+
+    //! Inserts \a item into d_sortedItems and the height index.
+    void insertSortedItem(ListViewItemRenderingState& item, size_t sorted_position);
+    //! Removes the item at \a sorted_position from d_sortedItems and the height index.
+    void eraseSortedItem(size_t sorted_position);
+
+    /*!
+    \brief
+        Refreshes the model index of the items from \a first onwards, or of
+        all or none of them depending on the model's ModelIndexStability.
+    */
+    void refreshItemIndices(size_t first);
+
+    //! Updates scrollbars, size and redraws after a change that was already
+    //! applied to the rendering state of the affected items.
+    void updateExtentsAndInvalidate();
 
     //! Updates the rendering state for the specified \a item using the specified
     //! \a index as the data source.
     void updateItem(ListViewItemRenderingState& item, ModelIndex index,
         float& max_width, float& total_height);
 
+    //! Initialises the rendering state for \a item without laying it out,
+    //! using the estimated item height.
+    void updateItemEstimate(ListViewItemRenderingState& item, ModelIndex index,
+        float& total_height);
+
+    //! Lays out the items in and near the visible area, and drops the layout
+    //! of items that moved away from it. Used when virtualization is enabled.
+    void layoutVisibleItems();
+
+    //! Drops the layout of \a item, keeping only its index and size.
+    void releaseItemLayout(ListViewItemRenderingState& item);
+
     Rectf getIndexRect(const ModelIndex& index) override;
 
-    std::vector<ListViewItemRenderingState> d_items;
+    //! Items in model order. Their addresses don't change when others are
+    //! added or removed, so d_sortedItems can be updated incrementally.
+    std::vector<std::unique_ptr<ListViewItemRenderingState>> d_items;
     std::vector<ListViewItemRenderingState*> d_sortedItems;
+    //! Items taken out of d_sortedItems until their changed data is known.
+    std::vector<ListViewItemRenderingState*> d_itemsChangingData;
+    //! Heights of d_sortedItems, in the same order.
+    ItemHeightIndex d_heightIndex;
+    //! Range of positions in d_sortedItems laid out by layoutVisibleItems.
+    size_t d_laidOutBegin = 0;
+    size_t d_laidOutEnd = 0;
+    //! Items laid out in a different generation need to be laid out again.
+    std::uint32_t d_layoutGeneration = 1;
 
     HorizontalTextFormatting d_horzFormatting = HorizontalTextFormatting::LeftAligned;
     bool d_wordWrap = false;
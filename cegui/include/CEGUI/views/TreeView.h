@@ -105,8 +105,8 @@ public:
     size_t d_totalChildCount;
 
     String d_text;
-    //! The name of the image that represents the icon
-    String d_icon;
+    //! The image that represents the icon
+    ImageHandle d_icon;
     RenderedText d_renderedText;
     Sizef d_size;
     bool d_isSelected;
@@ -114,6 +114,9 @@ public:
     size_t d_childId;
     bool d_subtreeIsExpanded;
     int d_nestedLevel;
+    //! TreeView layout generation this item was laid out in; 0 if it has no
+    //! layout. Only used when virtualization is enabled.
+    std::uint32_t d_layoutGeneration;
 
     TreeView* d_attachedTreeView;
 
@@ -185,6 +188,7 @@ protected:
 
     bool onChildrenRemoved(const EventArgs& args) override;
     bool onChildrenAdded(const EventArgs& args) override;
+    bool onScrollPositionChanged(const EventArgs& args) override;
 
     virtual void onSubtreeExpanded(ItemViewEventArgs& args);
     virtual void onSubtreeCollapsed(ItemViewEventArgs& args);
@@ -199,6 +203,8 @@ private:
         float& rendered_max_width, float& rendered_total_height);
 
     float d_subtreeExpanderMargin;
+    //! Items laid out in a different generation need to be laid out again.
+    std::uint32_t d_layoutGeneration;
 
     void addTreeViewProperties();
 
@@ -210,6 +216,20 @@ private:
 
     void fillRenderingState(TreeViewItemRenderingState& state, const ModelIndex& index, float& rendered_max_width, float& rendered_total_height);
 
+    //! Fetches the data of \a item and lays out its text.
+    void layoutItem(TreeViewItemRenderingState& item, const ModelIndex& index);
+    //! Drops the layout of \a item, keeping only its size.
+    void releaseItemLayout(TreeViewItemRenderingState& item);
+
+    /*!
+    \brief
+        Lays out the rows in and near the visible area, and drops the layout
+        of rows that moved away from it. Used when virtualization is enabled.
+    */
+    void layoutVisibleItems();
+    void layoutVisibleItems(TreeViewItemRenderingState& item, float& offset,
+        float top, float bottom, bool& extents_changed);
+
     ModelIndex indexAtWithAction(const glm::vec2& localPos, TreeViewItemAction action);
     ModelIndex indexAtRecursive(TreeViewItemRenderingState& item, float& cur_height,
         const glm::vec2& window_position, bool& handled, TreeViewItemAction action);
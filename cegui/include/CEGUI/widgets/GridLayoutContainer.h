@@ -30,6 +30,12 @@
 #define _CEGUIGridLayoutContainer_h_
 
 #include "LayoutContainer.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
 
 namespace CEGUI
 {
@@ -210,6 +216,20 @@ protected:
 
     virtual void layout_impl() override;
 
+    bool handleChildSized(const EventArgs& e) override;
+    bool handleChildMarginChanged(const EventArgs& e) override;
+
+    //! drops cached cell sizes, the next layout measures every cell again.
+    void invalidateCellSizes();
+    //! measures every cell and rebuilds column and row sizes from scratch.
+    void measureAllCells(float absWidth, float absHeight);
+    //! recalculates size of the column \a gridX from cached cell sizes.
+    bool updateColumnSize(size_t gridX, float absWidth);
+    //! recalculates size of the row \a gridY from cached cell sizes.
+    bool updateRowSize(size_t gridY, float absHeight);
+    //! sets position of the window in the given cell if it changed.
+    void positionCell(size_t gridX, size_t gridY);
+
     size_t d_gridWidth = 0;
     size_t d_gridHeight = 0;
     
@@ -221,6 +241,20 @@ protected:
     bool d_rowMajor = true;
     bool d_autoGrow = false;
 
+    //! bounding size of the window in each cell, indexed like d_children.
+    std::vector<UVector2> d_cellSizes;
+    //! size of each column / row, that is the largest size of its cells.
+    std::vector<UDim> d_colSizes;
+    std::vector<UDim> d_rowSizes;
+    //! offset of each column / row, with the total size as the last element.
+    std::vector<UDim> d_colOffsets;
+    std::vector<UDim> d_rowOffsets;
+    //! children whose size or margin changed since the last layout.
+    std::vector<Window*> d_dirtyCells;
+    //! child content area size the cached sizes were compared in.
+    Sizef d_cellSizesArea;
+    bool d_cellSizesValid = false;
+
 private:
 
     void addGridLayoutContainerProperties();
@@ -228,4 +262,8 @@ private:
 
 }
 
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
 #endif
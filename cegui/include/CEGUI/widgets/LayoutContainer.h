@@ -74,8 +74,13 @@ public:
     /*!
     \brief
         marks this layout container for relayouting before drawing
+
+        When attached to a GUIContext the container is scheduled with it, and
+        gets laid out by the next GUIContext::performPendingLayouts together
+        with all other pending containers. Containers not attached to any
+        GUIContext are laid out by update.
     */
-    void markNeedsLayouting() { d_needsLayouting = true; }
+    void markNeedsLayouting();
 
     /*!
     \brief
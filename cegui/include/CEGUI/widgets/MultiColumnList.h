@@ -757,6 +757,30 @@ public:
     */
     float   getHighestRowItemHeight(unsigned int row_idx) const;
 
+    /*!
+    \brief
+        Return, in pixels, the distance from the top of the first row to the
+        top of row \a row_idx.  Passing getRowCount() returns the total height
+        of all rows.
+
+        Row offsets are cached, so if ListboxItems attached to the list are
+        modified externally handleUpdatedItemData must be called for the
+        offsets to be refreshed.
+
+    \exception InvalidRequestException thrown if \a row_idx is greater than
+        getRowCount().
+    */
+    float   getRowOffset(unsigned int row_idx) const;
+
+    /*!
+    \brief
+        Return the index of the row at \a offset pixels from the top of the
+        first row, or getRowCount() if \a offset is below the last row.
+        Negative offsets return 0.  This is a binary search over the cached
+        row offsets.
+    */
+    unsigned int getRowAtOffset(float offset) const;
+
     /*!
     \brief
         Get whether or not column auto-sizing (autoSizeColumnHeader()) will use
@@ -1570,6 +1594,15 @@ protected:
     */
     void resortList();
 
+    //! Mark the cached row offsets as needing to be recalculated.
+    void invalidateRowOffsets();
+
+    //! Mark the cached height of every row as needing to be recalculated.
+    void invalidateRowHeights();
+
+    //! Recalculate the cached row offsets if they are out of date.
+    void updateRowOffsets() const;
+
 	/*************************************************************************
 		New event handlers for multi column list
 	*************************************************************************/
@@ -1681,6 +1714,8 @@ protected:
 		RowItems	d_items;
 		unsigned int		d_sortColumn;
 		unsigned int		d_rowID;
+		//! cached height of the highest item in the row.
+		mutable float		d_height = 0.0f;
 
 		// operators
 		ListboxItem* const& operator[](unsigned int idx) const	{return d_items[idx];}
@@ -1724,6 +1759,13 @@ protected:
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
+    //! offset of the top of each row, plus the total height as last element.
+    mutable std::vector<float> d_rowOffsets;
+    //! whether d_rowOffsets matches the current rows.
+    mutable bool d_rowOffsetsValid;
+    //! whether ListRow::d_height is up to date for all rows.
+    mutable bool d_rowHeightsValid;
+
     friend class MultiColumnListWindowRenderer;
 
 protected:
@@ -30,6 +30,7 @@
 #include "../Window.h"
 #include "../WindowFactory.h"
 #include <map>
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -77,6 +78,22 @@ public:
     Rectf getChildExtentsArea() const;
 
     virtual void adjustSizeToContent() override;
+
+    /*!
+    \brief
+        Adjust the size to the content now if a change to the children made
+        that necessary.
+
+        Changes to the children while the container is sized to its content
+        are collected and applied once, in update, so that adding or moving
+        many children causes a single size change (and a single update of the
+        scrollbars of a ScrollablePane).  getContentPixelRect and the content
+        size and scroll position functions of ScrollablePane call this first,
+        so they never report the extents from before the changes.
+    */
+    void adjustSizeToContentIfNecessary();
+
+    void update(float elapsed) override;
     
     const CachedRectf& getChildContentArea(const bool non_client = false) const override { (void)non_client; return d_childContentArea; }
 
@@ -88,6 +105,23 @@ protected:
 
     //! handles notifications about child windows being moved or sized.
     bool handleChildAreaChanged(const EventArgs& e);
+
+    //! Return the size that child positions and sizes are relative to.
+    Sizef getChildBaseSize() const;
+    //! Return the area occupied by \a child, relative to the content origin.
+    static Rectf getChildArea(const Window& child, const Sizef& base_size);
+    /*!
+    \brief
+        Update the cached extents after \a child was added, moved or sized.
+        Growing the extents is done in place; if \a child used to define an
+        edge that may now have moved inwards, the cache is invalidated so it
+        is rebuilt by the next call to getChildExtentsArea.
+    */
+    void updateCachedChildExtents(const Window& child);
+    //! Update the cached extents after \a child was removed.
+    void removeCachedChildExtents(const Window& child);
+    //! Return whether \a area touches an edge of the cached extents.
+    bool isOnCachedExtentsEdge(const Rectf& area) const;
     void subscribeOnChildAreaEvents(Window* child);
     void onIsSizeAdjustedToContentChanged(ElementEventArgs& e) override;
 
@@ -110,6 +144,16 @@ protected:
     glm::vec2 d_contentOffset;
 
     CachedRectf d_childContentArea;
+
+    //! Area of each child as included in d_cachedExtents.
+    mutable std::unordered_map<const Window*, Rectf> d_cachedChildAreas;
+    //! Extents of the children, valid while d_cachedExtentsValid is true.
+    mutable Rectf d_cachedExtents;
+    //! The child base size d_cachedExtents was calculated for.
+    mutable Sizef d_cachedExtentsBaseSize;
+    mutable bool d_cachedExtentsValid;
+    //! true when the size must be adjusted to the content on the next update.
+    bool d_needsSizeAdjustment;
 };
 
 } // End of  CEGUI namespace section
@@ -34,6 +34,7 @@
 #include "CEGUI/FontManager.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowNavigator.h"
+#include "CEGUI/widgets/LayoutContainer.h"
 #include "CEGUI/System.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/CoordConverter.h"
@@ -275,6 +276,12 @@ void GUIContext::draw(std::uint32_t drawModeMask)
     // Cursor is always dirty because it must be redrawn each frame
     const bool drawCursor = (drawModeMask & DrawModeFlagMouseCursor);
     
+    // Windows must be in their final places before anything is drawn
+    performPendingLayouts();
+
+    // May change which windows render through textures, marking them dirty
+    d_renderCachePolicy.update(d_rootWindow);
+
     drawModeMask &= d_dirtyDrawModeMask;
 
     drawWindowContentToTarget(drawModeMask);
@@ -347,6 +354,7 @@ void GUIContext::drawWindowContentToTarget(std::uint32_t drawModeMask)
             if (rs->isRenderingWindow())
                 static_cast<RenderingWindow*>(rs)->getOwner().clearGeometry();
 
+            d_occlusionCuller.update(d_rootWindow, drawModeMask);
             d_rootWindow->draw(drawModeMask);
         }
     }
@@ -425,9 +433,80 @@ void GUIContext::onWindowDetached(Window* window)
     if (window == d_oldCaptureWindow)
         d_oldCaptureWindow = nullptr;
 
+    if (!d_pendingLayouts.empty())
+        d_pendingLayouts.erase(std::remove(d_pendingLayouts.begin(), d_pendingLayouts.end(), window),
+                               d_pendingLayouts.end());
+
+    // Entries of the running pass are cleared rather than erased, it is being iterated
+    for (auto& container : d_layoutBatch)
+        if (container == window)
+            container = nullptr;
+
+    d_renderCachePolicy.onWindowDetached(window);
+    d_occlusionCuller.onWindowDetached(window);
+
     releaseInputCapture(true, window);
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::requestLayout(LayoutContainer* container)
+{
+    if (container && container->getGUIContextPtr() == this)
+        d_pendingLayouts.push_back(container);
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::performPendingLayouts()
+{
+    // Guards against containers that keep invalidating each other. Anything
+    // still pending after that many passes is left for the next call.
+    static const int MaxLayoutPasses = 16;
+
+    bool laidOut = false;
+    std::vector<std::pair<size_t, LayoutContainer*>> ordered;
+
+    for (int pass = 0; pass < MaxLayoutPasses && !d_pendingLayouts.empty(); ++pass)
+    {
+        // Containers may be requested again after being laid out by update
+        std::sort(d_pendingLayouts.begin(), d_pendingLayouts.end());
+        d_pendingLayouts.erase(std::unique(d_pendingLayouts.begin(), d_pendingLayouts.end()),
+                               d_pendingLayouts.end());
+
+        // Deepest first. A container's size depends on its children, so they
+        // must be final before it is arranged.
+        ordered.clear();
+        for (auto container : d_pendingLayouts)
+        {
+            size_t depth = 0;
+            for (const Element* e = container->getParentElement(); e; e = e->getParentElement())
+                ++depth;
+            ordered.emplace_back(depth, container);
+        }
+        std::stable_sort(ordered.begin(), ordered.end(),
+            [](const std::pair<size_t, LayoutContainer*>& a, const std::pair<size_t, LayoutContainer*>& b)
+            { return a.first > b.first; });
+
+        d_pendingLayouts.clear();
+        d_layoutBatch.clear();
+        for (const auto& entry : ordered)
+            d_layoutBatch.push_back(entry.second);
+
+        for (size_t i = 0; i < d_layoutBatch.size(); ++i)
+        {
+            LayoutContainer* container = d_layoutBatch[i];
+            if (container && container->needsLayouting())
+            {
+                container->layoutIfNecessary();
+                laidOut = true;
+            }
+        }
+
+        d_layoutBatch.clear();
+    }
+
+    return laidOut;
+}
+
 //----------------------------------------------------------------------------//
 void GUIContext::updateWindowContainingCursorInternal(Window* windowWithCursor)
 {
@@ -813,6 +892,7 @@ bool GUIContext::injectTimePulse(float timeElapsed)
 
     // Pass to sheet for distribution. This input is then /always/ considered handled.
     d_rootWindow->update(timeElapsed);
+    performPendingLayouts();
     return true;
 }
 
@@ -32,10 +32,14 @@
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/ColourRect.h"
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+const uint16_t GeometryBuffer::QuadIndices[6] = { 0, 1, 2, 3, 0, 2 };
 
 //---------------------------------------------------------------------------//
 GeometryBuffer::GeometryBuffer(RefCounted<RenderMaterial> renderMaterial):
@@ -92,6 +96,7 @@ void GeometryBuffer::appendGeometry(const float* vertexArray, size_t arraySize)
     std::memcpy(dest, vertexArray, arraySize * sizeof(float));
 
     d_vertexCount = d_vertexData.size() / static_cast<size_t>(getVertexAttributeElementCount());
+    d_compactVertexDataValid = false;
 
     onGeometryChanged();
 }
@@ -146,16 +151,128 @@ int GeometryBuffer::getVertexAttributeElementCount() const
     return count;
 }
 
+//---------------------------------------------------------------------------//
+const std::vector<uint8_t>& GeometryBuffer::getCompactVertexData() const
+{
+    if (!d_compactVertexDataValid)
+        updateCompactVertexData();
+
+    return d_compactVertexData;
+}
+
+//---------------------------------------------------------------------------//
+CompactVertexLayout GeometryBuffer::getCompactVertexLayout() const
+{
+    if (!d_compactVertexDataValid)
+        updateCompactVertexData();
+
+    return d_compactVertexLayout;
+}
+
+//---------------------------------------------------------------------------//
+size_t GeometryBuffer::getCompactVertexStride() const
+{
+    // 2 floats and 4 bytes, plus 2 shorts when textured
+    const size_t floatCount = static_cast<size_t>(getVertexAttributeElementCount());
+    return (floatCount == TEXTURED_VERTEX_FLOAT_COUNT) ? 16 : 12;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::fillQuadIndices(uint16_t* out, size_t quadCount)
+{
+    for (size_t quad = 0; quad < quadCount; ++quad)
+        for (size_t i = 0; i < 6; ++i)
+            *out++ = static_cast<uint16_t>(quad * 4 + QuadIndices[i]);
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::updateCompactVertexData() const
+{
+    d_compactVertexDataValid = true;
+    d_compactVertexData.clear();
+    d_compactVertexLayout = CompactVertexLayout::None;
+
+    // Only the standard layouts, with the attributes in the standard order
+    const size_t attributeCount = d_vertexAttributes.size();
+    if (attributeCount < 2 || attributeCount > 3 ||
+        d_vertexAttributes[0] != VertexAttributeType::Position0 ||
+        d_vertexAttributes[1] != VertexAttributeType::Colour0 ||
+        (attributeCount == 3 && d_vertexAttributes[2] != VertexAttributeType::TexCoord0))
+        return;
+
+    if (!d_vertexCount)
+        return;
+
+    const size_t floatCount = static_cast<size_t>(getVertexAttributeElementCount());
+    const bool textured = (attributeCount == 3);
+    const float* vertices = d_vertexData.data();
+
+    for (size_t i = 0; i < d_vertexCount; ++i)
+    {
+        const float* v = vertices + i * floatCount;
+        if (v[2] != 0.f || !std::isfinite(v[0]) || !std::isfinite(v[1]))
+            return;
+
+        // Written this way round so that NaN is rejected too
+        if (textured && !(v[7] >= 0.f && v[7] <= 1.f && v[8] >= 0.f && v[8] <= 1.f))
+            return;
+    }
+
+    // Quads are stored as v0 v1 v2 v3 v0 v2 by appendSolidRect and the Images
+    bool quads = (d_vertexCount % 6 == 0) && (d_vertexCount / 6 <= MaxCompactQuadCount);
+    const size_t vertexBytes = floatCount * sizeof(float);
+    for (size_t i = 0; quads && i < d_vertexCount; i += 6)
+    {
+        const float* quad = vertices + i * floatCount;
+        quads = !std::memcmp(quad + 4 * floatCount, quad, vertexBytes) &&
+                !std::memcmp(quad + 5 * floatCount, quad + 2 * floatCount, vertexBytes);
+    }
+
+    const size_t stride = getCompactVertexStride();
+    const size_t outCount = quads ? d_vertexCount / 6 * 4 : d_vertexCount;
+    d_compactVertexData.resize(outCount * stride);
+    uint8_t* out = d_compactVertexData.data();
+
+    for (size_t i = 0; i < d_vertexCount; ++i)
+    {
+        // The 2 repeated vertices of every quad
+        if (quads && i % 6 >= 4)
+            continue;
+
+        const float* v = vertices + i * floatCount;
+        std::memcpy(out, v, 2 * sizeof(float));
+
+        for (size_t c = 0; c < 4; ++c)
+            out[8 + c] = static_cast<uint8_t>(std::min(std::max(v[3 + c], 0.f), 1.f) * 255.f + 0.5f);
+
+        if (textured)
+        {
+            const uint16_t texCoords[2] =
+            {
+                static_cast<uint16_t>(v[7] * 65535.f + 0.5f),
+                static_cast<uint16_t>(v[8] * 65535.f + 0.5f)
+            };
+            std::memcpy(out + 12, texCoords, sizeof(texCoords));
+        }
+
+        out += stride;
+    }
+
+    d_compactVertexLayout = quads ? CompactVertexLayout::Quads : CompactVertexLayout::Triangles;
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::resetVertexAttributes()
 {
     d_vertexAttributes.clear();
+    d_compactVertexDataValid = false;
 }
 
 //---------------------------------------------------------------------------//
 void GeometryBuffer::addVertexAttribute(VertexAttributeType attribute)
 {
     d_vertexAttributes.push_back(attribute);
+    d_compactVertexDataValid = false;
 }
 
 //---------------------------------------------------------------------------//
@@ -243,6 +360,7 @@ void GeometryBuffer::reset()
     if (!d_vertexData.empty())
     {
         d_vertexData.clear();
+        d_compactVertexDataValid = false;
         onGeometryChanged();
     }
     d_clippingActive = true;
@@ -286,6 +404,7 @@ void GeometryBuffer::updateTextureCoordinates(const Texture* texture, float scal
         d_vertexData[i * TEXTURED_VERTEX_FLOAT_COUNT + 8] *= scaleFactor;
     }
 
+    d_compactVertexDataValid = false;
     onGeometryChanged();
 }
 
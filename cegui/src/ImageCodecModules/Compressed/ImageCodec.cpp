@@ -0,0 +1,448 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageCodecModules/Compressed/ImageCodec.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/Sizef.h"
+#include "CEGUI/TextureDecompressor.h"
+
+#include <cstring>
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+const std::uint8_t DDS_MAGIC[4] = { 'D', 'D', 'S', ' ' };
+const std::size_t DDS_HEADER_SIZE = 124;
+const std::size_t DDS_HEADER_DXT10_SIZE = 20;
+
+// DDS_PIXELFORMAT flags
+const std::uint32_t DDPF_ALPHAPIXELS = 0x1;
+const std::uint32_t DDPF_FOURCC = 0x4;
+const std::uint32_t DDPF_RGB = 0x40;
+// DDS caps2 flags
+const std::uint32_t DDSCAPS2_CUBEMAP = 0x200;
+const std::uint32_t DDSCAPS2_VOLUME = 0x200000;
+
+// DXGI_FORMAT values used in the DX10 extended header
+const std::uint32_t DXGI_FORMAT_R8G8B8A8_UNORM = 28;
+const std::uint32_t DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29;
+const std::uint32_t DXGI_FORMAT_BC1_UNORM = 71;
+const std::uint32_t DXGI_FORMAT_BC1_UNORM_SRGB = 72;
+const std::uint32_t DXGI_FORMAT_BC2_UNORM = 74;
+const std::uint32_t DXGI_FORMAT_BC2_UNORM_SRGB = 75;
+const std::uint32_t DXGI_FORMAT_BC3_UNORM = 77;
+const std::uint32_t DXGI_FORMAT_BC3_UNORM_SRGB = 78;
+const std::uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+const std::uint32_t DXGI_FORMAT_BC7_UNORM_SRGB = 99;
+const std::uint32_t D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+
+const std::uint8_t KTX2_MAGIC[12] =
+    { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+// identifier + 9 header fields + 4 index fields + 2 64 bit index fields
+const std::size_t KTX2_HEADER_SIZE = 12 + 9 * 4 + 4 * 4 + 2 * 8;
+const std::size_t KTX2_LEVEL_INDEX_ENTRY_SIZE = 3 * 8;
+
+// VkFormat values that we can load
+const std::uint32_t VK_FORMAT_R8G8B8_UNORM = 23;
+const std::uint32_t VK_FORMAT_R8G8B8_SRGB = 29;
+const std::uint32_t VK_FORMAT_R8G8B8A8_UNORM = 37;
+const std::uint32_t VK_FORMAT_R8G8B8A8_SRGB = 43;
+const std::uint32_t VK_FORMAT_BC1_RGB_UNORM_BLOCK = 131;
+const std::uint32_t VK_FORMAT_BC1_RGB_SRGB_BLOCK = 132;
+const std::uint32_t VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+const std::uint32_t VK_FORMAT_BC1_RGBA_SRGB_BLOCK = 134;
+const std::uint32_t VK_FORMAT_BC2_UNORM_BLOCK = 135;
+const std::uint32_t VK_FORMAT_BC2_SRGB_BLOCK = 136;
+const std::uint32_t VK_FORMAT_BC3_UNORM_BLOCK = 137;
+const std::uint32_t VK_FORMAT_BC3_SRGB_BLOCK = 138;
+const std::uint32_t VK_FORMAT_BC7_UNORM_BLOCK = 145;
+const std::uint32_t VK_FORMAT_BC7_SRGB_BLOCK = 146;
+const std::uint32_t VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK = 147;
+const std::uint32_t VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK = 148;
+const std::uint32_t VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK = 151;
+const std::uint32_t VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK = 152;
+
+//----------------------------------------------------------------------------//
+inline std::uint32_t readLE32(const std::uint8_t* p)
+{
+    return static_cast<std::uint32_t>(p[0]) |
+           (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) |
+           (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint64_t readLE64(const std::uint8_t* p)
+{
+    return static_cast<std::uint64_t>(readLE32(p)) |
+           (static_cast<std::uint64_t>(readLE32(p + 4)) << 32);
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint32_t makeFourCC(char a, char b, char c, char d)
+{
+    return static_cast<std::uint32_t>(a) |
+           (static_cast<std::uint32_t>(b) << 8) |
+           (static_cast<std::uint32_t>(c) << 16) |
+           (static_cast<std::uint32_t>(d) << 24);
+}
+
+//----------------------------------------------------------------------------//
+void logError(const String& message)
+{
+    Logger::getSingleton().logEvent(
+        "CompressedImageCodec::load - " + message, LoggingLevel::Error);
+}
+
+//----------------------------------------------------------------------------//
+bool dxgiToPixelFormat(std::uint32_t dxgi, Texture::PixelFormat& fmt)
+{
+    switch (dxgi)
+    {
+    case DXGI_FORMAT_R8G8B8A8_UNORM:
+    case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+        fmt = Texture::PixelFormat::Rgba;
+        return true;
+    case DXGI_FORMAT_BC1_UNORM:
+    case DXGI_FORMAT_BC1_UNORM_SRGB:
+        fmt = Texture::PixelFormat::RgbaDxt1;
+        return true;
+    case DXGI_FORMAT_BC2_UNORM:
+    case DXGI_FORMAT_BC2_UNORM_SRGB:
+        fmt = Texture::PixelFormat::RgbaDxt3;
+        return true;
+    case DXGI_FORMAT_BC3_UNORM:
+    case DXGI_FORMAT_BC3_UNORM_SRGB:
+        fmt = Texture::PixelFormat::RgbaDxt5;
+        return true;
+    case DXGI_FORMAT_BC7_UNORM:
+    case DXGI_FORMAT_BC7_UNORM_SRGB:
+        fmt = Texture::PixelFormat::RgbaBc7;
+        return true;
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool vkToPixelFormat(std::uint32_t vk, Texture::PixelFormat& fmt)
+{
+    switch (vk)
+    {
+    case VK_FORMAT_R8G8B8_UNORM:
+    case VK_FORMAT_R8G8B8_SRGB:
+        fmt = Texture::PixelFormat::Rgb;
+        return true;
+    case VK_FORMAT_R8G8B8A8_UNORM:
+    case VK_FORMAT_R8G8B8A8_SRGB:
+        fmt = Texture::PixelFormat::Rgba;
+        return true;
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbDxt1;
+        return true;
+    case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbaDxt1;
+        return true;
+    case VK_FORMAT_BC2_UNORM_BLOCK:
+    case VK_FORMAT_BC2_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbaDxt3;
+        return true;
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC3_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbaDxt5;
+        return true;
+    case VK_FORMAT_BC7_UNORM_BLOCK:
+    case VK_FORMAT_BC7_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbaBc7;
+        return true;
+    case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
+    case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbEtc2;
+        return true;
+    case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+    case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+        fmt = Texture::PixelFormat::RgbaEtc2;
+        return true;
+    default:
+        return false;
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+CompressedImageCodec::CompressedImageCodec() :
+    ImageCodec("CompressedImageCodec")
+{
+    d_supportedFormat = "dds ktx2";
+}
+
+//----------------------------------------------------------------------------//
+CompressedImageCodec::~CompressedImageCodec()
+{
+}
+
+//----------------------------------------------------------------------------//
+Texture* CompressedImageCodec::load(const RawDataContainer& data,
+                                    Texture* result)
+{
+    const std::uint8_t* buffer = data.getDataPtr();
+    const std::size_t size = data.getSize();
+
+    ContainerLevel level;
+    bool parsed = false;
+
+    if (size >= sizeof(DDS_MAGIC) &&
+        !std::memcmp(buffer, DDS_MAGIC, sizeof(DDS_MAGIC)))
+    {
+        parsed = parseDDS(buffer, size, level);
+    }
+    else if (size >= sizeof(KTX2_MAGIC) &&
+             !std::memcmp(buffer, KTX2_MAGIC, sizeof(KTX2_MAGIC)))
+    {
+        parsed = parseKTX2(buffer, size, level);
+    }
+    else
+    {
+        logError("data is neither a DDS nor a KTX2 file.");
+    }
+
+    if (!parsed)
+        return nullptr;
+
+    if (level.d_width == 0 || level.d_height == 0 ||
+        level.d_dataSize < TextureDecompressor::getDataSize(
+            level.d_format, level.d_width, level.d_height))
+    {
+        logError("texture data is truncated or has invalid dimensions.");
+        return nullptr;
+    }
+
+    return loadLevel(level, result);
+}
+
+//----------------------------------------------------------------------------//
+bool CompressedImageCodec::parseDDS(const std::uint8_t* buffer,
+                                    std::size_t size, ContainerLevel& level)
+{
+    if (size < sizeof(DDS_MAGIC) + DDS_HEADER_SIZE)
+    {
+        logError("DDS header is truncated.");
+        return false;
+    }
+
+    const std::uint8_t* header = buffer + sizeof(DDS_MAGIC);
+    if (readLE32(header) != DDS_HEADER_SIZE)
+    {
+        logError("invalid DDS header size.");
+        return false;
+    }
+
+    level.d_height = readLE32(header + 8);
+    level.d_width = readLE32(header + 12);
+
+    const std::uint8_t* pixel_format = header + 72;
+    const std::uint32_t pf_flags = readLE32(pixel_format + 4);
+    const std::uint32_t four_cc = readLE32(pixel_format + 8);
+    const std::uint32_t caps2 = readLE32(header + 108);
+
+    if (caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+    {
+        logError("cubemap and volume textures are not supported.");
+        return false;
+    }
+
+    std::size_t data_offset = sizeof(DDS_MAGIC) + DDS_HEADER_SIZE;
+
+    if ((pf_flags & DDPF_FOURCC) && four_cc == makeFourCC('D', 'X', '1', '0'))
+    {
+        if (size < data_offset + DDS_HEADER_DXT10_SIZE)
+        {
+            logError("DDS DX10 header is truncated.");
+            return false;
+        }
+
+        const std::uint8_t* dx10 = buffer + data_offset;
+        data_offset += DDS_HEADER_DXT10_SIZE;
+
+        if (readLE32(dx10 + 4) != D3D10_RESOURCE_DIMENSION_TEXTURE2D ||
+            readLE32(dx10 + 12) > 1)
+        {
+            logError("only single 2D textures are supported.");
+            return false;
+        }
+
+        if (!dxgiToPixelFormat(readLE32(dx10), level.d_format))
+        {
+            logError("unsupported DXGI format in DDS file.");
+            return false;
+        }
+    }
+    else if (pf_flags & DDPF_FOURCC)
+    {
+        if (four_cc == makeFourCC('D', 'X', 'T', '1'))
+            level.d_format = Texture::PixelFormat::RgbaDxt1;
+        else if (four_cc == makeFourCC('D', 'X', 'T', '3'))
+            level.d_format = Texture::PixelFormat::RgbaDxt3;
+        else if (four_cc == makeFourCC('D', 'X', 'T', '5'))
+            level.d_format = Texture::PixelFormat::RgbaDxt5;
+        else
+        {
+            logError("unsupported FourCC in DDS file.");
+            return false;
+        }
+    }
+    else if (pf_flags & DDPF_RGB)
+    {
+        const std::uint32_t bit_count = readLE32(pixel_format + 12);
+        const std::uint32_t r_mask = readLE32(pixel_format + 16);
+        const std::uint32_t g_mask = readLE32(pixel_format + 20);
+        const std::uint32_t b_mask = readLE32(pixel_format + 24);
+        const std::uint32_t a_mask = readLE32(pixel_format + 28);
+
+        if (r_mask != 0xFF || g_mask != 0xFF00 || b_mask != 0xFF0000)
+        {
+            logError("only RGB(A) byte ordered uncompressed DDS data is "
+                     "supported.");
+            return false;
+        }
+
+        if (bit_count == 32 && (pf_flags & DDPF_ALPHAPIXELS) &&
+            a_mask == 0xFF000000)
+            level.d_format = Texture::PixelFormat::Rgba;
+        else if (bit_count == 24)
+            level.d_format = Texture::PixelFormat::Rgb;
+        else
+        {
+            logError("unsupported uncompressed DDS pixel layout.");
+            return false;
+        }
+    }
+    else
+    {
+        logError("unsupported DDS pixel format.");
+        return false;
+    }
+
+    level.d_data = buffer + data_offset;
+    level.d_dataSize = size - data_offset;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool CompressedImageCodec::parseKTX2(const std::uint8_t* buffer,
+                                     std::size_t size, ContainerLevel& level)
+{
+    if (size < KTX2_HEADER_SIZE + KTX2_LEVEL_INDEX_ENTRY_SIZE)
+    {
+        logError("KTX2 header is truncated.");
+        return false;
+    }
+
+    const std::uint8_t* header = buffer + sizeof(KTX2_MAGIC);
+    const std::uint32_t vk_format = readLE32(header);
+    level.d_width = readLE32(header + 8);
+    level.d_height = readLE32(header + 12);
+    const std::uint32_t depth = readLE32(header + 16);
+    const std::uint32_t layer_count = readLE32(header + 20);
+    const std::uint32_t face_count = readLE32(header + 24);
+    const std::uint32_t supercompression = readLE32(header + 32);
+
+    if (depth > 1 || layer_count > 1 || face_count != 1)
+    {
+        logError("only single 2D textures are supported.");
+        return false;
+    }
+
+    if (supercompression != 0)
+    {
+        logError("supercompressed KTX2 data is not supported.");
+        return false;
+    }
+
+    if (!vkToPixelFormat(vk_format, level.d_format))
+    {
+        logError("unsupported VkFormat in KTX2 file.");
+        return false;
+    }
+
+    // the level index directly follows the header, level 0 comes first.
+    const std::uint8_t* level_index = buffer + KTX2_HEADER_SIZE;
+    const std::uint64_t offset = readLE64(level_index);
+    const std::uint64_t length = readLE64(level_index + 8);
+
+    if (offset > size || length > size - offset)
+    {
+        logError("KTX2 level data lies outside of the file.");
+        return false;
+    }
+
+    level.d_data = buffer + offset;
+    level.d_dataSize = static_cast<std::size_t>(length);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Texture* CompressedImageCodec::loadLevel(const ContainerLevel& level,
+                                         Texture* result)
+{
+    const Sizef size(static_cast<float>(level.d_width),
+                     static_cast<float>(level.d_height));
+
+    if (result->isPixelFormatSupported(level.d_format))
+    {
+        // upload the data as is, no decoding required.
+        result->loadFromMemory(level.d_data, size, level.d_format);
+        return result;
+    }
+
+    if (!TextureDecompressor::canDecompress(level.d_format))
+    {
+        logError("the texture does not support the pixel format of the data "
+                 "and it can not be decoded on the CPU.");
+        return nullptr;
+    }
+
+    std::vector<std::uint8_t> decoded(
+        static_cast<std::size_t>(level.d_width) * level.d_height * 4);
+    TextureDecompressor::decompress(level.d_format, level.d_data,
+                                    level.d_width, level.d_height,
+                                    decoded.data());
+
+    result->loadFromMemory(decoded.data(), size, Texture::PixelFormat::Rgba);
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of CEGUI namespace section
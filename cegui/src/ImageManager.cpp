@@ -36,9 +36,14 @@
 #include "CEGUI/System.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/BitmapImage.h"
+#include "CEGUI/TextureAtlas.h"
+#include "CEGUI/TextureResidencyManager.h"
 #include "CEGUI/svg/SVGImage.h"
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/XMLSerializer.h"
+#include "CEGUI/falagard/PropertyDefinition.h"
 
 #include <algorithm>
 
@@ -79,6 +84,8 @@ const String ImagesetAutoScaledAttribute( "autoScaled" );
 const String ImageTextureAttribute( "texture" );
 const String ImageSVGDataAttribute( "SVGData" );
 const String ImageNameAttribute( "name" );
+const String ImageXPosAttribute( "xPos" );
+const String ImageYPosAttribute( "yPos" );
 const String ImagesetVersionAttribute( "version" );
 // Internal Strings holding XML element and attribute defaults
 const String ImageTypeAttributeDefault( "BitmapImage" );
@@ -100,9 +107,44 @@ static SVGData* s_SVGData = nullptr;
 static CEGUI::String s_imagesetType = "";
 static AutoScaledMode s_autoScaled = AutoScaledMode::Disabled;
 static Sizef s_nativeResolution(640.0f, 480.0f);
+// name of the imageset being parsed when its image file was packed into an atlas
+static CEGUI::String s_atlasedImagesetName = "";
+static glm::vec2 s_atlasOffset(0.0f, 0.0f);
 
 //----------------------------------------------------------------------------//
-ImageManager::ImageManager()
+// Markers used in the open addressing image lookup table
+static const std::uint32_t EmptyLookupBucket = 0xFFFFFFFF;
+static const std::uint32_t DeletedLookupBucket = 0xFFFFFFFE;
+static const std::size_t MinimumLookupCapacity = 64;
+
+//----------------------------------------------------------------------------//
+// Track a texture holding the content of an image file, it can be evicted and
+// loaded from the file again.
+static void registerImageFileTexture(Texture& texture, const String& filename,
+                                     const String& resource_group)
+{
+    TextureResidencyManager& residency = TextureResidencyManager::getSingleton();
+    residency.registerTexture(texture, TextureResidencyManager::Category::Imageset);
+    residency.setReloadSource(texture, filename, resource_group);
+}
+
+//----------------------------------------------------------------------------//
+// Atlas allocations for imagesets are keyed by the imageset name with a
+// trailing '/' so they can never clash with the name of a loose image.
+static String getImagesetAllocationName(const String& imageset_name)
+{
+    return imageset_name + '/';
+}
+
+//----------------------------------------------------------------------------//
+ImageManager::ImageManager() :
+    d_imageLookup(MinimumLookupCapacity, EmptyLookupBucket),
+    d_imageLookupUsed(0),
+    d_generation(0),
+    d_atlasingMode(ImageAtlasingMode::Disabled),
+    d_atlasSize(1024.0f, 1024.0f),
+    d_atlasMaxImageSize(256.0f, 256.0f),
+    d_atlasNameCounter(0)
 {
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
 
@@ -120,6 +162,9 @@ ImageManager::~ImageManager()
 {
     destroyAll();
 
+    while (!d_atlasAllocations.empty())
+        releaseAtlasAllocation(d_atlasAllocations.begin()->first);
+
     while (!d_factories.empty())
         removeImageType(d_factories.begin()->first);
 
@@ -153,7 +198,7 @@ bool ImageManager::isImageTypeAvailable(const String& name) const
 //----------------------------------------------------------------------------//
 Image& ImageManager::create(const String& type, const String& name)
 {
-    if (d_images.find(name) != d_images.end())
+    if (isDefined(name))
         throw AlreadyExistsException(
             "Image already exists: " + name);
 
@@ -166,6 +211,7 @@ Image& ImageManager::create(const String& type, const String& name)
     ImageFactory* factory = i->second;
     Image& image = factory->create(name);
     d_images[name] = std::make_pair(&image, factory);
+    addImageSlot(image);
 
         String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
 
@@ -185,7 +231,7 @@ Image& ImageManager::create(const XMLAttributes& attributes)
         throw InvalidRequestException(
             "Invalid (empty) image name passed to create.");
 
-    if (d_images.find(name) != d_images.end())
+    if (isDefined(name))
         throw AlreadyExistsException(
             "Image already exists: " + name);
 
@@ -212,6 +258,7 @@ Image& ImageManager::create(const XMLAttributes& attributes)
     }
 
     d_images[name] = std::make_pair(&image, factory);
+    addImageSlot(image);
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
     Logger::getSingleton().logEvent(
@@ -242,9 +289,13 @@ void ImageManager::destroy(ImageMap::iterator& iter)
     Logger::getSingleton().logEvent(
         "[ImageManager] Deleted image: " + iter->first);
 
+    removeImageSlot(iter->first);
+
     // use the stored factory to destroy the image it created.
     iter->second.second->destroy(*iter->second.first);
 
+    releaseAtlasReference(iter->first);
+
     d_images.erase(iter);
 }
 
@@ -258,19 +309,153 @@ void ImageManager::destroyAll()
 //----------------------------------------------------------------------------//
 Image& ImageManager::get(const String& name) const
 {
-    ImageMap::const_iterator i = d_images.find(name);
-    
-    if (i == d_images.end())
+    const std::uint32_t index = findImageSlot(name, hashImageName(name));
+
+    if (index == ImageHandle::InvalidIndex)
         throw UnknownObjectException(
             "Image not defined: " + name);
 
-    return *i->second.first;
+    return *d_imageSlots[index].d_image;
 }
 
 //----------------------------------------------------------------------------//
 bool ImageManager::isDefined(const String& name) const
 {
-    return d_images.find(name) != d_images.end();
+    return findImageSlot(name, hashImageName(name)) != ImageHandle::InvalidIndex;
+}
+
+//----------------------------------------------------------------------------//
+ImageHandle ImageManager::getHandle(const String& name) const
+{
+    return getHandle(name, hashImageName(name));
+}
+
+//----------------------------------------------------------------------------//
+ImageHandle ImageManager::getHandle(const String& name,
+                                    std::size_t name_hash) const
+{
+    const std::uint32_t index = findImageSlot(name, name_hash);
+
+    if (index == ImageHandle::InvalidIndex)
+        return ImageHandle();
+
+    return ImageHandle(index, d_imageSlots[index].d_generation);
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t ImageManager::findImageSlot(const String& name,
+                                          std::size_t name_hash) const
+{
+    const std::size_t mask = d_imageLookup.size() - 1;
+
+    for (std::size_t pos = name_hash & mask; ; pos = (pos + 1) & mask)
+    {
+        const std::uint32_t index = d_imageLookup[pos];
+
+        if (index == EmptyLookupBucket)
+            return ImageHandle::InvalidIndex;
+
+        if (index == DeletedLookupBucket)
+            continue;
+
+        const ImageSlot& slot = d_imageSlots[index];
+        if (slot.d_nameHash == name_hash && slot.d_image->getName() == name)
+            return index;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::addImageSlot(Image& image)
+{
+    // keep the table at most half full, counting deleted buckets
+    if ((d_imageLookupUsed + 1) * 2 > d_imageLookup.size())
+    {
+        const std::size_t live = d_imageSlots.size() - d_freeImageSlots.size() + 1;
+        std::size_t capacity = MinimumLookupCapacity;
+        while (capacity < live * 4)
+            capacity *= 2;
+
+        rebuildImageLookup(capacity);
+    }
+
+    std::uint32_t index;
+    if (d_freeImageSlots.empty())
+    {
+        index = static_cast<std::uint32_t>(d_imageSlots.size());
+        ImageSlot slot;
+        slot.d_generation = 0;
+        d_imageSlots.push_back(slot);
+    }
+    else
+    {
+        index = d_freeImageSlots.back();
+        d_freeImageSlots.pop_back();
+    }
+
+    ImageSlot& slot = d_imageSlots[index];
+    slot.d_image = &image;
+    slot.d_nameHash = hashImageName(image.getName());
+
+    const std::size_t mask = d_imageLookup.size() - 1;
+    std::size_t pos = slot.d_nameHash & mask;
+    while (d_imageLookup[pos] != EmptyLookupBucket &&
+           d_imageLookup[pos] != DeletedLookupBucket)
+        pos = (pos + 1) & mask;
+
+    if (d_imageLookup[pos] == EmptyLookupBucket)
+        ++d_imageLookupUsed;
+
+    d_imageLookup[pos] = index;
+    ++d_generation;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::removeImageSlot(const String& name)
+{
+    const std::size_t hash = hashImageName(name);
+    const std::size_t mask = d_imageLookup.size() - 1;
+
+    for (std::size_t pos = hash & mask; d_imageLookup[pos] != EmptyLookupBucket;
+         pos = (pos + 1) & mask)
+    {
+        const std::uint32_t index = d_imageLookup[pos];
+
+        if (index == DeletedLookupBucket)
+            continue;
+
+        ImageSlot& slot = d_imageSlots[index];
+        if (slot.d_nameHash != hash || slot.d_image->getName() != name)
+            continue;
+
+        d_imageLookup[pos] = DeletedLookupBucket;
+        slot.d_image = nullptr;
+        ++slot.d_generation;
+        d_freeImageSlots.push_back(index);
+        ++d_generation;
+        return;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::rebuildImageLookup(std::size_t capacity)
+{
+    d_imageLookup.assign(capacity, EmptyLookupBucket);
+    d_imageLookupUsed = 0;
+
+    const std::size_t mask = capacity - 1;
+
+    for (std::size_t i = 0; i < d_imageSlots.size(); ++i)
+    {
+        if (!d_imageSlots[i].d_image)
+            continue;
+
+        std::size_t pos = d_imageSlots[i].d_nameHash & mask;
+        while (d_imageLookup[pos] != EmptyLookupBucket)
+            pos = (pos + 1) & mask;
+
+        d_imageLookup[pos] = static_cast<std::uint32_t>(i);
+        ++d_imageLookupUsed;
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -316,10 +501,48 @@ void ImageManager::destroyImageCollection(const String& prefix,
 void ImageManager::addBitmapImageFromFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
+    const String& group =
+        resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group;
+
+    Texture* tex = nullptr;
+
+    if (d_atlasingMode != ImageAtlasingMode::Disabled)
+    {
+        if (isDefined(name))
+            throw AlreadyExistsException(
+                "Image already exists: " + name);
+
+        std::vector<std::uint8_t> pixels;
+        Sizef size(0.0f, 0.0f);
+        Rectf area(0.0f, 0.0f, 0.0f, 0.0f);
+
+        if (TextureAtlas* atlas = packImageFile(filename, group, pixels, size, area))
+        {
+            AtlasAllocation& allocation = d_atlasAllocations[name];
+            allocation.d_atlas = atlas;
+            allocation.d_area = area;
+            allocation.d_refCount = 0;
+
+            BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
+            image.setTexture(&atlas->getTexture());
+            image.setImageArea(area);
+            addAtlasReference(name, name);
+            return;
+        }
+
+        // too big for an atlas, but already decoded so avoid loading it again
+        if (!pixels.empty())
+        {
+            tex = &System::getSingleton().getRenderer()->createTexture(name);
+            tex->loadFromMemory(pixels.data(), size, Texture::PixelFormat::Rgba);
+        }
+    }
+
     // create texture from image
-    Texture* tex = &System::getSingleton().getRenderer()->
-        createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+    if (!tex)
+        tex = &System::getSingleton().getRenderer()->
+            createTexture(name, filename, group);
+    registerImageFileTexture(*tex, filename, group);
 
     BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
     image.setTexture(tex);
@@ -327,6 +550,150 @@ void ImageManager::addBitmapImageFromFile(const String& name, const String& file
     image.setImageArea(rect);
 }
 
+//----------------------------------------------------------------------------//
+TextureAtlas* ImageManager::packImageFile(const String& filename,
+                                          const String& resource_group,
+                                          std::vector<std::uint8_t>& pixels,
+                                          Sizef& size, Rectf& area)
+{
+    pixels.clear();
+
+    if (!TextureAtlas::loadImageData(filename, resource_group, pixels, size))
+    {
+        pixels.clear();
+        return nullptr;
+    }
+
+    if (size.d_width > d_atlasMaxImageSize.d_width ||
+        size.d_height > d_atlasMaxImageSize.d_height)
+        return nullptr;
+
+    TextureAtlas* atlas = nullptr;
+
+    for (std::size_t i = 0; i < d_atlases.size() && !atlas; ++i)
+    {
+        if (d_atlases[i]->addImage(pixels.data(), size, area))
+            atlas = d_atlases[i];
+    }
+
+    if (!atlas)
+    {
+        const float maxSize = static_cast<float>(
+            System::getSingleton().getRenderer()->getMaxTextureSize());
+        const Sizef atlasSize(std::min(d_atlasSize.d_width, maxSize),
+                              std::min(d_atlasSize.d_height, maxSize));
+
+        atlas = new TextureAtlas("ImageManager_atlas_" +
+            PropertyHelper<std::uint32_t>::toString(d_atlasNameCounter++),
+            atlasSize);
+        // the packed images are not kept, so atlases can't be evicted
+        TextureResidencyManager::getSingleton().registerTexture(
+            atlas->getTexture(), TextureResidencyManager::Category::Imageset);
+
+        if (!atlas->addImage(pixels.data(), size, area))
+        {
+            delete atlas;
+            return nullptr;
+        }
+
+        d_atlases.push_back(atlas);
+
+        Logger::getSingleton().logEvent(
+            "[ImageManager] Created image atlas: " + atlas->getName());
+    }
+
+    Logger::getSingleton().logEvent(
+        "[ImageManager] Packed image file '" + filename + "' into atlas: " +
+        atlas->getName() + " (occupancy " +
+        PropertyHelper<float>::toString(atlas->getOccupancy() * 100.0f) + "%)");
+
+    return atlas;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::addAtlasReference(const String& image_name,
+                                     const String& allocation_name)
+{
+    ++d_atlasAllocations[allocation_name].d_refCount;
+    d_atlasedImages[image_name] = allocation_name;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::releaseAtlasReference(const String& image_name)
+{
+    std::unordered_map<String, String>::iterator i = d_atlasedImages.find(image_name);
+
+    if (i == d_atlasedImages.end())
+        return;
+
+    const String allocation_name(i->second);
+    d_atlasedImages.erase(i);
+
+    std::unordered_map<String, AtlasAllocation>::iterator a =
+        d_atlasAllocations.find(allocation_name);
+
+    if (a != d_atlasAllocations.end() && --a->second.d_refCount == 0)
+        releaseAtlasAllocation(allocation_name);
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::releaseAtlasAllocation(const String& allocation_name)
+{
+    std::unordered_map<String, AtlasAllocation>::iterator i =
+        d_atlasAllocations.find(allocation_name);
+
+    if (i == d_atlasAllocations.end())
+        return;
+
+    TextureAtlas* const atlas = i->second.d_atlas;
+    atlas->releaseImage(i->second.d_area);
+    d_atlasAllocations.erase(i);
+
+    if (atlas->getImageCount() != 0)
+        return;
+
+    Logger::getSingleton().logEvent(
+        "[ImageManager] Destroying empty image atlas: " + atlas->getName());
+
+    d_atlases.erase(std::find(d_atlases.begin(), d_atlases.end(), atlas));
+    delete atlas;
+}
+
+//----------------------------------------------------------------------------//
+const TextureAtlas& ImageManager::getAtlas(std::size_t index) const
+{
+    if (index >= d_atlases.size())
+        throw InvalidRequestException(
+            "Atlas index out of range: " +
+            PropertyHelper<std::uint32_t>::toString(static_cast<std::uint32_t>(index)));
+
+    return *d_atlases[index];
+}
+
+//----------------------------------------------------------------------------//
+float ImageManager::getAtlasOccupancy() const
+{
+    double used = 0.0;
+    double total = 0.0;
+
+    for (std::size_t i = 0; i < d_atlases.size(); ++i)
+    {
+        const Sizef& size = d_atlases[i]->getSize();
+        const double area = static_cast<double>(size.d_width) * size.d_height;
+
+        used += d_atlases[i]->getOccupancy() * area;
+        total += area;
+    }
+
+    return total > 0.0 ? static_cast<float>(used / total) : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageManager::isImageAtlased(const String& name) const
+{
+    return d_atlasedImages.find(name) != d_atlasedImages.end();
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::notifyDisplaySizeChanged(const Sizef& size)
 {
@@ -372,6 +739,21 @@ void ImageManager::elementEndLocal(const String& element)
     // ensure that everything is reset to default values when the Imageset ends
     if (element == ImagesetElement)
     {
+        // drop an atlas allocation that ended up without any images
+        if (!s_atlasedImagesetName.empty())
+        {
+            const String allocation_name(
+                getImagesetAllocationName(s_atlasedImagesetName));
+
+            std::unordered_map<String, AtlasAllocation>::const_iterator i =
+                d_atlasAllocations.find(allocation_name);
+
+            if (i != d_atlasAllocations.end() && i->second.d_refCount == 0)
+                releaseAtlasAllocation(allocation_name);
+
+            s_atlasedImagesetName = "";
+        }
+
         s_texture = nullptr;
         s_SVGData = nullptr;
         s_imagesetType = "";
@@ -446,7 +828,8 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
     String image_data_name = "";
 
     if (s_imagesetType == "BitmapImage")
-        image_data_name = s_texture->getName();
+        image_data_name = s_atlasedImagesetName.empty() ?
+            s_texture->getName() : s_atlasedImagesetName;
     else if (s_imagesetType == "SVGImage")
         image_data_name = s_SVGData->getName();
 
@@ -466,10 +849,26 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
     // SVGData's) name
     rw_attrs.add(ImageNameAttribute, image_name);
 
+    bool uses_atlas = false;
+
     if (s_imagesetType == "BitmapImage")
     {
         if (!rw_attrs.exists(ImageTextureAttribute))
             rw_attrs.add(ImageTextureAttribute, image_data_name);
+
+        // point images of an atlased imageset at the right part of the atlas
+        if (!s_atlasedImagesetName.empty() &&
+            rw_attrs.getValueAsString(ImageTextureAttribute) == s_atlasedImagesetName)
+        {
+            rw_attrs.add(ImageTextureAttribute, s_texture->getName());
+            rw_attrs.add(ImageXPosAttribute, PropertyHelper<std::int32_t>::toString(
+                attributes.getValueAsInteger(ImageXPosAttribute, 0) +
+                static_cast<std::int32_t>(s_atlasOffset.x)));
+            rw_attrs.add(ImageYPosAttribute, PropertyHelper<std::int32_t>::toString(
+                attributes.getValueAsInteger(ImageYPosAttribute, 0) +
+                static_cast<std::int32_t>(s_atlasOffset.y)));
+            uses_atlas = true;
+        }
     }
     else if (s_imagesetType == "SVGImage")
     {
@@ -491,6 +890,9 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
 
     d_deleteChainedHandler = false;
     d_chainedHandler = &create(rw_attrs);
+
+    if (uses_atlas)
+        addAtlasReference(image_name, getImagesetAllocationName(s_atlasedImagesetName));
 }
 
 //----------------------------------------------------------------------------//
@@ -507,10 +909,54 @@ void ImageManager::retrieveImagesetTexture(const String& name, const String& fil
     }
     else
     {
+        const String& group = resource_group.empty() ?
+            d_imagesetDefaultResourceGroup : resource_group;
+
+        if (d_atlasingMode == ImageAtlasingMode::LooseImagesAndImagesets)
+        {
+            const String allocation_name(getImagesetAllocationName(name));
+
+            std::unordered_map<String, AtlasAllocation>::iterator i =
+                d_atlasAllocations.find(allocation_name);
+
+            if (i == d_atlasAllocations.end())
+            {
+                std::vector<std::uint8_t> pixels;
+                Sizef size(0.0f, 0.0f);
+                Rectf area(0.0f, 0.0f, 0.0f, 0.0f);
+
+                if (TextureAtlas* atlas = packImageFile(filename, group, pixels, size, area))
+                {
+                    AtlasAllocation allocation;
+                    allocation.d_atlas = atlas;
+                    allocation.d_area = area;
+                    allocation.d_refCount = 0;
+                    i = d_atlasAllocations.insert(
+                        std::make_pair(allocation_name, allocation)).first;
+                }
+                else if (!pixels.empty())
+                {
+                    // too big for an atlas, but already decoded
+                    s_texture = &renderer->createTexture(name);
+                    s_texture->loadFromMemory(pixels.data(), size,
+                                              Texture::PixelFormat::Rgba);
+                    registerImageFileTexture(*s_texture, filename, group);
+                    return;
+                }
+            }
+
+            if (i != d_atlasAllocations.end())
+            {
+                s_texture = &i->second.d_atlas->getTexture();
+                s_atlasOffset = i->second.d_area.getPosition();
+                s_atlasedImagesetName = name;
+                return;
+            }
+        }
+
         // create texture from image
-        s_texture = &renderer->createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup :
-            resource_group);
+        s_texture = &renderer->createTexture(name, filename, group);
+        registerImageFileTexture(*s_texture, filename, group);
     }
 }
 
@@ -535,6 +981,78 @@ void ImageManager::retrieveImagesetSVGData(const String& name, const String& fil
 }
 
 //----------------------------------------------------------------------------//
+ImageReference::ImageReference() :
+    d_nameHash(0),
+    d_generation(0),
+    d_resolved(false)
+{
+}
 
-} // End of  CEGUI namespace section
+//----------------------------------------------------------------------------//
+ImageReference::ImageReference(const String& name) :
+    d_name(name),
+    d_nameHash(ImageManager::hashImageName(name)),
+    d_generation(0),
+    d_resolved(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+void ImageReference::setName(const String& name)
+{
+    d_name = name;
+    d_nameHash = ImageManager::hashImageName(name);
+    d_handle = ImageHandle();
+    d_resolved = false;
+}
 
+//----------------------------------------------------------------------------//
+Image* ImageReference::get() const
+{
+    if (d_name.empty())
+        return nullptr;
+
+    const ImageManager& mgr = ImageManager::getSingleton();
+
+    // names that don't resolve are cached too, until an image is created
+    if (!d_resolved || d_generation != mgr.getGeneration())
+    {
+        d_handle = mgr.getHandle(d_name, d_nameHash);
+        d_generation = mgr.getGeneration();
+        d_resolved = true;
+    }
+
+    return mgr.getImage(d_handle);
+}
+
+//----------------------------------------------------------------------------//
+const Image* ImageReference::getFromProperty(const Window& wnd,
+                                       const String& property_name)
+{
+    const Property* const property = wnd.getPropertyInstance(property_name);
+
+    const PropertyDefinition<Image*>* const definition =
+        dynamic_cast<const PropertyDefinition<Image*>*>(property);
+
+    // anything other than a defined user string goes the usual way
+    if (!definition || !wnd.isUserStringDefined(definition->getUserStringName()))
+        return wnd.getProperty<Image*>(property_name);
+
+    const String& image_name = wnd.getUserString(definition->getUserStringName());
+
+    if (image_name.empty())
+        return nullptr;
+
+    if (image_name != d_name)
+        setName(image_name);
+
+    if (Image* const image = get())
+        return image;
+
+    // let PropertyHelper report the failure in the usual manner
+    return PropertyHelper<Image*>::fromString(image_name);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
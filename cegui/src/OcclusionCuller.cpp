@@ -0,0 +1,251 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Skips drawing windows hidden behind opaque windows
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/OcclusionCuller.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/RenderingContext.h"
+#include <algorithm>
+
+namespace CEGUI
+{
+namespace
+{
+// Pieces a rect may be split into before the test gives up, reporting the
+// rect as visible.
+const std::size_t MaxCoverageFragments = 64;
+
+float getArea(const Rectf& rect)
+{
+    return rect.getWidth() * rect.getHeight();
+}
+
+bool contains(const Rectf& outer, const Rectf& inner)
+{
+    return inner.left() >= outer.left() && inner.top() >= outer.top() &&
+           inner.right() <= outer.right() && inner.bottom() <= outer.bottom();
+}
+
+// Add the parts of \a rect outside of \a cut to \a out, as up to 4 rects.
+void subtract(const Rectf& rect, const Rectf& cut, std::vector<Rectf>& out)
+{
+    const Rectf overlap(rect.getIntersection(cut));
+    if (overlap.empty())
+    {
+        out.push_back(rect);
+        return;
+    }
+
+    if (rect.top() < overlap.top())
+        out.push_back(Rectf(rect.left(), rect.top(), rect.right(), overlap.top()));
+    if (overlap.bottom() < rect.bottom())
+        out.push_back(Rectf(rect.left(), overlap.bottom(), rect.right(), rect.bottom()));
+    if (rect.left() < overlap.left())
+        out.push_back(Rectf(rect.left(), overlap.top(), overlap.left(), overlap.bottom()));
+    if (overlap.right() < rect.right())
+        out.push_back(Rectf(overlap.right(), overlap.top(), rect.right(), overlap.bottom()));
+}
+
+}
+
+//----------------------------------------------------------------------------//
+OcclusionCuller::OcclusionCuller()
+{
+}
+
+//----------------------------------------------------------------------------//
+OcclusionCuller::~OcclusionCuller()
+{
+}
+
+//----------------------------------------------------------------------------//
+void OcclusionCuller::setEnabled(bool setting)
+{
+    if (d_enabled == setting)
+        return;
+
+    reset();
+    d_enabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+void OcclusionCuller::reset()
+{
+    for (Window* wnd : d_culled)
+        wnd->d_occluded = false;
+
+    d_culled.clear();
+    d_occluders.clear();
+    d_statistics = Statistics();
+}
+
+//----------------------------------------------------------------------------//
+void OcclusionCuller::update(Window* root, std::uint32_t drawModeMask)
+{
+    if (!d_enabled)
+        return;
+
+    reset();
+
+    if (!root || !root->getGUIContextPtr())
+        return;
+
+    collect(*root, root->getGUIContextPtr(), drawModeMask);
+
+    // Front to back: everything in d_occluders is drawn after the window.
+    // Children are drawn after their parent, so never hidden by it.
+    for (auto it = d_candidates.rbegin(); it != d_candidates.rend(); ++it)
+    {
+        Window& wnd = *it->d_window;
+
+        const Rectf& area = wnd.getOuterRectClipper();
+        if (area.empty())
+            continue;
+
+        ++d_statistics.d_testedWindows;
+
+        if (isCovered(area, d_occluders))
+        {
+            wnd.d_occluded = true;
+            d_culled.push_back(&wnd);
+            continue;
+        }
+
+        // effects may change the alpha of the cached content
+        if (it->d_hasSurface &&
+            static_cast<RenderingWindow*>(wnd.getRenderingSurface())->getRenderEffect())
+            continue;
+
+        const Rectf opaque(wnd.getOpaqueRect().getIntersection(area));
+        if (!opaque.empty())
+            addOccluder(opaque);
+    }
+
+    d_statistics.d_culledWindows = d_culled.size();
+    d_statistics.d_occluders = d_occluders.size();
+    d_candidates.clear();
+}
+
+//----------------------------------------------------------------------------//
+void OcclusionCuller::collect(Window& window, const RenderingSurface* context,
+                              std::uint32_t drawModeMask)
+{
+    if (!window.isVisible())
+        return;
+
+    const bool drawn = window.checkIfDrawMaskAllowsDrawing(drawModeMask);
+
+    // The content of a RenderingWindow is drawn back as a single quad
+    if (RenderingSurface* surface = window.getRenderingSurface())
+    {
+        if (drawn && surface->isRenderingWindow() &&
+            &static_cast<RenderingWindow*>(surface)->getOwner() == context &&
+            window.getRotation() == glm::quat(1.f, 0.f, 0.f, 0.f))
+        {
+            const Candidate candidate = { &window, true };
+            d_candidates.push_back(candidate);
+        }
+
+        return;
+    }
+
+    // Other queues are drawn in a different order, and all descendants
+    // inherit the context.
+    RenderingContext ctx;
+    window.getRenderingContext(ctx);
+    if (ctx.surface != context || ctx.queue != RenderQueueID::Base)
+        return;
+
+    if (drawn)
+    {
+        const Candidate candidate = { &window, false };
+        d_candidates.push_back(candidate);
+    }
+
+    for (Window* child : window.d_drawList)
+        collect(*child, context, drawModeMask);
+}
+
+//----------------------------------------------------------------------------//
+void OcclusionCuller::addOccluder(const Rectf& rect)
+{
+    for (const Rectf& occluder : d_occluders)
+        if (contains(occluder, rect))
+            return;
+
+    d_occluders.erase(std::remove_if(d_occluders.begin(), d_occluders.end(),
+        [&rect](const Rectf& occluder) { return contains(rect, occluder); }),
+        d_occluders.end());
+
+    d_occluders.push_back(rect);
+
+    if (d_occluders.size() > d_maxOccluders)
+        d_occluders.erase(std::min_element(d_occluders.begin(), d_occluders.end(),
+            [](const Rectf& a, const Rectf& b) { return getArea(a) < getArea(b); }));
+}
+
+//----------------------------------------------------------------------------//
+void OcclusionCuller::onWindowDetached(Window* window)
+{
+    auto it = std::find(d_culled.begin(), d_culled.end(), window);
+    if (it == d_culled.end())
+        return;
+
+    window->d_occluded = false;
+    d_culled.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+bool OcclusionCuller::isCovered(const Rectf& rect,
+                                const std::vector<Rectf>& occluders)
+{
+    std::vector<Rectf> remaining(1, rect);
+    std::vector<Rectf> pieces;
+
+    for (const Rectf& occluder : occluders)
+    {
+        pieces.clear();
+        for (const Rectf& piece : remaining)
+            subtract(piece, occluder, pieces);
+
+        if (pieces.empty())
+            return true;
+
+        if (pieces.size() > MaxCoverageFragments)
+            return false;
+
+        remaining.swap(pieces);
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+}
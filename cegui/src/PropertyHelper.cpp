@@ -198,17 +198,11 @@ PropertyHelper<Image*>::fromString(const String& str)
     if (str.empty())
         return nullptr;
 
-    return_type image;
+    const ImageManager& imgr = ImageManager::getSingleton();
+    return_type image = imgr.getImage(imgr.getHandle(str));
 
-    try
-    {
-        image = &ImageManager::getSingleton().get(str);
-    }
-    catch (UnknownObjectException&)
-    {
-        image = nullptr;
+    if (!image)
         throwParsingException(getDataTypeName(), str);
-    }
 
     return image;
 }
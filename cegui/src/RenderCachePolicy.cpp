@@ -0,0 +1,362 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Automatic render-to-texture caching of static window trees
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RenderCachePolicy.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/TextureTarget.h"
+#include <algorithm>
+#include <cmath>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+RenderCachePolicy::RenderCachePolicy()
+{
+}
+
+//----------------------------------------------------------------------------//
+RenderCachePolicy::~RenderCachePolicy()
+{
+    // cached windows may outlive the policy, their textures stay registered
+    if (TextureResidencyManager* residency = TextureResidencyManager::getSingletonPtr())
+        residency->removeEvictor(*this);
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::setEnabled(bool setting)
+{
+    if (d_enabled == setting)
+        return;
+
+    clear();
+    d_records.clear();
+    d_promotionCount = 0;
+    d_demotionCount = 0;
+    d_texturesUnavailable = false;
+    d_enabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::update(Window* root)
+{
+    if (!d_enabled)
+        return;
+
+    if (root && (d_frame % d_evaluationInterval) == 0)
+        evaluate(*root);
+
+    ++d_frame;
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::onWindowDetached(Window* window)
+{
+    auto it = d_records.find(window);
+    if (it == d_records.end())
+        return;
+
+    // Nobody would manage the surface once the window has left the context
+    if (it->second.d_cached)
+        release(*window, it->second);
+
+    d_records.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::clear()
+{
+    while (!d_cached.empty())
+    {
+        Window* wnd = d_cached.back();
+        demote(*wnd, getRecord(*wnd));
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool RenderCachePolicy::isCached(const Window* window) const
+{
+    auto it = d_records.find(window);
+    return it != d_records.end() && it->second.d_cached;
+}
+
+//----------------------------------------------------------------------------//
+std::vector<RenderCachePolicy::Entry> RenderCachePolicy::getCacheEntries() const
+{
+    std::vector<Entry> entries;
+    entries.reserve(d_cached.size());
+
+    for (Window* wnd : d_cached)
+    {
+        const Record& record = d_records.find(wnd)->second;
+        Entry entry = { wnd, record.d_rate, record.d_vertexCount, record.d_textureBytes };
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
+
+//----------------------------------------------------------------------------//
+float RenderCachePolicy::getInvalidationRate(const Window* window) const
+{
+    auto it = d_records.find(window);
+    return (it != d_records.end()) ? it->second.d_rate : 0.f;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t RenderCachePolicy::getUsedMemory() const
+{
+    std::size_t bytes = 0;
+    for (Window* wnd : d_cached)
+        bytes += d_records.find(wnd)->second.d_textureBytes;
+
+    return bytes;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t RenderCachePolicy::estimateTextureBytes(const Window& window)
+{
+    // TextureTargets are sized to the unclipped area of the window, 32bpp
+    const Sizef size(window.getUnclippedOuterRect().get().getSize());
+    const std::size_t width = static_cast<std::size_t>(std::ceil(std::max(0.f, size.d_width)));
+    const std::size_t height = static_cast<std::size_t>(std::ceil(std::max(0.f, size.d_height)));
+
+    return width * height * 4;
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::evictTexture(Texture& texture)
+{
+    for (Window* wnd : d_cached)
+    {
+        if (getSurfaceTexture(*wnd) == &texture)
+        {
+            demote(*wnd, getRecord(*wnd));
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+RenderCachePolicy::Record& RenderCachePolicy::getRecord(const Window& window)
+{
+    auto it = d_records.find(&window);
+    if (it != d_records.end())
+        return it->second;
+
+    Record& record = d_records[&window];
+    record.d_firstSeenFrame = d_frame;
+    return record;
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::recordInvalidation(Window& window)
+{
+    // An invalidated window forces every cached ancestor to be redrawn, so
+    // the frame counts against the whole chain. Ancestors already marked in
+    // this frame have had the rest of the chain marked too.
+    for (Window* wnd = &window; wnd; wnd = wnd->getParent())
+    {
+        Record& record = getRecord(*wnd);
+        if (record.d_lastInvalidatedFrame == d_frame)
+            break;
+
+        record.d_lastInvalidatedFrame = d_frame;
+        ++record.d_invalidatedFrames;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::evaluate(Window& root)
+{
+    for (auto& pair : d_records)
+    {
+        Record& record = pair.second;
+        const float sample = std::min(1.f,
+            static_cast<float>(record.d_invalidatedFrames) / d_evaluationInterval);
+
+        record.d_rate = (record.d_rate + sample) * 0.5f;
+        record.d_invalidatedFrames = 0;
+    }
+
+    // Demote churning, hidden and (when over budget) the most recently cached
+    // windows first, so their memory is available to the promotions below.
+    std::size_t usedMemory = 0;
+    for (std::size_t i = 0; i < d_cached.size(); )
+    {
+        Window* wnd = d_cached[i];
+        Record& record = getRecord(*wnd);
+
+        // The application replaced the surface or took it over
+        if (!wnd->isUsingRenderCacheSurface() || wnd->isUsingAutoRenderingSurface())
+        {
+            release(*wnd, record);
+            continue;
+        }
+
+        record.d_textureBytes = estimateTextureBytes(*wnd);
+
+        if (record.d_rate > d_maxInvalidationRate || !wnd->isEffectiveVisible() ||
+            usedMemory + record.d_textureBytes > d_memoryBudget)
+        {
+            demote(*wnd, record);
+            continue;
+        }
+
+        usedMemory += record.d_textureBytes;
+        ++i;
+    }
+
+    if (d_texturesUnavailable)
+        return;
+
+    // The root usually covers the whole target and is not worth a texture
+    for (std::size_t i = 0; i < root.getChildCount() && !d_texturesUnavailable; ++i)
+        considerForCaching(*root.getChildAtIndex(i), usedMemory);
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::considerForCaching(Window& window, std::size_t& usedMemory)
+{
+    if (!window.isVisible())
+        return;
+
+    // Already rendered through a texture, either by us or by the application
+    if (window.isUsingAutoRenderingSurface() || window.getRenderingSurface())
+        return;
+
+    Record& record = getRecord(window);
+    if (isStatic(record))
+    {
+        const std::size_t bytes = estimateTextureBytes(window);
+        if (bytes && usedMemory + bytes <= d_memoryBudget &&
+            TextureResidencyManager::getSingleton().canAccommodate(bytes))
+        {
+            // Descendants can only have less geometry than this subtree
+            const std::size_t vertices = countVertices(window, d_minVertexCount);
+            if (vertices < d_minVertexCount)
+                return;
+
+            record.d_vertexCount = vertices;
+            record.d_textureBytes = bytes;
+            promote(window, record);
+
+            if (record.d_cached)
+                usedMemory += bytes;
+
+            return;
+        }
+    }
+
+    // Look for static parts further down
+    for (std::size_t i = 0; i < window.getChildCount() && !d_texturesUnavailable; ++i)
+        considerForCaching(*window.getChildAtIndex(i), usedMemory);
+}
+
+//----------------------------------------------------------------------------//
+bool RenderCachePolicy::isStatic(const Record& record) const
+{
+    const std::uint64_t since = std::max(record.d_firstSeenFrame, record.d_lastInvalidatedFrame);
+    return d_frame - since >= d_minStaticFrames;
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::promote(Window& window, Record& record)
+{
+    window.setUsingRenderCacheSurface(true);
+
+    if (!window.getRenderingSurface())
+    {
+        // The renderer does not support TextureTargets, there is no point
+        // in trying again for other windows.
+        window.setUsingRenderCacheSurface(false);
+        d_texturesUnavailable = true;
+        return;
+    }
+
+    record.d_cached = true;
+    d_cached.push_back(&window);
+    ++d_promotionCount;
+
+    // the content can be drawn again, so the texture may be evicted
+    TextureResidencyManager::getSingleton().setEvictor(*getSurfaceTexture(window), this);
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::demote(Window& window, Record& record)
+{
+    release(window, record);
+    ++d_demotionCount;
+}
+
+//----------------------------------------------------------------------------//
+void RenderCachePolicy::release(Window& window, Record& record)
+{
+    // the texture survives when the application uses the surface too
+    if (Texture* texture = getSurfaceTexture(window))
+        TextureResidencyManager::getSingleton().setEvictor(*texture, nullptr);
+
+    window.setUsingRenderCacheSurface(false);
+
+    record.d_cached = false;
+    d_cached.erase(std::find(d_cached.begin(), d_cached.end(), &window));
+}
+
+//----------------------------------------------------------------------------//
+std::size_t RenderCachePolicy::countVertices(Window& window, std::size_t limit)
+{
+    std::size_t count = 0;
+    for (const GeometryBuffer* buffer : window.getGeometryBuffers())
+        count += buffer->getVertexCount();
+
+    for (std::size_t i = 0; i < window.getChildCount() && count < limit; ++i)
+    {
+        Window* child = window.getChildAtIndex(i);
+        if (child->isVisible())
+            count += countVertices(*child, limit - count);
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+Texture* RenderCachePolicy::getSurfaceTexture(const Window& window)
+{
+    // the application may have replaced the surface
+    if (!window.isUsingRenderCacheSurface() || !window.getRenderingSurface())
+        return nullptr;
+
+    // automatic surfaces are always RenderingWindows
+    return &static_cast<RenderingWindow*>(window.getRenderingSurface())->
+        getTextureTarget().getTexture();
+}
+
+//----------------------------------------------------------------------------//
+
+}
@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/RenderEffectManager.h"
+#include "CEGUI/TextureFilterEffect.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
@@ -42,6 +43,11 @@ RenderEffectManager::RenderEffectManager()
 
     Logger::getSingleton().logEvent(
         "CEGUI::RenderEffectManager Singleton created. (" + addressStr + ")");
+
+    // built-in effects, these work with Renderers that support texture filters
+    addEffect<BlurEffect>(BlurEffect::EffectName);
+    addEffect<ColourMatrixEffect>(ColourMatrixEffect::EffectName);
+    addEffect<DropShadowEffect>(DropShadowEffect::EffectName);
 }
 
 //---------------------------------------------------------------------------//
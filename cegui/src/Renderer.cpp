@@ -153,4 +153,10 @@ void Renderer::setFontScale(const float fontScale)
     FontManager::getSingleton().updateAllFonts();
 }
 
+//----------------------------------------------------------------------------//
+void Renderer::setCompactVertexFormatEnabled(bool setting)
+{
+    d_compactVertexFormatEnabled = setting && isCompactVertexFormatSupported();
+}
+
 }
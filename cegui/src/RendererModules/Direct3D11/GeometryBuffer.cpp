@@ -54,6 +54,9 @@ Direct3D11GeometryBuffer::~Direct3D11GeometryBuffer()
 
     if (d_inputLayout)
         d_inputLayout->Release();
+
+    if (d_compactInputLayout)
+        d_compactInputLayout->Release();
 }
 
 //----------------------------------------------------------------------------//
@@ -64,7 +67,7 @@ void Direct3D11GeometryBuffer::draw(std::uint32_t drawModeMask) const
     if (d_vertexData.empty())
         return;
 
-    if (d_geometryDirty)
+    if (d_geometryDirty || d_uploadedCompactSetting != d_owner.isCompactVertexFormatEnabled())
         updateVertexBuffer();
 
     auto d3dCtx = d_owner.getDirect3DDeviceContext();
@@ -95,10 +98,15 @@ void Direct3D11GeometryBuffer::draw(std::uint32_t drawModeMask) const
     shaderParameterBindings->setParameter("alphaPercentage", d_alpha);
 
     // set our buffer as the vertex source.
-    const UINT stride = getVertexAttributeElementCount() * sizeof(float);
+    const bool compact = (d_uploadedLayout != CompactVertexLayout::None);
+    const UINT stride = compact ? static_cast<UINT>(getCompactVertexStride()) :
+                                  getVertexAttributeElementCount() * sizeof(float);
     const UINT offset = 0;
     d3dCtx->IASetVertexBuffers(0, 1, &d_vertexBuffer, &stride, &offset);
-    d3dCtx->IASetInputLayout(d_inputLayout);
+    d3dCtx->IASetInputLayout(compact ? d_compactInputLayout : d_inputLayout);
+
+    if (d_uploadedLayout == CompactVertexLayout::Quads)
+        d3dCtx->IASetIndexBuffer(d_owner.getQuadIndexBuffer(), DXGI_FORMAT_R16_UINT, 0);
 
     d_owner.bindBlendMode(d_blendMode);
     d_owner.bindRasterizerState(d_clippingActive);
@@ -138,11 +146,22 @@ void Direct3D11GeometryBuffer::updateMatrix() const
 void Direct3D11GeometryBuffer::updateVertexBuffer() const
 {
     d_geometryDirty = false;
+    d_uploadedCompactSetting = d_owner.isCompactVertexFormatEnabled();
+    d_uploadedLayout = CompactVertexLayout::None;
 
     if (d_vertexData.empty())
         return;
 
-    const UINT dataSize = static_cast<UINT>(d_vertexData.size() * sizeof(float));
+    const void* data = d_vertexData.data();
+    UINT dataSize = static_cast<UINT>(d_vertexData.size() * sizeof(float));
+
+    if (d_uploadedCompactSetting && d_compactInputLayout &&
+        getCompactVertexLayout() != CompactVertexLayout::None)
+    {
+        d_uploadedLayout = getCompactVertexLayout();
+        data = getCompactVertexData().data();
+        dataSize = static_cast<UINT>(getCompactVertexData().size());
+    }
 
     if (d_bufferSize < dataSize)
     {
@@ -159,7 +178,7 @@ void Direct3D11GeometryBuffer::updateVertexBuffer() const
     box.front = 0;
     box.back  = 1;
 
-    d_owner.getDirect3DDeviceContext()->UpdateSubresource(d_vertexBuffer, 0, &box, d_vertexData.data(), 0, 0);
+    d_owner.getDirect3DDeviceContext()->UpdateSubresource(d_vertexBuffer, 0, &box, data, 0, 0);
 }
 
 //----------------------------------------------------------------------------//
@@ -195,7 +214,11 @@ void Direct3D11GeometryBuffer::drawDependingOnFillRule() const
     {
     */
 
-    d_owner.getDirect3DDeviceContext()->Draw(static_cast<UINT>(d_vertexCount), 0);
+    // The quad indices reproduce the original triangle list one to one
+    if (d_uploadedLayout == CompactVertexLayout::Quads)
+        d_owner.getDirect3DDeviceContext()->DrawIndexed(static_cast<UINT>(d_vertexCount), 0, 0);
+    else
+        d_owner.getDirect3DDeviceContext()->Draw(static_cast<UINT>(d_vertexCount), 0);
             /* 
     }
     else if(d_polygonFillRule == PolygonFillRule::EvenOdd)
@@ -262,6 +285,36 @@ void Direct3D11GeometryBuffer::finaliseVertexAttributes()
         throw RendererException(
             "Failed to create D3D InputLayout.");
     }
+
+    if (d_compactInputLayout)
+    {
+        d_compactInputLayout->Release();
+        d_compactInputLayout = nullptr;
+    }
+
+    // 2D float position, RGBA8 colour and 16 bit normalised texture
+    // coordinates, see GeometryBuffer::getCompactVertexData. The shaders'
+    // float3 POSITION input gets 0 for the missing z.
+    const D3D11_INPUT_ELEMENT_DESC compactLayout[] =
+    {
+        {"POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 8, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R16G16_UNORM, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0}
+    };
+
+    // Geometry with any other layout is never uploaded compactly
+    if (vertexLayoutVector.size() < 2 || vertexLayoutVector.size() > 3)
+        return;
+
+    if (FAILED(d_owner.getDirect3DDevice()->CreateInputLayout(compactLayout,
+                                            static_cast<UINT>(vertexLayoutVector.size()),
+                                            shaderWrapper->getVertShaderBufferPointer(),
+                                            shaderWrapper->getVertShaderBufferSize(),
+                                            &d_compactInputLayout)))
+    {
+        throw RendererException(
+            "Failed to create compact D3D InputLayout.");
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -64,6 +64,7 @@ Direct3D11Renderer::Direct3D11Renderer(ID3D11Device* device,
     , d_depthStencilStateDefault(nullptr)
     , d_defaultTarget(nullptr)
     , d_samplerState(nullptr)
+    , d_quadIndexBuffer(nullptr)
 {
  
 	if(!device || !deviceContext) 
@@ -80,6 +81,7 @@ Direct3D11Renderer::Direct3D11Renderer(ID3D11Device* device,
     initialiseBlendStates();
     initialiseRasterizerStates();
     initialiseDepthStencilState();
+    initialiseQuadIndexBuffer();
 
     initialiseShaders();
 }
@@ -108,6 +110,8 @@ Direct3D11Renderer::~Direct3D11Renderer()
         d_depthStencilStateDefault->Release();
     if (d_samplerState)
         d_samplerState->Release();
+    if (d_quadIndexBuffer)
+        d_quadIndexBuffer->Release();
 }
 
 //----------------------------------------------------------------------------//
@@ -563,6 +567,36 @@ void Direct3D11Renderer::bindBlendMode(BlendMode d_blendMode)
     }
 }
 
+//----------------------------------------------------------------------------//
+void Direct3D11Renderer::initialiseQuadIndexBuffer()
+{
+    // Indices for the largest buffer that is stored as quads
+    std::vector<std::uint16_t> indices(GeometryBuffer::MaxCompactQuadCount * 6);
+    GeometryBuffer::fillQuadIndices(indices.data(), GeometryBuffer::MaxCompactQuadCount);
+
+    D3D11_BUFFER_DESC bufferDesc;
+    bufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    bufferDesc.ByteWidth = static_cast<UINT>(indices.size() * sizeof(std::uint16_t));
+    bufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+    bufferDesc.CPUAccessFlags = 0;
+    bufferDesc.MiscFlags = 0;
+    bufferDesc.StructureByteStride = 0;
+
+    D3D11_SUBRESOURCE_DATA initialData;
+    initialData.pSysMem = indices.data();
+    initialData.SysMemPitch = 0;
+    initialData.SysMemSlicePitch = 0;
+
+    if (FAILED(d_device->CreateBuffer(&bufferDesc, &initialData, &d_quadIndexBuffer)))
+        throw RendererException("Failed to create the quad index buffer.");
+}
+
+//----------------------------------------------------------------------------//
+bool Direct3D11Renderer::isCompactVertexFormatSupported() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void Direct3D11Renderer::bindRasterizerState(bool scissorEnabled)
 {
@@ -52,6 +52,7 @@ static DXGI_FORMAT toD3DPixelFormat(const Texture::PixelFormat fmt)
         case Texture::PixelFormat::RgbaDxt1: return DXGI_FORMAT_BC1_UNORM;
         case Texture::PixelFormat::RgbaDxt3: return DXGI_FORMAT_BC2_UNORM;
         case Texture::PixelFormat::RgbaDxt5: return DXGI_FORMAT_BC3_UNORM;
+        case Texture::PixelFormat::RgbaBc7:  return DXGI_FORMAT_BC7_UNORM;
         default:                    return DXGI_FORMAT_UNKNOWN;
     }
 }
@@ -71,6 +72,7 @@ static size_t calculateDataWidth(const size_t width, Texture::PixelFormat fmt)
 
     case Texture::PixelFormat::RgbaDxt3:
     case Texture::PixelFormat::RgbaDxt5:
+    case Texture::PixelFormat::RgbaBc7:
         return ((width + 3) / 4) * 16;
 
     default:
@@ -501,6 +503,7 @@ bool Direct3D11Texture::isPixelFormatSupported(const PixelFormat fmt) const
         case PixelFormat::RgbaDxt1:
         case PixelFormat::RgbaDxt3:
         case PixelFormat::RgbaDxt5:
+        case PixelFormat::RgbaBc7:
             return true;
 
         default:
@@ -30,6 +30,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/System.h"
+#include "CEGUI/TextureDecompressor.h"
 
 #include <cstdint>
 
@@ -148,9 +149,11 @@ NullTexture::~NullTexture()
 }
 
 //----------------------------------------------------------------------------//
-bool NullTexture::isPixelFormatSupported(const PixelFormat) const
+bool NullTexture::isPixelFormatSupported(const PixelFormat fmt) const
 {
-    return true;
+    // Report the block compressed formats as unsupported so that codecs take
+    // their CPU decoding path, as they would on a renderer without support.
+    return !TextureDecompressor::isCompressed(fmt);
 }
 
 //----------------------------------------------------------------------------//
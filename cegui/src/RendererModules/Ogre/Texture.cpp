@@ -72,10 +72,13 @@ static size_t calculateDataSize(const Sizef size, Texture::PixelFormat fmt)
         return (static_cast<size_t>(size.d_width * size.d_height) * 4 + 7) / 8;
 
     case Texture::PixelFormat::RgbaDxt1:
+    case Texture::PixelFormat::RgbEtc2:
         return static_cast<size_t>( std::ceil(size.d_width / 4) * std::ceil(size.d_height / 4) * 8 );
 
     case Texture::PixelFormat::RgbaDxt3:
     case Texture::PixelFormat::RgbaDxt5:
+    case Texture::PixelFormat::RgbaBc7:
+    case Texture::PixelFormat::RgbaEtc2:
         return static_cast<size_t>( std::ceil(size.d_width / 4) * std::ceil(size.d_height / 4) * 16 );
 
     default:
@@ -590,6 +593,9 @@ Ogre::PixelFormatGpu OgreTexture::toOgrePixelFormat(const Texture::PixelFormat f
         case Texture::PixelFormat::RgbaDxt1:  return Ogre::PFG_BC1_UNORM;
         case Texture::PixelFormat::RgbaDxt3:  return Ogre::PFG_BC2_UNORM;
         case Texture::PixelFormat::RgbaDxt5:  return Ogre::PFG_BC3_UNORM;
+        case Texture::PixelFormat::RgbaBc7:   return Ogre::PFG_BC7_UNORM;
+        case Texture::PixelFormat::RgbEtc2:   return Ogre::PFG_ETC2_RGB8_UNORM;
+        case Texture::PixelFormat::RgbaEtc2:  return Ogre::PFG_ETC2_RGBA8_UNORM;
 
         default:
             throw InvalidRequestException(
@@ -621,6 +627,10 @@ Texture::PixelFormat OgreTexture::fromOgrePixelFormat(
         case Ogre::PFG_BC2_UNORM_SRGB:    return Texture::PixelFormat::RgbaDxt3;
         case Ogre::PFG_BC3_UNORM:         return Texture::PixelFormat::RgbaDxt5;
         case Ogre::PFG_BC3_UNORM_SRGB:    return Texture::PixelFormat::RgbaDxt5;
+        case Ogre::PFG_BC7_UNORM:         return Texture::PixelFormat::RgbaBc7;
+        case Ogre::PFG_BC7_UNORM_SRGB:    return Texture::PixelFormat::RgbaBc7;
+        case Ogre::PFG_ETC2_RGB8_UNORM:   return Texture::PixelFormat::RgbEtc2;
+        case Ogre::PFG_ETC2_RGBA8_UNORM:  return Texture::PixelFormat::RgbaEtc2;
 
         default:
             throw InvalidRequestException(
@@ -641,6 +651,9 @@ Ogre::PixelFormat OgreTexture::toOgrePixelFormat(const Texture::PixelFormat fmt)
         case Texture::PixelFormat::RgbaDxt1:  return Ogre::PF_DXT1;
         case Texture::PixelFormat::RgbaDxt3:  return Ogre::PF_DXT3;
         case Texture::PixelFormat::RgbaDxt5:  return Ogre::PF_DXT5;
+        case Texture::PixelFormat::RgbaBc7:   return Ogre::PF_BC7_UNORM;
+        case Texture::PixelFormat::RgbEtc2:   return Ogre::PF_ETC2_RGB8;
+        case Texture::PixelFormat::RgbaEtc2:  return Ogre::PF_ETC2_RGBA8;
 
         default:
             throw InvalidRequestException(
@@ -665,6 +678,9 @@ Texture::PixelFormat OgreTexture::fromOgrePixelFormat(
         case Ogre::PF_DXT1:         return Texture::PixelFormat::RgbaDxt1;
         case Ogre::PF_DXT3:         return Texture::PixelFormat::RgbaDxt3;
         case Ogre::PF_DXT5:         return Texture::PixelFormat::RgbaDxt5;
+        case Ogre::PF_BC7_UNORM:    return Texture::PixelFormat::RgbaBc7;
+        case Ogre::PF_ETC2_RGB8:    return Texture::PixelFormat::RgbEtc2;
+        case Ogre::PF_ETC2_RGBA8:   return Texture::PixelFormat::RgbaEtc2;
 
         default:
             throw InvalidRequestException(
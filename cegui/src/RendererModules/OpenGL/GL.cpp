@@ -46,6 +46,8 @@ OpenGLInfo::OpenGLInfo() :
     d_verMajorForce(-1),
     d_verMinorForce(-1),
     d_isS3tcSupported(false),
+    d_isBptcSupported(false),
+    d_isEtc2Supported(false),
     d_isNpotTextureSupported(false),
     d_isReadBufferSupported(false),
     d_isPolygonModeSupported(false),
@@ -107,6 +109,14 @@ void OpenGLInfo::initSupportedFeatures()
 #if defined CEGUI_USE_EPOXY
 
     d_isS3tcSupported = epoxy_has_gl_extension("GL_EXT_texture_compression_s3tc");
+    d_isBptcSupported =
+          (isUsingDesktopOpengl() && verAtLeast(4, 2))
+      ||  epoxy_has_gl_extension("GL_ARB_texture_compression_bptc")
+      ||  epoxy_has_gl_extension("GL_EXT_texture_compression_bptc");
+    d_isEtc2Supported =
+          (isUsingDesktopOpengl() && verAtLeast(4, 3))
+      ||  (isUsingOpenglEs() && verMajor() >= 3)
+      ||  epoxy_has_gl_extension("GL_ARB_ES3_compatibility");
     d_isNpotTextureSupported =
           (isUsingDesktopOpengl()  &&  verMajor() >= 2)
       ||  (isUsingOpenglEs() && verMajor() >= 3)
@@ -124,6 +134,8 @@ void OpenGLInfo::initSupportedFeatures()
 #elif defined CEGUI_USE_GLEW
 
     d_isS3tcSupported = false;
+    d_isBptcSupported = (GLEW_VERSION_4_2 == GL_TRUE);
+    d_isEtc2Supported = (GLEW_VERSION_4_3 == GL_TRUE);
     glGetError();
 
     // Why do we do this and not use GLEW_EXT_texture_compression_s3tc?
@@ -138,13 +150,15 @@ void OpenGLInfo::initSupportedFeatures()
         {
             const char* extension
               (reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)));
-            if ((glGetError() == GL_NO_ERROR)  &&
-                extension  &&
-                !std::strcmp(extension, "GL_EXT_texture_compression_s3tc"))
-            {
+            if ((glGetError() != GL_NO_ERROR)  ||  !extension)
+                continue;
+
+            if (!std::strcmp(extension, "GL_EXT_texture_compression_s3tc"))
                 d_isS3tcSupported = true;
-                break;
-            }
+            else if (!std::strcmp(extension, "GL_ARB_texture_compression_bptc"))
+                d_isBptcSupported = true;
+            else if (!std::strcmp(extension, "GL_ARB_ES3_compatibility"))
+                d_isEtc2Supported = true;
         }
     }
     
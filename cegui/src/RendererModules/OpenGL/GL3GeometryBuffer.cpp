@@ -40,6 +40,8 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <limits>
+
 #define BUFFER_OFFSET(i) ((char *)NULL + (i))
 
 // Start of CEGUI namespace section
@@ -90,8 +92,12 @@ void OpenGL3GeometryBuffer::draw(std::uint32_t drawModeMask) const
     CEGUI::ShaderParameterBindings* shaderParameterBindings = (*d_renderMaterial).getShaderParamBindings();
 
     // Set the uniform variables for this GeometryBuffer in the Shader
-    shaderParameterBindings->setParameter("modelViewProjMatrix", d_matrix);
-    shaderParameterBindings->setParameter("alphaFactor", d_alpha);
+    static const ShaderParameterBindings::ParameterHandle matrixHandle =
+        ShaderParameterBindings::getParameterHandle("modelViewProjMatrix");
+    static const ShaderParameterBindings::ParameterHandle alphaHandle =
+        ShaderParameterBindings::getParameterHandle("alphaFactor");
+    shaderParameterBindings->setParameter(matrixHandle, d_matrix);
+    shaderParameterBindings->setParameter(alphaHandle, d_alpha);
 
     // activate desired blending mode
     d_owner.setupRenderingBlendMode(d_blendMode);
@@ -99,10 +105,12 @@ void OpenGL3GeometryBuffer::draw(std::uint32_t drawModeMask) const
     if (OpenGLInfo::getSingleton().isVaoSupported())
     {
 #ifdef CEGUI_OPENGL_BIG_BUFFER
-        if (getVertexAttributeElementCount() == 9) // TODO: store vertex type / decl?
-            d_glStateChanger->bindVertexArray(static_cast<OpenGL3Renderer&>(d_owner).d_verticesTexturedVAO);
+        const OpenGL3Renderer& owner = static_cast<OpenGL3Renderer&>(d_owner);
+        const bool textured = (getVertexAttributeElementCount() == 9); // TODO: store vertex type / decl?
+        if (d_uploadedLayout != CompactVertexLayout::None)
+            d_glStateChanger->bindVertexArray(textured ? owner.d_compactTexturedVAO : owner.d_compactSolidVAO);
         else
-            d_glStateChanger->bindVertexArray(static_cast<OpenGL3Renderer&>(d_owner).d_verticesSolidVAO);
+            d_glStateChanger->bindVertexArray(textured ? owner.d_verticesTexturedVAO : owner.d_verticesSolidVAO);
 #else
         // Bind our vao
         d_glStateChanger->bindVertexArray(d_verticesVAO);
@@ -134,6 +142,60 @@ void OpenGL3GeometryBuffer::draw(std::uint32_t drawModeMask) const
     updateRenderTargetData(d_owner.getActiveRenderTarget());
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isBatchable() const
+{
+    const OpenGL3Renderer& owner = static_cast<const OpenGL3Renderer&>(d_owner);
+
+    return !d_vertexData.empty() && !d_effect &&
+        d_polygonFillRule == PolygonFillRule::NoFilling &&
+        d_uploadedLayout == CompactVertexLayout::None &&
+        owner.isStandardShaderWrapper(d_renderMaterial->getShaderWrapper());
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isBatchCompatible(const OpenGL3GeometryBuffer& other) const
+{
+    if (d_renderMaterial->getShaderWrapper() != other.d_renderMaterial->getShaderWrapper() ||
+        d_blendMode != other.d_blendMode)
+        return false;
+
+    static const ShaderParameterBindings::ParameterHandle textureHandle =
+        ShaderParameterBindings::getParameterHandle("texture0");
+    const ShaderParameter* texture = d_renderMaterial->getShaderParamBindings()->getParameter(textureHandle);
+    const ShaderParameter* otherTexture = other.d_renderMaterial->getShaderParamBindings()->getParameter(textureHandle);
+
+    return texture == otherTexture || (texture && otherTexture && texture->equal(otherTexture));
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::getBatchUniforms(glm::mat4& matrix, float& alpha,
+                                             glm::vec4& clipRect) const
+{
+    updateMatrix();
+    matrix = d_matrix;
+    alpha = d_alpha;
+
+    if (d_clippingActive)
+    {
+        // Same truncation as for the glScissor call in draw()
+        const GLint x = static_cast<GLint>(d_preparedClippingRegion.left());
+        const GLint y = static_cast<GLint>(d_owner.getActiveViewPort().getHeight() - d_preparedClippingRegion.bottom());
+        const GLint w = static_cast<GLint>(d_preparedClippingRegion.getWidth());
+        const GLint h = static_cast<GLint>(d_preparedClippingRegion.getHeight());
+
+        clipRect = glm::vec4(static_cast<float>(x), static_cast<float>(y),
+                             static_cast<float>(x + w), static_cast<float>(y + h));
+    }
+    else
+    {
+        clipRect = glm::vec4(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    }
+
+    updateRenderTargetData(d_owner.getActiveRenderTarget());
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::initialiseVertexBuffers()
 {
@@ -258,14 +320,13 @@ void OpenGL3GeometryBuffer::onGeometryChanged()
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
 {
-    const auto vboPos = static_cast<GLint>(d_verticesVBOPosition);
     const auto vertexCount = static_cast<GLsizei>(d_vertexCount);
     if (d_polygonFillRule == PolygonFillRule::NoFilling)
     {
         d_glStateChanger->disable(GL_CULL_FACE);
         d_glStateChanger->disable(GL_STENCIL_TEST);
 
-        glDrawArrays(GL_TRIANGLES, vboPos, vertexCount);
+        drawTriangles(0, vertexCount);
     }
     else if (d_polygonFillRule == PolygonFillRule::EvenOdd)
     {
@@ -280,13 +341,13 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         glClear(GL_STENCIL_BUFFER_BIT);
         glStencilFunc(GL_ALWAYS, 0x00, 0xFF);
         glStencilOp(GL_INVERT, GL_KEEP, GL_INVERT);
-        glDrawArrays(GL_TRIANGLES, vboPos, vertexCount - d_postStencilVertexCount);
+        drawTriangles(0, vertexCount - d_postStencilVertexCount);
 
         unsigned int postStencilStart = vertexCount - d_postStencilVertexCount;
         glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
         glStencilMask(0x00);
         glStencilFunc(GL_EQUAL, 0xFF, 0xFF);
-        glDrawArrays(GL_TRIANGLES, vboPos + postStencilStart, d_postStencilVertexCount);
+        drawTriangles(postStencilStart, d_postStencilVertexCount);
     }
     else if (d_polygonFillRule == PolygonFillRule::NonZero)
     {
@@ -308,11 +369,11 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
 
         glCullFace(GL_FRONT);
         glStencilOp(GL_KEEP, GL_KEEP, GL_INCR_WRAP);
-        glDrawArrays(GL_TRIANGLES, vboPos + vertex_pos, solid_fill_count);
+        drawTriangles(vertex_pos, solid_fill_count);
 
         glCullFace(GL_BACK);
         glStencilOp(GL_KEEP, GL_KEEP, GL_DECR_WRAP);
-        glDrawArrays(GL_TRIANGLES, vboPos + vertex_pos, solid_fill_count);
+        drawTriangles(vertex_pos, solid_fill_count);
 
         vertex_pos += solid_fill_count;
 
@@ -325,9 +386,23 @@ void OpenGL3GeometryBuffer::drawDependingOnFillRule() const
         if(d_postStencilVertexCount != 0)
         {
             glStencilFunc(GL_NOTEQUAL, 0x00, 0xFF);
-            glDrawArrays(GL_TRIANGLES, vboPos + vertexCount - d_postStencilVertexCount, d_postStencilVertexCount);
+            drawTriangles(vertexCount - d_postStencilVertexCount, d_postStencilVertexCount);
         }
     }
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::drawTriangles(GLsizei first, GLsizei count) const
+{
+    const auto vboPos = static_cast<GLint>(d_verticesVBOPosition);
+
+    // The quad indices reproduce the original triangle list one to one, so
+    // vertex ranges of it are also ranges of the index buffer.
+    if (d_uploadedLayout == CompactVertexLayout::Quads)
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_SHORT,
+                                 BUFFER_OFFSET(first * sizeof(GLushort)), vboPos);
+    else
+        glDrawArrays(GL_TRIANGLES, vboPos + first, count);
+}
+
 }
@@ -43,10 +43,15 @@
 #include "CEGUI/RendererModules/OpenGL/GL3StateChangeWrapper.h"
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/RendererModules/OpenGL/GLBaseShaderWrapper.h"
+#include "CEGUI/RendererModules/OpenGL/ShaderManager.h"
+#include "CEGUI/ShaderParameterBindings.h"
+#include "CEGUI/RenderQueue.h"
 
 #include <algorithm>
 #include <iterator>
 
+#include <glm/gtc/type_ptr.hpp>
+
 #define BUFFER_OFFSET(i) ((char *)NULL + (i))
 
 #ifdef DEBUG
@@ -240,6 +245,11 @@ void OpenGL3Renderer::init()
 #ifdef CEGUI_OPENGL_BIG_BUFFER
     initialiseStandardTexturedVAO();
     initialiseStandardColouredVAO();
+
+    if (isCompactVertexFormatSupported())
+        initialiseCompactVAOs();
+
+    initialiseBatching();
 #endif
 }
 
@@ -251,6 +261,23 @@ OpenGL3Renderer::~OpenGL3Renderer()
     glDeleteVertexArrays(1, &d_verticesSolidVAO);
     glDeleteBuffers(1, &d_verticesSolidVBO);
     glDeleteBuffers(1, &d_verticesTexturedVBO);
+
+    if (d_quadIndexBuffer)
+    {
+        glDeleteVertexArrays(1, &d_compactTexturedVAO);
+        glDeleteVertexArrays(1, &d_compactSolidVAO);
+        glDeleteBuffers(1, &d_compactSolidVBO);
+        glDeleteBuffers(1, &d_compactTexturedVBO);
+        glDeleteBuffers(1, &d_quadIndexBuffer);
+    }
+
+    if (d_shaderWrapperBatchedTextured)
+    {
+        glDeleteVertexArrays(1, &d_batchTexturedVAO);
+        glDeleteVertexArrays(1, &d_batchSolidVAO);
+        glDeleteBuffers(1, &d_batchSlotsSolidVBO);
+        glDeleteBuffers(1, &d_batchSlotsTexturedVBO);
+    }
 #endif
 
     delete d_textureTargetFactory;
@@ -259,6 +286,9 @@ OpenGL3Renderer::~OpenGL3Renderer()
 
     delete d_shaderWrapperTextured;
     delete d_shaderWrapperSolid;
+    delete d_shaderWrapperBatchedTextured;
+    delete d_shaderWrapperBatchedSolid;
+    delete d_batchParameterBindings;
 }
 
 //----------------------------------------------------------------------------//
@@ -290,6 +320,9 @@ void OpenGL3Renderer::beginRendering()
     // functions. In that case disable client states like this: glDisableClientState(GL_VERTEX_ARRAY);
 
     d_openGLStateChanger->reset();
+    // the statistics of the state changer describe a single frame
+    d_openGLStateChanger->resetStatistics();
+    d_batchStatistics = GeometryBatchStatistics();
 
     // if enabled, restores a subset of the GL state back to default values.
     if (d_isStateResettingEnabled)
@@ -422,6 +455,11 @@ void OpenGL3Renderer::uploadBuffers(RenderingSurface& surface)
 #ifdef CEGUI_OPENGL_BIG_BUFFER
     d_vertex_data_solid.clear();
     d_vertex_data_textured.clear();
+    d_compact_data_solid.clear();
+    d_compact_data_textured.clear();
+
+    d_batch_slots_solid.clear();
+    d_batch_slots_textured.clear();
 
     for(auto &queue : surface.getRenderQueueList())
     {
@@ -429,8 +467,18 @@ void OpenGL3Renderer::uploadBuffers(RenderingSurface& surface)
     }
 
 
-    uploadVertexData(d_vertex_data_solid, d_verticesSolidVBO, d_verticesSolidVBOSize);
-    uploadVertexData(d_vertex_data_textured, d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    uploadVertexData(d_vertex_data_solid.data(), d_vertex_data_solid.size() * sizeof(float),
+                     d_verticesSolidVBO, d_verticesSolidVBOSize);
+    uploadVertexData(d_vertex_data_textured.data(), d_vertex_data_textured.size() * sizeof(float),
+                     d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    uploadVertexData(d_compact_data_solid.data(), d_compact_data_solid.size(),
+                     d_compactSolidVBO, d_compactSolidVBOSize);
+    uploadVertexData(d_compact_data_textured.data(), d_compact_data_textured.size(),
+                     d_compactTexturedVBO, d_compactTexturedVBOSize);
+    uploadVertexData(d_batch_slots_solid.data(), d_batch_slots_solid.size() * sizeof(float),
+                     d_batchSlotsSolidVBO, d_batchSlotsSolidVBOSize);
+    uploadVertexData(d_batch_slots_textured.data(), d_batch_slots_textured.size() * sizeof(float),
+                     d_batchSlotsTexturedVBO, d_batchSlotsTexturedVBOSize);
 
 #endif
 }
@@ -441,48 +489,107 @@ void OpenGL3Renderer::uploadBuffers(const std::vector<GeometryBuffer*>& buffers)
     // keep the vertex vector reserved memory so it is not constantly recreated
     d_vertex_data_solid.clear();
     d_vertex_data_textured.clear();
+    d_compact_data_solid.clear();
+    d_compact_data_textured.clear();
+    d_batch_slots_solid.clear();
+    d_batch_slots_textured.clear();
 
     addGeometry(buffers);
-    uploadVertexData(d_vertex_data_solid, d_verticesSolidVBO, d_verticesSolidVBOSize);
-    uploadVertexData(d_vertex_data_textured, d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    uploadVertexData(d_vertex_data_solid.data(), d_vertex_data_solid.size() * sizeof(float),
+                     d_verticesSolidVBO, d_verticesSolidVBOSize);
+    uploadVertexData(d_vertex_data_textured.data(), d_vertex_data_textured.size() * sizeof(float),
+                     d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    uploadVertexData(d_compact_data_solid.data(), d_compact_data_solid.size(),
+                     d_compactSolidVBO, d_compactSolidVBOSize);
+    uploadVertexData(d_compact_data_textured.data(), d_compact_data_textured.size(),
+                     d_compactTexturedVBO, d_compactTexturedVBOSize);
+    uploadVertexData(d_batch_slots_solid.data(), d_batch_slots_solid.size() * sizeof(float),
+                     d_batchSlotsSolidVBO, d_batchSlotsSolidVBOSize);
+    uploadVertexData(d_batch_slots_textured.data(), d_batch_slots_textured.size() * sizeof(float),
+                     d_batchSlotsTexturedVBO, d_batchSlotsTexturedVBOSize);
 }
 
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::addGeometry(const std::vector<GeometryBuffer*>& buffers)
 {
+    const bool compact = isCompactVertexFormatEnabled();
+    const bool batching = isGeometryBatchingActive();
+    // First buffer of the batch the next buffer may join
+    OpenGL3GeometryBuffer* batchStart = nullptr;
+
     for (auto buffer : buffers)
     {
+        auto glBuffer = static_cast<OpenGL3GeometryBuffer*>(buffer);
+        glBuffer->d_batchSlot = 0;
+        glBuffer->d_batchLength = 1;
+
         const auto& data = buffer->getVertexData();
         if (data.empty())
+        {
+            batchStart = nullptr;
             continue;
+        }
 
         const auto element_count = buffer->getVertexAttributeElementCount();
+
+        glBuffer->d_uploadedLayout = compact ? buffer->getCompactVertexLayout() : CompactVertexLayout::None;
+        if (glBuffer->d_uploadedLayout != CompactVertexLayout::None)
+        {
+            const auto& compactData = buffer->getCompactVertexData();
+            auto& destBuffer = (element_count == 9) ? d_compact_data_textured : d_compact_data_solid;
+
+            glBuffer->d_verticesVBOPosition = destBuffer.size() / buffer->getCompactVertexStride();
+            destBuffer.insert(destBuffer.end(), compactData.begin(), compactData.end());
+            batchStart = nullptr;
+            continue;
+        }
+
         auto& destBuffer = (element_count == 9) ? d_vertex_data_textured : d_vertex_data_solid;
 
-        static_cast<OpenGL3GeometryBuffer*>(buffer)->d_verticesVBOPosition = destBuffer.size() / element_count;
+        glBuffer->d_verticesVBOPosition = destBuffer.size() / element_count;
         destBuffer.reserve(destBuffer.size() + data.size());
         std::copy(data.begin(), data.end(), std::back_inserter(destBuffer));
+
+        if (!batching)
+            continue;
+
+        // Buffers drawn in a row and sharing their state form a batch. Their
+        // vertices are consecutive in the vbo, so one draw call covers them.
+        if (!glBuffer->isBatchable())
+            batchStart = nullptr;
+        else if (batchStart && batchStart->d_batchLength < MaxGeometryBatchSize &&
+                 batchStart->isBatchCompatible(*glBuffer))
+        {
+            glBuffer->d_batchSlot = batchStart->d_batchLength++;
+            glBuffer->d_batchLength = 0;
+        }
+        else
+            batchStart = glBuffer;
+
+        // The slot vbos mirror the vertex vbos, including unbatched buffers
+        auto& slots = (element_count == 9) ? d_batch_slots_textured : d_batch_slots_solid;
+        slots.insert(slots.end(), data.size() / element_count, static_cast<float>(glBuffer->d_batchSlot));
     }
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3Renderer::uploadVertexData(std::vector<float>& vertex_data, GLuint vbo_id, GLuint &vbo_max_size)
+void OpenGL3Renderer::uploadVertexData(const void* data, std::size_t size, GLuint vbo_id, GLuint &vbo_max_size)
 {
-    if(vertex_data.empty())
+    if(!size)
     {
         return;
     }
 
     d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo_id);
     // need a bigger buffer
-    if(vertex_data.size() * sizeof(float) > vbo_max_size)
+    if(size > vbo_max_size)
     {
-        glBufferData(GL_ARRAY_BUFFER, vertex_data.size() * sizeof(float), &vertex_data[0], GL_DYNAMIC_DRAW);
-        vbo_max_size = static_cast<GLuint>(vertex_data.size() * sizeof(float));
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+        vbo_max_size = static_cast<GLuint>(size);
     }
     else
     {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, vertex_data.size() * sizeof(float), &vertex_data[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
     }
 }
 
@@ -587,6 +694,245 @@ void OpenGL3Renderer::initialiseStandardColouredVAO()
 #endif
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::initialiseCompactVAOs()
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // Indices for the largest buffer that is stored as quads
+    std::vector<GLushort> indices(GeometryBuffer::MaxCompactQuadCount * 6);
+    GeometryBuffer::fillQuadIndices(indices.data(), GeometryBuffer::MaxCompactQuadCount);
+
+    glGenBuffers(1, &d_quadIndexBuffer);
+
+    const OpenGLBaseShaderWrapper* wrappers[2] = { d_shaderWrapperSolid, d_shaderWrapperTextured };
+    GLuint* vaos[2] = { &d_compactSolidVAO, &d_compactTexturedVAO };
+    GLuint* vbos[2] = { &d_compactSolidVBO, &d_compactTexturedVBO };
+
+    for (int i = 0; i < 2; ++i)
+    {
+        glGenBuffers(1, vbos[i]);
+        glGenVertexArrays(1, vaos[i]);
+        d_openGLStateChanger->bindVertexArray(*vaos[i]);
+
+        // The element array binding is part of the vao state, so this bypasses
+        // the state changer which does not track it per vao.
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, d_quadIndexBuffer);
+        if (i == 0)
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(), GL_STATIC_DRAW);
+
+        d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, *vbos[i]);
+        glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+
+        // 2D float position, normalised RGBA8 colour and normalised 16 bit
+        // texture coordinates. The shaders' inPosition gets 0 for z.
+        const GLsizei stride = (i == 0) ? 12 : 16;
+
+        GLint shader_pos_loc = wrappers[i]->getAttributeLocation("inPosition");
+        glEnableVertexAttribArray(shader_pos_loc);
+        glVertexAttribPointer(shader_pos_loc, 2, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(0));
+
+        GLint shader_colour_loc = wrappers[i]->getAttributeLocation("inColour");
+        glEnableVertexAttribArray(shader_colour_loc);
+        glVertexAttribPointer(shader_colour_loc, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, BUFFER_OFFSET(8));
+
+        if (i == 1)
+        {
+            GLint texture_coord_loc = wrappers[i]->getAttributeLocation("inTexCoord");
+            glEnableVertexAttribArray(texture_coord_loc);
+            glVertexAttribPointer(texture_coord_loc, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, BUFFER_OFFSET(12));
+        }
+    }
+
+    d_openGLStateChanger->bindVertexArray(0);
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::initialiseBatching()
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    OpenGLBaseShader* shaders[2] = {
+        d_shaderManager->getShader(OpenGLBaseShaderID::BatchedSolid),
+        d_shaderManager->getShader(OpenGLBaseShaderID::BatchedTextured) };
+
+    if (!shaders[0] || !shaders[0]->isCreatedSuccessfully() ||
+        !shaders[1] || !shaders[1]->isCreatedSuccessfully())
+        return;
+
+    d_shaderWrapperBatchedSolid = new OpenGLBaseShaderWrapper(*shaders[0], d_openGLStateChanger);
+    d_shaderWrapperBatchedTextured = new OpenGLBaseShaderWrapper(*shaders[1], d_openGLStateChanger);
+    d_shaderWrapperBatchedTextured->addTextureUniformVariable("texture0", 0);
+
+    d_batchParameterBindings = new ShaderParameterBindings();
+    d_batchMatrices.resize(MaxGeometryBatchSize);
+    d_batchAlphaFactors.resize(MaxGeometryBatchSize);
+    d_batchClipRects.resize(MaxGeometryBatchSize);
+
+    OpenGLBaseShaderWrapper* wrappers[2] = { d_shaderWrapperBatchedSolid, d_shaderWrapperBatchedTextured };
+    GLuint* vaos[2] = { &d_batchSolidVAO, &d_batchTexturedVAO };
+    GLuint* slotVbos[2] = { &d_batchSlotsSolidVBO, &d_batchSlotsTexturedVBO };
+    const GLuint vertexVbos[2] = { d_verticesSolidVBO, d_verticesTexturedVBO };
+
+    for (int i = 0; i < 2; ++i)
+    {
+        OpenGLBaseShaderWrapper* wrapper = wrappers[i];
+        wrapper->addUniformVariable("modelViewProjMatrices");
+        wrapper->addUniformVariable("alphaFactors");
+        wrapper->addUniformVariable("clipRects");
+        wrapper->addAttributeVariable("inPosition");
+        wrapper->addAttributeVariable("inColour");
+        wrapper->addAttributeVariable("inBatchSlot");
+
+        d_batchMatricesLocation[i] = wrapper->getUniformLocation("modelViewProjMatrices");
+        d_batchAlphaFactorsLocation[i] = wrapper->getUniformLocation("alphaFactors");
+        d_batchClipRectsLocation[i] = wrapper->getUniformLocation("clipRects");
+
+        glGenBuffers(1, slotVbos[i]);
+        d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, *slotVbos[i]);
+        glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+
+        glGenVertexArrays(1, vaos[i]);
+        d_openGLStateChanger->bindVertexArray(*vaos[i]);
+
+        // Same layout as the standard vaos, plus the slot from its own vbo
+        d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vertexVbos[i]);
+        const GLsizei stride = ((i == 0) ? (3 + 4) : (3 + 4 + 2)) * sizeof(GLfloat);
+
+        GLint shader_pos_loc = wrapper->getAttributeLocation("inPosition");
+        glEnableVertexAttribArray(shader_pos_loc);
+        glVertexAttribPointer(shader_pos_loc, 3, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(0));
+
+        GLint shader_colour_loc = wrapper->getAttributeLocation("inColour");
+        glEnableVertexAttribArray(shader_colour_loc);
+        glVertexAttribPointer(shader_colour_loc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(3 * sizeof(GLfloat)));
+
+        if (i == 1)
+        {
+            wrapper->addAttributeVariable("inTexCoord");
+            GLint texture_coord_loc = wrapper->getAttributeLocation("inTexCoord");
+            glEnableVertexAttribArray(texture_coord_loc);
+            glVertexAttribPointer(texture_coord_loc, 2, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(7 * sizeof(GLfloat)));
+        }
+
+        d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, *slotVbos[i]);
+        GLint slot_loc = wrapper->getAttributeLocation("inBatchSlot");
+        glEnableVertexAttribArray(slot_loc);
+        glVertexAttribPointer(slot_loc, 1, GL_FLOAT, GL_FALSE, sizeof(GLfloat), BUFFER_OFFSET(0));
+    }
+
+    d_openGLStateChanger->bindVertexArray(0);
+    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::isGeometryBatchingSupported() const
+{
+    return d_shaderWrapperBatchedTextured != nullptr;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::isStandardShaderWrapper(const ShaderWrapper* wrapper) const
+{
+    return wrapper == d_shaderWrapperTextured || wrapper == d_shaderWrapperSolid;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::drawRenderQueue(const RenderQueue& queue, std::uint32_t drawModeMask)
+{
+    const std::vector<GeometryBuffer*>& buffers = queue.getBuffers();
+
+    for (std::size_t i = 0; i < buffers.size(); )
+    {
+        const std::size_t count = isGeometryBatchingActive() ? getBatchLength(buffers, i) : 1;
+        if (count > 1)
+        {
+            drawBatch(buffers, i, count);
+            i += count;
+            continue;
+        }
+
+        buffers[i]->draw(drawModeMask);
+        ++d_batchStatistics.d_unbatchedBuffers;
+        ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::size_t OpenGL3Renderer::getBatchLength(const std::vector<GeometryBuffer*>& buffers,
+                                            std::size_t first) const
+{
+    const auto start = static_cast<const OpenGL3GeometryBuffer*>(buffers[first]);
+    const std::size_t count = start->d_batchLength;
+    if (count < 2 || first + count > buffers.size())
+        return 1;
+
+    // Batches are formed when the queue is uploaded, make sure the queue was
+    // not changed since then.
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        const auto buffer = static_cast<const OpenGL3GeometryBuffer*>(buffers[first + i]);
+        if (buffer->d_batchSlot != i || buffer->d_batchLength != 0)
+            return 1;
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::drawBatch(const std::vector<GeometryBuffer*>& buffers,
+                                std::size_t first, std::size_t count)
+{
+    const auto start = static_cast<const OpenGL3GeometryBuffer*>(buffers[first]);
+    const int textured = (start->getVertexAttributeElementCount() == 9) ? 1 : 0;
+
+    std::size_t vertexCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto buffer = static_cast<const OpenGL3GeometryBuffer*>(buffers[first + i]);
+        buffer->getBatchUniforms(d_batchMatrices[i], d_batchAlphaFactors[i], d_batchClipRects[i]);
+        vertexCount += buffer->getVertexCount();
+    }
+
+    // Clipping is done by the shaders
+    d_openGLStateChanger->disable(GL_SCISSOR_TEST);
+    setupRenderingBlendMode(start->getBlendMode());
+
+    // Binds the program and the texture shared by the batch
+    OpenGLBaseShaderWrapper* wrapper = textured ? d_shaderWrapperBatchedTextured : d_shaderWrapperBatchedSolid;
+    if (textured)
+        d_batchParameterBindings->setParameter("texture0", start->getTexture("texture0"));
+    wrapper->prepareForRendering(d_batchParameterBindings);
+
+    const GLsizei batchSize = static_cast<GLsizei>(count);
+    d_openGLStateChanger->uniformMatrix4fv(d_batchMatricesLocation[textured], batchSize,
+                                           glm::value_ptr(d_batchMatrices[0]));
+    d_openGLStateChanger->uniform1fv(d_batchAlphaFactorsLocation[textured], batchSize,
+                                     d_batchAlphaFactors.data());
+    d_openGLStateChanger->uniform4fv(d_batchClipRectsLocation[textured], batchSize,
+                                     glm::value_ptr(d_batchClipRects[0]));
+
+    d_openGLStateChanger->bindVertexArray(textured ? d_batchTexturedVAO : d_batchSolidVAO);
+    glDrawArrays(GL_TRIANGLES, static_cast<GLint>(start->d_verticesVBOPosition),
+                 static_cast<GLsizei>(vertexCount));
+
+    ++d_batchStatistics.d_batchDrawCalls;
+    d_batchStatistics.d_batchedBuffers += count;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3Renderer::isCompactVertexFormatSupported() const
+{
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    // Quads are drawn with glDrawElementsBaseVertex
+    OpenGLInfo& info = OpenGLInfo::getSingleton();
+    return info.isVaoSupported() && info.verAtLeast(3, 2);
+#else
+    return false;
+#endif
+}
+
 //----------------------------------------------------------------------------//
 OpenGLTexture* OpenGL3Renderer::createTexture_impl(const String& name)
 {
@@ -48,7 +48,10 @@ void OpenGL3StateChangeWrapper::bindVertexArray(GLuint vertexArray)
     {
         glBindVertexArray(vertexArray);
         d_vertexArrayObject = vertexArray;
+        ++d_statistics.d_stateChanges;
     }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 //----------------------------------------------------------------------------//
@@ -33,6 +33,7 @@
 #include "CEGUI/Exceptions.h"
 
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -48,6 +49,8 @@ OpenGLBaseShaderWrapper::OpenGLBaseShaderWrapper(OpenGLBaseShader& shader, OpenG
 //----------------------------------------------------------------------------//
 OpenGLBaseShaderWrapper::~OpenGLBaseShaderWrapper()
 {
+    for (ShaderParameter* parameter : d_shaderParameterStates)
+        delete parameter;
 }
 
 //----------------------------------------------------------------------------//
@@ -60,6 +63,7 @@ void OpenGLBaseShaderWrapper::addUniformVariable(const std::string& uniformName)
                                       "the name \"" + uniformName + "\" was not found in the OpenGL shader.");
 
     d_uniformVariables.insert(std::pair<std::string, GLint>(uniformName, variable_location));
+    setUniformLocation(uniformName, variable_location);
 }
 
 //----------------------------------------------------------------------------//
@@ -72,9 +76,25 @@ void OpenGLBaseShaderWrapper::addTextureUniformVariable(const std::string& unifo
                                       "the name \"" + uniformName + "\" was not found in the OpenGL shader.");
 
     d_uniformVariables.insert(std::pair<std::string, GLint>(uniformName, textureUnitIndex));
+    setUniformLocation(uniformName, textureUnitIndex);
 
     d_shader.bind();
-    glUniform1i(variable_location, textureUnitIndex);
+    d_glStateChangeWrapper->uniform1i(variable_location, textureUnitIndex);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLBaseShaderWrapper::setUniformLocation(const std::string& uniformName, GLint location)
+{
+    const ShaderParameterBindings::ParameterHandle handle =
+        ShaderParameterBindings::getParameterHandle(uniformName);
+
+    if (handle >= d_uniformLocations.size())
+    {
+        d_uniformLocations.resize(handle + 1, -1);
+        d_shaderParameterStates.resize(handle + 1, nullptr);
+    }
+
+    d_uniformLocations[handle] = location;
 }
 
 //----------------------------------------------------------------------------//
@@ -94,65 +114,63 @@ void OpenGLBaseShaderWrapper::prepareForRendering(const ShaderParameterBindings*
 {
     d_shader.bind();
 
-    const ShaderParameterBindings::ShaderParameterBindingsMap& shader_parameter_bindings = shaderParameterBindings->getShaderParameterBindings();
-    ShaderParameterBindings::ShaderParameterBindingsMap::const_iterator iter = shader_parameter_bindings.begin();
-    ShaderParameterBindings::ShaderParameterBindingsMap::const_iterator end = shader_parameter_bindings.end();
+    // Parameters are looked up by their handle, the bindings and the uniform
+    // locations use the same indices.
+    const std::vector<ShaderParameter*>& parameters = shaderParameterBindings->getParametersByHandle();
+    const size_t count = std::min(parameters.size(), d_uniformLocations.size());
 
-    while(iter != end)
+    for (size_t handle = 0; handle < count; ++handle)
     {
-        const CEGUI::ShaderParameter* parameter = iter->second;
+        const CEGUI::ShaderParameter* parameter = parameters[handle];
+        const GLint location = d_uniformLocations[handle];
+        if (!parameter || location == -1)
+            continue;
+
+        const CEGUI::ShaderParamType parameter_type = parameter->getType();
 
-        if(parameter->getType() != ShaderParamType::Texture)
+        // Uniform values are kept by the program, only upload changed ones.
+        // Texture binds are filtered by the state change wrapper.
+        if (parameter_type != ShaderParamType::Texture)
         {
-            std::map<std::string, ShaderParameter*>::iterator found_iterator = d_shaderParameterStates.find(iter->first);
-            if(found_iterator != d_shaderParameterStates.end())
+            ShaderParameter*& last_shader_parameter = d_shaderParameterStates[handle];
+            if (!last_shader_parameter)
             {
-                ShaderParameter* last_shader_parameter = found_iterator->second;
-                if(parameter->equal(last_shader_parameter))
-                {
-                    ++iter;
-                    continue;
-                }
-                else
-                {
-                    if(parameter->getType() == last_shader_parameter->getType())
-                        last_shader_parameter->takeOverParameterValue(parameter);
-                    else
-                    {
-                        delete found_iterator->second;
-                        found_iterator->second = parameter->clone();
-                    }
-                }
+                last_shader_parameter = parameter->clone();
+            }
+            else if (parameter->equal(last_shader_parameter))
+            {
+                d_glStateChangeWrapper->skipUniform();
+                continue;
+            }
+            else if (parameter_type == last_shader_parameter->getType())
+            {
+                last_shader_parameter->takeOverParameterValue(parameter);
             }
             else
             {
-                d_shaderParameterStates[iter->first] = parameter->clone();
+                delete last_shader_parameter;
+                last_shader_parameter = parameter->clone();
             }
         }
 
-        const GLint& location = d_uniformVariables.find(iter->first)->second;
-
-
-        CEGUI::ShaderParamType parameter_type = parameter->getType();
-
         switch(parameter_type)
         {
         case ShaderParamType::Int:
             {
                 const CEGUI::ShaderParameterInt* parameterInt = static_cast<const CEGUI::ShaderParameterInt*>(parameter);
-                glUniform1i(location, parameterInt->d_parameterValue);
+                d_glStateChangeWrapper->uniform1i(location, parameterInt->d_parameterValue);
             }
             break;
         case ShaderParamType::Float:
             {
                 const CEGUI::ShaderParameterFloat* parameterFloat = static_cast<const CEGUI::ShaderParameterFloat*>(parameter);
-                glUniform1f(location, parameterFloat->d_parameterValue);
+                d_glStateChangeWrapper->uniform1f(location, parameterFloat->d_parameterValue);
             }
             break;
         case ShaderParamType::Matrix4X4:
             {
                 const CEGUI::ShaderParameterMatrix* parameterMatrix = static_cast<const CEGUI::ShaderParameterMatrix*>(parameter);
-                glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(parameterMatrix->d_parameterValue));
+                d_glStateChangeWrapper->uniformMatrix4fv(location, 1, glm::value_ptr(parameterMatrix->d_parameterValue));
             }
             break;
         case ShaderParamType::Texture:
@@ -167,8 +185,6 @@ void OpenGLBaseShaderWrapper::prepareForRendering(const ShaderParameterBindings*
         default:
             break;
         }
-
-        ++iter;
     }
 }
 
@@ -55,23 +55,35 @@ void GLES2Texture::initInternalPixelFormatFields(const PixelFormat fmt)
     switch(fmt)
     {
     case PixelFormat::Rgba:
-        d_format = GL_RGBA;
-        d_subpixelFormat = GL_UNSIGNED_BYTE;
+        d_pixelDataFormat = GL_RGBA;
+        d_pixelDataType = GL_UNSIGNED_BYTE;
         break;
 
     case PixelFormat::Rgb:
-        d_format = GL_RGB;
-        d_subpixelFormat = GL_UNSIGNED_BYTE;
+        d_pixelDataFormat = GL_RGB;
+        d_pixelDataType = GL_UNSIGNED_BYTE;
         break;
 
     case PixelFormat::Rgb565:
-        d_format = GL_RGB;
-        d_subpixelFormat = GL_UNSIGNED_SHORT_5_6_5;
+        d_pixelDataFormat = GL_RGB;
+        d_pixelDataType = GL_UNSIGNED_SHORT_5_6_5;
         break;
 
     case PixelFormat::Rgba4444:
-        d_format = GL_RGBA;
-        d_subpixelFormat = GL_UNSIGNED_SHORT_4_4_4_4;
+        d_pixelDataFormat = GL_RGBA;
+        d_pixelDataType = GL_UNSIGNED_SHORT_4_4_4_4;
+        break;
+
+    case PixelFormat::RgbEtc2:
+        d_pixelDataFormat = GL_COMPRESSED_RGB8_ETC2;
+        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
+        d_isCompressed = true;
+        break;
+
+    case PixelFormat::RgbaEtc2:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA8_ETC2_EAC;
+        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
+        d_isCompressed = true;
         break;
 
     default:
@@ -82,10 +94,33 @@ void GLES2Texture::initInternalPixelFormatFields(const PixelFormat fmt)
 
 
 
+//----------------------------------------------------------------------------//
+bool GLES2Texture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    // ETC2 is the only compressed format initInternalPixelFormatFields maps,
+    // the others are decoded on the CPU by the image codec.
+    switch (fmt)
+    {
+    case PixelFormat::RgbDxt1:
+    case PixelFormat::RgbaDxt1:
+    case PixelFormat::RgbaDxt3:
+    case PixelFormat::RgbaDxt5:
+    case PixelFormat::RgbaBc7:
+        return false;
+
+    default:
+        return OpenGLTexture::isPixelFormatSupported(fmt);
+    }
+}
+
 //----------------------------------------------------------------------------//
 GLsizei GLES2Texture::getCompressedTextureSize(const Sizef& pixel_size) const
 {
     GLsizei blocksize = 16;
+
+    if (d_pixelDataFormat == GL_COMPRESSED_RGB8_ETC2)
+        blocksize = 8;
+
     return (
                static_cast<GLsizei>(
                    std::ceil(pixel_size.d_width / 4) *
@@ -116,7 +151,7 @@ void GLES2Texture::setTextureSize_impl(const Sizef& sz)
     if(d_isCompressed)
     {
         const GLsizei image_size = getCompressedTextureSize(size);
-        glCompressedTexImage2D(GL_TEXTURE_2D, 0, d_format,
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, d_pixelDataFormat,
                                static_cast<GLsizei>(size.d_width),
                                static_cast<GLsizei>(size.d_height),
                                0, image_size, 0);
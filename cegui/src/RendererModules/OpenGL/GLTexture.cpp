@@ -93,6 +93,24 @@ void OpenGL1Texture::initInternalPixelFormatFields(const PixelFormat fmt)
         d_isCompressed = true;
         break;
 
+    case PixelFormat::RgbaBc7:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA_BPTC_UNORM;
+        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
+        d_isCompressed = true;
+        break;
+
+    case PixelFormat::RgbEtc2:
+        d_pixelDataFormat = GL_COMPRESSED_RGB8_ETC2;
+        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
+        d_isCompressed = true;
+        break;
+
+    case PixelFormat::RgbaEtc2:
+        d_pixelDataFormat = GL_COMPRESSED_RGBA8_ETC2_EAC;
+        d_pixelDataType = GL_UNSIGNED_BYTE; // not used.
+        d_isCompressed = true;
+        break;
+
     default:
         throw RendererException(
                         "invalid or unsupported CEGUI::PixelFormat.");
@@ -110,7 +128,8 @@ GLsizei OpenGL1Texture::getCompressedTextureSize(const Sizef& pixel_size) const
     GLsizei blocksize = 16;
 
     if(d_pixelDataFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ||
-            d_pixelDataFormat == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT)
+            d_pixelDataFormat == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT ||
+            d_pixelDataFormat == GL_COMPRESSED_RGB8_ETC2)
     {
         blocksize = 8;
     }
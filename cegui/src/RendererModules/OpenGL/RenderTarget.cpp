@@ -67,6 +67,12 @@ void OpenGLRenderTarget::updateMatrix() const
     RenderTarget::updateMatrix( RenderTarget::createViewProjMatrixForOpenGL() );
 }
 
+void OpenGLRenderTarget::draw(const RenderQueue& queue,
+                              std::uint32_t drawModeMask)
+{
+    d_owner.drawRenderQueue(queue, drawModeMask);
+}
+
 OpenGLRendererBase& OpenGLRenderTarget::getOwner()
 {
     return d_owner;
@@ -31,6 +31,7 @@
 #include "CEGUI/RendererModules/OpenGL/TextureTarget.h"
 #include "CEGUI/RendererModules/OpenGL/ViewportTarget.h"
 #include "CEGUI/RendererModules/OpenGL/GeometryBufferBase.h"
+#include "CEGUI/RenderQueue.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/DynamicModule.h"
@@ -389,6 +390,13 @@ void OpenGLRendererBase::grabTextures()
         texture_iterator->second->grabTexture();
 }
 
+//----------------------------------------------------------------------------//
+void OpenGLRendererBase::drawRenderQueue(const RenderQueue& queue,
+                                         std::uint32_t drawModeMask)
+{
+    queue.draw(drawModeMask);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGLRendererBase::restoreTextures()
 {
@@ -79,6 +79,19 @@ void OpenGLBaseShaderManager::initialiseShaders()
         {
             loadShader(OpenGLBaseShaderID::StandardTextured, StandardShaderTexturedVertDesktopOpengl3, StandardShaderTexturedFragDesktopOpengl3);
             loadShader(OpenGLBaseShaderID::StandardSolid, StandardShaderSolidVertDesktopOpengl3, StandardShaderSolidFragDesktopOpengl3);
+
+            // Geometry batching is optional, the renderer works without these
+            try
+            {
+                loadShader(OpenGLBaseShaderID::BatchedTextured, BatchedShaderTexturedVertDesktopOpengl3, BatchedShaderTexturedFragDesktopOpengl3);
+                loadShader(OpenGLBaseShaderID::BatchedSolid, BatchedShaderSolidVertDesktopOpengl3, BatchedShaderSolidFragDesktopOpengl3);
+            }
+            catch (const RendererException&)
+            {
+                if (CEGUI::Logger* logger = CEGUI::Logger::getSingletonPtr())
+                    logger->logEvent("OpenGL3Renderer: The geometry batching shaders could not be "
+                        "created, geometry batching is not supported.", LoggingLevel::Warning);
+            }
         }
         else if (OpenGLInfo::getSingleton().verMajor() <= 2) // Open GL ES < 3
         {
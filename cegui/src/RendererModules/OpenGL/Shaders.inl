@@ -99,6 +99,97 @@ static const char StandardShaderTexturedFragDesktopOpengl3[] =
 "}"
 ;
 
+/*! A string containing a desktop OpenGL 3.2 vertex shader for solid colouring
+    of a batch of GeometryBuffers. Each vertex carries the slot of its buffer,
+    which selects the buffer's matrix, alpha and clip rect. The array sizes
+    must match OpenGL3Renderer::MaxGeometryBatchSize. */
+static const char BatchedShaderSolidVertDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform mat4 modelViewProjMatrices[32];\n"
+"uniform float alphaFactors[32];\n"
+"uniform vec4 clipRects[32];\n"
+"in vec3 inPosition;\n"
+"in vec4 inColour;\n"
+"in float inBatchSlot;\n"
+"out vec4 exColour;\n"
+"flat out float exAlphaFactor;\n"
+"flat out vec4 exClipRect;\n"
+"void main(void)\n"
+"{\n"
+    "int slot = int(inBatchSlot);\n"
+    "exColour = inColour;\n"
+    "exAlphaFactor = alphaFactors[slot];\n"
+    "exClipRect = clipRects[slot];\n"
+    "gl_Position = modelViewProjMatrices[slot] * vec4(inPosition, 1.0);\n"
+"}"
+;
+
+/*! A string containing a desktop OpenGL 3.2 fragment shader for solid colouring
+    of a batch of GeometryBuffers. Fragments outside the clip rect, given in
+    window coordinates as left, bottom, right and top, are discarded, which
+    keeps the same pixels as glScissor would. */
+static const char BatchedShaderSolidFragDesktopOpengl3[] = 
+"#version 150 core\n"
+"in vec4 exColour;\n"
+"flat in float exAlphaFactor;\n"
+"flat in vec4 exClipRect;\n"
+"out vec4 out0;\n"
+"void main(void)\n"
+"{\n"
+    "if (any(lessThan(gl_FragCoord.xy, exClipRect.xy)) ||\n"
+    "    any(greaterThanEqual(gl_FragCoord.xy, exClipRect.zw)))\n"
+        "discard;\n"
+    "out0 = exColour;\n"
+    "out0.a *= exAlphaFactor;\n"
+"}"
+;
+
+/*! A string containing a desktop OpenGL 3.2 vertex shader for a batch of
+    textured GeometryBuffers, see BatchedShaderSolidVertDesktopOpengl3. */
+static const char BatchedShaderTexturedVertDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform mat4 modelViewProjMatrices[32];\n"
+"uniform float alphaFactors[32];\n"
+"uniform vec4 clipRects[32];\n"
+"in vec3 inPosition;\n"
+"in vec2 inTexCoord;\n"
+"in vec4 inColour;\n"
+"in float inBatchSlot;\n"
+"out vec2 exTexCoord;\n"
+"out vec4 exColour;\n"
+"flat out float exAlphaFactor;\n"
+"flat out vec4 exClipRect;\n"
+"void main(void)\n"
+"{\n"
+    "int slot = int(inBatchSlot);\n"
+    "exTexCoord = inTexCoord;\n"
+    "exColour = inColour;\n"
+    "exAlphaFactor = alphaFactors[slot];\n"
+    "exClipRect = clipRects[slot];\n"
+    "gl_Position = modelViewProjMatrices[slot] * vec4(inPosition, 1.0);\n"
+"}"
+;
+
+/*! A string containing a desktop OpenGL 3.2 fragment shader for a batch of
+    textured GeometryBuffers, see BatchedShaderSolidFragDesktopOpengl3. */
+static const char BatchedShaderTexturedFragDesktopOpengl3[] = 
+"#version 150 core\n"
+"uniform sampler2D texture0;\n"
+"in vec2 exTexCoord;\n"
+"in vec4 exColour;\n"
+"flat in float exAlphaFactor;\n"
+"flat in vec4 exClipRect;\n"
+"out vec4 out0;\n"
+"void main(void)\n"
+"{\n"
+    "if (any(lessThan(gl_FragCoord.xy, exClipRect.xy)) ||\n"
+    "    any(greaterThanEqual(gl_FragCoord.xy, exClipRect.zw)))\n"
+        "discard;\n"
+    "out0 = texture(texture0, exTexCoord) * exColour;\n"
+    "out0.a *= exAlphaFactor;\n"
+"}"
+;
+
 /*! A string containing an OpenGL ES 3.0 vertex shader for solid colouring of a
     polygon. */
 static const char StandardShaderSolidVertOpenglEs3[] = 
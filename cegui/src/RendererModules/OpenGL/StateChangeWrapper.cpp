@@ -157,7 +157,10 @@ void OpenGLBaseStateChangeWrapper::useProgram(GLuint program)
     {
         glUseProgram(program);
         d_shaderProgram = program;
+        ++d_statistics.d_stateChanges;
     }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 GLuint OpenGLBaseStateChangeWrapper::getUsedProgram() const
 {
@@ -168,7 +171,12 @@ void OpenGLBaseStateChangeWrapper::blendFunc(GLenum sfactor, GLenum dfactor)
 {
     bool callIsRedundant = d_blendFuncSeperateParams.equal(sfactor, dfactor);
     if (!callIsRedundant)
+    {
         glBlendFunc(sfactor, dfactor);
+        ++d_statistics.d_stateChanges;
+    }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 OpenGLBaseStateChangeWrapper::BlendFuncSeperateParams OpenGLBaseStateChangeWrapper::getBlendFuncParams() const
@@ -180,14 +188,24 @@ void OpenGLBaseStateChangeWrapper::blendFuncSeparate(GLenum sfactorRGB, GLenum d
 {
     bool callIsRedundant = d_blendFuncSeperateParams.equal(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
     if (!callIsRedundant)
+    {
         glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+        ++d_statistics.d_stateChanges;
+    }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 void OpenGLBaseStateChangeWrapper::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     bool callIsRedundant = d_viewPortParams.equal(x, y, width, height);
     if(!callIsRedundant)
+    {
         glViewport(x, y, width, height);
+        ++d_statistics.d_stateChanges;
+    }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 OpenGLBaseStateChangeWrapper::PortParams OpenGLBaseStateChangeWrapper::getViewportParams() const
@@ -199,7 +217,12 @@ void OpenGLBaseStateChangeWrapper::scissor(GLint x, GLint y, GLsizei width, GLsi
 {
     bool callIsRedundant = d_scissorParams.equal(x, y, width, height);
     if (!callIsRedundant)
+    {
         glScissor(x, y, width, height);
+        ++d_statistics.d_stateChanges;
+    }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 OpenGLBaseStateChangeWrapper::PortParams OpenGLBaseStateChangeWrapper::getScissorParams() const
@@ -211,7 +234,12 @@ void OpenGLBaseStateChangeWrapper::bindBuffer(GLenum target, GLuint buffer)
 {
     bool callIsRedundant = d_bindBufferParams.equal(target, buffer);
     if (!callIsRedundant)
+    {
         glBindBuffer(target, buffer);
+        ++d_statistics.d_stateChanges;
+    }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 OpenGLBaseStateChangeWrapper::BindBufferParams OpenGLBaseStateChangeWrapper::getBoundBuffer() const
@@ -228,7 +256,10 @@ void OpenGLBaseStateChangeWrapper::activeTexture(unsigned int texture_position)
 
         glActiveTexture(GL_TEXTURE0 + texture_position);
         d_activeTexturePosition = texture_position;
+        ++d_statistics.d_stateChanges;
     }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 unsigned int OpenGLBaseStateChangeWrapper::getActiveTexture() const
@@ -246,7 +277,10 @@ void OpenGLBaseStateChangeWrapper::bindTexture(GLenum target, GLuint texture)
     {
         glBindTexture(target, texture);
         boundTexture.bindTexture(target, texture);
+        ++d_statistics.d_stateChanges;
     }
+    else
+        ++d_statistics.d_skippedStateChanges;
 }
 
 void OpenGLBaseStateChangeWrapper::enable(GLenum capability)
@@ -254,17 +288,19 @@ void OpenGLBaseStateChangeWrapper::enable(GLenum capability)
     std::map<GLenum, bool>::iterator found_iterator = d_enabledOpenGLStates.find(capability);
     if(found_iterator != d_enabledOpenGLStates.end())
     {
-        if(found_iterator->second != true)
+        if(found_iterator->second == true)
         {
-            glEnable(capability);
-            found_iterator->second = true;
+            ++d_statistics.d_skippedStateChanges;
+            return;
         }
+
+        found_iterator->second = true;
     }
     else
-    {
         d_enabledOpenGLStates[capability] = true;
-        glEnable(capability);
-    }
+
+    glEnable(capability);
+    ++d_statistics.d_stateChanges;
 }
 
 void OpenGLBaseStateChangeWrapper::disable(GLenum capability)
@@ -272,17 +308,54 @@ void OpenGLBaseStateChangeWrapper::disable(GLenum capability)
     std::map<GLenum, bool>::iterator found_iterator = d_enabledOpenGLStates.find(capability);
     if(found_iterator != d_enabledOpenGLStates.end())
     {
-        if(found_iterator->second != false)
+        if(found_iterator->second == false)
         {
-            glDisable(capability);
-            found_iterator->second = false;
+            ++d_statistics.d_skippedStateChanges;
+            return;
         }
+
+        found_iterator->second = false;
     }
     else
-    {
         d_enabledOpenGLStates[capability] = false;
-        glDisable(capability);
-    }
+
+    glDisable(capability);
+    ++d_statistics.d_stateChanges;
+}
+
+void OpenGLBaseStateChangeWrapper::uniform1i(GLint location, GLint value)
+{
+    glUniform1i(location, value);
+    ++d_statistics.d_stateChanges;
+    ++d_statistics.d_uniformUploads;
+}
+
+void OpenGLBaseStateChangeWrapper::uniform1f(GLint location, GLfloat value)
+{
+    glUniform1f(location, value);
+    ++d_statistics.d_stateChanges;
+    ++d_statistics.d_uniformUploads;
+}
+
+void OpenGLBaseStateChangeWrapper::uniform1fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    glUniform1fv(location, count, value);
+    ++d_statistics.d_stateChanges;
+    ++d_statistics.d_uniformUploads;
+}
+
+void OpenGLBaseStateChangeWrapper::uniform4fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    glUniform4fv(location, count, value);
+    ++d_statistics.d_stateChanges;
+    ++d_statistics.d_uniformUploads;
+}
+
+void OpenGLBaseStateChangeWrapper::uniformMatrix4fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    glUniformMatrix4fv(location, count, GL_FALSE, value);
+    ++d_statistics.d_stateChanges;
+    ++d_statistics.d_uniformUploads;
 }
 
 int OpenGLBaseStateChangeWrapper::isStateEnabled(GLenum capability) const
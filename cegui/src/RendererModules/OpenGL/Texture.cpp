@@ -394,6 +394,27 @@ void OpenGLTexture::setOpenGLTexture(GLuint tex, const Sizef& size)
     updateCachedScaleValues();
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGLTexture::releaseData()
+{
+    // a grabbed texture has no OpenGL texture to release
+    if (d_grabBuffer)
+        return false;
+
+    // save old texture binding
+    GLuint old_tex;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&old_tex));
+
+    // An empty image frees the storage and keeps the texture name, which the
+    // state change wrappers may have cached. d_size is kept as well.
+    glBindTexture(GL_TEXTURE_2D, d_ogltexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    // restore previous texture binding.
+    glBindTexture(GL_TEXTURE_2D, old_tex);
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 bool OpenGLTexture::isPixelFormatSupported(const PixelFormat fmt) const
 {
@@ -411,6 +432,13 @@ bool OpenGLTexture::isPixelFormatSupported(const PixelFormat fmt) const
     case PixelFormat::RgbaDxt5:
         return OpenGLInfo::getSingleton().isS3tcSupported();
 
+    case PixelFormat::RgbaBc7:
+        return OpenGLInfo::getSingleton().isBptcSupported();
+
+    case PixelFormat::RgbEtc2:
+    case PixelFormat::RgbaEtc2:
+        return OpenGLInfo::getSingleton().isEtc2Supported();
+
     default:
         return false;
     }
@@ -0,0 +1,291 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Pixel storage of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/FrameBuffer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+inline std::uint8_t toByte(float value)
+{
+    return static_cast<std::uint8_t>(std::min(std::max(value, 0.f), 1.f) * 255.f + 0.5f);
+}
+
+//----------------------------------------------------------------------------//
+struct CrcTable
+{
+    CrcTable()
+    {
+        for (std::uint32_t n = 0; n < 256; ++n)
+        {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+
+            d_values[n] = c;
+        }
+    }
+
+    std::uint32_t d_values[256];
+};
+
+//----------------------------------------------------------------------------//
+std::uint32_t crc32(const std::uint8_t* data, std::size_t length)
+{
+    static const CrcTable table;
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < length; ++i)
+        crc = table.d_values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+//----------------------------------------------------------------------------//
+void appendBigEndian(std::vector<std::uint8_t>& data, std::uint32_t value)
+{
+    data.push_back(static_cast<std::uint8_t>(value >> 24));
+    data.push_back(static_cast<std::uint8_t>(value >> 16));
+    data.push_back(static_cast<std::uint8_t>(value >> 8));
+    data.push_back(static_cast<std::uint8_t>(value));
+}
+
+//----------------------------------------------------------------------------//
+void appendChunk(std::vector<std::uint8_t>& data, const char* type,
+                 const std::vector<std::uint8_t>& content)
+{
+    appendBigEndian(data, static_cast<std::uint32_t>(content.size()));
+
+    const std::size_t typeStart = data.size();
+    data.insert(data.end(), type, type + 4);
+    data.insert(data.end(), content.begin(), content.end());
+
+    appendBigEndian(data, crc32(&data[typeStart], data.size() - typeStart));
+}
+
+}
+
+//----------------------------------------------------------------------------//
+SoftwareFrameBuffer::SoftwareFrameBuffer() :
+    d_width(0),
+    d_height(0),
+    d_withStencil(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareFrameBuffer::SoftwareFrameBuffer(unsigned int width, unsigned int height,
+                                         bool withStencil) :
+    d_width(0),
+    d_height(0),
+    d_withStencil(withStencil)
+{
+    resize(width, height);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareFrameBuffer::resize(unsigned int width, unsigned int height)
+{
+    d_width = width;
+    d_height = height;
+
+    const std::size_t count = static_cast<std::size_t>(width) * height;
+    d_pixels.resize(count * 4);
+    d_stencil.resize(d_withStencil ? count : 0);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareFrameBuffer::setStencilEnabled(bool setting)
+{
+    d_withStencil = setting;
+    d_stencil.assign(setting ? static_cast<std::size_t>(d_width) * d_height : 0, 0);
+}
+
+//----------------------------------------------------------------------------//
+argb_t SoftwareFrameBuffer::getPixel(unsigned int x, unsigned int y) const
+{
+    if (x >= d_width || y >= d_height)
+        throw InvalidRequestException("The pixel is outside of the frame buffer.");
+
+    const std::uint8_t* pixel = &d_pixels[(static_cast<std::size_t>(y) * d_width + x) * 4];
+    return (static_cast<argb_t>(pixel[3]) << 24) | (static_cast<argb_t>(pixel[0]) << 16) |
+           (static_cast<argb_t>(pixel[1]) << 8) | pixel[2];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareFrameBuffer::clear(const Colour& colour)
+{
+    const std::uint8_t value[4] = { toByte(colour.getRed()), toByte(colour.getGreen()),
+                                    toByte(colour.getBlue()), toByte(colour.getAlpha()) };
+
+    for (std::size_t i = 0; i < d_pixels.size(); i += 4)
+        std::copy(value, value + 4, &d_pixels[i]);
+
+    std::fill(d_stencil.begin(), d_stencil.end(), 0);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareFrameBuffer::clearStencil(int left, int top, int right, int bottom)
+{
+    if (!d_withStencil)
+        return;
+
+    left = std::max(left, 0);
+    top = std::max(top, 0);
+    right = std::min(right, static_cast<int>(d_width));
+    bottom = std::min(bottom, static_cast<int>(d_height));
+
+    for (int y = top; y < bottom; ++y)
+        std::fill(d_stencil.begin() + y * d_width + left,
+                  d_stencil.begin() + y * d_width + right, 0);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareFrameBuffer::Difference SoftwareFrameBuffer::compare(
+    const SoftwareFrameBuffer& other, int tolerance) const
+{
+    Difference result;
+
+    if (d_width != other.d_width || d_height != other.d_height)
+    {
+        result.d_differingPixels = std::max(d_pixels.size(), other.d_pixels.size()) / 4;
+        result.d_maxChannelDifference = 255;
+        return result;
+    }
+
+    for (std::size_t i = 0; i < d_pixels.size(); i += 4)
+    {
+        int pixelDifference = 0;
+        for (int c = 0; c < 4; ++c)
+            pixelDifference = std::max(pixelDifference,
+                                       std::abs(d_pixels[i + c] - other.d_pixels[i + c]));
+
+        if (pixelDifference > tolerance)
+            ++result.d_differingPixels;
+
+        result.d_maxChannelDifference = std::max(result.d_maxChannelDifference, pixelDifference);
+    }
+
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareFrameBuffer::savePNG(const String& filename) const
+{
+    std::vector<std::uint8_t> data;
+    encodePNG(data);
+
+    std::ofstream file;
+#   if defined(_MSC_VER)
+    file.open(System::getStringTranscoder().stringToStdWString(filename).c_str(),
+              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+#   else
+#       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    file.open(String::convertUtf32ToUtf8(filename.getString()).c_str(),
+              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+#       else
+    file.open(filename.c_str(),
+              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+#       endif
+#   endif
+
+    if (file)
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+    if (!file)
+        throw FileIOException(
+            "Failed to write file '" + filename + "'");
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareFrameBuffer::encodePNG(std::vector<std::uint8_t>& data) const
+{
+    static const std::uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    data.assign(signature, signature + 8);
+
+    std::vector<std::uint8_t> header;
+    appendBigEndian(header, d_width);
+    appendBigEndian(header, d_height);
+    // 8 bits per channel, RGBA, deflate, adaptive filtering, no interlace
+    const std::uint8_t format[5] = { 8, 6, 0, 0, 0 };
+    header.insert(header.end(), format, format + 5);
+    appendChunk(data, "IHDR", header);
+
+    // Each row is preceded by its filter type, 0 (none)
+    const std::size_t rowSize = static_cast<std::size_t>(d_width) * 4 + 1;
+    std::vector<std::uint8_t> raw(rowSize * d_height, 0);
+    for (unsigned int y = 0; y < d_height; ++y)
+        std::copy(d_pixels.begin() + y * (rowSize - 1), d_pixels.begin() + (y + 1) * (rowSize - 1),
+                  raw.begin() + y * rowSize + 1);
+
+    // zlib stream made of stored (uncompressed) deflate blocks; the images
+    // are meant for tests and tools, not for size.
+    std::vector<std::uint8_t> compressed;
+    compressed.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    compressed.push_back(0x78);
+    compressed.push_back(0x01);
+
+    std::size_t offset = 0;
+    do
+    {
+        const std::size_t length = std::min<std::size_t>(65535, raw.size() - offset);
+        const bool last = offset + length == raw.size();
+        compressed.push_back(last ? 1 : 0);
+        compressed.push_back(static_cast<std::uint8_t>(length));
+        compressed.push_back(static_cast<std::uint8_t>(length >> 8));
+        compressed.push_back(static_cast<std::uint8_t>(~length));
+        compressed.push_back(static_cast<std::uint8_t>(~length >> 8));
+        compressed.insert(compressed.end(), raw.begin() + offset, raw.begin() + offset + length);
+        offset += length;
+    }
+    while (offset < raw.size());
+
+    std::uint32_t adlerA = 1, adlerB = 0;
+    for (const std::uint8_t value : raw)
+    {
+        adlerA = (adlerA + value) % 65521;
+        adlerB = (adlerB + adlerA) % 65521;
+    }
+    appendBigEndian(compressed, (adlerB << 16) | adlerA);
+
+    appendChunk(data, "IDAT", compressed);
+    appendChunk(data, "IEND", std::vector<std::uint8_t>());
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,124 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    GeometryBuffer implementation of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RenderEffect.h"
+#include "CEGUI/RenderMaterial.h"
+
+namespace CEGUI
+{
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::SoftwareGeometryBuffer(SoftwareRenderer& owner,
+                                               CEGUI::RefCounted<RenderMaterial> renderMaterial) :
+    GeometryBuffer(renderMaterial),
+    d_owner(owner)
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::draw(std::uint32_t drawModeMask) const
+{
+    CEGUI_UNUSED(drawModeMask);
+
+    SoftwareFrameBuffer* target = d_owner.getActiveFrameBuffer();
+    if (d_vertexData.empty() || !target)
+        return;
+
+    if (d_clippingActive)
+    {
+        // Skip completely clipped geometry
+        if (!static_cast<int>(d_preparedClippingRegion.getWidth()) ||
+            !static_cast<int>(d_preparedClippingRegion.getHeight()))
+            return;
+    }
+
+    SoftwareRasteriser::DrawCall call;
+    call.d_target = target;
+    call.d_vertices = d_vertexData.data();
+    call.d_vertexCount = d_vertexCount;
+    call.d_stride = getVertexAttributeElementCount();
+
+    int offset = 0;
+    for (const VertexAttributeType attribute : d_vertexAttributes)
+    {
+        switch (attribute)
+        {
+        case VertexAttributeType::Position0:
+            call.d_positionOffset = offset;
+            offset += 3;
+            break;
+        case VertexAttributeType::Colour0:
+            call.d_colourOffset = offset;
+            offset += 4;
+            break;
+        case VertexAttributeType::TexCoord0:
+            call.d_texCoordOffset = offset;
+            offset += 2;
+            break;
+        }
+    }
+
+    if (const Texture* texture = getMainTexture())
+        call.d_texture = &static_cast<const SoftwareTexture*>(texture)->getFrameBuffer();
+
+    call.d_matrix = d_owner.getViewProjectionMatrix() * getModelMatrix();
+    call.d_viewport = d_owner.getActiveRenderTarget()->getArea();
+    call.d_clippingActive = d_clippingActive;
+    call.d_clippingRegion = d_preparedClippingRegion;
+    call.d_alpha = d_alpha;
+    call.d_blendMode = d_blendMode;
+    call.d_fillRule = d_polygonFillRule;
+    call.d_postStencilVertexCount = d_postStencilVertexCount;
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        d_renderMaterial->prepareForRendering();
+
+        const SoftwareRasteriser::Result result = d_owner.getRasteriser().draw(call);
+        d_owner.addStatistics(result.d_triangles, result.d_fragments);
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+
+    updateRenderTargetData(d_owner.getActiveRenderTarget());
+}
+
+//----------------------------------------------------------------------------//
+
+}
@@ -0,0 +1,575 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Triangle rasteriser of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/FrameBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// Draws covering fewer pixels are not worth waking up the worker threads
+const int MinParallelArea = 128 * 128;
+
+//----------------------------------------------------------------------------//
+inline float clamp01(float value)
+{
+    return value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint8_t toByte(float value)
+{
+    return static_cast<std::uint8_t>(clamp01(value) * 255.f + 0.5f);
+}
+
+//----------------------------------------------------------------------------//
+// Bilinear sample with clamp to edge addressing, like GL_LINEAR and
+// GL_CLAMP_TO_EDGE. Sampling a missing or empty texture gives opaque black,
+// as sampling an incomplete texture does in OpenGL.
+void sampleTexture(const SoftwareFrameBuffer* texture, float u, float v, float* out)
+{
+    const int width = texture ? static_cast<int>(texture->getWidth()) : 0;
+    const int height = texture ? static_cast<int>(texture->getHeight()) : 0;
+    if (!width || !height)
+    {
+        out[0] = out[1] = out[2] = 0.f;
+        out[3] = 1.f;
+        return;
+    }
+
+    // Clamping first also keeps the int conversions below defined
+    const float tx = std::min(std::max(u * width - 0.5f, -1.f), static_cast<float>(width));
+    const float ty = std::min(std::max(v * height - 0.5f, -1.f), static_cast<float>(height));
+    const float floorX = std::floor(tx);
+    const float floorY = std::floor(ty);
+    const float fx = tx - floorX;
+    const float fy = ty - floorY;
+
+    const int x0 = std::min(std::max(static_cast<int>(floorX), 0), width - 1);
+    const int y0 = std::min(std::max(static_cast<int>(floorY), 0), height - 1);
+    const int x1 = std::min(std::max(static_cast<int>(floorX) + 1, 0), width - 1);
+    const int y1 = std::min(std::max(static_cast<int>(floorY) + 1, 0), height - 1);
+
+    const std::uint8_t* pixels = texture->getPixels();
+    const std::uint8_t* p00 = pixels + (y0 * width + x0) * 4;
+    const std::uint8_t* p10 = pixels + (y0 * width + x1) * 4;
+    const std::uint8_t* p01 = pixels + (y1 * width + x0) * 4;
+    const std::uint8_t* p11 = pixels + (y1 * width + x1) * 4;
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const float top = p00[c] + (p10[c] - p00[c]) * fx;
+        const float bottom = p01[c] + (p11[c] - p01[c]) * fx;
+        out[c] = (top + (bottom - top) * fy) * (1.f / 255.f);
+    }
+}
+
+//----------------------------------------------------------------------------//
+// The blend equations set up by OpenGL3Renderer::setupRenderingBlendMode
+inline void blend(std::uint8_t* dst, const float* src, BlendMode mode)
+{
+    const float srcA = clamp01(src[3]);
+    const float dstA = dst[3] * (1.f / 255.f);
+    const float invSrcA = 1.f - srcA;
+
+    if (mode == BlendMode::RttPremultiplied)
+    {
+        for (int c = 0; c < 3; ++c)
+            dst[c] = toByte(clamp01(src[c]) + dst[c] * (1.f / 255.f) * invSrcA);
+
+        dst[3] = toByte(srcA + dstA * invSrcA);
+    }
+    else
+    {
+        for (int c = 0; c < 3; ++c)
+            dst[c] = toByte(clamp01(src[c]) * srcA + dst[c] * (1.f / 255.f) * invSrcA);
+
+        dst[3] = toByte(srcA * (1.f - dstA) + dstA);
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::SoftwareRasteriser() :
+    d_call(nullptr),
+    d_left(0),
+    d_top(0),
+    d_right(0),
+    d_bottom(0),
+    d_tileCount(0),
+    d_generation(0),
+    d_busyWorkers(0),
+    d_stopping(false),
+    d_nextTile(0),
+    d_fragments(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::~SoftwareRasteriser()
+{
+    setThreadCount(1);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setThreadCount(unsigned int count)
+{
+    if (!count)
+        count = std::max(1u, std::thread::hardware_concurrency());
+
+    if (count == getThreadCount())
+        return;
+
+    if (!d_workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_stopping = true;
+        }
+        d_wakeCondition.notify_all();
+
+        for (auto& worker : d_workers)
+            worker.join();
+
+        d_workers.clear();
+        d_stopping = false;
+    }
+
+    // The calling thread rasterises too, so it counts as one of them. Workers
+    // get the current generation here, one read once they run could already
+    // include the next draw, which they would then never take part in.
+    for (unsigned int i = 1; i < count; ++i)
+        d_workers.emplace_back(&SoftwareRasteriser::workerMain, this, d_generation);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::Result SoftwareRasteriser::draw(const DrawCall& call)
+{
+    Result result;
+
+    SoftwareFrameBuffer* target = call.d_target;
+    if (!target || !call.d_vertices || call.d_vertexCount < 3 || call.d_stride <= 0)
+        return result;
+
+    const int fbWidth = static_cast<int>(target->getWidth());
+    const int fbHeight = static_cast<int>(target->getHeight());
+
+    // Frame buffer rows go from top to bottom, while OpenGL window
+    // coordinates (and so the viewport and scissor boxes) go upwards.
+    const Rectf& vp = call.d_viewport;
+    const int vpHeight = static_cast<int>(vp.getHeight());
+    d_left = static_cast<int>(vp.left());
+    d_right = d_left + static_cast<int>(vp.getWidth());
+    d_bottom = fbHeight - static_cast<int>(vp.top());
+    d_top = d_bottom - vpHeight;
+
+    if (call.d_clippingActive)
+    {
+        const Rectf& clip = call.d_clippingRegion;
+        const int scissorX = static_cast<int>(clip.left());
+        const int scissorY = static_cast<int>(vpHeight - clip.bottom());
+        const int scissorW = static_cast<int>(clip.getWidth());
+        const int scissorH = static_cast<int>(clip.getHeight());
+
+        d_left = std::max(d_left, scissorX);
+        d_right = std::min(d_right, scissorX + scissorW);
+        d_top = std::max(d_top, fbHeight - (scissorY + scissorH));
+        d_bottom = std::min(d_bottom, fbHeight - scissorY);
+    }
+
+    d_left = std::max(d_left, 0);
+    d_top = std::max(d_top, 0);
+    d_right = std::min(d_right, fbWidth);
+    d_bottom = std::min(d_bottom, fbHeight);
+
+    if (d_left >= d_right || d_top >= d_bottom)
+        return result;
+
+    d_call = &call;
+    setupVertices(call);
+
+    d_triangles.clear();
+    d_passes.clear();
+
+    const std::size_t postCount = std::min(call.d_postStencilVertexCount, call.d_vertexCount);
+    if (call.d_fillRule == PolygonFillRule::NoFilling)
+    {
+        Pass pass = { PassOp::Colour, StencilFunc::Always, 0, 0, false };
+        setupTriangles(0, call.d_vertexCount);
+        pass.d_triangleCount = d_triangles.size();
+        d_passes.push_back(pass);
+    }
+    else
+    {
+        // Find the covered pixels with the stencil, then draw the geometry
+        // following the stencil geometry where the fill rule says inside.
+        const bool evenOdd = call.d_fillRule == PolygonFillRule::EvenOdd;
+        const std::size_t stencilCount = call.d_vertexCount - postCount;
+
+        Pass stencilPass = { evenOdd ? PassOp::StencilInvert : PassOp::StencilWind,
+                             StencilFunc::Always, 0, 0, true };
+        setupTriangles(0, stencilCount);
+        stencilPass.d_triangleCount = d_triangles.size();
+        d_passes.push_back(stencilPass);
+
+        Pass colourPass = { PassOp::Colour,
+                            evenOdd ? StencilFunc::EqualFF : StencilFunc::NotEqualZero,
+                            d_triangles.size(), 0, false };
+        setupTriangles(stencilCount, postCount);
+        colourPass.d_triangleCount = d_triangles.size() - colourPass.d_firstTriangle;
+        d_passes.push_back(colourPass);
+    }
+
+    d_tileCount = (d_bottom - d_top + TileHeight - 1) / TileHeight;
+    d_fragments = 0;
+    runTiles();
+
+    result.d_triangles = call.d_vertexCount / 3;
+    result.d_fragments = d_fragments;
+    d_call = nullptr;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setupVertices(const DrawCall& call)
+{
+    d_vertices.resize(call.d_vertexCount);
+
+    const Rectf& vp = call.d_viewport;
+    const float vpWidth = vp.getWidth();
+    const float vpHeight = vp.getHeight();
+    const float fbHeight = static_cast<float>(call.d_target->getHeight());
+
+    const float* src = call.d_vertices;
+    for (Vertex& vertex : d_vertices)
+    {
+        const float* pos = src + call.d_positionOffset;
+        const glm::vec4 clip = call.d_matrix * glm::vec4(pos[0], pos[1], pos[2], 1.f);
+
+        // Vertices behind the eye have their triangles dropped
+        vertex.d_invW = (clip.w > 0.f) ? 1.f / clip.w : 0.f;
+
+        const float ndcX = clip.x * vertex.d_invW;
+        const float ndcY = clip.y * vertex.d_invW;
+        vertex.d_x = vp.left() + (ndcX + 1.f) * 0.5f * vpWidth;
+        vertex.d_y = fbHeight - (vp.top() + (ndcY + 1.f) * 0.5f * vpHeight);
+
+        if (call.d_colourOffset >= 0)
+            std::copy(src + call.d_colourOffset, src + call.d_colourOffset + 4, vertex.d_colour);
+        else
+            std::fill(vertex.d_colour, vertex.d_colour + 4, 1.f);
+
+        if (call.d_texCoordOffset >= 0)
+        {
+            vertex.d_uv[0] = src[call.d_texCoordOffset];
+            vertex.d_uv[1] = src[call.d_texCoordOffset + 1];
+        }
+        else
+        {
+            vertex.d_uv[0] = vertex.d_uv[1] = 0.f;
+        }
+
+        src += call.d_stride;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setupTriangles(std::size_t firstVertex, std::size_t vertexCount)
+{
+    const std::size_t end = firstVertex + vertexCount - vertexCount % 3;
+    for (std::size_t i = firstVertex; i < end; i += 3)
+    {
+        const Vertex& a = d_vertices[i];
+        const Vertex& b = d_vertices[i + 1];
+        const Vertex& c = d_vertices[i + 2];
+
+        if (a.d_invW <= 0.f || b.d_invW <= 0.f || c.d_invW <= 0.f)
+            continue;
+
+        float area = (b.d_x - a.d_x) * (c.d_y - a.d_y) - (b.d_y - a.d_y) * (c.d_x - a.d_x);
+        if (area == 0.f || !std::isfinite(area))
+            continue;
+
+        Triangle tri;
+        tri.d_flipped = area < 0.f;
+        tri.d_index[0] = static_cast<std::uint32_t>(i);
+        tri.d_index[1] = static_cast<std::uint32_t>(tri.d_flipped ? i + 2 : i + 1);
+        tri.d_index[2] = static_cast<std::uint32_t>(tri.d_flipped ? i + 1 : i + 2);
+        tri.d_invArea = 1.f / std::fabs(area);
+        tri.d_perspective = a.d_invW != b.d_invW || a.d_invW != c.d_invW;
+
+        // Rows and columns whose pixel centre may be covered, clamped to the
+        // scissor rectangle before converting to int.
+        const float minX = std::max(std::min(std::min(a.d_x, b.d_x), c.d_x) - 0.5f, static_cast<float>(d_left));
+        const float maxX = std::min(std::max(std::max(a.d_x, b.d_x), c.d_x) - 0.5f, static_cast<float>(d_right));
+        const float minY = std::max(std::min(std::min(a.d_y, b.d_y), c.d_y) - 0.5f, static_cast<float>(d_top));
+        const float maxY = std::min(std::max(std::max(a.d_y, b.d_y), c.d_y) - 0.5f, static_cast<float>(d_bottom));
+
+        tri.d_minX = static_cast<int>(std::ceil(minX));
+        tri.d_maxX = std::min(static_cast<int>(std::floor(maxX)) + 1, d_right);
+        tri.d_minY = static_cast<int>(std::ceil(minY));
+        tri.d_maxY = std::min(static_cast<int>(std::floor(maxY)) + 1, d_bottom);
+
+        if (tri.d_minX < tri.d_maxX && tri.d_minY < tri.d_maxY)
+            d_triangles.push_back(tri);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::runTiles()
+{
+    const int area = (d_right - d_left) * (d_bottom - d_top);
+    if (d_workers.empty() || d_tileCount < 2 || area < MinParallelArea)
+    {
+        for (int tile = 0; tile < d_tileCount; ++tile)
+            rasteriseTile(tile);
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_nextTile = 0;
+        d_busyWorkers = d_workers.size();
+        ++d_generation;
+    }
+    d_wakeCondition.notify_all();
+
+    for (int tile; (tile = d_nextTile++) < d_tileCount; )
+        rasteriseTile(tile);
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_doneCondition.wait(lock, [this]() { return d_busyWorkers == 0; });
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::workerMain(std::uint64_t generation)
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_wakeCondition.wait(lock, [&]() { return d_stopping || d_generation != generation; });
+            if (d_stopping)
+                return;
+
+            generation = d_generation;
+        }
+
+        for (int tile; (tile = d_nextTile++) < d_tileCount; )
+            rasteriseTile(tile);
+
+        std::lock_guard<std::mutex> lock(d_mutex);
+        if (--d_busyWorkers == 0)
+            d_doneCondition.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::rasteriseTile(int tile)
+{
+    const int top = d_top + tile * TileHeight;
+    const int bottom = std::min(top + TileHeight, d_bottom);
+
+    SoftwareFrameBuffer& target = *d_call->d_target;
+    std::uint8_t* const stencil = target.getStencil();
+
+    std::size_t fragments = 0;
+    for (const Pass& pass : d_passes)
+    {
+        // Without a stencil buffer the stencil test always passes and stencil
+        // operations do nothing, as in OpenGL.
+        if (pass.d_op != PassOp::Colour && !stencil)
+            continue;
+
+        if (pass.d_clearStencil)
+            target.clearStencil(d_left, top, d_right, bottom);
+
+        const std::size_t end = pass.d_firstTriangle + pass.d_triangleCount;
+        for (std::size_t i = pass.d_firstTriangle; i < end; ++i)
+        {
+            const Triangle& tri = d_triangles[i];
+            if (tri.d_maxY <= top || tri.d_minY >= bottom)
+                continue;
+
+            fragments += rasteriseTriangle(tri, pass, std::max(top, tri.d_minY),
+                                           std::min(bottom, tri.d_maxY));
+        }
+    }
+
+    d_fragments += fragments;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SoftwareRasteriser::rasteriseTriangle(const Triangle& tri, const Pass& pass,
+                                                  int top, int bottom)
+{
+    const DrawCall& call = *d_call;
+    SoftwareFrameBuffer& target = *call.d_target;
+    const int width = static_cast<int>(target.getWidth());
+    std::uint8_t* const pixels = target.getPixels();
+    std::uint8_t* const stencil = target.getStencil();
+
+    const Vertex* v[3] = { &d_vertices[tri.d_index[0]],
+                           &d_vertices[tri.d_index[1]],
+                           &d_vertices[tri.d_index[2]] };
+
+    // Edge i is opposite vertex i, its edge function divided by the area of
+    // the triangle is the barycentric weight of that vertex.
+    float edgeX[3], edgeY[3], stepX[3], stepY[3];
+    bool topLeft[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const Vertex& a = *v[(i + 1) % 3];
+        const Vertex& b = *v[(i + 2) % 3];
+        edgeX[i] = a.d_x;
+        edgeY[i] = a.d_y;
+        stepX[i] = -(b.d_y - a.d_y);
+        stepY[i] = b.d_x - a.d_x;
+        // Pixel centres exactly on an edge belong to the triangle to its
+        // right or below it, so that shared edges are drawn exactly once.
+        topLeft[i] = stepX[i] > 0.f || (stepX[i] == 0.f && stepY[i] > 0.f);
+    }
+
+    const bool textured = call.d_texCoordOffset >= 0;
+    const float startX = tri.d_minX + 0.5f;
+    std::size_t fragments = 0;
+
+    for (int y = top; y < bottom; ++y)
+    {
+        const float py = y + 0.5f;
+        float rowEdge[3];
+        for (int i = 0; i < 3; ++i)
+            rowEdge[i] = stepY[i] * (py - edgeY[i]) + stepX[i] * (startX - edgeX[i]);
+
+        // Skip to shortly before the first covered pixel of the row
+        int skip = 0;
+        for (int i = 0; i < 3; ++i)
+            if (stepX[i] > 0.f && rowEdge[i] < 0.f)
+                skip = std::max(skip, static_cast<int>(std::min(-rowEdge[i] / stepX[i],
+                    static_cast<float>(tri.d_maxX - tri.d_minX))) - 1);
+
+        std::uint8_t* pixel = pixels + (y * width + tri.d_minX + skip) * 4;
+        std::uint8_t* const stencilRow = stencil ? stencil + y * width : nullptr;
+        bool entered = false;
+
+        for (int x = tri.d_minX + skip; x < tri.d_maxX; ++x, pixel += 4)
+        {
+            const float offset = static_cast<float>(x - tri.d_minX);
+            const float e0 = rowEdge[0] + stepX[0] * offset;
+            const float e1 = rowEdge[1] + stepX[1] * offset;
+            const float e2 = rowEdge[2] + stepX[2] * offset;
+
+            const bool inside = (topLeft[0] ? e0 >= 0.f : e0 > 0.f) &&
+                                (topLeft[1] ? e1 >= 0.f : e1 > 0.f) &&
+                                (topLeft[2] ? e2 >= 0.f : e2 > 0.f);
+
+            if (!inside)
+            {
+                // Triangles are convex, the covered part of a row is one span
+                if (entered)
+                    break;
+
+                continue;
+            }
+
+            entered = true;
+            std::uint8_t* const stencilValue = stencilRow ? stencilRow + x : nullptr;
+
+            if (pass.d_op == PassOp::StencilInvert)
+            {
+                *stencilValue = static_cast<std::uint8_t>(~*stencilValue);
+                continue;
+            }
+
+            if (pass.d_op == PassOp::StencilWind)
+            {
+                *stencilValue = static_cast<std::uint8_t>(*stencilValue + (tri.d_flipped ? 1 : 255));
+                continue;
+            }
+
+            if (stencilValue &&
+                ((pass.d_stencilFunc == StencilFunc::EqualFF && *stencilValue != 0xFF) ||
+                 (pass.d_stencilFunc == StencilFunc::NotEqualZero && *stencilValue == 0)))
+                continue;
+
+            float w1 = e1 * tri.d_invArea;
+            float w2 = e2 * tri.d_invArea;
+
+            if (tri.d_perspective)
+            {
+                const float p0 = e0 * tri.d_invArea * v[0]->d_invW;
+                const float p1 = w1 * v[1]->d_invW;
+                const float p2 = w2 * v[2]->d_invW;
+                const float norm = 1.f / (p0 + p1 + p2);
+                w1 = p1 * norm;
+                w2 = p2 * norm;
+            }
+
+            // Interpolating relative to the first vertex keeps attributes
+            // that are constant over the triangle exact.
+            float colour[4];
+            for (int c = 0; c < 4; ++c)
+                colour[c] = v[0]->d_colour[c] + (v[1]->d_colour[c] - v[0]->d_colour[c]) * w1 +
+                                                (v[2]->d_colour[c] - v[0]->d_colour[c]) * w2;
+
+            if (textured)
+            {
+                float texel[4];
+                sampleTexture(call.d_texture,
+                              v[0]->d_uv[0] + (v[1]->d_uv[0] - v[0]->d_uv[0]) * w1 +
+                                              (v[2]->d_uv[0] - v[0]->d_uv[0]) * w2,
+                              v[0]->d_uv[1] + (v[1]->d_uv[1] - v[0]->d_uv[1]) * w1 +
+                                              (v[2]->d_uv[1] - v[0]->d_uv[1]) * w2,
+                              texel);
+
+                for (int c = 0; c < 4; ++c)
+                    colour[c] *= texel[c];
+            }
+
+            colour[3] *= call.d_alpha;
+
+            blend(pixel, colour, call.d_blendMode);
+            ++fragments;
+        }
+    }
+
+    return fragments;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
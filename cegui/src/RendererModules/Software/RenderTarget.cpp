@@ -0,0 +1,79 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    RenderTarget base of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SoftwareRenderTarget::SoftwareRenderTarget(SoftwareRenderer& owner,
+                                           SoftwareFrameBuffer* frameBuffer) :
+    d_owner(owner),
+    d_frameBuffer(frameBuffer)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderTarget::~SoftwareRenderTarget()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::activate()
+{
+    if (!RenderTarget::d_matrixValid)
+        updateMatrix();
+
+    d_owner.setViewProjectionMatrix(RenderTarget::d_matrix);
+
+    RenderTarget::activate();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::updateMatrix() const
+{
+    // The rasteriser maps clip space to pixels the way OpenGL does
+    RenderTarget::updateMatrix(RenderTarget::createViewProjMatrixForOpenGL());
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderTarget::isImageryCache() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderTarget::getOwner()
+{
+    return d_owner;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,442 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Main source file for the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/FrameBuffer.h"
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RendererModules/Software/ShaderWrapper.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/TextureFilter.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String SoftwareRenderer::d_rendererID(
+        "CEGUI::SoftwareRenderer - Renderer rasterising on the CPU.");
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::bootstrapSystem(const Sizef& displaySize,
+                                                    const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    if (System::getSingletonPtr())
+        throw InvalidRequestException(
+            "CEGUI::System object is already initialised.");
+
+    SoftwareRenderer& renderer = create(displaySize);
+    DefaultResourceProvider* rp(new DefaultResourceProvider());
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroySystem()
+{
+    System* sys = System::getSingletonPtr();
+    if (sys == nullptr)
+    {
+        throw InvalidRequestException(
+            "CEGUI::System object is not created or was already destroyed.");
+    }
+
+    SoftwareRenderer* renderer = static_cast<SoftwareRenderer*>(sys->getRenderer());
+    ResourceProvider* rp = sys->getResourceProvider();
+
+    System::destroy();
+    delete rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::create(const Sizef& displaySize, const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    return *(new SoftwareRenderer(displaySize));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroy(SoftwareRenderer& renderer)
+{
+    delete &renderer;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareFrameBuffer& SoftwareRenderer::getFrameBuffer()
+{
+    return *d_frameBuffer;
+}
+
+//----------------------------------------------------------------------------//
+const SoftwareFrameBuffer& SoftwareRenderer::getFrameBuffer() const
+{
+    return *d_frameBuffer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setThreadCount(unsigned int count)
+{
+    d_rasteriser->setThreadCount(count);
+}
+
+//----------------------------------------------------------------------------//
+unsigned int SoftwareRenderer::getThreadCount() const
+{
+    return d_rasteriser->getThreadCount();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::addStatistics(std::size_t triangles, std::size_t fragments)
+{
+    ++d_statistics.d_drawCalls;
+    d_statistics.d_triangles += triangles;
+    d_statistics.d_fragments += fragments;
+}
+
+//----------------------------------------------------------------------------//
+RenderTarget& SoftwareRenderer::getDefaultRenderTarget()
+{
+    return *d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+RefCounted<RenderMaterial> SoftwareRenderer::createRenderMaterial(const DefaultShaderType shaderType) const
+{
+    if (shaderType == DefaultShaderType::Textured)
+        return RefCounted<RenderMaterial>(new RenderMaterial(d_shaderWrapperTextured));
+
+    if (shaderType == DefaultShaderType::Solid)
+        return RefCounted<RenderMaterial>(new RenderMaterial(d_shaderWrapperSolid));
+
+    throw RendererException(
+        "A default shader of this type does not exist.");
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial)
+{
+    SoftwareGeometryBuffer* geom_buffer = new SoftwareGeometryBuffer(*this, renderMaterial);
+
+    geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
+    geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
+    geom_buffer->addVertexAttribute(VertexAttributeType::TexCoord0);
+
+    addGeometryBuffer(*geom_buffer);
+    return *geom_buffer;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial)
+{
+    SoftwareGeometryBuffer* geom_buffer = new SoftwareGeometryBuffer(*this, renderMaterial);
+
+    geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
+    geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
+
+    addGeometryBuffer(*geom_buffer);
+    return *geom_buffer;
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* SoftwareRenderer::createTextureTarget(bool addStencilBuffer)
+{
+    TextureTarget* tt = new SoftwareTextureTarget(*this, addStencilBuffer);
+    d_textureTargets.push_back(tt);
+    return tt;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                              d_textureTargets.end(),
+                                              target);
+
+    if (d_textureTargets.end() != i)
+    {
+        if (getActiveRenderTarget() == target)
+            setActiveRenderTarget(nullptr);
+
+        d_textureTargets.erase(i);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextureTargets()
+{
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const String& filename,
+                                         const String& resourceGroup)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name, filename, resourceGroup);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const Sizef& size)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name, size);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::throwIfNameExists(const String& name) const
+{
+    if (d_textures.find(name) != d_textures.end())
+        throw AlreadyExistsException(
+            "[SoftwareRenderer] Texture already exists: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureCreation(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Created texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(Texture& texture)
+{
+    destroyTexture(texture.getName());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(const String& name)
+{
+    TextureMap::iterator i = d_textures.find(name);
+
+    if (d_textures.end() != i)
+    {
+        logTextureDestruction(name);
+        delete i->second;
+        d_textures.erase(i);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureDestruction(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Destroyed texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(d_textures.begin()->first);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::getTexture(const String& name) const
+{
+    TextureMap::const_iterator i = d_textures.find(name);
+
+    if (i == d_textures.end())
+        throw UnknownObjectException(
+            "Texture does not exist: " + name);
+
+    return *i->second;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTextureDefined(const String& name) const
+{
+    return d_textures.find(name) != d_textures.end();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::beginRendering()
+{
+    d_statistics = Statistics();
+
+    if (d_clearOnBeginRendering)
+        d_frameBuffer->clear(d_clearColour);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::endRendering()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setDisplaySize(const Sizef& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+
+        d_frameBuffer->resize(static_cast<unsigned int>(std::max(0.f, sz.d_width)),
+                              static_cast<unsigned int>(std::max(0.f, sz.d_height)));
+        d_frameBuffer->clear(d_clearColour);
+
+        // FIXME: This is probably not the right thing to do in all cases.
+        Rectf area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+unsigned int SoftwareRenderer::getMaxTextureSize() const
+{
+    return 8192;
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTexCoordSystemFlipped() const
+{
+    // Frame buffers, including those of TextureTargets, store the top row first
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::applyTextureFilter(TextureTarget& target,
+                                          const Sizef& size,
+                                          const TextureFilter& filter)
+{
+    SoftwareFrameBuffer& frameBuffer =
+        static_cast<SoftwareTexture&>(target.getTexture()).getFrameBuffer();
+
+    const unsigned int width = std::min(frameBuffer.getWidth(),
+        static_cast<unsigned int>(std::ceil(std::max(0.f, size.d_width))));
+    const unsigned int height = std::min(frameBuffer.getHeight(),
+        static_cast<unsigned int>(std::ceil(std::max(0.f, size.d_height))));
+
+    filter.apply(frameBuffer.getPixels(), width, height,
+                 static_cast<std::size_t>(frameBuffer.getWidth()) * 4);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setActiveRenderTarget(RenderTarget* renderTarget)
+{
+    Renderer::setActiveRenderTarget(renderTarget);
+
+    // RenderTarget is a virtual base, so a static_cast is not possible
+    SoftwareRenderTarget* target = dynamic_cast<SoftwareRenderTarget*>(renderTarget);
+    d_activeFrameBuffer = target ? target->getFrameBuffer() : nullptr;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::SoftwareRenderer(const Sizef& displaySize) :
+    d_displaySize(displaySize),
+    d_frameBuffer(new SoftwareFrameBuffer(
+        static_cast<unsigned int>(std::max(0.f, displaySize.d_width)),
+        static_cast<unsigned int>(std::max(0.f, displaySize.d_height)), true)),
+    d_defaultTarget(nullptr),
+    d_activeFrameBuffer(nullptr),
+    d_rasteriser(new SoftwareRasteriser()),
+    d_shaderWrapperTextured(new SoftwareShaderWrapper()),
+    d_shaderWrapperSolid(new SoftwareShaderWrapper()),
+    d_clearColour(0.f, 0.f, 0.f, 1.f),
+    d_clearOnBeginRendering(true)
+{
+    d_frameBuffer->clear(d_clearColour);
+    d_rasteriser->setThreadCount(0);
+
+    // create default target & rendering root (surface) that uses it
+    d_defaultTarget = new SoftwareRenderTarget(*this, d_frameBuffer);
+    d_defaultTarget->setArea(Rectf(glm::vec2(0, 0), displaySize));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::~SoftwareRenderer()
+{
+    destroyAllGeometryBuffers();
+    SoftwareRenderer::destroyAllTextureTargets();
+    SoftwareRenderer::destroyAllTextures();
+
+    delete d_defaultTarget;
+    delete d_shaderWrapperTextured;
+    delete d_shaderWrapperSolid;
+    delete d_rasteriser;
+    delete d_frameBuffer;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,281 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Texture implementation of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/System.h"
+#include "CEGUI/TextureDecompressor.h"
+#include "CEGUI/Rectf.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const String& SoftwareTexture::getName() const
+{
+    return d_name;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const glm::vec2& SoftwareTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::setSize(const Sizef& sz)
+{
+    d_frameBuffer.resize(
+        static_cast<unsigned int>(std::max(1.f, std::ceil(sz.d_width))),
+        static_cast<unsigned int>(std::max(1.f, std::ceil(sz.d_height))));
+    d_frameBuffer.clear();
+
+    d_dataSize = sz;
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        throw RendererException(
+            "CEGUI::System object has not been created!");
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+                                                     resourceGroup);
+
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    // throw exception if data was load loaded to texture.
+    if (!res)
+        throw RendererException(
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'.");
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromMemory(const void* buffer,
+                                     const Sizef& buffer_size,
+                                     PixelFormat pixel_format)
+{
+    if (!isPixelFormatSupported(pixel_format))
+        throw InvalidRequestException(
+            "Data was supplied in an unsupported pixel format.");
+
+    const unsigned int width = static_cast<unsigned int>(buffer_size.d_width);
+    const unsigned int height = static_cast<unsigned int>(buffer_size.d_height);
+    d_frameBuffer.resize(width, height);
+
+    const std::size_t count = static_cast<std::size_t>(width) * height;
+    std::uint8_t* dst = d_frameBuffer.getPixels();
+
+    // Packed formats are read as native 16 bit values with the first
+    // component in the most significant bits, like GL_UNSIGNED_SHORT_4_4_4_4
+    // and GL_UNSIGNED_SHORT_5_6_5.
+    switch (pixel_format)
+    {
+    case PixelFormat::Rgba:
+        std::memcpy(dst, buffer, count * 4);
+        break;
+
+    case PixelFormat::Rgb:
+    {
+        const std::uint8_t* src = static_cast<const std::uint8_t*>(buffer);
+        for (std::size_t i = 0; i < count; ++i, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 0xFF;
+        }
+        break;
+    }
+
+    case PixelFormat::Rgba4444:
+    {
+        const std::uint16_t* src = static_cast<const std::uint16_t*>(buffer);
+        for (std::size_t i = 0; i < count; ++i, dst += 4)
+        {
+            const std::uint16_t value = src[i];
+            dst[0] = static_cast<std::uint8_t>(((value >> 12) & 0xF) * 17);
+            dst[1] = static_cast<std::uint8_t>(((value >> 8) & 0xF) * 17);
+            dst[2] = static_cast<std::uint8_t>(((value >> 4) & 0xF) * 17);
+            dst[3] = static_cast<std::uint8_t>((value & 0xF) * 17);
+        }
+        break;
+    }
+
+    case PixelFormat::Rgb565:
+    {
+        const std::uint16_t* src = static_cast<const std::uint16_t*>(buffer);
+        for (std::size_t i = 0; i < count; ++i, dst += 4)
+        {
+            const std::uint16_t value = src[i];
+            dst[0] = static_cast<std::uint8_t>(((value >> 11) & 0x1F) * 255 / 31);
+            dst[1] = static_cast<std::uint8_t>(((value >> 5) & 0x3F) * 255 / 63);
+            dst[2] = static_cast<std::uint8_t>((value & 0x1F) * 255 / 31);
+            dst[3] = 0xFF;
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    d_dataSize = buffer_size;
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitFromMemory(const void* sourceData, const Rectf& area)
+{
+    const int texWidth = static_cast<int>(d_frameBuffer.getWidth());
+    const int texHeight = static_cast<int>(d_frameBuffer.getHeight());
+    const int srcWidth = static_cast<int>(area.getWidth());
+
+    const int left = std::max(0, static_cast<int>(area.left()));
+    const int top = std::max(0, static_cast<int>(area.top()));
+    const int right = std::min(texWidth, static_cast<int>(area.left()) + srcWidth);
+    const int bottom = std::min(texHeight, static_cast<int>(area.top()) +
+                                           static_cast<int>(area.getHeight()));
+
+    if (left >= right || top >= bottom)
+        return;
+
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(sourceData);
+    for (int y = top; y < bottom; ++y)
+    {
+        const int srcRow = y - static_cast<int>(area.top());
+        const int srcColumn = left - static_cast<int>(area.left());
+        std::memcpy(d_frameBuffer.getPixels() + (y * texWidth + left) * 4,
+                    src + (srcRow * srcWidth + srcColumn) * 4,
+                    (right - left) * 4);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitToMemory(void* targetData)
+{
+    std::memcpy(targetData, d_frameBuffer.getPixels(),
+                static_cast<std::size_t>(d_frameBuffer.getWidth()) *
+                d_frameBuffer.getHeight() * 4);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::updateCachedScaleValues()
+{
+    d_size.d_width = static_cast<float>(d_frameBuffer.getWidth());
+    d_size.d_height = static_cast<float>(d_frameBuffer.getHeight());
+
+    d_texelScaling.x = d_size.d_width ? 1.0f / d_size.d_width : 0.0f;
+    d_texelScaling.y = d_size.d_height ? 1.0f / d_size.d_height : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const String& filename,
+                                 const String& resourceGroup) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+    SoftwareTexture::loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const Sizef& sz) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+    setSize(sz);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::~SoftwareTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTexture::releaseData()
+{
+    // d_size is kept, an empty frame buffer samples as black
+    const bool stencil = d_frameBuffer.isStencilEnabled();
+    d_frameBuffer = SoftwareFrameBuffer();
+    d_frameBuffer.setStencilEnabled(stencil);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTexture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    // Block compressed data is decoded on the CPU by the image codecs
+    return !TextureDecompressor::isCompressed(fmt);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
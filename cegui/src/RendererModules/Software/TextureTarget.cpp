@@ -0,0 +1,105 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    TextureTarget implementation of the software renderer
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+std::uint32_t SoftwareTextureTarget::s_textureNumber = 0;
+const float SoftwareTextureTarget::DEFAULT_SIZE = 128.0f;
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::SoftwareTextureTarget(SoftwareRenderer& owner, bool addStencilBuffer) :
+    SoftwareRenderTarget(owner, nullptr),
+    TextureTarget(addStencilBuffer),
+    d_CEGUITexture(nullptr)
+{
+    d_CEGUITexture = static_cast<SoftwareTexture*>(
+        &d_owner.createTexture(generateTextureName()));
+
+    d_frameBuffer = &d_CEGUITexture->getFrameBuffer();
+    d_frameBuffer->setStencilEnabled(addStencilBuffer);
+
+    // setup area and cause the initial texture to be generated.
+    SoftwareTextureTarget::declareRenderSize(Sizef(DEFAULT_SIZE, DEFAULT_SIZE));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::~SoftwareTextureTarget()
+{
+    d_owner.destroyTexture(*d_CEGUITexture);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isImageryCache() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::clear()
+{
+    d_frameBuffer->clear();
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareTextureTarget::getTexture() const
+{
+    return *d_CEGUITexture;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::declareRenderSize(const Sizef& sz)
+{
+    // The texture is at least 1 x 1 pixels, like the OpenGL FBO targets
+    setArea(Rectf(d_area.getPosition(),
+                  Sizef(std::max(1.f, std::ceil(sz.d_width)),
+                        std::max(1.f, std::ceil(sz.d_height)))));
+
+    d_CEGUITexture->setSize(d_area.getSize());
+}
+
+//----------------------------------------------------------------------------//
+String SoftwareTextureTarget::generateTextureName()
+{
+    String tmp("_software_tt_tex_");
+    tmp.append(PropertyHelper<std::uint32_t>::toString(s_textureNumber++));
+
+    return tmp;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
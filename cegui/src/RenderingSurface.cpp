@@ -28,6 +28,8 @@
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/Renderer.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/TextureResidencyManager.h"
 #include <algorithm>
 
 namespace CEGUI
@@ -112,6 +114,17 @@ void RenderingSurface::draw(const RenderQueue& queue, RenderQueueEventArgs& args
 {
     fireEvent(EventRenderQueueStarted, args, EventNamespace);
 
+    // evicted textures must be loaded again before the renderer samples them
+    TextureResidencyManager& residency = TextureResidencyManager::getSingleton();
+    if (residency.isEnabled())
+    {
+        for (const GeometryBuffer* buffer : queue.getBuffers())
+        {
+            if (const Texture* texture = buffer->getMainTexture())
+                residency.notifyTextureUsed(*texture);
+        }
+    }
+
     d_target->draw(queue, drawModeMask);
 
     args.handled = 0;
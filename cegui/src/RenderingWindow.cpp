@@ -138,6 +138,9 @@ void RenderingWindow::draw(std::uint32_t drawModeMask)
     {
         // base class will render out queues for us
         RenderingSurface::draw(drawModeMask);
+        // let the effect process the fresh content, it stays in the texture
+        if (RenderEffect* effect = d_geometryBuffer.getRenderEffect())
+            effect->processRenderedContent(*this);
         // mark as no longer invalidated
         d_invalidated = false;
     }
@@ -25,9 +25,27 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/ShaderParameterBindings.h"
+#include "CEGUI/Exceptions.h"
+#include <unordered_map>
 
 namespace CEGUI
 {
+namespace
+{
+//! Names of all shader parameters used so far, indexed by their handle
+struct ParameterNameRegistry
+{
+    std::unordered_map<std::string, ShaderParameterBindings::ParameterHandle> d_handles;
+    std::vector<std::string> d_names;
+};
+
+ParameterNameRegistry& getParameterNameRegistry()
+{
+    static ParameterNameRegistry registry;
+    return registry;
+}
+
+}
 
 //----------------------------------------------------------------------------//
 bool ShaderParameterFloat::equal(const ShaderParameter* other_parameter) const
@@ -92,6 +110,33 @@ ShaderParameterBindings::~ShaderParameterBindings()
         delete pair.second;
 }
 
+//----------------------------------------------------------------------------//
+ShaderParameterBindings::ParameterHandle ShaderParameterBindings::getParameterHandle(
+    const std::string& parameter_name)
+{
+    ParameterNameRegistry& registry = getParameterNameRegistry();
+
+    auto it = registry.d_handles.find(parameter_name);
+    if (it != registry.d_handles.end())
+        return it->second;
+
+    const ParameterHandle handle = static_cast<ParameterHandle>(registry.d_names.size());
+    registry.d_names.push_back(parameter_name);
+    registry.d_handles.emplace(parameter_name, handle);
+    return handle;
+}
+
+//----------------------------------------------------------------------------//
+const std::string& ShaderParameterBindings::getParameterName(ParameterHandle handle)
+{
+    const ParameterNameRegistry& registry = getParameterNameRegistry();
+
+    if (handle >= registry.d_names.size())
+        throw InvalidRequestException("No shader parameter name is registered for the handle.");
+
+    return registry.d_names[handle];
+}
+
 //----------------------------------------------------------------------------//
 void ShaderParameterBindings::removeParameter(const std::string& parameter_name)
 {
@@ -100,6 +145,7 @@ void ShaderParameterBindings::removeParameter(const std::string& parameter_name)
     {
         delete it->second;
         d_shaderParameterBindings.erase(it);
+        d_parametersByHandle[getParameterHandle(parameter_name)] = nullptr;
     }
 }
 
@@ -116,6 +162,12 @@ void ShaderParameterBindings::setNewParameter(const std::string& parameter_name,
     {
         d_shaderParameterBindings.emplace(parameter_name, shader_parameter);
     }
+
+    const ParameterHandle handle = getParameterHandle(parameter_name);
+    if (handle >= d_parametersByHandle.size())
+        d_parametersByHandle.resize(handle + 1, nullptr);
+
+    d_parametersByHandle[handle] = shader_parameter;
 }
 
 //----------------------------------------------------------------------------//
@@ -165,4 +217,44 @@ ShaderParameter* ShaderParameterBindings::getParameter(const std::string& parame
     return (it != d_shaderParameterBindings.end()) ? it->second : nullptr;
 }
 
+//----------------------------------------------------------------------------//
+void ShaderParameterBindings::setParameter(ParameterHandle handle, const glm::mat4& matrix)
+{
+    ShaderParameter* shader_param = getParameter(handle);
+    if (shader_param && (shader_param->getType() == ShaderParamType::Matrix4X4))
+        static_cast<ShaderParameterMatrix*>(shader_param)->d_parameterValue = matrix;
+    else
+        setNewParameter(getParameterName(handle), new ShaderParameterMatrix(matrix));
+}
+
+//----------------------------------------------------------------------------//
+void ShaderParameterBindings::setParameter(ParameterHandle handle, const CEGUI::Texture* texture)
+{
+    ShaderParameter* shader_param = getParameter(handle);
+    if (shader_param && (shader_param->getType() == ShaderParamType::Texture))
+        static_cast<ShaderParameterTexture*>(shader_param)->d_parameterValue = texture;
+    else
+        setNewParameter(getParameterName(handle), new ShaderParameterTexture(texture));
+}
+
+//----------------------------------------------------------------------------//
+void ShaderParameterBindings::setParameter(ParameterHandle handle, float fvalue)
+{
+    ShaderParameter* shader_param = getParameter(handle);
+    if (shader_param && (shader_param->getType() == ShaderParamType::Float))
+        static_cast<ShaderParameterFloat*>(shader_param)->d_parameterValue = fvalue;
+    else
+        setNewParameter(getParameterName(handle), new ShaderParameterFloat(fvalue));
+}
+
+//----------------------------------------------------------------------------//
+void ShaderParameterBindings::setParameter(ParameterHandle handle, int value)
+{
+    ShaderParameter* shader_param = getParameter(handle);
+    if (shader_param && (shader_param->getType() == ShaderParamType::Int))
+        static_cast<ShaderParameterInt*>(shader_param)->d_parameterValue = value;
+    else
+        setNewParameter(getParameterName(handle), new ShaderParameterInt(value));
+}
+
 }
@@ -35,6 +35,7 @@
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/SchemeManager.h"
 #include "CEGUI/RenderEffectManager.h"
+#include "CEGUI/TextureResidencyManager.h"
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/Clipboard.h"
@@ -415,6 +416,9 @@ void System::renderAllGUIContexts()
 
     d_renderer->endRendering();
 
+    // evict textures over budget and start the next frame
+    TextureResidencyManager::getSingleton().update();
+
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
 }
@@ -434,6 +438,9 @@ void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 
     d_renderer->endRendering();
 
+    // evict textures over budget and start the next frame
+    TextureResidencyManager::getSingleton().update();
+
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
 }
@@ -685,6 +692,7 @@ void System::addStandardWindowFactories()
 void System::createSingletons()
 {
     // cause creation of other singleton objects
+    new TextureResidencyManager();
     new ImageManager();
     new FontManager();
     new WindowFactoryManager();
@@ -711,6 +719,7 @@ void System::destroySingletons()
     delete ImageManager::getSingletonPtr();
     delete GlobalEventSet::getSingletonPtr();
     delete SVGDataManager::getSingletonPtr();
+    delete TextureResidencyManager::getSingletonPtr();
 }
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,339 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Packs small images into a shared Texture
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureAtlas.h"
+#include "CEGUI/TextureDecompressor.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::uint32_t TextureAtlas::ImageGutter;
+
+//----------------------------------------------------------------------------//
+namespace
+{
+/*
+    Texture implementation that does not create anything on the GPU and simply
+    keeps the pixels an ImageCodec hands to it, converted to RGBA.
+*/
+class PixelCaptureTexture : public Texture
+{
+public:
+    PixelCaptureTexture(std::vector<std::uint8_t>& pixels) :
+        d_pixels(pixels),
+        d_size(0, 0),
+        d_texelScaling(0, 0),
+        d_captured(false)
+    {}
+
+    bool isCaptured() const { return d_captured; }
+
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&) override
+    {
+        throw InvalidRequestException(
+            "PixelCaptureTexture can only be loaded through an ImageCodec.");
+    }
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format) override
+    {
+        const std::uint32_t width = static_cast<std::uint32_t>(buffer_size.d_width);
+        const std::uint32_t height = static_cast<std::uint32_t>(buffer_size.d_height);
+        const std::size_t count = static_cast<std::size_t>(width) * height;
+        const std::uint8_t* src = static_cast<const std::uint8_t*>(buffer);
+
+        d_size = Sizef(static_cast<float>(width), static_cast<float>(height));
+        d_pixels.resize(count * 4);
+        d_captured = true;
+
+        switch (pixel_format)
+        {
+        case PixelFormat::Rgba:
+            std::memcpy(d_pixels.data(), src, count * 4);
+            break;
+
+        case PixelFormat::Rgb:
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                d_pixels[i * 4 + 0] = src[i * 3 + 0];
+                d_pixels[i * 4 + 1] = src[i * 3 + 1];
+                d_pixels[i * 4 + 2] = src[i * 3 + 2];
+                d_pixels[i * 4 + 3] = 0xFF;
+            }
+            break;
+
+        case PixelFormat::Rgba4444:
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint16_t p;
+                std::memcpy(&p, src + i * 2, 2);
+                d_pixels[i * 4 + 0] = static_cast<std::uint8_t>(((p >> 12) & 0xF) * 17);
+                d_pixels[i * 4 + 1] = static_cast<std::uint8_t>(((p >> 8) & 0xF) * 17);
+                d_pixels[i * 4 + 2] = static_cast<std::uint8_t>(((p >> 4) & 0xF) * 17);
+                d_pixels[i * 4 + 3] = static_cast<std::uint8_t>((p & 0xF) * 17);
+            }
+            break;
+
+        case PixelFormat::Rgb565:
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint16_t p;
+                std::memcpy(&p, src + i * 2, 2);
+                d_pixels[i * 4 + 0] = static_cast<std::uint8_t>(((p >> 11) & 0x1F) * 255 / 31);
+                d_pixels[i * 4 + 1] = static_cast<std::uint8_t>(((p >> 5) & 0x3F) * 255 / 63);
+                d_pixels[i * 4 + 2] = static_cast<std::uint8_t>((p & 0x1F) * 255 / 31);
+                d_pixels[i * 4 + 3] = 0xFF;
+            }
+            break;
+
+        default:
+            if (TextureDecompressor::canDecompress(pixel_format))
+                TextureDecompressor::decompress(pixel_format, src, width, height,
+                                                d_pixels.data());
+            else
+                d_captured = false;
+            break;
+        }
+    }
+
+    void blitFromMemory(const void*, const Rectf&) override {}
+    void blitToMemory(void*) override {}
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const override
+    {
+        return fmt == PixelFormat::Rgba || fmt == PixelFormat::Rgb ||
+               fmt == PixelFormat::Rgba4444 || fmt == PixelFormat::Rgb565;
+    }
+
+private:
+    std::vector<std::uint8_t>& d_pixels;
+    Sizef d_size;
+    glm::vec2 d_texelScaling;
+    String d_name;
+    bool d_captured;
+};
+
+}
+
+//----------------------------------------------------------------------------//
+TextureAtlas::TextureAtlas(const String& name, const Sizef& size) :
+    d_texture(&System::getSingleton().getRenderer()->createTexture(name, size)),
+    d_size(size),
+    d_shelfEnd(0),
+    d_imageCount(0),
+    d_usedPixels(0),
+    d_allocatedPixels(0)
+{
+    // Clear the texture so unused space never holds garbage
+    const std::vector<std::uint8_t> clearData(
+        static_cast<std::size_t>(size.d_width) *
+        static_cast<std::size_t>(size.d_height) * 4, 0);
+    d_texture->blitFromMemory(clearData.data(), Rectf(glm::vec2(0.f, 0.f), size));
+}
+
+//----------------------------------------------------------------------------//
+TextureAtlas::~TextureAtlas()
+{
+    System::getSingleton().getRenderer()->destroyTexture(*d_texture);
+}
+
+//----------------------------------------------------------------------------//
+const String& TextureAtlas::getName() const
+{
+    return d_texture->getName();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureAtlas::findShelf(std::uint32_t width, std::uint32_t height) const
+{
+    const std::uint32_t atlasWidth = static_cast<std::uint32_t>(d_size.d_width);
+
+    std::size_t best = d_shelves.size();
+    std::uint32_t bestWaste = std::numeric_limits<std::uint32_t>::max();
+
+    for (std::size_t i = 0; i < d_shelves.size(); ++i)
+    {
+        const Shelf& shelf = d_shelves[i];
+
+        if (shelf.d_height < height || shelf.d_nextX + width > atlasWidth)
+            continue;
+
+        const std::uint32_t waste = shelf.d_height - height;
+        if (waste < bestWaste)
+        {
+            best = i;
+            bestWaste = waste;
+        }
+    }
+
+    return best;
+}
+
+//----------------------------------------------------------------------------//
+bool TextureAtlas::addImage(const void* pixels, const Sizef& size, Rectf& area)
+{
+    const std::uint32_t imageWidth = static_cast<std::uint32_t>(size.d_width);
+    const std::uint32_t imageHeight = static_cast<std::uint32_t>(size.d_height);
+    const std::uint32_t width = imageWidth + ImageGutter * 2;
+    const std::uint32_t height = imageHeight + ImageGutter * 2;
+
+    if (imageWidth == 0 || imageHeight == 0 ||
+        width > static_cast<std::uint32_t>(d_size.d_width) ||
+        height > static_cast<std::uint32_t>(d_size.d_height))
+        return false;
+
+    const bool canOpenShelf =
+        d_shelfEnd + height <= static_cast<std::uint32_t>(d_size.d_height);
+
+    std::size_t shelfIndex = findShelf(width, height);
+
+    // Prefer a new shelf over one that would waste more than half the image
+    // height, as long as there is room left for it.
+    if (shelfIndex == d_shelves.size() ||
+        (canOpenShelf && (d_shelves[shelfIndex].d_height - height) * 2 > height))
+    {
+        if (!canOpenShelf)
+            return false;
+
+        Shelf shelf;
+        shelf.d_y = d_shelfEnd;
+        shelf.d_height = height;
+        shelf.d_nextX = 0;
+        d_shelves.push_back(shelf);
+        d_shelfEnd += height;
+        shelfIndex = d_shelves.size() - 1;
+    }
+
+    Shelf& shelf = d_shelves[shelfIndex];
+    const glm::vec2 position(static_cast<float>(shelf.d_nextX),
+                             static_cast<float>(shelf.d_y));
+    shelf.d_nextX += width;
+
+    // Build the image with its gutter, repeating the edge pixels outwards
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(pixels);
+    std::vector<std::uint8_t> data(static_cast<std::size_t>(width) * height * 4);
+
+    for (std::uint32_t y = 0; y < height; ++y)
+    {
+        const std::uint32_t srcY = std::min(
+            y > ImageGutter ? y - ImageGutter : 0, imageHeight - 1);
+
+        for (std::uint32_t x = 0; x < width; ++x)
+        {
+            const std::uint32_t srcX = std::min(
+                x > ImageGutter ? x - ImageGutter : 0, imageWidth - 1);
+
+            std::memcpy(&data[(static_cast<std::size_t>(y) * width + x) * 4],
+                        &src[(static_cast<std::size_t>(srcY) * imageWidth + srcX) * 4],
+                        4);
+        }
+    }
+
+    d_texture->blitFromMemory(data.data(),
+        Rectf(position, Sizef(static_cast<float>(width), static_cast<float>(height))));
+
+    area = Rectf(position + glm::vec2(ImageGutter, ImageGutter), size);
+
+    ++d_imageCount;
+    d_usedPixels += static_cast<std::uint64_t>(imageWidth) * imageHeight;
+    d_allocatedPixels += static_cast<std::uint64_t>(width) * height;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void TextureAtlas::releaseImage(const Rectf& area)
+{
+    if (d_imageCount == 0)
+        return;
+
+    --d_imageCount;
+    d_usedPixels -= std::min(d_usedPixels,
+        static_cast<std::uint64_t>(area.getWidth()) *
+        static_cast<std::uint64_t>(area.getHeight()));
+}
+
+//----------------------------------------------------------------------------//
+float TextureAtlas::getOccupancy() const
+{
+    return static_cast<float>(static_cast<double>(d_usedPixels) /
+                              (d_size.d_width * d_size.d_height));
+}
+
+//----------------------------------------------------------------------------//
+float TextureAtlas::getAllocatedRatio() const
+{
+    return static_cast<float>(static_cast<double>(d_allocatedPixels) /
+                              (d_size.d_width * d_size.d_height));
+}
+
+//----------------------------------------------------------------------------//
+bool TextureAtlas::loadImageData(const String& filename,
+                                 const String& resourceGroup,
+                                 std::vector<std::uint8_t>& pixels,
+                                 Sizef& size)
+{
+    System& sys = System::getSingleton();
+
+    RawDataContainer file;
+    sys.getResourceProvider()->loadRawDataContainer(filename, file,
+                                                    resourceGroup);
+
+    PixelCaptureTexture capture(pixels);
+    Texture* res = sys.getImageCodec().load(file, &capture);
+
+    sys.getResourceProvider()->unloadRawDataContainer(file);
+
+    if (!res)
+        throw FileIOException(
+            sys.getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'.");
+
+    size = capture.getOriginalDataSize();
+    return capture.isCaptured();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,544 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Helpers for block compressed texture data
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureDecompressor.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// Decoded 4x4 block, row major, RGBA.
+typedef std::uint8_t DecodedBlock[16][4];
+
+//----------------------------------------------------------------------------//
+inline std::uint8_t clampToByte(int value)
+{
+    return static_cast<std::uint8_t>(std::min(255, std::max(0, value)));
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint16_t readLE16(const std::uint8_t* p)
+{
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint32_t readLE32(const std::uint8_t* p)
+{
+    return static_cast<std::uint32_t>(p[0]) |
+           (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) |
+           (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint64_t readBE64(const std::uint8_t* p)
+{
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i)
+        value = (value << 8) | p[i];
+
+    return value;
+}
+
+//----------------------------------------------------------------------------//
+inline int bits(std::uint64_t value, int highest_bit, int count)
+{
+    return static_cast<int>((value >> (highest_bit - count + 1)) &
+                            ((1u << count) - 1));
+}
+
+//----------------------------------------------------------------------------//
+void unpack565(std::uint16_t c, std::uint8_t* out)
+{
+    const int r = (c >> 11) & 0x1F;
+    const int g = (c >> 5) & 0x3F;
+    const int b = c & 0x1F;
+    out[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    out[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    out[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+    out[3] = 255;
+}
+
+//----------------------------------------------------------------------------//
+// Decodes the colour part shared by BC1, BC2 and BC3.
+void decodeBC1Colours(const std::uint8_t* src, DecodedBlock& out,
+                      bool allow_three_colour_mode, bool punch_through_alpha)
+{
+    const std::uint16_t c0 = readLE16(src);
+    const std::uint16_t c1 = readLE16(src + 2);
+    const std::uint32_t indices = readLE32(src + 4);
+
+    std::uint8_t palette[4][4];
+    unpack565(c0, palette[0]);
+    unpack565(c1, palette[1]);
+
+    if (c0 > c1 || !allow_three_colour_mode)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            palette[2][i] = static_cast<std::uint8_t>((2 * palette[0][i] + palette[1][i]) / 3);
+            palette[3][i] = static_cast<std::uint8_t>((palette[0][i] + 2 * palette[1][i]) / 3);
+        }
+        palette[2][3] = palette[3][3] = 255;
+    }
+    else
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            palette[2][i] = static_cast<std::uint8_t>((palette[0][i] + palette[1][i]) / 2);
+            palette[3][i] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = punch_through_alpha ? 0 : 255;
+    }
+
+    for (int i = 0; i < 16; ++i)
+        std::memcpy(out[i], palette[(indices >> (2 * i)) & 3], 4);
+}
+
+//----------------------------------------------------------------------------//
+void decodeBC2Alpha(const std::uint8_t* src, DecodedBlock& out)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        const int a = (src[i / 2] >> ((i & 1) * 4)) & 0xF;
+        out[i][3] = static_cast<std::uint8_t>(a | (a << 4));
+    }
+}
+
+//----------------------------------------------------------------------------//
+void decodeBC3Alpha(const std::uint8_t* src, DecodedBlock& out)
+{
+    int palette[8];
+    palette[0] = src[0];
+    palette[1] = src[1];
+
+    if (palette[0] > palette[1])
+    {
+        for (int i = 1; i < 7; ++i)
+            palette[i + 1] = ((7 - i) * palette[0] + i * palette[1]) / 7;
+    }
+    else
+    {
+        for (int i = 1; i < 5; ++i)
+            palette[i + 1] = ((5 - i) * palette[0] + i * palette[1]) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    std::uint64_t indices = 0;
+    for (int i = 7; i >= 2; --i)
+        indices = (indices << 8) | src[i];
+
+    for (int i = 0; i < 16; ++i)
+        out[i][3] = static_cast<std::uint8_t>(palette[(indices >> (3 * i)) & 7]);
+}
+
+//----------------------------------------------------------------------------//
+const int ETC_MODIFIERS[8][2] =
+{
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 },
+    { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+};
+
+const int ETC_DISTANCES[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+const int EAC_MODIFIERS[16][8] =
+{
+    { -3, -6, -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 },
+    { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 },
+    { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 },
+    { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 },
+    { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 },
+    { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 },
+    { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 },
+    { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+//----------------------------------------------------------------------------//
+inline int extend4(int v) { return (v << 4) | v; }
+inline int extend5(int v) { return (v << 3) | (v >> 2); }
+inline int extend6(int v) { return (v << 2) | (v >> 4); }
+inline int extend7(int v) { return (v << 1) | (v >> 6); }
+
+//----------------------------------------------------------------------------//
+// ETC pixel indices are stored column major; returns the 2 bit index for the
+// pixel at (x, y).
+inline int etcPixelIndex(std::uint64_t block, int x, int y)
+{
+    const int i = x * 4 + y;
+    return static_cast<int>((((block >> (16 + i)) & 1) << 1) |
+                            ((block >> i) & 1));
+}
+
+//----------------------------------------------------------------------------//
+void setRGB(std::uint8_t* out, int r, int g, int b)
+{
+    out[0] = clampToByte(r);
+    out[1] = clampToByte(g);
+    out[2] = clampToByte(b);
+}
+
+//----------------------------------------------------------------------------//
+void decodeETC2Planar(std::uint64_t block, DecodedBlock& out)
+{
+    const int ro = extend6(bits(block, 62, 6));
+    const int go = extend7((bits(block, 56, 1) << 6) | bits(block, 54, 6));
+    const int bo = extend6((bits(block, 48, 1) << 5) |
+                           (bits(block, 44, 2) << 3) | bits(block, 41, 3));
+    const int rh = extend6((bits(block, 38, 5) << 1) | bits(block, 32, 1));
+    const int gh = extend7(bits(block, 31, 7));
+    const int bh = extend6(bits(block, 24, 6));
+    const int rv = extend6(bits(block, 18, 6));
+    const int gv = extend7(bits(block, 12, 7));
+    const int bv = extend6(bits(block, 5, 6));
+
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            setRGB(out[y * 4 + x],
+                   (x * (rh - ro) + y * (rv - ro) + 4 * ro + 2) >> 2,
+                   (x * (gh - go) + y * (gv - go) + 4 * go + 2) >> 2,
+                   (x * (bh - bo) + y * (bv - bo) + 4 * bo + 2) >> 2);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void decodeETC2PaintColours(std::uint64_t block, const int paint[4][3],
+                            DecodedBlock& out)
+{
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            const int* c = paint[etcPixelIndex(block, x, y)];
+            setRGB(out[y * 4 + x], c[0], c[1], c[2]);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void decodeETC2T(std::uint64_t block, DecodedBlock& out)
+{
+    const int c1[3] = {
+        extend4((bits(block, 60, 2) << 2) | bits(block, 57, 2)),
+        extend4(bits(block, 55, 4)),
+        extend4(bits(block, 51, 4)) };
+    const int c2[3] = {
+        extend4(bits(block, 47, 4)),
+        extend4(bits(block, 43, 4)),
+        extend4(bits(block, 39, 4)) };
+    const int d = ETC_DISTANCES[(bits(block, 35, 2) << 1) | bits(block, 32, 1)];
+
+    const int paint[4][3] =
+    {
+        { c1[0], c1[1], c1[2] },
+        { c2[0] + d, c2[1] + d, c2[2] + d },
+        { c2[0], c2[1], c2[2] },
+        { c2[0] - d, c2[1] - d, c2[2] - d }
+    };
+
+    decodeETC2PaintColours(block, paint, out);
+}
+
+//----------------------------------------------------------------------------//
+void decodeETC2H(std::uint64_t block, DecodedBlock& out)
+{
+    const int c1[3] = {
+        extend4(bits(block, 62, 4)),
+        extend4((bits(block, 58, 3) << 1) | bits(block, 52, 1)),
+        extend4((bits(block, 51, 1) << 3) | bits(block, 49, 3)) };
+    const int c2[3] = {
+        extend4(bits(block, 46, 4)),
+        extend4(bits(block, 42, 4)),
+        extend4(bits(block, 38, 4)) };
+
+    const int v1 = (c1[0] << 16) | (c1[1] << 8) | c1[2];
+    const int v2 = (c2[0] << 16) | (c2[1] << 8) | c2[2];
+    const int d = ETC_DISTANCES[(bits(block, 34, 1) << 2) |
+                                (bits(block, 32, 1) << 1) | (v1 >= v2 ? 1 : 0)];
+
+    const int paint[4][3] =
+    {
+        { c1[0] + d, c1[1] + d, c1[2] + d },
+        { c1[0] - d, c1[1] - d, c1[2] - d },
+        { c2[0] + d, c2[1] + d, c2[2] + d },
+        { c2[0] - d, c2[1] - d, c2[2] - d }
+    };
+
+    decodeETC2PaintColours(block, paint, out);
+}
+
+//----------------------------------------------------------------------------//
+void decodeETC2Colours(const std::uint8_t* src, DecodedBlock& out)
+{
+    const std::uint64_t block = readBE64(src);
+    const bool diff = bits(block, 33, 1) != 0;
+    const bool flip = bits(block, 32, 1) != 0;
+
+    int base[2][3];
+    if (diff)
+    {
+        int r = bits(block, 63, 5);
+        int g = bits(block, 55, 5);
+        int b = bits(block, 47, 5);
+        // 3 bit two's complement deltas
+        const int dr = (bits(block, 58, 3) ^ 4) - 4;
+        const int dg = (bits(block, 50, 3) ^ 4) - 4;
+        const int db = (bits(block, 42, 3) ^ 4) - 4;
+
+        // overflowing deltas select the additional ETC2 modes
+        if (r + dr < 0 || r + dr > 31)
+            return decodeETC2T(block, out);
+        if (g + dg < 0 || g + dg > 31)
+            return decodeETC2H(block, out);
+        if (b + db < 0 || b + db > 31)
+            return decodeETC2Planar(block, out);
+
+        base[0][0] = extend5(r);
+        base[0][1] = extend5(g);
+        base[0][2] = extend5(b);
+        base[1][0] = extend5(r + dr);
+        base[1][1] = extend5(g + dg);
+        base[1][2] = extend5(b + db);
+    }
+    else
+    {
+        base[0][0] = extend4(bits(block, 63, 4));
+        base[1][0] = extend4(bits(block, 59, 4));
+        base[0][1] = extend4(bits(block, 55, 4));
+        base[1][1] = extend4(bits(block, 51, 4));
+        base[0][2] = extend4(bits(block, 47, 4));
+        base[1][2] = extend4(bits(block, 43, 4));
+    }
+
+    const int table[2] = { bits(block, 39, 3), bits(block, 36, 3) };
+
+    for (int y = 0; y < 4; ++y)
+    {
+        for (int x = 0; x < 4; ++x)
+        {
+            const int sub_block = flip ? (y >= 2) : (x >= 2);
+            const int index = etcPixelIndex(block, x, y);
+            const int magnitude = ETC_MODIFIERS[table[sub_block]][index & 1];
+            const int modifier = (index & 2) ? -magnitude : magnitude;
+            const int* c = base[sub_block];
+            setRGB(out[y * 4 + x],
+                   c[0] + modifier, c[1] + modifier, c[2] + modifier);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void decodeEACAlpha(const std::uint8_t* src, DecodedBlock& out)
+{
+    const std::uint64_t block = readBE64(src);
+    const int base = bits(block, 63, 8);
+    const int multiplier = bits(block, 55, 4);
+    const int* modifiers = EAC_MODIFIERS[bits(block, 51, 4)];
+
+    for (int x = 0; x < 4; ++x)
+    {
+        for (int y = 0; y < 4; ++y)
+        {
+            const int index = bits(block, 47 - (x * 4 + y) * 3, 3);
+            out[y * 4 + x][3] = clampToByte(base + modifiers[index] * multiplier);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool decodeBlock(Texture::PixelFormat fmt, const std::uint8_t* src,
+                 DecodedBlock& out)
+{
+    switch (fmt)
+    {
+    case Texture::PixelFormat::RgbDxt1:
+        decodeBC1Colours(src, out, true, false);
+        return true;
+
+    case Texture::PixelFormat::RgbaDxt1:
+        decodeBC1Colours(src, out, true, true);
+        return true;
+
+    case Texture::PixelFormat::RgbaDxt3:
+        decodeBC1Colours(src + 8, out, false, false);
+        decodeBC2Alpha(src, out);
+        return true;
+
+    case Texture::PixelFormat::RgbaDxt5:
+        decodeBC1Colours(src + 8, out, false, false);
+        decodeBC3Alpha(src, out);
+        return true;
+
+    case Texture::PixelFormat::RgbEtc2:
+        decodeETC2Colours(src, out);
+        for (int i = 0; i < 16; ++i)
+            out[i][3] = 255;
+        return true;
+
+    case Texture::PixelFormat::RgbaEtc2:
+        decodeETC2Colours(src + 8, out);
+        decodeEACAlpha(src, out);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+bool TextureDecompressor::isCompressed(Texture::PixelFormat fmt)
+{
+    return getBlockSize(fmt) != 0 ||
+           fmt == Texture::PixelFormat::Pvrtc2 ||
+           fmt == Texture::PixelFormat::Pvrtc4;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureDecompressor::getBlockSize(Texture::PixelFormat fmt)
+{
+    switch (fmt)
+    {
+    case Texture::PixelFormat::RgbDxt1:
+    case Texture::PixelFormat::RgbaDxt1:
+    case Texture::PixelFormat::RgbEtc2:
+        return 8;
+
+    case Texture::PixelFormat::RgbaDxt3:
+    case Texture::PixelFormat::RgbaDxt5:
+    case Texture::PixelFormat::RgbaBc7:
+    case Texture::PixelFormat::RgbaEtc2:
+        return 16;
+
+    default:
+        return 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::size_t TextureDecompressor::getDataSize(Texture::PixelFormat fmt,
+                                             std::uint32_t width,
+                                             std::uint32_t height)
+{
+    const std::size_t w = width;
+    const std::size_t h = height;
+
+    switch (fmt)
+    {
+    case Texture::PixelFormat::Rgb:
+        return w * h * 3;
+
+    case Texture::PixelFormat::Rgba:
+        return w * h * 4;
+
+    case Texture::PixelFormat::Rgba4444:
+    case Texture::PixelFormat::Rgb565:
+        return w * h * 2;
+
+    // PVRTC has a minimum size of 2x2 blocks
+    case Texture::PixelFormat::Pvrtc2:
+        return (std::max<std::size_t>(w, 16) * std::max<std::size_t>(h, 8) * 2 + 7) / 8;
+
+    case Texture::PixelFormat::Pvrtc4:
+        return (std::max<std::size_t>(w, 8) * std::max<std::size_t>(h, 8) * 4 + 7) / 8;
+
+    default:
+        return ((w + 3) / 4) * ((h + 3) / 4) * getBlockSize(fmt);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool TextureDecompressor::canDecompress(Texture::PixelFormat fmt)
+{
+    switch (fmt)
+    {
+    case Texture::PixelFormat::RgbDxt1:
+    case Texture::PixelFormat::RgbaDxt1:
+    case Texture::PixelFormat::RgbaDxt3:
+    case Texture::PixelFormat::RgbaDxt5:
+    case Texture::PixelFormat::RgbEtc2:
+    case Texture::PixelFormat::RgbaEtc2:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool TextureDecompressor::decompress(Texture::PixelFormat fmt, const void* src,
+                                     std::uint32_t width, std::uint32_t height,
+                                     std::uint8_t* dst)
+{
+    if (!canDecompress(fmt))
+        return false;
+
+    const std::uint8_t* block_ptr = static_cast<const std::uint8_t*>(src);
+    const std::size_t block_size = getBlockSize(fmt);
+    DecodedBlock block;
+
+    for (std::uint32_t by = 0; by < height; by += 4)
+    {
+        for (std::uint32_t bx = 0; bx < width; bx += 4)
+        {
+            decodeBlock(fmt, block_ptr, block);
+            block_ptr += block_size;
+
+            // copy the block, clipping it to the image at the right/bottom
+            const std::uint32_t rows = std::min<std::uint32_t>(4, height - by);
+            const std::uint32_t cols = std::min<std::uint32_t>(4, width - bx);
+            for (std::uint32_t y = 0; y < rows; ++y)
+                std::memcpy(dst + ((by + y) * static_cast<std::size_t>(width) + bx) * 4,
+                            block[y * 4], cols * 4);
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,405 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Description and CPU implementation of texture filters
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureFilter.h"
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//! How pixels outside of the filtered area are sampled by the blur.
+enum class BlurEdges
+{
+    //! use the nearest pixel inside the area.
+    Clamp,
+    //! they are transparent.
+    Transparent
+};
+
+//----------------------------------------------------------------------------//
+void createGaussianKernel(const float sigma, std::vector<float>& kernel)
+{
+    const int half = std::max(1, static_cast<int>(std::ceil(sigma * 3.f)));
+    kernel.resize(half * 2 + 1);
+
+    float sum = 0.f;
+    for (int i = -half; i <= half; ++i)
+    {
+        kernel[i + half] = std::exp(-static_cast<float>(i * i) / (2.f * sigma * sigma));
+        sum += kernel[i + half];
+    }
+
+    for (float& weight : kernel)
+        weight /= sum;
+}
+
+//----------------------------------------------------------------------------//
+// Convolve every row (or column) of \a data with \a kernel.
+void blurPass(std::vector<float>& data, const int width, const int height,
+              const int channels, const std::vector<float>& kernel,
+              const bool horizontal, const BlurEdges edges,
+              std::vector<float>& line)
+{
+    const int half = static_cast<int>(kernel.size() / 2);
+    const int length = horizontal ? width : height;
+    const int lineCount = horizontal ? height : width;
+    const std::size_t step = horizontal ? channels : static_cast<std::size_t>(width) * channels;
+    const std::size_t lineStep = horizontal ? static_cast<std::size_t>(width) * channels : channels;
+
+    line.resize(static_cast<std::size_t>(length) * channels);
+
+    for (int l = 0; l < lineCount; ++l)
+    {
+        float* base = &data[l * lineStep];
+
+        for (int i = 0; i < length; ++i)
+        {
+            float sum[4] = { 0.f, 0.f, 0.f, 0.f };
+
+            for (int k = -half; k <= half; ++k)
+            {
+                int j = i + k;
+                if (j < 0 || j >= length)
+                {
+                    if (edges == BlurEdges::Transparent)
+                        continue;
+
+                    j = std::min(std::max(j, 0), length - 1);
+                }
+
+                const float* src = base + j * step;
+                const float weight = kernel[k + half];
+                for (int c = 0; c < channels; ++c)
+                    sum[c] += src[c] * weight;
+            }
+
+            std::copy(sum, sum + channels, &line[i * channels]);
+        }
+
+        for (int i = 0; i < length; ++i)
+            std::copy(&line[i * channels], &line[i * channels] + channels, base + i * step);
+    }
+}
+
+//----------------------------------------------------------------------------//
+// Blur \a data (width x height pixels of \a channels floats) in place.
+void blurPlane(std::vector<float>& data, const int width, const int height,
+               const int channels, const float radius, const BlurEdges edges)
+{
+    const int factor = TextureFilter::getDownsampleFactor(radius);
+    const float sigma = radius * 0.5f / factor;
+
+    // less than a quarter pixel makes no visible difference
+    if (sigma < 0.25f)
+        return;
+
+    const int smallWidth = (width + factor - 1) / factor;
+    const int smallHeight = (height + factor - 1) / factor;
+
+    std::vector<float> small;
+    std::vector<float>& work = (factor > 1) ? small : data;
+
+    // box filter down to the small image, partial blocks at the right and
+    // bottom edges average the pixels they cover.
+    if (factor > 1)
+    {
+        small.assign(static_cast<std::size_t>(smallWidth) * smallHeight * channels, 0.f);
+
+        for (int sy = 0; sy < smallHeight; ++sy)
+        {
+            const int y1 = std::min(height, (sy + 1) * factor);
+            for (int sx = 0; sx < smallWidth; ++sx)
+            {
+                const int x1 = std::min(width, (sx + 1) * factor);
+                float* dst = &small[(static_cast<std::size_t>(sy) * smallWidth + sx) * channels];
+
+                for (int y = sy * factor; y < y1; ++y)
+                    for (int x = sx * factor; x < x1; ++x)
+                    {
+                        const float* src = &data[(static_cast<std::size_t>(y) * width + x) * channels];
+                        for (int c = 0; c < channels; ++c)
+                            dst[c] += src[c];
+                    }
+
+                const float scale = 1.f / ((x1 - sx * factor) * (y1 - sy * factor));
+                for (int c = 0; c < channels; ++c)
+                    dst[c] *= scale;
+            }
+        }
+    }
+
+    std::vector<float> kernel;
+    createGaussianKernel(sigma, kernel);
+
+    std::vector<float> line;
+    blurPass(work, smallWidth, smallHeight, channels, kernel, true, edges, line);
+    blurPass(work, smallWidth, smallHeight, channels, kernel, false, edges, line);
+
+    if (factor == 1)
+        return;
+
+    // bilinear upsampling back to the full size
+    for (int y = 0; y < height; ++y)
+    {
+        const float v = (y + 0.5f) / factor - 0.5f;
+        const int v0 = static_cast<int>(std::floor(v));
+        const float fy = v - v0;
+        const int sy0 = std::min(std::max(v0, 0), smallHeight - 1);
+        const int sy1 = std::min(std::max(v0 + 1, 0), smallHeight - 1);
+
+        for (int x = 0; x < width; ++x)
+        {
+            const float u = (x + 0.5f) / factor - 0.5f;
+            const int u0 = static_cast<int>(std::floor(u));
+            const float fx = u - u0;
+            const int sx0 = std::min(std::max(u0, 0), smallWidth - 1);
+            const int sx1 = std::min(std::max(u0 + 1, 0), smallWidth - 1);
+
+            const float* p00 = &small[(static_cast<std::size_t>(sy0) * smallWidth + sx0) * channels];
+            const float* p10 = &small[(static_cast<std::size_t>(sy0) * smallWidth + sx1) * channels];
+            const float* p01 = &small[(static_cast<std::size_t>(sy1) * smallWidth + sx0) * channels];
+            const float* p11 = &small[(static_cast<std::size_t>(sy1) * smallWidth + sx1) * channels];
+            float* dst = &data[(static_cast<std::size_t>(y) * width + x) * channels];
+
+            for (int c = 0; c < channels; ++c)
+            {
+                const float top = p00[c] + (p10[c] - p00[c]) * fx;
+                const float bottom = p01[c] + (p11[c] - p01[c]) * fx;
+                dst[c] = top + (bottom - top) * fy;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::uint8_t toByte(const float value)
+{
+    return static_cast<std::uint8_t>(std::min(255.f, std::max(0.f, value + 0.5f)));
+}
+
+//----------------------------------------------------------------------------//
+// Store a premultiplied colour (0 - 255), keeping the colour channels no
+// larger than the alpha.
+void storePremultiplied(std::uint8_t* dst, const float* colour)
+{
+    dst[3] = toByte(colour[3]);
+    for (int c = 0; c < 3; ++c)
+        dst[c] = std::min(dst[3], toByte(colour[c]));
+}
+
+//----------------------------------------------------------------------------//
+void applyBlur(std::uint8_t* pixels, const int width, const int height,
+               const std::size_t pitch, const float radius)
+{
+    std::vector<float> data(static_cast<std::size_t>(width) * height * 4);
+
+    for (int y = 0; y < height; ++y)
+        std::copy(pixels + y * pitch, pixels + y * pitch + width * 4,
+                  &data[static_cast<std::size_t>(y) * width * 4]);
+
+    blurPlane(data, width, height, 4, radius, BlurEdges::Clamp);
+
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            storePremultiplied(pixels + y * pitch + x * 4,
+                               &data[(static_cast<std::size_t>(y) * width + x) * 4]);
+}
+
+//----------------------------------------------------------------------------//
+void applyColourMatrix(std::uint8_t* pixels, const int width, const int height,
+                       const std::size_t pitch, const float* matrix)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        std::uint8_t* row = pixels + y * pitch;
+        for (int x = 0; x < width; ++x)
+        {
+            std::uint8_t* pixel = row + x * 4;
+
+            const float alpha = pixel[3] / 255.f;
+            const float unpremultiply = (pixel[3] != 0) ? 1.f / pixel[3] : 0.f;
+            const float in[5] = { pixel[0] * unpremultiply, pixel[1] * unpremultiply,
+                                  pixel[2] * unpremultiply, alpha, 1.f };
+
+            float out[4];
+            for (int r = 0; r < 4; ++r)
+            {
+                const float* coefficients = matrix + r * 5;
+                float value = 0.f;
+                for (int c = 0; c < 5; ++c)
+                    value += coefficients[c] * in[c];
+
+                out[r] = std::min(1.f, std::max(0.f, value));
+            }
+
+            const float colour[4] = { out[0] * out[3] * 255.f, out[1] * out[3] * 255.f,
+                                      out[2] * out[3] * 255.f, out[3] * 255.f };
+            storePremultiplied(pixel, colour);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void applyDropShadow(std::uint8_t* pixels, const int width, const int height,
+                     const std::size_t pitch, const glm::vec2& offset,
+                     const float radius, const Colour& colour)
+{
+    const int offsetX = static_cast<int>(std::lround(offset.x));
+    const int offsetY = static_cast<int>(std::lround(offset.y));
+
+    // the shadow is the alpha of the content, moved by the offset
+    std::vector<float> shadow(static_cast<std::size_t>(width) * height, 0.f);
+    for (int y = std::max(0, offsetY); y < std::min(height, height + offsetY); ++y)
+        for (int x = std::max(0, offsetX); x < std::min(width, width + offsetX); ++x)
+            shadow[static_cast<std::size_t>(y) * width + x] =
+                pixels[(y - offsetY) * pitch + (x - offsetX) * 4 + 3];
+
+    blurPlane(shadow, width, height, 1, radius, BlurEdges::Transparent);
+
+    const float tint[4] = { colour.getRed(), colour.getGreen(), colour.getBlue(), 1.f };
+
+    // draw the content over the shadow
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+        {
+            std::uint8_t* pixel = pixels + y * pitch + x * 4;
+            const float coverage = shadow[static_cast<std::size_t>(y) * width + x] *
+                                   colour.getAlpha() * (1.f - pixel[3] / 255.f);
+
+            float result[4];
+            for (int c = 0; c < 4; ++c)
+                result[c] = pixel[c] + tint[c] * coverage;
+
+            storePremultiplied(pixel, result);
+        }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+const int TextureFilter::ColourMatrixSize;
+
+//----------------------------------------------------------------------------//
+TextureFilter::TextureFilter(Type type) :
+    d_type(type)
+{
+    getIdentityMatrix(d_matrix);
+}
+
+//----------------------------------------------------------------------------//
+TextureFilter TextureFilter::createBlur(float radius)
+{
+    TextureFilter filter(Type::Blur);
+    filter.d_radius = std::max(0.f, radius);
+    return filter;
+}
+
+//----------------------------------------------------------------------------//
+TextureFilter TextureFilter::createColourMatrix(const float* matrix)
+{
+    TextureFilter filter(Type::ColourMatrix);
+    std::copy(matrix, matrix + ColourMatrixSize, filter.d_matrix);
+    return filter;
+}
+
+//----------------------------------------------------------------------------//
+TextureFilter TextureFilter::createDropShadow(const glm::vec2& offset,
+                                              float radius,
+                                              const Colour& colour)
+{
+    TextureFilter filter(Type::DropShadow);
+    filter.d_offset = offset;
+    filter.d_radius = std::max(0.f, radius);
+    filter.d_colour = colour;
+    return filter;
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilter::getIdentityMatrix(float* matrix)
+{
+    std::fill(matrix, matrix + ColourMatrixSize, 0.f);
+    for (int i = 0; i < 4; ++i)
+        matrix[i * 5 + i] = 1.f;
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilter::getSaturationMatrix(float* matrix, float saturation)
+{
+    // Rec. 709 luminance weights, as used by the SVG feColorMatrix filter
+    const float luminance[3] = { 0.2126f, 0.7152f, 0.0722f };
+
+    getIdentityMatrix(matrix);
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c)
+            matrix[r * 5 + c] = luminance[c] * (1.f - saturation) +
+                                ((r == c) ? saturation : 0.f);
+}
+
+//----------------------------------------------------------------------------//
+int TextureFilter::getDownsampleFactor(float radius)
+{
+    int factor = 1;
+    while (factor < 8 && radius * 0.5f / factor > 2.f)
+        factor *= 2;
+
+    return factor;
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilter::apply(std::uint8_t* pixels, unsigned int width,
+                          unsigned int height, std::size_t pitch) const
+{
+    if (!width || !height)
+        return;
+
+    const int w = static_cast<int>(width);
+    const int h = static_cast<int>(height);
+
+    switch (d_type)
+    {
+    case Type::Blur:
+        applyBlur(pixels, w, h, pitch, d_radius);
+        break;
+
+    case Type::ColourMatrix:
+        applyColourMatrix(pixels, w, h, pitch, d_matrix);
+        break;
+
+    case Type::DropShadow:
+        applyDropShadow(pixels, w, h, pitch, d_offset, d_radius, d_colour);
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
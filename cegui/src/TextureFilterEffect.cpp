@@ -0,0 +1,172 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Built-in RenderEffects that filter the RenderingWindow texture
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureFilterEffect.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Window.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+TextureFilter createIdentityColourMatrix()
+{
+    float matrix[TextureFilter::ColourMatrixSize];
+    TextureFilter::getIdentityMatrix(matrix);
+    return TextureFilter::createColourMatrix(matrix);
+}
+}
+
+//----------------------------------------------------------------------------//
+const String BlurEffect::EffectName("Core/Blur");
+const String ColourMatrixEffect::EffectName("Core/ColourMatrix");
+const String DropShadowEffect::EffectName("Core/DropShadow");
+
+//----------------------------------------------------------------------------//
+TextureFilterEffect::TextureFilterEffect(Window* window,
+                                         const TextureFilter& filter) :
+    d_window(window),
+    d_filter(filter)
+{
+}
+
+//----------------------------------------------------------------------------//
+int TextureFilterEffect::getPassCount() const
+{
+    return 1;
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilterEffect::performPreRenderFunctions(const int /*pass*/)
+{
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilterEffect::performPostRenderFunctions()
+{
+}
+
+//----------------------------------------------------------------------------//
+bool TextureFilterEffect::realiseGeometry(RenderingWindow& /*window*/,
+                                          GeometryBuffer& /*geometry*/)
+{
+    // the filtered texture is drawn with the default geometry
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool TextureFilterEffect::update(const float /*elapsed*/,
+                                 RenderingWindow& /*window*/)
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilterEffect::processRenderedContent(RenderingWindow& window)
+{
+    TextureTarget& target = window.getTextureTarget();
+
+    d_filterApplied = target.getOwner().applyTextureFilter(
+        target, window.getSize(), d_filter);
+
+    if (d_filterApplied)
+        ++d_filterCount;
+}
+
+//----------------------------------------------------------------------------//
+void TextureFilterEffect::setFilter(const TextureFilter& filter)
+{
+    d_filter = filter;
+
+    if (d_window)
+        d_window->invalidate(false);
+}
+
+//----------------------------------------------------------------------------//
+BlurEffect::BlurEffect(Window* window) :
+    TextureFilterEffect(window, TextureFilter::createBlur(8.f))
+{
+}
+
+//----------------------------------------------------------------------------//
+void BlurEffect::setRadius(float radius)
+{
+    setFilter(TextureFilter::createBlur(radius));
+}
+
+//----------------------------------------------------------------------------//
+ColourMatrixEffect::ColourMatrixEffect(Window* window) :
+    TextureFilterEffect(window, createIdentityColourMatrix())
+{
+}
+
+//----------------------------------------------------------------------------//
+void ColourMatrixEffect::setMatrix(const float* matrix)
+{
+    setFilter(TextureFilter::createColourMatrix(matrix));
+}
+
+//----------------------------------------------------------------------------//
+void ColourMatrixEffect::setSaturation(float saturation)
+{
+    float matrix[TextureFilter::ColourMatrixSize];
+    TextureFilter::getSaturationMatrix(matrix, saturation);
+    setMatrix(matrix);
+}
+
+//----------------------------------------------------------------------------//
+DropShadowEffect::DropShadowEffect(Window* window) :
+    TextureFilterEffect(window, TextureFilter::createDropShadow(
+        glm::vec2(4.f, 4.f), 8.f, Colour(0.f, 0.f, 0.f, 0.5f)))
+{
+}
+
+//----------------------------------------------------------------------------//
+void DropShadowEffect::setOffset(const glm::vec2& offset)
+{
+    setFilter(TextureFilter::createDropShadow(offset, getRadius(), getColour()));
+}
+
+//----------------------------------------------------------------------------//
+void DropShadowEffect::setRadius(float radius)
+{
+    setFilter(TextureFilter::createDropShadow(getOffset(), radius, getColour()));
+}
+
+//----------------------------------------------------------------------------//
+void DropShadowEffect::setColour(const Colour& colour)
+{
+    setFilter(TextureFilter::createDropShadow(getOffset(), getRadius(), colour));
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,335 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Tracks texture memory and evicts reloadable textures over budget
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Sizef.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/SharedStringStream.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace CEGUI
+{
+//---------------------------------------------------------------------------//
+template<>
+TextureResidencyManager* Singleton<TextureResidencyManager>::ms_Singleton = nullptr;
+
+//---------------------------------------------------------------------------//
+TextureResidencyManager::TextureResidencyManager()
+{
+    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+
+    Logger::getSingleton().logEvent(
+        "CEGUI::TextureResidencyManager Singleton created. (" + addressStr + ")");
+}
+
+//---------------------------------------------------------------------------//
+TextureResidencyManager::~TextureResidencyManager()
+{
+    String addressStr = SharedStringstream::GetPointerAddressAsString(this);
+
+    Logger::getSingleton().logEvent(
+        "CEGUI::TextureResidencyManager singleton destroyed (" + addressStr + ")");
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::setEnabled(bool setting)
+{
+    if (d_enabled == setting)
+        return;
+
+    // nothing would reload evicted textures once disabled
+    if (!setting)
+    {
+        for (auto& pair : d_entries)
+        {
+            if (pair.second.d_evicted)
+                reload(pair.second);
+        }
+    }
+
+    d_enabled = setting;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::registerTexture(Texture& texture, Category category)
+{
+    Entry& entry = d_entries[&texture];
+    if (!entry.d_texture)
+    {
+        entry.d_texture = &texture;
+        entry.d_bytes = estimateTextureBytes(texture);
+    }
+
+    entry.d_category = category;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::unregisterTexture(const Texture& texture)
+{
+    d_entries.erase(&texture);
+}
+
+//---------------------------------------------------------------------------//
+bool TextureResidencyManager::isTextureRegistered(const Texture& texture) const
+{
+    return d_entries.find(&texture) != d_entries.end();
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::setReloadSource(const Texture& texture,
+                                              const String& filename,
+                                              const String& resourceGroup)
+{
+    Entry& entry = getEntry(texture);
+    entry.d_filename = filename;
+    entry.d_resourceGroup = resourceGroup;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::setEvictor(const Texture& texture, Evictor* evictor)
+{
+    getEntry(texture).d_evictor = evictor;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::removeEvictor(const Evictor& evictor)
+{
+    for (auto& pair : d_entries)
+    {
+        if (pair.second.d_evictor == &evictor)
+            pair.second.d_evictor = nullptr;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::update()
+{
+    // TextureTargets and font textures change size after registration
+    for (auto& pair : d_entries)
+    {
+        if (!pair.second.d_evicted)
+            pair.second.d_bytes = estimateTextureBytes(*pair.second.d_texture);
+    }
+
+    if (d_enabled)
+        enforceBudget();
+
+    ++d_frame;
+}
+
+//---------------------------------------------------------------------------//
+bool TextureResidencyManager::isEvicted(const Texture& texture) const
+{
+    auto it = d_entries.find(&texture);
+    return it != d_entries.end() && it->second.d_evicted;
+}
+
+//---------------------------------------------------------------------------//
+std::uint64_t TextureResidencyManager::getLastUsedFrame(const Texture& texture) const
+{
+    auto it = d_entries.find(&texture);
+    return (it != d_entries.end()) ? it->second.d_lastUsedFrame : 0;
+}
+
+//---------------------------------------------------------------------------//
+bool TextureResidencyManager::canAccommodate(std::size_t bytes) const
+{
+    return !d_enabled || getResidentBytes() + bytes <= d_budget;
+}
+
+//---------------------------------------------------------------------------//
+std::size_t TextureResidencyManager::getResidentBytes() const
+{
+    std::size_t bytes = 0;
+    for (const auto& pair : d_entries)
+    {
+        if (!pair.second.d_evicted)
+            bytes += pair.second.d_bytes;
+    }
+
+    return bytes;
+}
+
+//---------------------------------------------------------------------------//
+TextureResidencyManager::CategoryStatistics TextureResidencyManager::getStatistics(
+    Category category) const
+{
+    CategoryStatistics stats;
+    for (const auto& pair : d_entries)
+    {
+        const Entry& entry = pair.second;
+        if (entry.d_category != category)
+            continue;
+
+        ++stats.d_textureCount;
+        if (entry.d_evicted)
+            stats.d_evictedBytes += entry.d_bytes;
+        else
+            stats.d_residentBytes += entry.d_bytes;
+    }
+
+    const Counters& counters = d_counters[static_cast<int>(category)];
+    stats.d_evictionCount = counters.d_evictionCount;
+    stats.d_reloadCount = counters.d_reloadCount;
+    return stats;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::resetStatistics()
+{
+    std::fill(std::begin(d_counters), std::end(d_counters), Counters());
+}
+
+//---------------------------------------------------------------------------//
+std::size_t TextureResidencyManager::estimateTextureBytes(const Texture& texture)
+{
+    // Pixel formats are not known here, assume 32bpp
+    const Sizef& size = texture.getSize();
+    const std::size_t width = static_cast<std::size_t>(std::ceil(std::max(0.f, size.d_width)));
+    const std::size_t height = static_cast<std::size_t>(std::ceil(std::max(0.f, size.d_height)));
+
+    return width * height * 4;
+}
+
+//---------------------------------------------------------------------------//
+TextureResidencyManager::Entry& TextureResidencyManager::getEntry(const Texture& texture)
+{
+    auto it = d_entries.find(&texture);
+    if (it == d_entries.end())
+        throw UnknownObjectException("Texture '" + texture.getName() +
+            "' is not registered with the TextureResidencyManager.");
+
+    return it->second;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::markUsed(const Texture& texture)
+{
+    auto it = d_entries.find(&texture);
+    if (it == d_entries.end())
+        return;
+
+    if (it->second.d_evicted)
+        reload(it->second);
+
+    it->second.d_lastUsedFrame = d_frame;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::reload(Entry& entry)
+{
+    // Textures kept by their Evictor are restored by it
+    if (!entry.d_evictor && !entry.d_filename.empty())
+    {
+        try
+        {
+            entry.d_texture->loadFromFile(entry.d_filename, entry.d_resourceGroup);
+        }
+        catch (Exception&)
+        {
+            // Don't try again every frame, the texture stays empty
+            Logger::getSingleton().logEvent("TextureResidencyManager - "
+                "failed to reload texture '" + entry.d_texture->getName() +
+                "' from '" + entry.d_filename + "'.", LoggingLevel::Error);
+            entry.d_filename.clear();
+        }
+    }
+
+    entry.d_evicted = false;
+    entry.d_bytes = estimateTextureBytes(*entry.d_texture);
+    ++d_counters[static_cast<int>(entry.d_category)].d_reloadCount;
+}
+
+//---------------------------------------------------------------------------//
+bool TextureResidencyManager::evict(Entry& entry)
+{
+    Counters& counters = d_counters[static_cast<int>(entry.d_category)];
+
+    if (entry.d_evictor)
+    {
+        // The evictor usually destroys the texture, which removes the entry
+        entry.d_evicted = true;
+        ++counters.d_evictionCount;
+        entry.d_evictor->evictTexture(*entry.d_texture);
+        return true;
+    }
+
+    if (!entry.d_texture->releaseData())
+    {
+        // The Renderer can't release texture data, stop trying
+        entry.d_filename.clear();
+        return false;
+    }
+
+    entry.d_evicted = true;
+    ++counters.d_evictionCount;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void TextureResidencyManager::enforceBudget()
+{
+    std::size_t resident = getResidentBytes();
+    if (resident <= d_budget)
+        return;
+
+    // Least recently used first. Textures used in this frame are still needed.
+    std::vector<std::pair<std::uint64_t, const Texture*>> candidates;
+    for (const auto& pair : d_entries)
+    {
+        const Entry& entry = pair.second;
+        if (!entry.d_evicted && entry.d_lastUsedFrame < d_frame &&
+            (entry.d_evictor || !entry.d_filename.empty()))
+            candidates.push_back(std::make_pair(entry.d_lastUsedFrame, pair.first));
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates)
+    {
+        if (resident <= d_budget)
+            break;
+
+        // Evictors may destroy other textures too
+        auto it = d_entries.find(candidate.second);
+        if (it == d_entries.end() || it->second.d_evicted)
+            continue;
+
+        const std::size_t bytes = it->second.d_bytes;
+        if (evict(it->second))
+            resident -= std::min(resident, bytes);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+}
@@ -45,6 +45,8 @@
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/RenderTarget.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/TextureResidencyManager.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/widgets/DragContainer.h"
@@ -85,6 +87,7 @@ const String Window::UpdateModePropertyName("UpdateMode");
 const String Window::CursorInputPropagationEnabledPropertyName("CursorInputPropagationEnabled");
 const String Window::AutoWindowPropertyName("AutoWindow");
 const String Window::DrawModeMaskPropertyName("DrawModeMask");
+const String Window::OpaqueAreaPropertyName("OpaqueArea");
 //----------------------------------------------------------------------------//
 const String Window::EventNamespace("Window");
 const String Window::EventUpdated ("Updated");
@@ -208,6 +211,7 @@ Window::Window(const String& type, const String& name):
     // rendering components and options
     d_needsRedraw(true),
     d_autoRenderingWindow(false),
+    d_renderCacheWindow(false),
     d_autoRenderingSurfaceStencilEnabled(false),
 
     // alpha transparency set up
@@ -239,7 +243,8 @@ Window::Window(const String& type, const String& name):
     d_hitTestRectValid(false),
 
     d_propagatePointerInputs(false),
-    d_containsPointer(false)
+    d_containsPointer(false),
+    d_occluded(false)
 {
     addWindowProperties();
 }
@@ -1210,7 +1215,10 @@ void Window::invalidate(bool recursive)
     invalidate_impl(recursive);
 
     if (d_guiContext)
+    {
         d_guiContext->markAsDirty();
+        d_guiContext->getRenderCachePolicy().notifyWindowInvalidated(*this);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -1236,6 +1244,11 @@ void Window::draw(std::uint32_t drawModeMask)
     if (!isEffectiveVisible())
         return;
 
+    // a surface hidden behind opaque windows is not drawn back to its owner,
+    // its content stays cached until it is uncovered.
+    if (d_occluded && d_surface)
+        return;
+
     // get rendering context
     RenderingContext ctx;
     getRenderingContext(ctx);
@@ -1249,8 +1262,9 @@ void Window::draw(std::uint32_t drawModeMask)
     // redraw if no surface set, or if surface is invalidated
     if (!d_surface || d_surface->isInvalidated())
     {
-        // perform drawing for 'this' Window
-        if (allowDrawing)
+        // perform drawing for 'this' Window, unless it is hidden behind
+        // opaque windows drawn later
+        if (allowDrawing && !d_occluded)
             drawSelf(ctx, drawModeMask);
 
         // render any child windows
@@ -1280,6 +1294,7 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMas
     for (auto buffer : d_geometryBuffers)
         System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
     d_geometryBuffers.clear();
+    d_opaqueImageryArea = Rectf(0.f, 0.f, 0.f, 0.f);
 
     // signal rendering started
     WindowEventArgs args(this);
@@ -1898,7 +1913,10 @@ void Window::onAlphaChanged(WindowEventArgs& e)
     if (auto rs = getTargetRenderingSurface())
         rs->invalidate();
     if (d_guiContext)
+    {
         d_guiContext->markAsDirty();
+        d_guiContext->getRenderCachePolicy().notifyWindowInvalidated(*this);
+    }
 
     fireEvent(EventAlphaChanged, e, EventNamespace);
 }
@@ -2078,6 +2096,8 @@ void Window::onChildRemoved(ElementEventArgs& e)
     // Though we do need to invalidate the rendering surface!
     if (auto rs = getTargetRenderingSurface())
         rs->invalidate();
+    if (d_guiContext)
+        d_guiContext->getRenderCachePolicy().notifyWindowInvalidated(*this);
 
     Element::onChildRemoved(e);
 }
@@ -2667,8 +2687,12 @@ void Window::setRenderingSurface(RenderingSurface* surface)
     if (d_surface == surface)
         return;
 
-    if (d_autoRenderingWindow)
-        setUsingAutoRenderingSurface(false);
+    if (hasAutoRenderingWindow())
+    {
+        releaseRenderingWindow();
+        d_autoRenderingWindow = false;
+        d_renderCacheWindow = false;
+    }
 
     d_surface = surface;
 
@@ -2686,14 +2710,34 @@ void Window::setUsingAutoRenderingSurface(bool setting)
     if (setting)
     {
         allocateRenderingWindow(d_autoRenderingSurfaceStencilEnabled);
+        d_autoRenderingWindow = true;
     }
     else
     {
-        releaseRenderingWindow();
+        // the surface stays while the RenderCachePolicy still uses it
+        if (!d_renderCacheWindow)
+            releaseRenderingWindow();
         d_autoRenderingWindow = false;
     }
 }
 
+//----------------------------------------------------------------------------//
+void Window::setUsingRenderCacheSurface(bool setting)
+{
+    if (setting)
+    {
+        allocateRenderingWindow(d_autoRenderingSurfaceStencilEnabled);
+        d_renderCacheWindow = true;
+    }
+    else
+    {
+        // the surface stays while the application still uses it
+        if (!d_autoRenderingWindow)
+            releaseRenderingWindow();
+        d_renderCacheWindow = false;
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Window::setAutoRenderingSurfaceStencilEnabled(bool setting)
 {
@@ -2702,7 +2746,7 @@ void Window::setAutoRenderingSurfaceStencilEnabled(bool setting)
 
     d_autoRenderingSurfaceStencilEnabled = setting;
 
-    if (!d_autoRenderingWindow || !d_surface)
+    if (!hasAutoRenderingWindow() || !d_surface)
         return;
 
     // We need to recreate the auto rendering window since we just changed a crucial setting for it
@@ -2713,11 +2757,9 @@ void Window::setAutoRenderingSurfaceStencilEnabled(bool setting)
 //----------------------------------------------------------------------------//
 void Window::allocateRenderingWindow(bool addStencilBuffer)
 {
-    if (d_autoRenderingWindow && d_surface)
+    if (hasAutoRenderingWindow() && d_surface)
         return;
 
-    d_autoRenderingWindow = true;
-
     CEGUI::RenderingSurface* rs = getTargetRenderingSurface();
     if (!rs)
     {
@@ -2739,6 +2781,9 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
         return;
     }
 
+    TextureResidencyManager::getSingleton().registerTexture(
+        t->getTexture(), TextureResidencyManager::Category::RenderTarget);
+
     d_surface = &rs->createRenderingWindow(*t);
     transferChildSurfaces();
     updateRenderingWindow(true);
@@ -2750,7 +2795,7 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
 //----------------------------------------------------------------------------//
 void Window::releaseRenderingWindow()
 {
-    if (!d_autoRenderingWindow || !d_surface)
+    if (!hasAutoRenderingWindow() || !d_surface)
         return;
 
     auto oldSurface = static_cast<RenderingWindow*>(d_surface);
@@ -3020,7 +3065,10 @@ void Window::updateGeometryTransformAndClipping()
         {
             ctx.surface->invalidate();
             if (d_guiContext)
+            {
                 d_guiContext->markAsDirty();
+                d_guiContext->getRenderCachePolicy().notifyWindowInvalidated(*this);
+            }
         }
     }
 
@@ -3097,10 +3145,10 @@ void Window::onTargetSurfaceChanged(RenderingSurface* newSurface)
     //???if (d_surface && !d_surface->isRenderingWindow())?
     //???any window must be processed, even the one that was set externally?
     //!!!transferRenderingWindow!
-    if (d_surface && !d_autoRenderingWindow)
+    if (d_surface && !hasAutoRenderingWindow())
         return;
 
-    if (d_autoRenderingWindow)
+    if (hasAutoRenderingWindow())
     {
         if (newSurface == d_surface)
             return;
@@ -3266,6 +3314,48 @@ void Window::setDrawModeMask(std::uint32_t drawModeMask)
         d_guiContext->markAsDirty();
 }
 
+//----------------------------------------------------------------------------//
+void Window::setOpaqueArea(const URect& area)
+{
+    if (d_opaqueArea == area)
+        return;
+
+    d_opaqueArea = area;
+    if (d_guiContext)
+        d_guiContext->markAsDirty();
+}
+
+//----------------------------------------------------------------------------//
+void Window::addOpaqueImageryArea(const Rectf& area)
+{
+    if (area.getWidth() * area.getHeight() >
+        d_opaqueImageryArea.getWidth() * d_opaqueImageryArea.getHeight())
+        d_opaqueImageryArea = area;
+}
+
+//----------------------------------------------------------------------------//
+Rectf Window::getOpaqueRect() const
+{
+    if (getEffectiveAlpha() < 1.f)
+        return Rectf(0.f, 0.f, 0.f, 0.f);
+
+    const Rectf& outer = getUnclippedOuterRect().get();
+    Rectf opaque(CoordConverter::asAbsolute(d_opaqueArea, outer.getSize()));
+    if (opaque.empty())
+        opaque = Rectf(0.f, 0.f, 0.f, 0.f);
+
+    // the imagery may change when the geometry is rebuilt
+    if (!d_needsRedraw && !d_opaqueImageryArea.empty() &&
+        d_opaqueImageryArea.getWidth() * d_opaqueImageryArea.getHeight() >
+        opaque.getWidth() * opaque.getHeight())
+        opaque = d_opaqueImageryArea;
+
+    if (!opaque.empty())
+        opaque.offset(outer.getPosition());
+
+    return opaque;
+}
+
 //----------------------------------------------------------------------------//
 void Window::addWindowProperties()
 {
@@ -3475,6 +3565,13 @@ void Window::addWindowProperties()
         "Value is a bitmask of 32 bit size, which will be checked against the bitmask specified for the draw call.",
         &Window::setDrawModeMask, &Window::getDrawModeMask, DrawModeFlagWindowRegular
     );
+
+    CEGUI_DEFINE_PROPERTY(Window, URect,
+        OpaqueAreaPropertyName, "Property to get/set the area of the Window, relative to its outer area, that "
+        "is covered by opaque pixels. Windows hidden behind it are not drawn when occlusion culling is enabled. "
+        "Value is a URect, an empty area declares nothing.",
+        &Window::setOpaqueArea, &Window::getOpaqueArea, URect(UDim(0, 0), UDim(0, 0), UDim(0, 0), UDim(0, 0))
+    );
 }
 
 } // End of  CEGUI namespace section
@@ -68,10 +68,15 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
 {
     Rectf items_area(getViewRenderArea());
     glm::vec2 item_pos(getItemRenderStartPosition(list_view, items_area));
+    const std::vector<ListViewItemRenderingState*>& items = list_view->getItems();
 
-    for (size_t i = 0; i < list_view->getItems().size(); ++i)
+    // skip straight to the first item that is (partially) visible
+    size_t i = list_view->getItemPositionAtOffset(items_area.top() - item_pos.y);
+    item_pos.y += list_view->getItemOffset(i);
+
+    for (; i < items.size() && item_pos.y < items_area.bottom(); ++i)
     {
-        ListViewItemRenderingState* item = list_view->getItems().at(i);
+        ListViewItemRenderingState* item = items[i];
         Sizef size(item->d_size);
 
         size.d_width = std::max(items_area.getWidth(), size.d_width);
@@ -81,9 +86,8 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
         item_rect.top(item_pos.y);
         item_rect.setSize(size);
 
-        if (!item->d_icon.empty())
+        if (const Image* img = ImageManager::getSingleton().getImage(item->d_icon))
         {
-            Image& img = ImageManager::getSingleton().get(item->d_icon);
 
             Rectf icon_rect(item_rect);
             icon_rect.setWidth(size.d_height);
@@ -93,7 +97,7 @@ void FalagardListView::createRenderGeometry(ListView* list_view)
 
             ImageRenderSettings renderSettings(icon_rect, &icon_clipper, ICON_COLOUR_RECT, 1.0f);
 
-            img.createRenderGeometry(list_view->getGeometryBuffers(), renderSettings);
+            img->createRenderGeometry(list_view->getGeometryBuffers(), renderSettings);
 
             item_rect.left(item_rect.left() + icon_rect.getWidth());
         }
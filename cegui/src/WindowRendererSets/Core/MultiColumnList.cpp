@@ -101,10 +101,6 @@ namespace CEGUI
         // calculate position of area we have to render into
         Rectf itemsArea(getListRenderArea());
 
-        // set up initial positional details for items
-        itemPos.y = itemsArea.top() - vertScrollbar->getScrollPosition();
-        itemPos.z = 0.0f;
-
         const float alpha = w->getEffectiveAlpha();
         const ColourRect normalTextCol = getOptionalColour(UnselectedTextColourPropertyName, ListboxTextItem::DefaultTextColour);
         const ColourRect selectedTextCol = getOptionalColour(SelectedTextColourPropertyName, ListboxTextItem::DefaultTextColour);
@@ -112,48 +108,68 @@ namespace CEGUI
             w->isActive() ? ActiveSelectionColourPropertyName : InactiveSelectionColourPropertyName,
             ListboxItem::DefaultSelectionColour);
 
-        // loop through the items
-        for (unsigned int i = 0; i < w->getRowCount(); ++i)
-        {
-            // set initial x position for this row.
-            itemPos.x = itemsArea.left() - horzScrollbar->getScrollPosition();
+        // work out the horizontal extent of the columns once, and which of
+        // them intersect the items area.
+        const unsigned int columnCount = w->getColumnCount();
+        const float headerWidth = header->getPixelSize().d_width;
+        const float columnsLeft = itemsArea.left() - horzScrollbar->getScrollPosition();
+
+        d_columnOffsets.resize(columnCount + 1);
+        d_columnOffsets[0] = columnsLeft;
+        for (unsigned int j = 0; j < columnCount; ++j)
+            d_columnOffsets[j + 1] = d_columnOffsets[j] +
+                CoordConverter::asAbsolute(header->getColumnWidth(j), headerWidth);
+
+        unsigned int firstColumn = 0;
+        while (firstColumn < columnCount && d_columnOffsets[firstColumn + 1] <= itemsArea.left())
+            ++firstColumn;
+
+        unsigned int lastColumn = firstColumn;
+        while (lastColumn < columnCount && d_columnOffsets[lastColumn] < itemsArea.right())
+            ++lastColumn;
+
+        // only rows that intersect the items area are visited; the first one
+        // is found by a binary search of the cached row offsets.
+        const float scrollPosition = vertScrollbar->getScrollPosition();
+        const unsigned int rowCount = w->getRowCount();
+        unsigned int row = w->getRowAtOffset(scrollPosition);
+
+        itemPos.y = itemsArea.top() - scrollPosition + (row < rowCount ? w->getRowOffset(row) : 0.0f);
+        itemPos.z = 0.0f;
 
+        for (; row < rowCount && itemPos.y < itemsArea.bottom(); ++row)
+        {
             // calculate height for this row.
-            itemSize.d_height = w->getHighestRowItemHeight(i);
+            itemSize.d_height = w->getRowOffset(row + 1) - w->getRowOffset(row);
 
-            // loop through the columns in this row
-            for (unsigned int j = 0; j < w->getColumnCount(); ++j)
+            // loop through the visible columns in this row
+            for (unsigned int j = firstColumn; j < lastColumn; ++j)
             {
-                // allow item to use full width of the column
-                itemSize.d_width = CoordConverter::asAbsolute(header->getColumnWidth(j), header->getPixelSize().d_width);
-
-                ListboxItem* item = w->getItemAtGridReference(MCLGridRef(i,j));
+                ListboxItem* item = w->getItemAtGridReference(MCLGridRef(row, j));
 
                 // is the item for this column set?
-                if (item)
-                {
-                    // calculate destination area for this item.
-                    itemRect.left(itemPos.x);
-                    itemRect.top(itemPos.y);
-                    itemRect.setSize(itemSize);
-                    itemClipper = itemRect.getIntersection(itemsArea);
-
-                    // skip this item if totally clipped
-                    if (itemClipper.getWidth() == 0)
-                    {
-                        itemPos.x += itemSize.d_width;
-                        continue;
-                    }
-
-                    // Create render geometry for this item and add it to the Window
-                    item->setSelectionColours(selectionBgCol);
-                    if (auto textItem = dynamic_cast<ListboxTextItem*>(item))
-                        textItem->setTextColours(textItem->isSelected() ? selectedTextCol : normalTextCol);
-                    item->createRenderGeometry(w->getGeometryBuffers(), itemRect, alpha, &itemClipper);
-                }
-
-                // update position for next column.
-                itemPos.x += itemSize.d_width;
+                if (!item)
+                    continue;
+
+                // allow item to use full width of the column
+                itemPos.x = d_columnOffsets[j];
+                itemSize.d_width = d_columnOffsets[j + 1] - d_columnOffsets[j];
+
+                // calculate destination area for this item.
+                itemRect.left(itemPos.x);
+                itemRect.top(itemPos.y);
+                itemRect.setSize(itemSize);
+                itemClipper = itemRect.getIntersection(itemsArea);
+
+                // skip this item if totally clipped
+                if (itemClipper.getWidth() == 0)
+                    continue;
+
+                // Create render geometry for this item and add it to the Window
+                item->setSelectionColours(selectionBgCol);
+                if (auto textItem = dynamic_cast<ListboxTextItem*>(item))
+                    textItem->setTextColours(textItem->isSelected() ? selectedTextCol : normalTextCol);
+                item->createRenderGeometry(w->getGeometryBuffers(), itemRect, alpha, &itemClipper);
             }
 
             // update position ready for next row
@@ -73,6 +73,10 @@ void FalagardTreeView::renderTreeItem(TreeView* tree_view, const Rectf& items_ar
     float expander_margin = tree_view->getSubtreeExpanderMargin();
     for (TreeViewItemRenderingState* const item : item_to_render->d_renderedChildren)
     {
+        // nothing past this point is visible
+        if (item_pos.y >= items_area.bottom())
+            return;
+
         Sizef size = item->d_size;
 
         // center the expander compared to the item's height
@@ -80,50 +84,55 @@ void FalagardTreeView::renderTreeItem(TreeView* tree_view, const Rectf& items_ar
 
         size.d_width = std::max(items_area.getWidth(), size.d_width);
         float indent = d_subtreeExpanderImagerySize.d_width + expander_margin * 2;
-        if (item->d_totalChildCount > 0)
+
+        // rows above the visible area only need to be skipped over
+        const float row_height = std::max(size.d_height, d_subtreeExpanderImagerySize.d_height);
+        if (item_pos.y + row_height > items_area.top())
         {
-            const ImagerySection* section = item->d_subtreeIsExpanded
-                ? d_subtreeCollapserImagery : d_subtreeExpanderImagery;
+            if (item->d_totalChildCount > 0)
+            {
+                const ImagerySection* section = item->d_subtreeIsExpanded
+                    ? d_subtreeCollapserImagery : d_subtreeExpanderImagery;
 
-            Rectf button_rect;
-            button_rect.left(item_pos.x + expander_margin);
-            button_rect.top(item_pos.y +
-                (half_diff > 0 ? half_diff : 0));
-            button_rect.setSize(d_subtreeExpanderImagerySize);
+                Rectf button_rect;
+                button_rect.left(item_pos.x + expander_margin);
+                button_rect.top(item_pos.y +
+                    (half_diff > 0 ? half_diff : 0));
+                button_rect.setSize(d_subtreeExpanderImagerySize);
 
-            Rectf button_clipper(button_rect.getIntersection(items_area));
-            section->render(*tree_view, button_rect, nullptr, &button_clipper);
+                Rectf button_clipper(button_rect.getIntersection(items_area));
+                section->render(*tree_view, button_rect, nullptr, &button_clipper);
 
-            indent = button_rect.getWidth() + expander_margin * 2;
-        }
+                indent = button_rect.getWidth() + expander_margin * 2;
+            }
 
-        Rectf item_rect;
-        item_rect.left(item_pos.x + indent);
-        item_rect.top(item_pos.y + (half_diff < 0 ? -half_diff : 0));
-        item_rect.setSize(size);
+            Rectf item_rect;
+            item_rect.left(item_pos.x + indent);
+            item_rect.top(item_pos.y + (half_diff < 0 ? -half_diff : 0));
+            item_rect.setSize(size);
 
-        if (!item->d_icon.empty())
-        {
-            Image& img = ImageManager::getSingleton().get(item->d_icon);
+            if (const Image* img = ImageManager::getSingleton().getImage(item->d_icon))
+            {
 
-            Rectf icon_rect(item_rect);
-            icon_rect.setWidth(size.d_height);
-            icon_rect.setHeight(size.d_height);
+                Rectf icon_rect(item_rect);
+                icon_rect.setWidth(size.d_height);
+                icon_rect.setHeight(size.d_height);
 
-            Rectf icon_clipper(icon_rect.getIntersection(items_area));
+                Rectf icon_clipper(icon_rect.getIntersection(items_area));
 
-            ImageRenderSettings renderSettings(icon_rect, &icon_clipper, ICON_COLOUR_RECT, 1.0f);
+                ImageRenderSettings renderSettings(icon_rect, &icon_clipper, ICON_COLOUR_RECT, 1.0f);
 
-            img.createRenderGeometry(tree_view->getGeometryBuffers(), renderSettings);
+                img->createRenderGeometry(tree_view->getGeometryBuffers(), renderSettings);
 
-            item_rect.left(item_rect.left() + icon_rect.getWidth());
-        }
+                item_rect.left(item_rect.left() + icon_rect.getWidth());
+            }
 
-        Rectf item_clipper(item_rect.getIntersection(items_area));
-        createRenderGeometryAndAddToItemView(tree_view, item->d_renderedText, item_rect,
-            tree_view->getEffectiveFont(), &tree_view->getTextColourRect(), &item_clipper, item->d_isSelected);
+            Rectf item_clipper(item_rect.getIntersection(items_area));
+            createRenderGeometryAndAddToItemView(tree_view, item->d_renderedText, item_rect,
+                tree_view->getEffectiveFont(), &tree_view->getTextColourRect(), &item_clipper, item->d_isSelected);
+        }
 
-        item_pos.y += std::max(size.d_height, d_subtreeExpanderImagerySize.d_height);
+        item_pos.y += row_height;
 
         if (item->d_renderedChildren.empty())
             continue;
@@ -27,25 +27,104 @@
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/SharedStringStream.h"
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
 
 namespace CEGUI
 {
+    namespace
+    {
+        //! Return whether \a str is equal to the null terminated UTF-8 string \a utf8.
+        bool equalsUtf8(const String& str, const char* utf8)
+        {
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+            return std::strcmp(str.c_str(), utf8) == 0;
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+            // Attribute names are nearly always plain ASCII, so compare code
+            // units directly and only convert when a multi-byte sequence turns up.
+            const std::u32string& u32 = str.getString();
+            size_t i = 0;
+            for (; utf8[i]; ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(utf8[i]);
+                if (c >= 0x80)
+                    return u32 == String::convertUtf8ToUtf32(utf8);
+
+                if (i >= u32.size() || u32[i] != c)
+                    return false;
+            }
+
+            return i == u32.size();
+#endif
+        }
+    }
+
+    XMLAttributes::XMLAttributes(const XMLAttributes& other)
+    {
+        *this = other;
+    }
+
+    XMLAttributes& XMLAttributes::operator=(const XMLAttributes& other)
+    {
+        if (this == &other)
+            return *this;
+
+        // Copies always own their strings; views into a parser's buffers
+        // would dangle once the copy outlives the parser callback.
+        d_attrs.clear();
+        d_attrs.reserve(other.d_attrs.size());
+
+        for (const Attribute& attr : other.d_attrs)
+            d_attrs.push_back({nullptr, nullptr, other.getNameString(attr),
+                               other.getValueString(attr), true, true});
+
+        return *this;
+    }
+
     void XMLAttributes::add(const String& attrName, const String& attrValue)
     {
-        d_attrs[attrName] = attrValue;
+        if (Attribute* attr = find(attrName))
+        {
+            getNameString(*attr);
+            attr->d_rawName = nullptr;
+            attr->d_rawValue = nullptr;
+            attr->d_value = attrValue;
+            attr->d_valueConverted = true;
+        }
+        else
+            d_attrs.push_back({nullptr, nullptr, attrName, attrValue, true, true});
     }
 
-    void XMLAttributes::remove(const String& attrName)
+    void XMLAttributes::addView(const char* attrName, const char* attrValue)
     {
-        auto pos = d_attrs.find(attrName);
+        if (Attribute* attr = findRaw(attrName))
+        {
+            // keep the (possibly owned) name, replace the value only
+            getNameString(*attr);
+            attr->d_rawName = attrName;
+            attr->d_rawValue = attrValue;
+            attr->d_valueConverted = false;
+        }
+        else
+            d_attrs.push_back({attrName, attrValue, String(), String(), false, false});
+    }
 
-        if (pos != d_attrs.end())
-            d_attrs.erase(pos);
+    void XMLAttributes::clear()
+    {
+        d_attrs.clear();
+    }
+
+    void XMLAttributes::remove(const String& attrName)
+    {
+        if (const Attribute* attr = find(attrName))
+            d_attrs.erase(d_attrs.begin() + (attr - d_attrs.data()));
     }
 
     bool XMLAttributes::exists(const String& attrName) const
     {
-        return d_attrs.find(attrName) != d_attrs.end();
+        return find(attrName) != nullptr;
     }
 
     size_t XMLAttributes::getCount(void) const
@@ -61,10 +140,7 @@ namespace CEGUI
                 "The specified index is out of range for this XMLAttributes block.");
         }
 
-        auto iter = d_attrs.begin();
-        std::advance(iter, index);
-
-        return (*iter).first;
+        return getNameString(d_attrs[index]);
     }
 
     const String& XMLAttributes::getValue(size_t index) const
@@ -75,19 +151,14 @@ namespace CEGUI
                 "The specified index is out of range for this XMLAttributes block.");
         }
 
-        auto iter = d_attrs.begin();
-        std::advance(iter, index);
-
-        return (*iter).second;
+        return getValueString(d_attrs[index]);
     }
 
     const String& XMLAttributes::getValue(const String& attrName) const
     {
-        auto pos = d_attrs.find(attrName);
-
-        if (pos != d_attrs.end())
+        if (const Attribute* attr = find(attrName))
         {
-            return (*pos).second;
+            return getValueString(*attr);
         }
         else
         {
@@ -98,69 +169,75 @@ namespace CEGUI
 
     String XMLAttributes::getValueAsString(const String& attrName, const String& def) const
     {
-        return (exists(attrName)) ? getValue(attrName) : def;
+        const Attribute* attr = find(attrName);
+        return attr ? getValueString(*attr) : def;
     }
 
 
     bool XMLAttributes::getValueAsBool(const String& attrName, bool def) const
     {
-        if (!exists(attrName))
+        const Attribute* attr = find(attrName);
+        if (!attr)
         {
             return def;
         }
 
-        const String& val = getValue(attrName);
+        std::string buffer;
+        const char* val = getValueUtf8(*attr, buffer);
 
-        if (val == "false" || val == "False" || val == "0")
+        if (!std::strcmp(val, "false") || !std::strcmp(val, "False") || !std::strcmp(val, "0"))
         {
             return false;
         }
-        else if (val == "true" || val == "True" || val == "1")
+        else if (!std::strcmp(val, "true") || !std::strcmp(val, "True") || !std::strcmp(val, "1"))
         {
             return true;
         }
         else
         {
             throw InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to bool.");
+                "failed to convert attribute '" + attrName + "' with value '" + getValueString(*attr) + "' to bool.");
         }
     }
 
     int XMLAttributes::getValueAsInteger(const String& attrName, int def) const
     {
-        if (!exists(attrName))
+        const Attribute* attr = find(attrName);
+        if (!attr)
         {
             return def;
         }
 
-        int val;
-#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
-        std::istringstream strm(getValue(attrName).c_str());
-#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-        std::istringstream strm( String::convertUtf32ToUtf8(getValue(attrName).getString()).c_str());
-#endif
-        strm >> val;
+        std::string buffer;
+        const char* str = getValueUtf8(*attr, buffer);
 
-        // Check for success and end-of-file
-        if(strm.fail() || !strm.eof())
+        // strtol skips leading whitespace like the stream extraction used to;
+        // anything left over after the number is an error.
+        char* end;
+        errno = 0;
+        const long val = std::strtol(str, &end, 10);
+
+        if (end == str || *end != '\0' || errno == ERANGE || val < INT_MIN || val > INT_MAX)
         {
             throw InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to integer.");
+                "failed to convert attribute '" + attrName + "' with value '" + getValueString(*attr) + "' to integer.");
         }
 
-        return val;
+        return static_cast<int>(val);
     }
 
     float XMLAttributes::getValueAsFloat(const String& attrName, float def) const
     {
-        if (!exists(attrName))
+        const Attribute* attr = find(attrName);
+        if (!attr)
         {
             return def;
         }
 
+        std::string buffer;
         float val;
         std::stringstream& strm = SharedStringstream::GetPreparedStream();
-        strm << getValue(attrName);
+        strm << getValueUtf8(*attr, buffer);
 
         strm >> val;
 
@@ -168,10 +245,77 @@ namespace CEGUI
         if(strm.fail() || !strm.eof())
         {
             throw InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to float.");
+                "failed to convert attribute '" + attrName + "' with value '" + getValueString(*attr) + "' to float.");
         }
 
         return val;
     }
 
+    const XMLAttributes::Attribute* XMLAttributes::find(const String& attrName) const
+    {
+        // blocks rarely hold more than a handful of attributes, so a linear
+        // search beats hashing the name
+        for (const Attribute& attr : d_attrs)
+        {
+            if (attr.d_nameConverted ? attr.d_name == attrName
+                                     : equalsUtf8(attrName, attr.d_rawName))
+                return &attr;
+        }
+
+        return nullptr;
+    }
+
+    XMLAttributes::Attribute* XMLAttributes::find(const String& attrName)
+    {
+        return const_cast<Attribute*>(static_cast<const XMLAttributes*>(this)->find(attrName));
+    }
+
+    XMLAttributes::Attribute* XMLAttributes::findRaw(const char* attrName)
+    {
+        for (Attribute& attr : d_attrs)
+        {
+            if (attr.d_nameConverted ? equalsUtf8(attr.d_name, attrName)
+                                     : !std::strcmp(attr.d_rawName, attrName))
+                return &attr;
+        }
+
+        return nullptr;
+    }
+
+    const String& XMLAttributes::getNameString(const Attribute& attr) const
+    {
+        if (!attr.d_nameConverted)
+        {
+            attr.d_name = attr.d_rawName;
+            attr.d_nameConverted = true;
+        }
+
+        return attr.d_name;
+    }
+
+    const String& XMLAttributes::getValueString(const Attribute& attr) const
+    {
+        if (!attr.d_valueConverted)
+        {
+            attr.d_value = attr.d_rawValue;
+            attr.d_valueConverted = true;
+        }
+
+        return attr.d_value;
+    }
+
+    const char* XMLAttributes::getValueUtf8(const Attribute& attr, std::string& buffer)
+    {
+        if (attr.d_rawValue)
+            return attr.d_rawValue;
+
+#if (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_ASCII) || (CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_8)
+        (void)buffer;
+        return attr.d_value.c_str();
+#elif CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+        buffer = String::convertUtf32ToUtf8(attr.d_value.getString());
+        return buffer.c_str();
+#endif
+    }
+
 } // End of  CEGUI namespace section
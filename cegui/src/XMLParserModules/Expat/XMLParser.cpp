@@ -90,8 +90,9 @@ void ExpatParser::startElement(void* data, const char* element, const char** att
     XMLHandler* handler = static_cast<XMLHandler*>(data);
     XMLAttributes attrs;
 
+    // attribute strings stay valid until this callback returns
     for(size_t i = 0 ; attr[i] ; i += 2)
-        attrs.add(attr[i], attr[i+1]);
+        attrs.addView(attr[i], attr[i+1]);
 
     handler->elementStart(element, attrs);
 }
@@ -49,8 +49,9 @@ static void processNode(XMLHandler& handler, pugi::xml_node node)
 
     {
         XMLAttributes attrs;
+        // the strings are owned by the document, which outlives the handler call
         for (auto attr : node.attributes())
-            attrs.add(attr.name(), attr.value());
+            attrs.addView(attr.name(), attr.value());
 
         handler.elementStart(nodeName, attrs);
     }
@@ -67,7 +67,8 @@ namespace CEGUI
         const tinyxml2::XMLAttribute *currAttr = element->FirstAttribute();
         while (currAttr)
         {
-            attrs.add(currAttr->Name(), currAttr->Value());
+            // the strings are owned by the document, which outlives the handler call
+            attrs.addView(currAttr->Name(), currAttr->Value());
             currAttr = currAttr->Next();
         }
 
@@ -0,0 +1,395 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Flat, precompiled form of a Falagard dimension tree
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/falagard/DimensionProgram.h"
+#include "CEGUI/falagard/Dimensions.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/XMLSerializer.h"
+#include "CEGUI/falagard/PropertyDefinition.h"
+#include "CEGUI/CoordConverter.h"
+#include "CEGUI/TypedProperty.h"
+
+#include <algorithm>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+DimensionProgram::DimensionProgram()
+{
+}
+
+//----------------------------------------------------------------------------//
+DimensionProgram::~DimensionProgram()
+{
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::clear()
+{
+    d_code.clear();
+    d_properties.clear();
+    d_calls.clear();
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::compile(const BaseDim* dim)
+{
+    clear();
+
+    if (!dim)
+        return;
+
+    // the evaluation stack has a fixed size; trees nested deeper than that
+    // are simply evaluated through the original objects.
+    if (compileNode(dim) > MaxStackDepth)
+    {
+        clear();
+        emitCall(dim);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool DimensionProgram::isConstant() const
+{
+    return d_code.size() == 1 && d_code.front().d_op == OpCode::Constant;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t DimensionProgram::compileNode(const BaseDim* dim)
+{
+    if (!dim)
+    {
+        // missing operands of an OperatorDim evaluate to zero
+        emitConstant(0.0f);
+        return 1;
+    }
+
+    if (const AbsoluteDim* absolute = dynamic_cast<const AbsoluteDim*>(dim))
+    {
+        emitConstant(absolute->getBaseValue());
+        return 1;
+    }
+
+    if (const UnifiedDim* unified = dynamic_cast<const UnifiedDim*>(dim))
+    {
+        OpCode op;
+        switch (unified->getSourceDimension())
+        {
+        case DimensionType::LeftEdge:
+        case DimensionType::RightEdge:
+        case DimensionType::XPosition:
+        case DimensionType::XOffset:
+        case DimensionType::Width:
+            op = OpCode::UnifiedWidth;
+            break;
+
+        case DimensionType::TopEdge:
+        case DimensionType::BottomEdge:
+        case DimensionType::YPosition:
+        case DimensionType::YOffset:
+        case DimensionType::Height:
+            op = OpCode::UnifiedHeight;
+            break;
+
+        default:
+            // let the UnifiedDim raise its usual exception when evaluated
+            emitCall(dim);
+            return 1;
+        }
+
+        const UDim& value = unified->getBaseValue();
+        if (value.d_scale == 0.0f)
+            emitConstant(CoordConverter::asAbsolute(value, 0.0f));
+        else
+            d_code.push_back({op, 0, value});
+
+        return 1;
+    }
+
+    if (const OperatorDim* op = dynamic_cast<const OperatorDim*>(dim))
+    {
+        switch (op->getOperator())
+        {
+        case DimensionOperator::NoOp:
+            emitConstant(0.0f);
+            return 1;
+
+        case DimensionOperator::Add:
+        case DimensionOperator::Subtract:
+        case DimensionOperator::Multiply:
+        case DimensionOperator::Divide:
+        case DimensionOperator::Max:
+        case DimensionOperator::Min:
+            break;
+
+        default:
+            emitCall(dim);
+            return 1;
+        }
+
+        const std::size_t leftDepth = compileNode(op->getLeftOperand());
+        const std::size_t rightDepth = compileNode(op->getRightOperand());
+        compileOperator(*op);
+
+        return std::max(leftDepth, rightDepth + 1);
+    }
+
+    if (const PropertyDim* property = dynamic_cast<const PropertyDim*>(dim))
+    {
+        OpCode op;
+        switch (property->getSourceDimension())
+        {
+        case DimensionType::Invalid:
+            op = OpCode::PropertyScalar;
+            break;
+
+        case DimensionType::Width:
+            op = OpCode::PropertyUDimWidth;
+            break;
+
+        case DimensionType::Height:
+            op = OpCode::PropertyUDimHeight;
+            break;
+
+        default:
+            emitCall(dim);
+            return 1;
+        }
+
+        PropertyAccessor accessor = {property, nullptr, nullptr, nullptr,
+                                     false, String(), UDim(0, 0), false};
+        d_code.push_back({op, static_cast<std::uint32_t>(d_properties.size()),
+                          UDim(0, 0)});
+        d_properties.push_back(accessor);
+        return 1;
+    }
+
+    // image, font and widget dims, and anything user defined.
+    emitCall(dim);
+    return 1;
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::compileOperator(const OperatorDim& dim)
+{
+    OpCode op;
+    switch (dim.getOperator())
+    {
+    case DimensionOperator::Add:        op = OpCode::Add; break;
+    case DimensionOperator::Subtract:   op = OpCode::Subtract; break;
+    case DimensionOperator::Multiply:   op = OpCode::Multiply; break;
+    case DimensionOperator::Divide:     op = OpCode::Divide; break;
+    case DimensionOperator::Max:        op = OpCode::Max; break;
+    default:                            op = OpCode::Min; break;
+    }
+
+    // An operand that compiled to a constant is always a single instruction,
+    // so if the last two instructions are constants they are the operands.
+    const std::size_t count = d_code.size();
+    if (count >= 2 &&
+        d_code[count - 1].d_op == OpCode::Constant &&
+        d_code[count - 2].d_op == OpCode::Constant)
+    {
+        const float lval = d_code[count - 2].d_value.d_offset;
+        const float rval = d_code[count - 1].d_value.d_offset;
+        d_code.resize(count - 2);
+
+        float result;
+        switch (op)
+        {
+        case OpCode::Add:       result = lval + rval; break;
+        case OpCode::Subtract:  result = lval - rval; break;
+        case OpCode::Multiply:  result = lval * rval; break;
+        case OpCode::Divide:    result = rval == 0.0f ? 0.0f : lval / rval; break;
+        case OpCode::Max:       result = lval > rval ? lval : rval; break;
+        default:                result = lval < rval ? lval : rval; break;
+        }
+
+        emitConstant(result);
+        return;
+    }
+
+    d_code.push_back({op, 0, UDim(0, 0)});
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::emitConstant(float value)
+{
+    d_code.push_back({OpCode::Constant, 0, UDim(0, value)});
+}
+
+//----------------------------------------------------------------------------//
+void DimensionProgram::emitCall(const BaseDim* dim)
+{
+    d_code.push_back({OpCode::Call, static_cast<std::uint32_t>(d_calls.size()),
+                      UDim(0, 0)});
+    d_calls.push_back(dim);
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::evaluate(const Window& wnd) const
+{
+    return run(wnd, nullptr);
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::evaluate(const Window& wnd, const Rectf& container) const
+{
+    return run(wnd, &container);
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::run(const Window& wnd, const Rectf* container) const
+{
+    float stack[MaxStackDepth];
+    std::size_t top = 0;
+
+    for (const Instruction& instr : d_code)
+    {
+        switch (instr.d_op)
+        {
+        case OpCode::Constant:
+            stack[top++] = instr.d_value.d_offset;
+            break;
+
+        case OpCode::UnifiedWidth:
+            stack[top++] = CoordConverter::asAbsolute(instr.d_value,
+                container ? container->getWidth() : wnd.getPixelSize().d_width);
+            break;
+
+        case OpCode::UnifiedHeight:
+            stack[top++] = CoordConverter::asAbsolute(instr.d_value,
+                container ? container->getHeight() : wnd.getPixelSize().d_height);
+            break;
+
+        case OpCode::PropertyUDimWidth:
+        case OpCode::PropertyUDimHeight:
+        case OpCode::PropertyScalar:
+            stack[top++] = readProperty(wnd, d_properties[instr.d_index], instr.d_op);
+            break;
+
+        case OpCode::Call:
+            stack[top++] = container ? d_calls[instr.d_index]->getValue(wnd, *container)
+                                     : d_calls[instr.d_index]->getValue(wnd);
+            break;
+
+        case OpCode::Add:
+            --top;
+            stack[top - 1] = stack[top - 1] + stack[top];
+            break;
+
+        case OpCode::Subtract:
+            --top;
+            stack[top - 1] = stack[top - 1] - stack[top];
+            break;
+
+        case OpCode::Multiply:
+            --top;
+            stack[top - 1] = stack[top - 1] * stack[top];
+            break;
+
+        // divide by zero returns zero, as OperatorDim does.
+        case OpCode::Divide:
+            --top;
+            stack[top - 1] = stack[top] == 0.0f ? 0.0f : stack[top - 1] / stack[top];
+            break;
+
+        case OpCode::Max:
+            --top;
+            stack[top - 1] = stack[top - 1] > stack[top] ? stack[top - 1] : stack[top];
+            break;
+
+        case OpCode::Min:
+            --top;
+            stack[top - 1] = stack[top - 1] < stack[top] ? stack[top - 1] : stack[top];
+            break;
+        }
+    }
+
+    return top ? stack[0] : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+float DimensionProgram::readProperty(const Window& wnd,
+                                     const PropertyAccessor& accessor,
+                                     OpCode op) const
+{
+    const PropertyDim& dim = *accessor.d_dim;
+    const String& name = dim.getPropertyName();
+
+    const Window& source = dim.getWidgetName().empty() ?
+        wnd : *wnd.getChild(dim.getWidgetName());
+
+    // The same Property instance is normally shared by every window of a
+    // type, so only a change of instance needs the casts to be redone.
+    const Property* property = source.getPropertyInstance(name);
+    if (property != accessor.d_property)
+    {
+        accessor.d_property = property;
+        accessor.d_udimProperty = dynamic_cast<const TypedProperty<UDim>*>(property);
+        accessor.d_udimDefinition = dynamic_cast<const PropertyDefinition<UDim>*>(property);
+        accessor.d_isBool = property->getDataType() == PropertyHelper<bool>::getDataTypeName();
+        accessor.d_hasLastValue = false;
+    }
+
+    if (op == OpCode::PropertyScalar)
+    {
+        if (accessor.d_isBool)
+            return source.getProperty<bool>(name) ? 1.0f : 0.0f;
+
+        return source.getProperty<float>(name);
+    }
+
+    UDim value;
+    if (accessor.d_udimDefinition && property->isReadable() &&
+        source.isUserStringDefined(accessor.d_udimDefinition->getUserStringName()))
+    {
+        // Falagard property definitions hold their value as a string; only
+        // parse it again if it differs from the one seen last time.
+        const String& str = source.getUserString(accessor.d_udimDefinition->getUserStringName());
+        if (!accessor.d_hasLastValue || str != accessor.d_lastString)
+        {
+            accessor.d_lastValue = PropertyHelper<UDim>::fromString(str);
+            accessor.d_lastString = str;
+            accessor.d_hasLastValue = true;
+        }
+        value = accessor.d_lastValue;
+    }
+    else if (accessor.d_udimProperty)
+        value = accessor.d_udimProperty->getNative(&source);
+    else
+        value = source.getProperty<UDim>(name);
+
+    return CoordConverter::asAbsolute(value, op == OpCode::PropertyUDimWidth ?
+        source.getPixelSize().d_width : source.getPixelSize().d_height);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
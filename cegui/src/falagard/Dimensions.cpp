@@ -452,26 +452,30 @@ void ImageDimBase::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) con
 //----------------------------------------------------------------------------//
 ImageDim::ImageDim(const String& image_name, DimensionType dim) :
     ImageDimBase(dim),
-    d_imageName(image_name)
+    d_image(image_name)
 {
 }
 
 //----------------------------------------------------------------------------//
 const String& ImageDim::getSourceImageName() const
 {
-    return d_imageName;
+    return d_image.getName();
 }
 
 //----------------------------------------------------------------------------//
 void ImageDim::setSourceImageName(const String& image_name)
 {
-    d_imageName = image_name;
+    d_image.setName(image_name);
 }
 
 //----------------------------------------------------------------------------//
 const Image* ImageDim::getSourceImage(const Window& /*wnd*/) const
 {
-    return &ImageManager::getSingleton().get(d_imageName);
+    if (const Image* image = d_image.get())
+        return image;
+
+    // not defined; let ImageManager raise the usual exception
+    return &ImageManager::getSingleton().get(d_image.getName());
 }
 
 //----------------------------------------------------------------------------//
@@ -490,7 +494,7 @@ void ImageDim::writeXMLElementName_impl(XMLSerializer& xml_stream) const
 void ImageDim::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const
 {
     ImageDimBase::writeXMLElementAttributes_impl(xml_stream);
-    xml_stream.attribute(Falagard_xmlHandler::NameAttribute, d_imageName);
+    xml_stream.attribute(Falagard_xmlHandler::NameAttribute, d_image.getName());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -518,8 +522,7 @@ void ImagePropertyDim::setSourceProperty(const String& property_name)
 //----------------------------------------------------------------------------//
 const Image* ImagePropertyDim::getSourceImage(const Window& wnd) const
 {
-    const String& image_name(wnd.getProperty(d_propertyName));
-    return image_name.empty() ? 0 : &ImageManager::getSingleton().get(image_name);
+    return d_propertyImage.getFromProperty(wnd, d_propertyName);
 }
 
 //----------------------------------------------------------------------------//
@@ -954,6 +957,7 @@ Dimension::Dimension(const BaseDim& dim, DimensionType type)
 {
     d_value = dim.clone();
     d_type = type;
+    d_program.compile(d_value);
 }
 
 //----------------------------------------------------------------------------//
@@ -961,17 +965,22 @@ Dimension::Dimension(const Dimension& other)
 {
     d_value = other.d_value ? other.d_value->clone() : 0;
     d_type = other.d_type;
+    d_program.compile(d_value);
 }
 
 //----------------------------------------------------------------------------//
 Dimension& Dimension::operator=(const Dimension& other)
 {
+    if (this == &other)
+        return *this;
+
     // release old value, if any.
     if (d_value)
         delete d_value;
 
     d_value = other.d_value ? other.d_value->clone() : 0;
     d_type = other.d_type;
+    d_program.compile(d_value);
 
     return *this;
 }
@@ -991,6 +1000,19 @@ void Dimension::setBaseDimension(const BaseDim& dim)
         delete d_value;
 
     d_value = dim.clone();
+    d_program.compile(d_value);
+}
+
+//----------------------------------------------------------------------------//
+float Dimension::getValue(const Window& wnd) const
+{
+    return d_program.evaluate(wnd);
+}
+
+//----------------------------------------------------------------------------//
+float Dimension::getValue(const Window& wnd, const Rectf& container) const
+{
+    return d_program.evaluate(wnd, container);
 }
 
 //----------------------------------------------------------------------------//
@@ -1220,18 +1242,18 @@ Rectf ComponentArea::getPixelRect(const Window& wnd) const
         assert(d_right_or_width.getDimensionType() == DimensionType::RightEdge || d_right_or_width.getDimensionType() == DimensionType::Width);
         assert(d_bottom_or_height.getDimensionType() == DimensionType::BottomEdge || d_bottom_or_height.getDimensionType() == DimensionType::Height);
 
-        pixelRect.left(d_left.getBaseDimension().getValue(wnd));
-        pixelRect.top(d_top.getBaseDimension().getValue(wnd));
+        pixelRect.left(d_left.getValue(wnd));
+        pixelRect.top(d_top.getValue(wnd));
 
         if (d_right_or_width.getDimensionType() == DimensionType::Width)
-            pixelRect.setWidth(d_right_or_width.getBaseDimension().getValue(wnd));
+            pixelRect.setWidth(d_right_or_width.getValue(wnd));
         else
-            pixelRect.right(d_right_or_width.getBaseDimension().getValue(wnd));
+            pixelRect.right(d_right_or_width.getValue(wnd));
 
         if (d_bottom_or_height.getDimensionType() == DimensionType::Height)
-            pixelRect.setHeight(d_bottom_or_height.getBaseDimension().getValue(wnd));
+            pixelRect.setHeight(d_bottom_or_height.getValue(wnd));
         else
-            pixelRect.bottom(d_bottom_or_height.getBaseDimension().getValue(wnd));
+            pixelRect.bottom(d_bottom_or_height.getValue(wnd));
     }
 
     return pixelRect;
@@ -1265,18 +1287,18 @@ Rectf ComponentArea::getPixelRect(const Window& wnd, const Rectf& container) con
         assert(d_right_or_width.getDimensionType() == DimensionType::RightEdge || d_right_or_width.getDimensionType() == DimensionType::Width);
         assert(d_bottom_or_height.getDimensionType() == DimensionType::BottomEdge || d_bottom_or_height.getDimensionType() == DimensionType::Height);
 
-        pixelRect.left(d_left.getBaseDimension().getValue(wnd, container) + container.left());
-        pixelRect.top(d_top.getBaseDimension().getValue(wnd, container) + container.top());
+        pixelRect.left(d_left.getValue(wnd, container) + container.left());
+        pixelRect.top(d_top.getValue(wnd, container) + container.top());
 
         if (d_right_or_width.getDimensionType() == DimensionType::Width)
-            pixelRect.setWidth(d_right_or_width.getBaseDimension().getValue(wnd, container));
+            pixelRect.setWidth(d_right_or_width.getValue(wnd, container));
         else
-            pixelRect.right(d_right_or_width.getBaseDimension().getValue(wnd, container) + container.left());
+            pixelRect.right(d_right_or_width.getValue(wnd, container) + container.left());
 
         if (d_bottom_or_height.getDimensionType() == DimensionType::Height)
-            pixelRect.setHeight(d_bottom_or_height.getBaseDimension().getValue(wnd, container));
+            pixelRect.setHeight(d_bottom_or_height.getValue(wnd, container));
         else
-            pixelRect.bottom(d_bottom_or_height.getBaseDimension().getValue(wnd, container) + container.top());
+            pixelRect.bottom(d_bottom_or_height.getValue(wnd, container) + container.top());
     }
 
     return pixelRect;
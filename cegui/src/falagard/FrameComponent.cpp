@@ -177,10 +177,12 @@ const Image* FrameComponent::getImage(FrameImageComponent imageComponent,
     if (!d_frameImages[frameImageIndex].d_specified)
         return nullptr;
 
-    if (d_frameImages[frameImageIndex].d_propertyName.empty())
-        return d_frameImages[frameImageIndex].d_image;
+    const FrameImageSource& source = d_frameImages[frameImageIndex];
+
+    if (source.d_propertyName.empty())
+        return source.getImage();
 
-    return wnd.getProperty<Image*>(d_frameImages[frameImageIndex].d_propertyName);
+    return source.d_propertyImage.getFromProperty(wnd, source.d_propertyName);
 }
 
 //----------------------------------------------------------------------------//
@@ -194,7 +196,7 @@ const Image* FrameComponent::getImage(FrameImageComponent imageComponent) const
         return nullptr;
 
     if (d_frameImages[frameImageIndex].d_propertyName.empty())
-        return d_frameImages[frameImageIndex].d_image;
+        return d_frameImages[frameImageIndex].getImage();
 
     return nullptr;
 }
@@ -207,6 +209,7 @@ void FrameComponent::setImage(FrameImageComponent part, const Image* image)
     const int frameImageIndex = static_cast<int>(part);
 
     d_frameImages[frameImageIndex].d_image = image;
+    d_frameImages[frameImageIndex].d_imageReference.setName(String());
     d_frameImages[frameImageIndex].d_specified = image != nullptr;
     d_frameImages[frameImageIndex].d_propertyName.clear();
 }
@@ -214,17 +217,22 @@ void FrameComponent::setImage(FrameImageComponent part, const Image* image)
 //----------------------------------------------------------------------------//
 void FrameComponent::setImage(FrameImageComponent part, const String& name)
 {
-    const Image* image;
-    try
+    if (!ImageManager::getSingleton().isDefined(name))
     {
-        image = &ImageManager::getSingleton().get(name);
-    }
-    catch (UnknownObjectException&)
-    {
-        image = nullptr;
+        setImage(part, static_cast<const Image*>(nullptr));
+        return;
     }
 
-    setImage(part, image);
+    assert(part < FrameImageComponent::FrameImageCount);
+
+    const int frameImageIndex = static_cast<int>(part);
+
+    // keep the name rather than the pointer so the image is found again
+    // through a cached handle should it be destroyed and recreated.
+    d_frameImages[frameImageIndex].d_image = nullptr;
+    d_frameImages[frameImageIndex].d_imageReference.setName(name);
+    d_frameImages[frameImageIndex].d_specified = true;
+    d_frameImages[frameImageIndex].d_propertyName.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -236,6 +244,7 @@ void FrameComponent::setImagePropertySource(FrameImageComponent part,
     const int frameImageIndex = static_cast<int>(part);
 
     d_frameImages[frameImageIndex].d_image = nullptr;
+    d_frameImages[frameImageIndex].d_imageReference.setName(String());
     d_frameImages[frameImageIndex].d_specified = !name.empty();
     d_frameImages[frameImageIndex].d_propertyName = name;
 }
@@ -724,7 +733,9 @@ void FrameComponent::writeXMLToStream(XMLSerializer& xml_stream) const
             if (d_frameImages[i].d_propertyName.empty())
                 xml_stream.openTag(Falagard_xmlHandler::ImageElement)
                     .attribute(Falagard_xmlHandler::ComponentAttribute, FalagardXMLHelper<FrameImageComponent>::toString(static_cast<FrameImageComponent>(i)))
-                    .attribute(Falagard_xmlHandler::NameAttribute, d_frameImages[i].d_image->getName())
+                    .attribute(Falagard_xmlHandler::NameAttribute,
+                        d_frameImages[i].d_image ? d_frameImages[i].d_image->getName() :
+                                                   d_frameImages[i].d_imageReference.getName())
                     .closeTag();
             else
                 xml_stream.openTag(Falagard_xmlHandler::ImagePropertyElement)
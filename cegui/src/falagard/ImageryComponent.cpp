@@ -48,24 +48,24 @@ namespace CEGUI
 
     const Image* ImageryComponent::getImage() const
     {
-        return d_image;
+        return d_imageReference.getName().empty() ?
+            d_image : d_imageReference.get();
     }
 
     void ImageryComponent::setImage(const Image* image)
     {
         d_image = image;
+        d_imageReference.setName(String());
     }
 
     void ImageryComponent::setImage(const String& name)
     {
-        try
-        {
-            d_image = &ImageManager::getSingleton().get(name);
-        }
-        catch (UnknownObjectException&)
-        {
-            d_image = nullptr;
-        }
+        d_image = nullptr;
+
+        // keep the name rather than the pointer so the image is found again
+        // through a cached handle should it be destroyed and recreated.
+        d_imageReference.setName(
+            ImageManager::getSingleton().isDefined(name) ? name : String());
     }
 
     VerticalImageFormatting ImageryComponent::getVerticalFormatting(const Window& wnd) const
@@ -126,8 +126,8 @@ namespace CEGUI
     {
         // get final image to use.
         const Image* img = isImageFetchedFromProperty() ?
-            srcWindow.getProperty<Image*>(d_imagePropertyName) :
-            d_image;
+            d_propertyImage.getFromProperty(srcWindow, d_imagePropertyName) :
+            getImage();
 
         // do not draw anything if image is not set.
         if (!img)
@@ -279,7 +279,8 @@ namespace CEGUI
                 .closeTag();
         else
             xml_stream.openTag(Falagard_xmlHandler::ImageElement)
-                .attribute(Falagard_xmlHandler::NameAttribute, d_image->getName())
+                .attribute(Falagard_xmlHandler::NameAttribute,
+                    d_image ? d_image->getName() : d_imageReference.getName())
                 .closeTag();
 
         // get base class to write colours
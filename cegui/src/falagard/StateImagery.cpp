@@ -27,6 +27,8 @@
 #include "CEGUI/falagard/StateImagery.h"
 #include "CEGUI/falagard/XMLHandler.h"
 #include "CEGUI/XMLSerializer.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/ColourRect.h"
 #include <algorithm> // sort
 
 namespace CEGUI
@@ -34,7 +36,8 @@ namespace CEGUI
 
 StateImagery::StateImagery(const String& name) :
     d_stateName(name),
-    d_clipToDisplay(false)
+    d_clipToDisplay(false),
+    d_opaque(false)
 {}
 
 void StateImagery::render(Window& srcWindow, const ColourRect* modcols, const Rectf* clipper) const
@@ -42,6 +45,9 @@ void StateImagery::render(Window& srcWindow, const ColourRect* modcols, const Re
     // render all layers defined for this state
     for (const auto& layer : d_layers)
         layer.render(srcWindow, modcols, d_clipToDisplay ? nullptr : clipper);
+
+    if (d_opaque && isOpaqueColours(modcols))
+        srcWindow.addOpaqueImageryArea(Rectf(glm::vec2(0.f, 0.f), srcWindow.getPixelSize()));
 }
 
 void StateImagery::render(Window& srcWindow, const Rectf& baseRect, const ColourRect* modcols, const Rectf* clipper) const
@@ -49,6 +55,16 @@ void StateImagery::render(Window& srcWindow, const Rectf& baseRect, const Colour
     // render all layers defined for this state
     for (const auto& layer : d_layers)
         layer.render(srcWindow, baseRect, modcols, d_clipToDisplay ? nullptr : clipper);
+
+    if (d_opaque && isOpaqueColours(modcols))
+        srcWindow.addOpaqueImageryArea(baseRect);
+}
+
+bool StateImagery::isOpaqueColours(const ColourRect* modcols)
+{
+    return !modcols ||
+        (modcols->d_top_left.getAlpha() >= 1.f && modcols->d_top_right.getAlpha() >= 1.f &&
+         modcols->d_bottom_left.getAlpha() >= 1.f && modcols->d_bottom_right.getAlpha() >= 1.f);
 }
 
 void StateImagery::addLayer(const LayerSpecification& layer)
@@ -88,6 +104,16 @@ void StateImagery::setClippedToDisplay(bool setting)
     d_clipToDisplay = setting;
 }
 
+bool StateImagery::isOpaque() const
+{
+    return d_opaque;
+}
+
+void StateImagery::setOpaque(bool setting)
+{
+    d_opaque = setting;
+}
+
 void StateImagery::writeXMLToStream(XMLSerializer& xml_stream) const
 {
     xml_stream.openTag(Falagard_xmlHandler::StateImageryElement)
@@ -96,6 +122,9 @@ void StateImagery::writeXMLToStream(XMLSerializer& xml_stream) const
     if (d_clipToDisplay)
         xml_stream.attribute(Falagard_xmlHandler::ClippedAttribute, PropertyHelper<bool>::ValueFalse);
 
+    if (d_opaque)
+        xml_stream.attribute(Falagard_xmlHandler::OpaqueAttribute, PropertyHelper<bool>::ValueTrue);
+
     // output all layers defined for this state
     for(LayerSpecificationList::const_iterator curr = d_layers.begin(); curr != d_layers.end(); ++curr)
         (*curr).writeXMLToStream(xml_stream);
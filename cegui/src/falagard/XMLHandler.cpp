@@ -119,6 +119,7 @@ namespace CEGUI
     const String Falagard_xmlHandler::FontAttribute("font");
     const String Falagard_xmlHandler::InitialValueAttribute("initialValue");
     const String Falagard_xmlHandler::ClippedAttribute("clipped");
+    const String Falagard_xmlHandler::OpaqueAttribute("opaque");
     const String Falagard_xmlHandler::OperatorAttribute("op");
     const String Falagard_xmlHandler::PaddingAttribute("padding");
     const String Falagard_xmlHandler::LayoutOnWriteAttribute("layoutOnWrite");
@@ -512,6 +513,7 @@ namespace CEGUI
 
         d_stateimagery = new StateImagery(attributes.getValueAsString(NameAttribute));
         d_stateimagery->setClippedToDisplay(!attributes.getValueAsBool(ClippedAttribute, true));
+        d_stateimagery->setOpaque(attributes.getValueAsBool(OpaqueAttribute, false));
 
         CEGUI_LOGINSANE("-----> Start of definition for imagery for state '" + d_stateimagery->getName() + "'.");
     }
@@ -182,6 +182,22 @@ void SVGPolygon::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     SVGTesselator::tesselatePolygon(out, this, render_settings);
 }
 
+//----------------------------------------------------------------------------//
+SVGPath::SVGPath(const SVGPaintStyle& paint_style,
+                 const glm::mat3x3& transformation,
+                 const std::vector<Command>& commands) :
+    SVGBasicShape(paint_style, transformation),
+    d_commands(commands)
+{
+}
+
+//----------------------------------------------------------------------------//
+void SVGPath::createRenderGeometry(std::vector<GeometryBuffer*>& out,
+    const SVGImage::SVGImageRenderSettings& render_settings) const
+{
+    SVGTesselator::tesselatePath(out, this, render_settings);
+}
+
 //----------------------------------------------------------------------------//
 }
 
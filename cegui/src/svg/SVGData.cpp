@@ -35,6 +35,9 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/XMLAttributes.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
@@ -53,6 +56,7 @@ const String SVGEllipseElement( "ellipse" );
 const String SVGLineElement( "line" );
 const String SVGPolylineElement( "polyline" );
 const String SVGPolygonElement( "polygon" );
+const String SVGPathElement( "path" );
 
 // SVG graphics elements paint attributes
 const String SVGGraphicsElementAttributeFill( "fill" );
@@ -88,17 +92,148 @@ const String SVGEllipseAttributeRX( "rx" );
 const String SVGEllipseAttributeRY( "ry" );
 // SVG 'polyline' element attributes
 const String SVGPolylineAttributePoints( "points" );
+
+const String SVGPathAttributeData( "d" );
 // SVG 'polyline' element attributes
 const String SVGLineAttributeX1( "x1" );
 const String SVGLineAttributeY1( "y1" );
 const String SVGLineAttributeX2( "x2" );
 const String SVGLineAttributeY2( "y2" );
 
+//----------------------------------------------------------------------------//
+static std::uint64_t createRevision()
+{
+    static std::uint64_t lastRevision = 0;
+    return ++lastRevision;
+}
+
+//----------------------------------------------------------------------------//
+static bool isPathWhitespace(const String& data, size_t pos)
+{
+    return data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\n' || data[pos] == '\r';
+}
+
+//----------------------------------------------------------------------------//
+static void skipPathWhitespace(const String& data, size_t& pos)
+{
+    while (pos < data.length() && isPathWhitespace(data, pos))
+        ++pos;
+}
+
+//----------------------------------------------------------------------------//
+// Skips whitespace and at most one comma separating two values of the path data
+static void skipPathSeparator(const String& data, size_t& pos)
+{
+    skipPathWhitespace(data, pos);
+    if (pos < data.length() && data[pos] == ',')
+    {
+        ++pos;
+        skipPathWhitespace(data, pos);
+    }
+}
+
+//----------------------------------------------------------------------------//
+static bool isPathDigit(const String& data, size_t pos)
+{
+    return pos < data.length() && data[pos] >= '0' && data[pos] <= '9';
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Reads a number as defined by the path data grammar. Numbers don't need to
+    be separated if this is unambiguous, for example "10-5" or "0.5.5" contain
+    two numbers each, so the stream operators can't be used here.
+*/
+static bool readPathNumber(const String& data, size_t& pos, float& value)
+{
+    size_t cur = pos;
+    double sign = 1.0;
+    if (cur < data.length() && (data[cur] == '+' || data[cur] == '-'))
+    {
+        sign = (data[cur] == '-') ? -1.0 : 1.0;
+        ++cur;
+    }
+
+    double mantissa = 0.0;
+    bool hasDigits = false;
+    while (isPathDigit(data, cur))
+    {
+        mantissa = mantissa * 10.0 + (data[cur] - '0');
+        hasDigits = true;
+        ++cur;
+    }
+
+    if (cur < data.length() && data[cur] == '.')
+    {
+        ++cur;
+        double scale = 0.1;
+        while (isPathDigit(data, cur))
+        {
+            mantissa += (data[cur] - '0') * scale;
+            scale *= 0.1;
+            hasDigits = true;
+            ++cur;
+        }
+    }
+
+    if (!hasDigits)
+        return false;
+
+    // The exponent is only consumed if it is complete
+    if (cur < data.length() && (data[cur] == 'e' || data[cur] == 'E'))
+    {
+        size_t expPos = cur + 1;
+        int expSign = 1;
+        if (expPos < data.length() && (data[expPos] == '+' || data[expPos] == '-'))
+        {
+            expSign = (data[expPos] == '-') ? -1 : 1;
+            ++expPos;
+        }
+
+        if (isPathDigit(data, expPos))
+        {
+            int exponent = 0;
+            while (isPathDigit(data, expPos))
+            {
+                exponent = std::min(exponent * 10 + static_cast<int>(data[expPos] - '0'), 1000);
+                ++expPos;
+            }
+
+            mantissa *= std::pow(10.0, expSign * exponent);
+            cur = expPos;
+        }
+    }
+
+    value = static_cast<float>(sign * mantissa);
+    pos = cur;
+    skipPathSeparator(data, pos);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+static bool readPathFlag(const String& data, size_t& pos, bool& flag)
+{
+    if (pos >= data.length() || (data[pos] != '0' && data[pos] != '1'))
+        return false;
+
+    flag = data[pos] == '1';
+    ++pos;
+    skipPathSeparator(data, pos);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+static bool readPathPoint(const String& data, size_t& pos, glm::vec2& point)
+{
+    return readPathNumber(data, pos, point.x) && readPathNumber(data, pos, point.y);
+}
+
 //----------------------------------------------------------------------------//
 SVGData::SVGData(const String& name)
     : d_name(name)
     , d_width(0.f)
     , d_height(0.f)
+    , d_revision(createRevision())
 {
 }
 
@@ -106,7 +241,8 @@ SVGData::SVGData(const String& name)
 SVGData::SVGData(const String& name,
                  const String& filename,
                  const String& resourceGroup) :
-    d_name(name)
+    d_name(name),
+    d_revision(createRevision())
 {
     loadFromFile(filename, resourceGroup);
 }
@@ -136,6 +272,7 @@ void SVGData::loadFromFile(const String& file_name,
 void SVGData::addShape(SVGBasicShape* svg_shape)
 {
     d_svgBasicShapes.push_back(svg_shape);
+    d_revision = createRevision();
 }
 
 //----------------------------------------------------------------------------//
@@ -145,6 +282,13 @@ void SVGData::destroyShapes()
         delete shape;
 
     d_svgBasicShapes.clear();
+    d_revision = createRevision();
+}
+
+//----------------------------------------------------------------------------//
+void SVGData::notifyShapesChanged()
+{
+    d_revision = createRevision();
 }
 
 //----------------------------------------------------------------------------//
@@ -217,6 +361,11 @@ void SVGData::elementStartLocal(const String& element,
     {
         elementSVGPolygon(attributes);
     }
+    // handle SVG 'path' element
+    else if(element == SVGPathElement)
+    {
+        elementSVGPath(attributes);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -378,6 +527,22 @@ void SVGData::elementSVGPolygon(const XMLAttributes& attributes)
     addShape(polygon);
 }
 
+//----------------------------------------------------------------------------//
+void SVGData::elementSVGPath(const XMLAttributes& attributes)
+{
+    SVGPaintStyle paint_style = parsePaintStyle(attributes);
+    glm::mat3x3 transform = parseTransform(attributes);
+
+    const String pathDataString(
+        attributes.getValueAsString(SVGPathAttributeData, ""));
+
+    std::vector<SVGPath::Command> commands;
+    parsePathData(pathDataString, commands);
+
+    SVGPath* path = new SVGPath(paint_style, transform, commands);
+    addShape(path);
+}
+
 //----------------------------------------------------------------------------//
 void SVGData::elementEndLocal(const String& /*element*/)
 {
@@ -908,5 +1073,181 @@ void SVGData::parsePointsString(const String& pointsString, std::vector<glm::vec
 }
 
 //----------------------------------------------------------------------------//
+//----------------------------------------------------------------------------//
+void SVGData::parsePathData(const String& pathDataString, std::vector<SVGPath::Command>& commands)
+{
+    size_t pos = 0;
+    skipPathWhitespace(pathDataString, pos);
+
+    // An empty path disables rendering of the element
+    if (pos == pathDataString.length())
+        return;
+
+    if (pathDataString[pos] != 'M' && pathDataString[pos] != 'm')
+        throw SVGParsingException("SVG file parsing was aborted because the SVG path data "
+                                  "does not start with a 'moveto' command: " + pathDataString);
+
+    glm::vec2 currentPoint(0.0f);
+    glm::vec2 subpathStart(0.0f);
+    // The control point reflected by the smooth curve commands, and the type of curve it belongs to
+    glm::vec2 lastControlPoint(0.0f);
+    SVGPath::CommandType lastCurveType = SVGPath::CommandType::Count;
+    bool subpathClosed = false;
+    char commandChar = 0;
+
+    while (pos < pathDataString.length())
+    {
+        const bool isNewCommand = !isPathDigit(pathDataString, pos) &&
+            pathDataString[pos] != '-' && pathDataString[pos] != '+' && pathDataString[pos] != '.';
+
+        if (isNewCommand)
+        {
+            commandChar = static_cast<char>(pathDataString[pos]);
+            ++pos;
+            skipPathWhitespace(pathDataString, pos);
+        }
+        // Values following a closepath must belong to a new command
+        else if (commandChar == 'Z' || commandChar == 'z')
+            throw SVGParsingException("SVG file parsing was aborted because of an invalid value "
+                                      "in the SVG path data (values following 'closepath'): " +
+                                      pathDataString);
+
+        const bool isRelative = commandChar >= 'a' && commandChar <= 'z';
+        const glm::vec2 origin = isRelative ? currentPoint : glm::vec2(0.0f);
+
+        SVGPath::Command command;
+        bool isValid = true;
+
+        switch (commandChar)
+        {
+        case 'M':
+        case 'm':
+            command.d_type = SVGPath::CommandType::MoveTo;
+            isValid = readPathPoint(pathDataString, pos, command.d_point);
+            command.d_point += origin;
+            subpathStart = command.d_point;
+            subpathClosed = false;
+            // Subsequent pairs of coordinates are implicit 'lineto' commands
+            commandChar = isRelative ? 'l' : 'L';
+            break;
+
+        case 'L':
+        case 'l':
+            command.d_type = SVGPath::CommandType::LineTo;
+            isValid = readPathPoint(pathDataString, pos, command.d_point);
+            command.d_point += origin;
+            break;
+
+        case 'H':
+        case 'h':
+            command.d_type = SVGPath::CommandType::LineTo;
+            command.d_point = currentPoint;
+            isValid = readPathNumber(pathDataString, pos, command.d_point.x);
+            command.d_point.x += origin.x;
+            break;
+
+        case 'V':
+        case 'v':
+            command.d_type = SVGPath::CommandType::LineTo;
+            command.d_point = currentPoint;
+            isValid = readPathNumber(pathDataString, pos, command.d_point.y);
+            command.d_point.y += origin.y;
+            break;
+
+        case 'C':
+        case 'c':
+            command.d_type = SVGPath::CommandType::CubicTo;
+            isValid = readPathPoint(pathDataString, pos, command.d_control1) &&
+                      readPathPoint(pathDataString, pos, command.d_control2) &&
+                      readPathPoint(pathDataString, pos, command.d_point);
+            command.d_control1 += origin;
+            command.d_control2 += origin;
+            command.d_point += origin;
+            break;
+
+        case 'S':
+        case 's':
+            command.d_type = SVGPath::CommandType::CubicTo;
+            command.d_control1 = (lastCurveType == SVGPath::CommandType::CubicTo) ?
+                2.0f * currentPoint - lastControlPoint : currentPoint;
+            isValid = readPathPoint(pathDataString, pos, command.d_control2) &&
+                      readPathPoint(pathDataString, pos, command.d_point);
+            command.d_control2 += origin;
+            command.d_point += origin;
+            break;
+
+        case 'Q':
+        case 'q':
+            command.d_type = SVGPath::CommandType::QuadraticTo;
+            isValid = readPathPoint(pathDataString, pos, command.d_control1) &&
+                      readPathPoint(pathDataString, pos, command.d_point);
+            command.d_control1 += origin;
+            command.d_point += origin;
+            break;
+
+        case 'T':
+        case 't':
+            command.d_type = SVGPath::CommandType::QuadraticTo;
+            command.d_control1 = (lastCurveType == SVGPath::CommandType::QuadraticTo) ?
+                2.0f * currentPoint - lastControlPoint : currentPoint;
+            isValid = readPathPoint(pathDataString, pos, command.d_point);
+            command.d_point += origin;
+            break;
+
+        case 'A':
+        case 'a':
+            command.d_type = SVGPath::CommandType::ArcTo;
+            isValid = readPathPoint(pathDataString, pos, command.d_radii) &&
+                      readPathNumber(pathDataString, pos, command.d_xAxisRotation) &&
+                      readPathFlag(pathDataString, pos, command.d_largeArc) &&
+                      readPathFlag(pathDataString, pos, command.d_sweep) &&
+                      readPathPoint(pathDataString, pos, command.d_point);
+            command.d_point += origin;
+            break;
+
+        case 'Z':
+        case 'z':
+            command.d_type = SVGPath::CommandType::ClosePath;
+            break;
+
+        default:
+            throw SVGParsingException("SVG file parsing was aborted because of an unknown command "
+                                      "in the SVG path data: " + pathDataString);
+        }
+
+        if (!isValid)
+            throw SVGParsingException("SVG file parsing was aborted because of an invalid value "
+                                      "in the SVG path data (missing or invalid parameters): " +
+                                      pathDataString);
+
+        if (command.d_type == SVGPath::CommandType::ClosePath)
+        {
+            commands.push_back(command);
+            currentPoint = subpathStart;
+            subpathClosed = true;
+            lastCurveType = SVGPath::CommandType::Count;
+            continue;
+        }
+
+        // A drawing command following a closepath starts a new subpath at the start of the closed one
+        if (subpathClosed && command.d_type != SVGPath::CommandType::MoveTo)
+        {
+            SVGPath::Command moveTo;
+            moveTo.d_point = subpathStart;
+            commands.push_back(moveTo);
+        }
+        subpathClosed = false;
+
+        if (command.d_type == SVGPath::CommandType::CubicTo)
+            lastControlPoint = command.d_control2;
+        else if (command.d_type == SVGPath::CommandType::QuadraticTo)
+            lastControlPoint = command.d_control1;
+        lastCurveType = command.d_type;
+
+        currentPoint = command.d_point;
+        commands.push_back(command);
+    }
 }
 
+//----------------------------------------------------------------------------//
+}
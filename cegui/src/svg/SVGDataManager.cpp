@@ -27,6 +27,7 @@
 
 #include "CEGUI/svg/SVGDataManager.h"
 #include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGRasterCache.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/SharedStringStream.h"
@@ -39,7 +40,8 @@ template<> SVGDataManager* Singleton<SVGDataManager>::ms_Singleton = nullptr;
 
 
 //----------------------------------------------------------------------------//
-SVGDataManager::SVGDataManager()
+SVGDataManager::SVGDataManager() :
+    d_rasterCache(new SVGRasterCache())
 {
 
 }
@@ -48,6 +50,7 @@ SVGDataManager::SVGDataManager()
 SVGDataManager::~SVGDataManager()
 {
     destroyAll();
+    delete d_rasterCache;
 }
 
 //----------------------------------------------------------------------------//
@@ -30,7 +30,13 @@
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/svg/SVGBasicShape.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/svg/SVGRasterCache.h"
+#include "CEGUI/BitmapImage.h"
 #include "CEGUI/XMLAttributes.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <algorithm>
 
 namespace CEGUI
 {
@@ -47,11 +53,22 @@ const String ImageAutoScaledAttribute( "autoScaled" );
 const String ImageNativeHorzResAttribute( "nativeHorzRes" );
 const String ImageNativeVertResAttribute( "nativeVertRes" );
 
+//! Memory the geometry caches of all SVGImages may use together
+static size_t GeometryCacheBudget = 4 * 1024 * 1024;
+//! Memory used by the geometry caches of all SVGImages
+static size_t GeometryCacheMemoryUsage = 0;
+//! SVGImages holding cached geometry, searched for the least recently used entry
+static std::vector<const SVGImage*> GeometryCacheImages;
+//! Counter used to find the least recently used cache entry of all SVGImages
+static std::uint64_t GeometryCacheUseCounter = 0;
+
 //----------------------------------------------------------------------------//
 SVGImage::SVGImage(const String& name) :
     Image(name),
     d_svgData(nullptr),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_useRasterCache(false),
+    d_cachedRevision(0)
 {
 }
 
@@ -64,7 +81,9 @@ SVGImage::SVGImage(const String& name, SVGData& svg_data) :
           AutoScaledMode::Disabled,
           Sizef(640, 480)),
     d_svgData(&svg_data),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_useRasterCache(false),
+    d_cachedRevision(0)
 {
 }
 
@@ -82,14 +101,25 @@ SVGImage::SVGImage(const XMLAttributes& attributes) :
                 static_cast<float>(attributes.getValueAsInteger(ImageNativeVertResAttribute, 480)))),
     d_svgData(&SVGDataManager::getSingleton().getSVGData(
               attributes.getValueAsString(ImageSVGDataAttribute))),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_useRasterCache(false),
+    d_cachedRevision(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SVGImage::~SVGImage()
 {
+    clearGeometryCache();
+    releaseRasterCache();
 }
 
 //----------------------------------------------------------------------------//
 void SVGImage::setSVGData(SVGData* svg_Data)
 {
     d_svgData = svg_Data;
+    clearGeometryCache();
+    releaseRasterCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -100,7 +130,7 @@ SVGData* SVGImage::getSVGData()
 
 //----------------------------------------------------------------------------//
 void SVGImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
-    const ImageRenderSettings& renderSettings, size_t /*canCombineFromIdx*/) const
+    const ImageRenderSettings& renderSettings, size_t canCombineFromIdx) const
 {
     //!!!FIXME: not used for anything but early exit! Is it intended?!
     {
@@ -117,13 +147,226 @@ void SVGImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
             return;
     }
 
+    if (!d_svgData)
+        return;
+
     const glm::vec2 scaleImgToDest(renderSettings.d_destArea.getWidth() / d_imageArea.getWidth(),
         renderSettings.d_destArea.getHeight() / d_imageArea.getHeight());
     const SVGImageRenderSettings svgSettings(renderSettings, scaleImgToDest, d_useGeometryAntialiasing);
 
-    // TODO: can use single buffer or at least combine something?
+    if (d_useRasterCache)
+    {
+        SVGRasterCache& rasterCache = SVGDataManager::getSingleton().getRasterCache();
+        if (const BitmapImage* raster = rasterCache.getRasterisedImage(*this, scaleImgToDest))
+        {
+            ImageRenderSettings rasterSettings(renderSettings);
+            rasterSettings.d_destArea.offset(d_scaledOffset);
+
+            const size_t firstNewBuffer = out.size();
+            raster->createRenderGeometry(out, rasterSettings, canCombineFromIdx);
+
+            // The rasterised image holds premultiplied colours, like the
+            // texture of a RenderingWindow
+            for (size_t i = firstNewBuffer; i < out.size(); ++i)
+                out[i]->setBlendMode(BlendMode::RttPremultiplied);
+
+            return;
+        }
+    }
+
+    createShapeGeometry(out, svgSettings);
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::createShapeGeometry(std::vector<GeometryBuffer*>& out,
+    const SVGImageRenderSettings& svgSettings) const
+{
+    const CachedGeometry& geometry = getCachedGeometry(svgSettings);
+
+    // The cached vertices don't depend on the position, clipping or alpha
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    for (const CachedBatch& batch : geometry.d_batches)
+    {
+        GeometryBuffer& buffer = renderer.createGeometryBufferColoured();
+
+        if (svgSettings.d_clipArea)
+        {
+            buffer.setClippingActive(true);
+            buffer.setClippingRegion(*svgSettings.d_clipArea);
+        }
+        else
+            buffer.setClippingActive(false);
+
+        buffer.setScale(svgSettings.d_scaleFactor);
+        buffer.setAlpha(svgSettings.d_alpha);
+        buffer.setStencilRenderingActive(batch.d_fillRule);
+        buffer.setStencilPostRenderingVertexCount(batch.d_postStencilVertexCount);
+        buffer.appendGeometry(batch.d_vertices.data(), batch.d_vertices.size());
+
+        out.push_back(&buffer);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const SVGImage::CachedGeometry& SVGImage::getCachedGeometry(
+    const SVGImageRenderSettings& svgSettings) const
+{
+    if (d_svgData->getRevision() != d_cachedRevision)
+    {
+        clearGeometryCache();
+        d_cachedRevision = d_svgData->getRevision();
+    }
+
+    // Stroke widths, anti-aliasing offsets and the number of segments of
+    // curves depend on the scale, so it is part of the key.
+    for (CachedGeometry& geometry : d_geometryCache)
+    {
+        if (geometry.d_scaleFactor == svgSettings.d_scaleFactor &&
+            geometry.d_antiAliasing == svgSettings.d_antiAliasing)
+        {
+            geometry.d_lastUse = ++GeometryCacheUseCounter;
+            return geometry;
+        }
+    }
+
+    CachedGeometry geometry;
+    geometry.d_scaleFactor = svgSettings.d_scaleFactor;
+    geometry.d_antiAliasing = svgSettings.d_antiAliasing;
+    geometry.d_lastUse = ++GeometryCacheUseCounter;
+    tessellate(geometry, svgSettings);
+
+    // Doesn't fit even after discarding everything that is cached
+    if (geometry.d_bytes > GeometryCacheBudget)
+    {
+        d_uncachedGeometry = std::move(geometry);
+        return d_uncachedGeometry;
+    }
+
+    while (GeometryCacheMemoryUsage + geometry.d_bytes > GeometryCacheBudget)
+        evictGeometryCacheEntry();
+
+    if (d_geometryCache.empty())
+        GeometryCacheImages.push_back(this);
+
+    GeometryCacheMemoryUsage += geometry.d_bytes;
+    d_geometryCache.push_back(std::move(geometry));
+    return d_geometryCache.back();
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::tessellate(CachedGeometry& geometry,
+                          const SVGImageRenderSettings& svgSettings) const
+{
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    std::vector<GeometryBuffer*> buffers;
     for (const SVGBasicShape* currentShape : d_svgData->getShapes())
-        currentShape->createRenderGeometry(out, svgSettings);
+        currentShape->createRenderGeometry(buffers, svgSettings);
+
+    geometry.d_bytes = sizeof(CachedGeometry);
+    for (GeometryBuffer* buffer : buffers)
+    {
+        const std::vector<float>& vertices = buffer->getVertexData();
+        if (!vertices.empty())
+        {
+            // Consecutive buffers drawn without the stencil are merged into one
+            const bool mergeable = buffer->getPolygonFillRule() == PolygonFillRule::NoFilling;
+            if (!mergeable || geometry.d_batches.empty() ||
+                geometry.d_batches.back().d_fillRule != PolygonFillRule::NoFilling)
+            {
+                CachedBatch batch;
+                batch.d_fillRule = buffer->getPolygonFillRule();
+                batch.d_postStencilVertexCount = buffer->getStencilPostRenderingVertexCount();
+                geometry.d_batches.push_back(std::move(batch));
+            }
+
+            // Bake the shape's transformation into the vertices, so that shapes
+            // with different transformations can share a buffer.
+            std::vector<float>& dest = geometry.d_batches.back().d_vertices;
+            const size_t start = dest.size();
+            dest.insert(dest.end(), vertices.begin(), vertices.end());
+
+            const glm::mat4& transform = buffer->getCustomTransform();
+            for (size_t i = start; i < dest.size(); i += GeometryBuffer::COLORED_VERTEX_FLOAT_COUNT)
+            {
+                const glm::vec4 position = transform * glm::vec4(dest[i], dest[i + 1], dest[i + 2], 1.0f);
+                dest[i] = position.x;
+                dest[i + 1] = position.y;
+                dest[i + 2] = position.z;
+            }
+        }
+
+        renderer.destroyGeometryBuffer(*buffer);
+    }
+
+    for (CachedBatch& batch : geometry.d_batches)
+    {
+        batch.d_vertices.shrink_to_fit();
+        geometry.d_bytes += sizeof(CachedBatch) + batch.d_vertices.size() * sizeof(float);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::evictGeometryCacheEntry()
+{
+    const SVGImage* oldestImage = nullptr;
+    std::vector<CachedGeometry>::iterator oldest;
+    for (const SVGImage* image : GeometryCacheImages)
+    {
+        for (auto it = image->d_geometryCache.begin(); it != image->d_geometryCache.end(); ++it)
+        {
+            if (!oldestImage || it->d_lastUse < oldest->d_lastUse)
+            {
+                oldestImage = image;
+                oldest = it;
+            }
+        }
+    }
+
+    if (!oldestImage)
+        return;
+
+    GeometryCacheMemoryUsage -= oldest->d_bytes;
+    oldestImage->d_geometryCache.erase(oldest);
+
+    if (oldestImage->d_geometryCache.empty())
+        GeometryCacheImages.erase(std::find(GeometryCacheImages.begin(),
+                                            GeometryCacheImages.end(), oldestImage));
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::clearGeometryCache() const
+{
+    if (!d_geometryCache.empty())
+        GeometryCacheImages.erase(std::find(GeometryCacheImages.begin(),
+                                            GeometryCacheImages.end(), this));
+
+    for (const CachedGeometry& geometry : d_geometryCache)
+        GeometryCacheMemoryUsage -= geometry.d_bytes;
+
+    d_geometryCache.clear();
+    d_uncachedGeometry.d_batches.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::setGeometryCacheBudget(size_t bytes)
+{
+    GeometryCacheBudget = bytes;
+
+    while (GeometryCacheMemoryUsage > GeometryCacheBudget && !GeometryCacheImages.empty())
+        evictGeometryCacheEntry();
+}
+
+//----------------------------------------------------------------------------//
+size_t SVGImage::getGeometryCacheBudget()
+{
+    return GeometryCacheBudget;
+}
+
+//----------------------------------------------------------------------------//
+size_t SVGImage::getGeometryCacheMemoryUsage()
+{
+    return GeometryCacheMemoryUsage;
 }
 
 //----------------------------------------------------------------------------//
@@ -138,6 +381,31 @@ void SVGImage::setUseGeometryAntialiasing(bool use_geometry_antialiasing)
     d_useGeometryAntialiasing = use_geometry_antialiasing;
 }
 
+//----------------------------------------------------------------------------//
+bool SVGImage::getUsesRasterCache() const
+{
+    return d_useRasterCache;
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::setUseRasterCache(bool use_raster_cache)
+{
+    if (d_useRasterCache == use_raster_cache)
+        return;
+
+    d_useRasterCache = use_raster_cache;
+    releaseRasterCache();
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::releaseRasterCache() const
+{
+    // The SVGDataManager is destroyed after the ImageManager, but images that
+    // are not managed might outlive it.
+    if (SVGDataManager* manager = SVGDataManager::getSingletonPtr())
+        manager->getRasterCache().releaseImage(*this);
+}
+
 //----------------------------------------------------------------------------//
 }
 
@@ -0,0 +1,377 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Atlas of rasterised SVGImages
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/svg/SVGRasterCache.h"
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/PropertyHelper.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SVGRasterCache::SVGRasterCache() :
+    d_pageSize(1024.0f, 1024.0f)
+{
+}
+
+//----------------------------------------------------------------------------//
+SVGRasterCache::~SVGRasterCache()
+{
+    for (auto& pair : d_entries)
+        for (const Entry& entry : pair.second)
+            delete entry.d_bitmap;
+
+    if (!d_pages.empty())
+    {
+        Renderer& renderer = d_pages.front().d_target->getOwner();
+        for (Page& page : d_pages)
+            renderer.destroyTextureTarget(page.d_target);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const BitmapImage* SVGRasterCache::getRasterisedImage(const SVGImage& image,
+                                                      const glm::vec2& scale)
+{
+    const SVGData* data = image.d_svgData;
+    const Rectf& imageArea = image.getImageArea();
+    if (!data || d_texturesUnavailable || imageArea.empty() ||
+        scale.x <= 0.0f || scale.y <= 0.0f)
+        return nullptr;
+
+    const int levelX = getScaleLevel(scale.x, d_levelsPerOctave);
+    const int levelY = getScaleLevel(scale.y, d_levelsPerOctave);
+    const bool antiAliasing = image.getUsesGeometryAntialiasing();
+
+    std::vector<Entry>& entries = d_entries[&image];
+
+    // Versions of the image before its SVGData changed won't be used again
+    for (std::size_t i = 0; i < entries.size(); )
+    {
+        if (entries[i].d_revision != data->getRevision())
+        {
+            releaseEntry(entries[i]);
+            entries.erase(entries.begin() + i);
+        }
+        else
+            ++i;
+    }
+
+    for (const Entry& entry : entries)
+        if (entry.d_levelX == levelX && entry.d_levelY == levelY &&
+            entry.d_antiAliasing == antiAliasing)
+            return entry.d_bitmap;
+
+    const Sizef size(
+        std::ceil(imageArea.getWidth() * getLevelScale(levelX, d_levelsPerOctave)),
+        std::ceil(imageArea.getHeight() * getLevelScale(levelY, d_levelsPerOctave)));
+
+    std::size_t pageIndex;
+    Rectf area;
+    if (!allocate(size, pageIndex, area))
+    {
+        if (entries.empty())
+            d_entries.erase(&image);
+
+        return nullptr;
+    }
+
+    Page& page = d_pages[pageIndex];
+    rasterise(image, page, area, antiAliasing);
+
+    // With a flipped texture coordinate system the area ends up upside down
+    // in the texture. An inverted image area makes BitmapImage flip it back.
+    Rectf textureArea(area);
+    Renderer& renderer = page.d_target->getOwner();
+    if (renderer.isTexCoordSystemFlipped())
+    {
+        const float height = page.d_target->getArea().getHeight();
+        textureArea = Rectf(area.left(), height - area.top(),
+                            area.right(), height - area.bottom());
+    }
+
+    Entry entry;
+    entry.d_levelX = levelX;
+    entry.d_levelY = levelY;
+    entry.d_antiAliasing = antiAliasing;
+    entry.d_revision = data->getRevision();
+    entry.d_page = pageIndex;
+    entry.d_bitmap = new BitmapImage(
+        "__svg_raster_" + PropertyHelper<std::uint32_t>::toString(d_imageCounter++),
+        &page.d_target->getTexture(), textureArea, glm::vec2(0.0f, 0.0f),
+        AutoScaledMode::Disabled, Sizef(640.0f, 480.0f));
+
+    entries.push_back(entry);
+    ++page.d_imageCount;
+    ++d_rasterisationCount;
+
+    return entry.d_bitmap;
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasterCache::releaseImage(const SVGImage& image)
+{
+    auto it = d_entries.find(&image);
+    if (it == d_entries.end())
+        return;
+
+    for (const Entry& entry : it->second)
+        releaseEntry(entry);
+
+    d_entries.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasterCache::clear()
+{
+    for (auto& pair : d_entries)
+        for (const Entry& entry : pair.second)
+            delete entry.d_bitmap;
+
+    d_entries.clear();
+
+    if (!d_pages.empty())
+    {
+        Renderer& renderer = d_pages.front().d_target->getOwner();
+        for (Page& page : d_pages)
+            renderer.destroyTextureTarget(page.d_target);
+
+        d_pages.clear();
+    }
+
+    d_texturesUnavailable = false;
+
+    if (System* system = System::getSingletonPtr())
+        system->invalidateAllCachedRendering();
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGRasterCache::getUsedMemory() const
+{
+    std::size_t bytes = 0;
+    for (const Page& page : d_pages)
+    {
+        const Sizef& size = page.d_target->getArea().getSize();
+        bytes += static_cast<std::size_t>(size.d_width) *
+                 static_cast<std::size_t>(size.d_height) * 4;
+    }
+
+    return bytes;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGRasterCache::getEntryCount() const
+{
+    std::size_t count = 0;
+    for (const auto& pair : d_entries)
+        count += pair.second.size();
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+std::size_t SVGRasterCache::getEntryCount(const SVGImage& image) const
+{
+    auto it = d_entries.find(&image);
+    return (it != d_entries.end()) ? it->second.size() : 0;
+}
+
+//----------------------------------------------------------------------------//
+int SVGRasterCache::getScaleLevel(float scale, std::uint32_t levelsPerOctave)
+{
+    // The tolerance keeps exact levels, e.g. a scale of 1, from being rounded
+    // up to the next level because of floating point error.
+    return static_cast<int>(std::ceil(std::log2(scale) * levelsPerOctave - 0.001f));
+}
+
+//----------------------------------------------------------------------------//
+float SVGRasterCache::getLevelScale(int level, std::uint32_t levelsPerOctave)
+{
+    return std::exp2(static_cast<float>(level) / levelsPerOctave);
+}
+
+//----------------------------------------------------------------------------//
+bool SVGRasterCache::allocate(const Sizef& size, std::size_t& pageIndex, Rectf& area)
+{
+    const std::uint32_t width = static_cast<std::uint32_t>(size.d_width) + ImageGutter * 2;
+    const std::uint32_t height = static_cast<std::uint32_t>(size.d_height) + ImageGutter * 2;
+
+    for (pageIndex = 0; pageIndex < d_pages.size(); ++pageIndex)
+        if (allocateOnPage(d_pages[pageIndex], width, height, area))
+            return true;
+
+    if (width > d_pageSize.d_width || height > d_pageSize.d_height)
+        return false;
+
+    const std::size_t pageBytes = static_cast<std::size_t>(d_pageSize.d_width) *
+                                  static_cast<std::size_t>(d_pageSize.d_height) * 4;
+    if (getUsedMemory() + pageBytes > d_memoryBudget)
+        return false;
+
+    // The stencil buffer is needed for the fills of paths and polygons
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    TextureTarget* target = renderer.createTextureTarget(true);
+    if (!target)
+    {
+        d_texturesUnavailable = true;
+        return false;
+    }
+
+    target->declareRenderSize(d_pageSize);
+    TextureResidencyManager::getSingleton().registerTexture(
+        target->getTexture(), TextureResidencyManager::Category::RenderTarget);
+
+    Page page;
+    page.d_target = target;
+    page.d_shelfEnd = 0;
+    page.d_imageCount = 0;
+    page.d_needsClear = true;
+    d_pages.push_back(page);
+
+    pageIndex = d_pages.size() - 1;
+    return allocateOnPage(d_pages.back(), width, height, area);
+}
+
+//----------------------------------------------------------------------------//
+bool SVGRasterCache::allocateOnPage(Page& page, std::uint32_t width,
+                                    std::uint32_t height, Rectf& area)
+{
+    const Sizef& pageSize = page.d_target->getArea().getSize();
+    const std::uint32_t pageWidth = static_cast<std::uint32_t>(pageSize.d_width);
+    const std::uint32_t pageHeight = static_cast<std::uint32_t>(pageSize.d_height);
+
+    // Take the shelf that wastes the least height, as TextureAtlas does
+    std::size_t best = page.d_shelves.size();
+    std::uint32_t bestWaste = std::numeric_limits<std::uint32_t>::max();
+    for (std::size_t i = 0; i < page.d_shelves.size(); ++i)
+    {
+        const Shelf& shelf = page.d_shelves[i];
+        if (shelf.d_height < height || shelf.d_nextX + width > pageWidth)
+            continue;
+
+        if (shelf.d_height - height < bestWaste)
+        {
+            best = i;
+            bestWaste = shelf.d_height - height;
+        }
+    }
+
+    const bool canOpenShelf = width <= pageWidth && page.d_shelfEnd + height <= pageHeight;
+
+    if (best == page.d_shelves.size() ||
+        (canOpenShelf && (page.d_shelves[best].d_height - height) * 2 > height))
+    {
+        if (!canOpenShelf)
+            return false;
+
+        Shelf shelf;
+        shelf.d_y = page.d_shelfEnd;
+        shelf.d_height = height;
+        shelf.d_nextX = 0;
+        page.d_shelves.push_back(shelf);
+        page.d_shelfEnd += height;
+        best = page.d_shelves.size() - 1;
+    }
+
+    Shelf& shelf = page.d_shelves[best];
+    area = Rectf(glm::vec2(static_cast<float>(shelf.d_nextX + ImageGutter),
+                           static_cast<float>(shelf.d_y + ImageGutter)),
+                 Sizef(static_cast<float>(width - ImageGutter * 2),
+                       static_cast<float>(height - ImageGutter * 2)));
+    shelf.d_nextX += width;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasterCache::rasterise(const SVGImage& image, Page& page,
+                               const Rectf& area, bool antiAliasing)
+{
+    Renderer& renderer = page.d_target->getOwner();
+    RenderTarget* previousTarget = renderer.getActiveRenderTarget();
+
+    // The gutters stay transparent, so pages are only cleared when they are
+    // created or all their images were released.
+    if (page.d_needsClear)
+    {
+        page.d_target->clear();
+        page.d_needsClear = false;
+    }
+
+    const Rectf& imageArea = image.getImageArea();
+    const glm::vec2 scale(area.getWidth() / imageArea.getWidth(),
+                          area.getHeight() / imageArea.getHeight());
+    const ImageRenderSettings settings(Rectf(glm::vec2(0.0f, 0.0f), area.getSize()), &area);
+    const SVGImage::SVGImageRenderSettings svgSettings(settings, scale, antiAliasing);
+
+    std::vector<GeometryBuffer*> buffers;
+    image.createShapeGeometry(buffers, svgSettings);
+
+    for (GeometryBuffer* buffer : buffers)
+        buffer->setTranslation(glm::vec3(area.left(), area.top(), 0.0f));
+
+    page.d_target->activate();
+    renderer.uploadBuffers(buffers);
+    for (GeometryBuffer* buffer : buffers)
+        page.d_target->draw(*buffer);
+    page.d_target->deactivate();
+
+    renderer.setActiveRenderTarget(previousTarget);
+
+    for (GeometryBuffer* buffer : buffers)
+        renderer.destroyGeometryBuffer(*buffer);
+}
+
+//----------------------------------------------------------------------------//
+void SVGRasterCache::releaseEntry(const Entry& entry)
+{
+    delete entry.d_bitmap;
+
+    // Geometry of windows may still use the other images on the page, so its
+    // space can only be reused once all of them are gone.
+    Page& page = d_pages[entry.d_page];
+    if (--page.d_imageCount == 0)
+    {
+        page.d_shelves.clear();
+        page.d_shelfEnd = 0;
+        page.d_needsClear = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+}
@@ -38,7 +38,9 @@
     #include <glm/gtc/constants.hpp>
 #endif
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 
 // Start of CEGUI namespace section
@@ -48,6 +50,453 @@ namespace CEGUI
 //circle will be. We will set it to an, for our needs, appropriate fixed value.
 const float CircleRoundnessValue = 0.8f;
 
+//----------------------------------------------------------------------------//
+//! Returns twice the signed area of the triangle, positive for the orientation of outer fill contours
+static float getTriangleArea(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c)
+{
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+//----------------------------------------------------------------------------//
+//! Returns twice the signed area of a closed contour, with the sign of getTriangleArea
+static float getContourArea(const std::vector<glm::vec2>& points)
+{
+    float area = 0.0f;
+    for(size_t i = 0, j = points.size() - 1; i < points.size(); j = i++)
+        area += points[j].x * points[i].y - points[i].x * points[j].y;
+
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether the point lies inside the closed contour, using the even-odd rule
+static bool isPointInContour(const glm::vec2& point, const std::vector<glm::vec2>& points)
+{
+    bool inside = false;
+    for(size_t i = 0, j = points.size() - 1; i < points.size(); j = i++)
+    {
+        const glm::vec2& a = points[i];
+        const glm::vec2& b = points[j];
+
+        if((a.y > point.y) != (b.y > point.y) &&
+           point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x)
+            inside = !inside;
+    }
+
+    return inside;
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether the point lies inside the triangle or on its edges, for either orientation of the triangle
+static bool isPointInTriangle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c, const glm::vec2& point)
+{
+    const float area1 = getTriangleArea(a, b, point);
+    const float area2 = getTriangleArea(b, c, point);
+    const float area3 = getTriangleArea(c, a, point);
+
+    const bool has_negative = area1 < 0.0f || area2 < 0.0f || area3 < 0.0f;
+    const bool has_positive = area1 > 0.0f || area2 > 0.0f || area3 > 0.0f;
+
+    return !(has_negative && has_positive);
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether a point that is collinear with a segment lies on it
+static bool isCollinearPointOnSegment(const glm::vec2& a, const glm::vec2& b, const glm::vec2& point)
+{
+    return point.x >= std::min(a.x, b.x) && point.x <= std::max(a.x, b.x) &&
+           point.y >= std::min(a.y, b.y) && point.y <= std::max(a.y, b.y);
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether two segments intersect or touch
+static bool areSegmentsTouching(const glm::vec2& p1, const glm::vec2& p2,
+                                const glm::vec2& q1, const glm::vec2& q2)
+{
+    const float area1 = getTriangleArea(q1, q2, p1);
+    const float area2 = getTriangleArea(q1, q2, p2);
+    const float area3 = getTriangleArea(p1, p2, q1);
+    const float area4 = getTriangleArea(p1, p2, q2);
+
+    if(((area1 > 0.0f && area2 < 0.0f) || (area1 < 0.0f && area2 > 0.0f)) &&
+       ((area3 > 0.0f && area4 < 0.0f) || (area3 < 0.0f && area4 > 0.0f)))
+        return true;
+
+    return (area1 == 0.0f && isCollinearPointOnSegment(q1, q2, p1)) ||
+           (area2 == 0.0f && isCollinearPointOnSegment(q1, q2, p2)) ||
+           (area3 == 0.0f && isCollinearPointOnSegment(p1, p2, q1)) ||
+           (area4 == 0.0f && isCollinearPointOnSegment(p1, p2, q2));
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether the segment from the corner to next_point runs back over the segment from previous_point to the corner
+static bool isFoldingBack(const glm::vec2& previous_point, const glm::vec2& corner, const glm::vec2& next_point)
+{
+    return getTriangleArea(previous_point, corner, next_point) == 0.0f &&
+           glm::dot(previous_point - corner, next_point - corner) > 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+//! An edge of a fill contour, used when looking for intersections
+struct ContourEdge
+{
+    size_t d_contour;
+    size_t d_start;
+    float d_minY;
+    float d_maxY;
+};
+
+//----------------------------------------------------------------------------//
+//! Returns whether any of the closed contours intersect or touch each other or themselves
+static bool areContoursIntersecting(const std::vector<std::vector<glm::vec2>>& contours)
+{
+    std::vector<ContourEdge> edges;
+    for(size_t contour = 0; contour < contours.size(); ++contour)
+    {
+        const std::vector<glm::vec2>& points = contours[contour];
+        for(size_t i = 0; i < points.size(); ++i)
+        {
+            const float y1 = points[i].y;
+            const float y2 = points[(i + 1) % points.size()].y;
+            const ContourEdge edge = { contour, i, std::min(y1, y2), std::max(y1, y2) };
+            edges.push_back(edge);
+        }
+    }
+
+    //Sweep over the edges from top to bottom, only comparing edges whose vertical ranges overlap
+    std::sort(edges.begin(), edges.end(),
+              [](const ContourEdge& a, const ContourEdge& b) { return a.d_minY < b.d_minY; });
+
+    std::vector<const ContourEdge*> active_edges;
+    for(const ContourEdge& edge : edges)
+    {
+        active_edges.erase(std::remove_if(active_edges.begin(), active_edges.end(),
+            [&edge](const ContourEdge* other) { return other->d_maxY < edge.d_minY; }),
+            active_edges.end());
+
+        const std::vector<glm::vec2>& points = contours[edge.d_contour];
+        const size_t edge_end = (edge.d_start + 1) % points.size();
+        const glm::vec2& p1 = points[edge.d_start];
+        const glm::vec2& p2 = points[edge_end];
+
+        for(const ContourEdge* other : active_edges)
+        {
+            const std::vector<glm::vec2>& other_points = contours[other->d_contour];
+            const size_t other_end = (other->d_start + 1) % other_points.size();
+            const glm::vec2& q1 = other_points[other->d_start];
+            const glm::vec2& q2 = other_points[other_end];
+
+            //Neighbouring edges share a point, they only overlap if one runs back over the other
+            if(other->d_contour == edge.d_contour)
+            {
+                if(other_end == edge.d_start)
+                {
+                    if(isFoldingBack(q1, p1, p2))
+                        return true;
+                    continue;
+                }
+
+                if(edge_end == other->d_start)
+                {
+                    if(isFoldingBack(p1, p2, q2))
+                        return true;
+                    continue;
+                }
+            }
+
+            if(std::max(p1.x, p2.x) < std::min(q1.x, q2.x) ||
+               std::max(q1.x, q2.x) < std::min(p1.x, p2.x))
+                continue;
+
+            if(areSegmentsTouching(p1, p2, q1, q2))
+                return true;
+        }
+
+        active_edges.push_back(&edge);
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+//! A polygon stored as rings of linked vertices, from which ears are clipped
+struct EarClippingPolygon
+{
+    //! Adds a vertex that is not linked to any other vertex yet and returns its index
+    size_t addVertex(const glm::vec2& point)
+    {
+        const size_t index = d_points.size();
+        d_points.push_back(point);
+        d_previous.push_back(index);
+        d_next.push_back(index);
+        return index;
+    }
+
+    //! Adds a ring of vertices with the given orientation and returns the index of its first vertex
+    size_t addRing(const std::vector<glm::vec2>& points, const bool positive)
+    {
+        const bool reverse = (getContourArea(points) > 0.0f) != positive;
+        const size_t first = d_points.size();
+        for(size_t i = 0; i < points.size(); ++i)
+        {
+            const size_t index = addVertex(points[reverse ? points.size() - 1 - i : i]);
+            d_previous[index] = (i == 0) ? first + points.size() - 1 : index - 1;
+            d_next[index] = (i == points.size() - 1) ? first : index + 1;
+        }
+
+        return first;
+    }
+
+    //! Unlinks a vertex from its ring
+    void removeVertex(const size_t index)
+    {
+        d_next[d_previous[index]] = d_next[index];
+        d_previous[d_next[index]] = d_previous[index];
+    }
+
+    //! Returns whether the vertex of a positively oriented ring is a reflex or collinear vertex
+    bool isReflex(const size_t index) const
+    {
+        return getTriangleArea(d_points[d_previous[index]], d_points[index], d_points[d_next[index]]) <= 0.0f;
+    }
+
+    //! Stores which vertices are reflex, see d_reflex
+    void updateReflex(const size_t index)
+    {
+        const bool reflex = isReflex(index);
+        if(reflex != d_reflex[index])
+        {
+            d_reflex[index] = reflex;
+            d_reflexCount += reflex ? 1 : -1;
+        }
+    }
+
+    std::vector<glm::vec2> d_points;
+    std::vector<size_t> d_previous;
+    std::vector<size_t> d_next;
+    //! Reflex state of the vertices while clipping ears. Only reflex vertices can lie inside an ear
+    std::vector<bool> d_reflex;
+    size_t d_reflexCount = 0;
+};
+
+//----------------------------------------------------------------------------//
+//! Connects a hole to the ring of the outer contour by a pair of coincident edges, making them a single ring
+static bool bridgeHole(EarClippingPolygon& polygon, const size_t outer, const size_t hole)
+{
+    const std::vector<glm::vec2>& points = polygon.d_points;
+
+    //The rightmost vertex of the hole is connected to a vertex visible from it towards the right
+    size_t hole_vertex = hole;
+    for(size_t i = polygon.d_next[hole]; i != hole; i = polygon.d_next[i])
+        if(points[i].x > points[hole_vertex].x)
+            hole_vertex = i;
+
+    const glm::vec2 hole_point = points[hole_vertex];
+
+    //Find the closest edge hit by a ray from the hole vertex towards the right
+    float hit_x = std::numeric_limits<float>::infinity();
+    size_t outer_vertex = points.size();
+    size_t i = outer;
+    do
+    {
+        const size_t j = polygon.d_next[i];
+        const glm::vec2& a = points[i];
+        const glm::vec2& b = points[j];
+
+        if((a.y <= hole_point.y && b.y >= hole_point.y) || (b.y <= hole_point.y && a.y >= hole_point.y))
+        {
+            const float x = (a.y == b.y) ? std::min(a.x, b.x) :
+                            a.x + (hole_point.y - a.y) * (b.x - a.x) / (b.y - a.y);
+
+            if(x >= hole_point.x && x < hit_x)
+            {
+                hit_x = x;
+                //The end of the edge farthest to the right is visible unless vertices inside the triangle below hide it
+                if(a.y == hole_point.y && a.x == x)
+                    outer_vertex = i;
+                else if(b.y == hole_point.y && b.x == x)
+                    outer_vertex = j;
+                else
+                    outer_vertex = (a.x > b.x) ? i : j;
+            }
+        }
+
+        i = j;
+    }
+    while(i != outer);
+
+    if(outer_vertex == points.size())
+        return false;
+
+    //Reflex vertices inside the triangle spanned by the hole vertex, the hit point and the chosen vertex may hide the
+    //latter. The one with the smallest angle to the ray is visible in that case
+    const glm::vec2 hit_point(hit_x, hole_point.y);
+    const glm::vec2 candidate_point = points[outer_vertex];
+    if(hit_point != candidate_point)
+    {
+        float best_tangent = std::numeric_limits<float>::infinity();
+        size_t best_vertex = outer_vertex;
+
+        i = outer;
+        do
+        {
+            const glm::vec2& point = points[i];
+            if(i != outer_vertex && point.x > hole_point.x && polygon.isReflex(i) &&
+               isPointInTriangle(hole_point, hit_point, candidate_point, point))
+            {
+                const float tangent = std::abs(point.y - hole_point.y) / (point.x - hole_point.x);
+                if(tangent < best_tangent || (tangent == best_tangent && point.x < points[best_vertex].x))
+                {
+                    best_tangent = tangent;
+                    best_vertex = i;
+                }
+            }
+
+            i = polygon.d_next[i];
+        }
+        while(i != outer);
+
+        outer_vertex = best_vertex;
+    }
+
+    //Split both vertices and link the rings through the two copies
+    const size_t outer_copy = polygon.addVertex(points[outer_vertex]);
+    const size_t hole_copy = polygon.addVertex(points[hole_vertex]);
+    const size_t outer_next = polygon.d_next[outer_vertex];
+    const size_t hole_previous = polygon.d_previous[hole_vertex];
+
+    polygon.d_next[outer_vertex] = hole_vertex;
+    polygon.d_previous[hole_vertex] = outer_vertex;
+
+    polygon.d_next[outer_copy] = outer_next;
+    polygon.d_previous[outer_next] = outer_copy;
+
+    polygon.d_next[hole_copy] = outer_copy;
+    polygon.d_previous[outer_copy] = hole_copy;
+
+    polygon.d_next[hole_previous] = hole_copy;
+    polygon.d_previous[hole_copy] = hole_previous;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+//! Returns whether the triangle formed by a vertex and its neighbours can be clipped off the polygon
+static bool isEar(const EarClippingPolygon& polygon, const size_t previous, const size_t vertex, const size_t next)
+{
+    const glm::vec2& a = polygon.d_points[previous];
+    const glm::vec2& b = polygon.d_points[vertex];
+    const glm::vec2& c = polygon.d_points[next];
+
+    if(getTriangleArea(a, b, c) <= 0.0f)
+        return false;
+
+    //Only reflex vertices can lie inside the ear. Copies of the ear's vertices made when bridging holes don't count
+    if(polygon.d_reflexCount == 0)
+        return true;
+
+    for(size_t i = polygon.d_next[next]; i != previous; i = polygon.d_next[i])
+    {
+        const glm::vec2& point = polygon.d_points[i];
+        if(polygon.d_reflex[i] && point != a && point != b && point != c &&
+           isPointInTriangle(a, b, c, point))
+            return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+//! Removes a vertex while clipping ears, updating the reflex state of its neighbours
+static void removeEarClippingVertex(EarClippingPolygon& polygon, const size_t vertex)
+{
+    if(polygon.d_reflex[vertex])
+    {
+        polygon.d_reflex[vertex] = false;
+        --polygon.d_reflexCount;
+    }
+
+    const size_t previous = polygon.d_previous[vertex];
+    const size_t next = polygon.d_next[vertex];
+    polygon.removeVertex(vertex);
+
+    polygon.updateReflex(previous);
+    polygon.updateReflex(next);
+}
+
+//----------------------------------------------------------------------------//
+//! Triangulates a positively oriented ring by clipping ears. Returns false if it gets stuck on invalid input
+static bool clipEars(EarClippingPolygon& polygon, size_t vertex, size_t vertex_count,
+                     std::vector<glm::vec2>& triangles)
+{
+    polygon.d_reflex.assign(polygon.d_points.size(), false);
+    polygon.d_reflexCount = 0;
+    size_t i = vertex;
+    do
+    {
+        polygon.updateReflex(i);
+        i = polygon.d_next[i];
+    }
+    while(i != vertex);
+
+    //The vertex at which a full pass around the ring without finding an ear ends
+    size_t stop_vertex = vertex;
+
+    while(vertex_count > 3)
+    {
+        const size_t previous = polygon.d_previous[vertex];
+        const size_t next = polygon.d_next[vertex];
+
+        if(isEar(polygon, previous, vertex, next))
+        {
+            triangles.push_back(polygon.d_points[previous]);
+            triangles.push_back(polygon.d_points[vertex]);
+            triangles.push_back(polygon.d_points[next]);
+
+            removeEarClippingVertex(polygon, vertex);
+            --vertex_count;
+
+            vertex = next;
+            stop_vertex = next;
+            continue;
+        }
+
+        vertex = next;
+        if(vertex != stop_vertex)
+            continue;
+
+        //Without ears only collinear vertices or spikes left behind by bridges can be removed
+        size_t degenerate = vertex;
+        while(getTriangleArea(polygon.d_points[polygon.d_previous[degenerate]], polygon.d_points[degenerate],
+                              polygon.d_points[polygon.d_next[degenerate]]) != 0.0f)
+        {
+            degenerate = polygon.d_next[degenerate];
+            if(degenerate == vertex)
+                return false;
+        }
+
+        vertex = polygon.d_next[degenerate];
+        stop_vertex = vertex;
+        removeEarClippingVertex(polygon, degenerate);
+        --vertex_count;
+    }
+
+    const size_t previous = polygon.d_previous[vertex];
+    const size_t next = polygon.d_next[vertex];
+    if(getTriangleArea(polygon.d_points[previous], polygon.d_points[vertex], polygon.d_points[next]) > 0.0f)
+    {
+        triangles.push_back(polygon.d_points[previous]);
+        triangles.push_back(polygon.d_points[vertex]);
+        triangles.push_back(polygon.d_points[next]);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+const float SVGTesselator::PathFlatteningTolerance = 0.25f;
+const unsigned int SVGTesselator::MaxPathCurveSegments = 256;
+
 //----------------------------------------------------------------------------//
 SVGTesselator::StrokeSegmentData::StrokeSegmentData(GeometryBuffer& geometry_buffer,
                                                     const float stroke_half_width,
@@ -251,21 +700,29 @@ void SVGTesselator::tesselatePolyline(
     GeometryBuffer* fill_geometry_buffer;
     GeometryBuffer* stroke_geometry_buffer;
 
-    setupGeometryBuffers(out,
-        fill_geometry_buffer, stroke_geometry_buffer,
-        render_settings, polyline->d_transformation, false);
-
     //The shape's paint styles
     const SVGPaintStyle& paint_style = polyline->d_paintStyle;
 
     //Getting the points defining the polyline
     const std::vector<glm::vec2>& points = polyline->d_points;
 
+    //Triangulate the fill, unless the polyline intersects itself and needs the stencil
+    std::vector<glm::vec2> fill_triangles;
+    const bool is_fill_needing_stencil = createFillTriangles(
+        std::vector<std::vector<glm::vec2>>(1, points), paint_style, fill_triangles);
+
+    setupGeometryBuffers(out,
+        fill_geometry_buffer, stroke_geometry_buffer,
+        render_settings, polyline->d_transformation, is_fill_needing_stencil);
+
     //Get the final scale by extracting the scale from the matrix and combining it with the image scale
     glm::vec2 scale_factors = determineScaleFactors(polyline->d_transformation, render_settings);
 
     //Create and append the polyline's fill geometry
-    createFill(points, *fill_geometry_buffer, paint_style, render_settings, scale_factors);
+    if(is_fill_needing_stencil)
+        createFill(points, *fill_geometry_buffer, paint_style, render_settings, scale_factors);
+    else
+        addFillTriangles(fill_triangles, *fill_geometry_buffer, paint_style);
 
     //Create and append the polyline's stroke geometry
     createStroke(points, *stroke_geometry_buffer, paint_style, render_settings, scale_factors, false);
@@ -281,26 +738,142 @@ void SVGTesselator::tesselatePolygon(
     GeometryBuffer* fill_geometry_buffer;
     GeometryBuffer* stroke_geometry_buffer;
 
-    setupGeometryBuffers(out,
-        fill_geometry_buffer, stroke_geometry_buffer,
-        render_settings, polygon->d_transformation, false);
-
     //The shape's paint styles
     const SVGPaintStyle& paint_style = polygon->d_paintStyle;
 
     //Getting the points defining the polyline
     const std::vector<glm::vec2>& points = polygon->d_points;
 
+    //Triangulate the fill, unless the polygon intersects itself and needs the stencil
+    std::vector<glm::vec2> fill_triangles;
+    const bool is_fill_needing_stencil = createFillTriangles(
+        std::vector<std::vector<glm::vec2>>(1, points), paint_style, fill_triangles);
+
+    setupGeometryBuffers(out,
+        fill_geometry_buffer, stroke_geometry_buffer,
+        render_settings, polygon->d_transformation, is_fill_needing_stencil);
+
     //Get the final scale by extracting the scale from the matrix and combining it with the image scale
     glm::vec2 scale_factors = determineScaleFactors(polygon->d_transformation, render_settings);
 
     //Create and append the polyline's fill geometry
-    createFill(points, *fill_geometry_buffer, paint_style, render_settings, scale_factors);
+    if(is_fill_needing_stencil)
+        createFill(points, *fill_geometry_buffer, paint_style, render_settings, scale_factors);
+    else
+        addFillTriangles(fill_triangles, *fill_geometry_buffer, paint_style);
 
     //Create and append the polyline's stroke geometry
     createStroke(points, *stroke_geometry_buffer, paint_style, render_settings, scale_factors, true);
 }
 
+//----------------------------------------------------------------------------//
+void SVGTesselator::tesselatePath(
+    std::vector<GeometryBuffer*>& out,
+    const SVGPath* path,
+    const SVGImage::SVGImageRenderSettings& render_settings)
+{
+    //Get the final scale by extracting the scale from the matrix and combining it with the image scale
+    glm::vec2 scale_factors = determineScaleFactors(path->d_transformation, render_settings);
+
+    //The flattening tolerance is given in pixels, so we convert it into the path's coordinate system
+    float max_scale = 1.0f / std::min(scale_factors.x, scale_factors.y);
+    if(!(max_scale > 0.0f) || std::isinf(max_scale))
+        return;
+
+    std::vector<FlattenedSubpath> subpaths;
+    flattenPath(path, PathFlatteningTolerance / max_scale, subpaths);
+
+    //The shape's paint styles
+    const SVGPaintStyle& paint_style = path->d_paintStyle;
+
+    //Triangulate the fill, unless the subpaths intersect and need the stencil
+    std::vector<std::vector<glm::vec2>> contours;
+    for(const FlattenedSubpath& subpath : subpaths)
+        contours.push_back(subpath.d_points);
+
+    std::vector<glm::vec2> fill_triangles;
+    const bool is_fill_needing_stencil = createFillTriangles(contours, paint_style, fill_triangles);
+
+    //Setup the required Geometrybuffers
+    GeometryBuffer* fill_geometry_buffer;
+    GeometryBuffer* stroke_geometry_buffer;
+
+    setupGeometryBuffers(out,
+        fill_geometry_buffer, stroke_geometry_buffer,
+        render_settings, path->d_transformation, is_fill_needing_stencil);
+
+    //Create and append the path's fill geometry
+    if(is_fill_needing_stencil)
+        createPathFill(subpaths, *fill_geometry_buffer, paint_style);
+    else
+        addFillTriangles(fill_triangles, *fill_geometry_buffer, paint_style);
+
+    //Create and append the stroke geometry of each subpath
+    for(const FlattenedSubpath& subpath : subpaths)
+        createStroke(subpath.d_points, *stroke_geometry_buffer, paint_style, render_settings, scale_factors, subpath.d_closed);
+}
+
+//----------------------------------------------------------------------------//
+void SVGTesselator::flattenPath(const SVGPath* path,
+                                const float tolerance,
+                                std::vector<FlattenedSubpath>& subpaths)
+{
+    glm::vec2 current_point(0.0f);
+
+    for(const SVGPath::Command& command : path->d_commands)
+    {
+        switch(command.d_type)
+        {
+        case SVGPath::CommandType::MoveTo:
+            subpaths.push_back(FlattenedSubpath());
+            subpaths.back().d_points.push_back(command.d_point);
+            current_point = command.d_point;
+            break;
+
+        case SVGPath::CommandType::LineTo:
+            addPathPoint(subpaths, current_point);
+            addPathPoint(subpaths, command.d_point);
+            current_point = command.d_point;
+            break;
+
+        case SVGPath::CommandType::QuadraticTo:
+            addPathPoint(subpaths, current_point);
+            flattenQuadraticBezier(current_point, command.d_control1, command.d_point, tolerance, subpaths);
+            current_point = command.d_point;
+            break;
+
+        case SVGPath::CommandType::CubicTo:
+            addPathPoint(subpaths, current_point);
+            flattenCubicBezier(current_point, command.d_control1, command.d_control2, command.d_point, tolerance, subpaths);
+            current_point = command.d_point;
+            break;
+
+        case SVGPath::CommandType::ArcTo:
+            addPathPoint(subpaths, current_point);
+            flattenArc(current_point, command, tolerance, subpaths);
+            current_point = command.d_point;
+            break;
+
+        case SVGPath::CommandType::ClosePath:
+            if(!subpaths.empty() && !subpaths.back().d_closed)
+            {
+                FlattenedSubpath& subpath = subpaths.back();
+                subpath.d_closed = true;
+
+                //The closing line segment is implicit
+                if(subpath.d_points.size() > 1 && subpath.d_points.back() == subpath.d_points.front())
+                    subpath.d_points.pop_back();
+
+                current_point = subpath.d_points.front();
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
 //----------------------------------------------------------------------------//
 void SVGTesselator::setupGeometryBuffers(
     std::vector<GeometryBuffer*>& out,
@@ -1482,6 +2055,353 @@ void SVGTesselator::createFill(const std::vector<glm::vec2>& points,
                 geometry_buffer, fill_vertex);
 }
 
+//----------------------------------------------------------------------------//
+void SVGTesselator::createPathFill(const std::vector<FlattenedSubpath>& subpaths,
+                                   GeometryBuffer& geometry_buffer,
+                                   const SVGPaintStyle& paint_style)
+{
+    if(paint_style.d_fill.d_none)
+        return;
+
+    //Create the path fill vertex
+    ColouredVertex fill_vertex(glm::vec3(), getFillColour(paint_style));
+
+    //Every subpath is filled as if it was closed. The stencil takes care of overlaps and holes
+    glm::vec2 min, max;
+    bool has_fill = false;
+    for(const FlattenedSubpath& subpath : subpaths)
+    {
+        if(subpath.d_points.size() < 3)
+            continue;
+
+        addTriangleFanGeometry(subpath.d_points, geometry_buffer, fill_vertex);
+
+        glm::vec2 subpath_min, subpath_max;
+        calculateMinMax(subpath.d_points, subpath_min, subpath_max);
+        min = has_fill ? glm::min(min, subpath_min) : subpath_min;
+        max = has_fill ? glm::max(max, subpath_max) : subpath_max;
+        has_fill = true;
+    }
+
+    if(!has_fill)
+        return;
+
+    //Switches the stencil mode on
+    geometry_buffer.setStencilRenderingActive(paint_style.d_fillRule);
+    //Set the vertex count to the quad's vertex count
+    geometry_buffer.setStencilPostRenderingVertexCount(6);
+
+    //Add the quad covering the bounding box of all subpaths
+    addFillQuad(min, glm::vec2(min.x, max.y), glm::vec2(max.x, min.y), max,
+                geometry_buffer, fill_vertex);
+}
+
+//----------------------------------------------------------------------------//
+bool SVGTesselator::triangulateFill(const std::vector<std::vector<glm::vec2>>& contours,
+                                    const PolygonFillRule fill_rule,
+                                    std::vector<glm::vec2>& triangles)
+{
+    //Remove repeated points, the closing point and flat contours
+    std::vector<std::vector<glm::vec2>> cleaned_contours;
+    std::vector<float> areas;
+    for(const std::vector<glm::vec2>& contour : contours)
+    {
+        std::vector<glm::vec2> points;
+        for(const glm::vec2& point : contour)
+            if(points.empty() || points.back() != point)
+                points.push_back(point);
+
+        while(points.size() > 1 && points.back() == points.front())
+            points.pop_back();
+
+        if(points.size() < 3)
+            continue;
+
+        //A contour without area is either flat or intersects itself
+        const float area = getContourArea(points);
+        if(area == 0.0f)
+        {
+            for(const glm::vec2& point : points)
+                if(getTriangleArea(points[0], points[1], point) != 0.0f)
+                    return false;
+
+            continue;
+        }
+
+        cleaned_contours.push_back(std::move(points));
+        areas.push_back(area);
+    }
+
+    if(areContoursIntersecting(cleaned_contours))
+        return false;
+
+    //Find the innermost contour surrounding each contour. Contours don't touch, so testing one point is enough
+    const size_t contour_count = cleaned_contours.size();
+    std::vector<size_t> parents(contour_count, contour_count);
+    for(size_t i = 0; i < contour_count; ++i)
+    {
+        for(size_t j = 0; j < contour_count; ++j)
+        {
+            if(std::abs(areas[j]) <= std::abs(areas[i]) ||
+               (parents[i] != contour_count && std::abs(areas[j]) >= std::abs(areas[parents[i]])))
+                continue;
+
+            if(isPointInContour(cleaned_contours[i].front(), cleaned_contours[j]))
+                parents[i] = j;
+        }
+    }
+
+    //The winding number and nesting depth of the area directly inside each contour. Contours are larger than the
+    //ones they surround, so handling them by decreasing area visits the parents first
+    std::vector<size_t> order(contour_count);
+    for(size_t i = 0; i < contour_count; ++i)
+        order[i] = i;
+
+    std::sort(order.begin(), order.end(),
+              [&areas](size_t a, size_t b) { return std::abs(areas[a]) > std::abs(areas[b]); });
+
+    std::vector<int> windings(contour_count);
+    std::vector<unsigned int> depths(contour_count);
+    for(const size_t i : order)
+    {
+        const bool has_parent = parents[i] != contour_count;
+        windings[i] = (has_parent ? windings[parents[i]] : 0) + (areas[i] > 0.0f ? 1 : -1);
+        depths[i] = (has_parent ? depths[parents[i]] : 0) + 1;
+    }
+
+    //Each filled area is bounded by a contour and the contours directly inside it, which form its holes
+    const size_t first_triangle = triangles.size();
+    for(size_t i = 0; i < contour_count; ++i)
+    {
+        const bool is_filled = (fill_rule == PolygonFillRule::EvenOdd) ? (depths[i] % 2 == 1) : (windings[i] != 0);
+        if(!is_filled)
+            continue;
+
+        EarClippingPolygon polygon;
+        const size_t outer = polygon.addRing(cleaned_contours[i], true);
+
+        std::vector<std::pair<float, size_t>> holes;
+        for(size_t j = 0; j < contour_count; ++j)
+        {
+            if(parents[j] != i)
+                continue;
+
+            float max_x = cleaned_contours[j].front().x;
+            for(const glm::vec2& point : cleaned_contours[j])
+                max_x = std::max(max_x, point.x);
+
+            holes.push_back(std::make_pair(max_x, polygon.addRing(cleaned_contours[j], false)));
+        }
+
+        //Bridging the rightmost holes first keeps the bridges of the others from crossing them
+        std::sort(holes.begin(), holes.end(),
+                  [](const std::pair<float, size_t>& a, const std::pair<float, size_t>& b) { return a.first > b.first; });
+
+        bool is_triangulated = true;
+        for(const std::pair<float, size_t>& hole : holes)
+            is_triangulated = is_triangulated && bridgeHole(polygon, outer, hole.second);
+
+        if(!is_triangulated || !clipEars(polygon, outer, polygon.d_points.size(), triangles))
+        {
+            triangles.resize(first_triangle);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool SVGTesselator::createFillTriangles(const std::vector<std::vector<glm::vec2>>& contours,
+                                        const SVGPaintStyle& paint_style,
+                                        std::vector<glm::vec2>& triangles)
+{
+    if(paint_style.d_fill.d_none)
+        return false;
+
+    //Only self-intersecting shapes still need the stencil
+    return !triangulateFill(contours, paint_style.d_fillRule, triangles);
+}
+
+//----------------------------------------------------------------------------//
+void SVGTesselator::addFillTriangles(const std::vector<glm::vec2>& triangles,
+                                     GeometryBuffer& geometry_buffer,
+                                     const SVGPaintStyle& paint_style)
+{
+    if(triangles.empty() || paint_style.d_fill.d_none)
+        return;
+
+    ColouredVertex fill_vertex(glm::vec3(), getFillColour(paint_style));
+
+    for(size_t i = 0; i + 2 < triangles.size(); i += 3)
+        addTriangleGeometry(triangles[i], triangles[i + 1], triangles[i + 2], geometry_buffer, fill_vertex);
+}
+
+//----------------------------------------------------------------------------//
+void SVGTesselator::addPathPoint(std::vector<FlattenedSubpath>& subpaths,
+                                 const glm::vec2& point)
+{
+    //Drawing commands following a closepath start a new subpath at the same point
+    if(subpaths.empty() || subpaths.back().d_closed)
+        subpaths.push_back(FlattenedSubpath());
+
+    std::vector<glm::vec2>& points = subpaths.back().d_points;
+
+    //Zero length segments would break the stroke's linejoins
+    if(points.empty() || points.back() != point)
+        points.push_back(point);
+}
+
+//----------------------------------------------------------------------------//
+unsigned int SVGTesselator::calculateCurveSegmentCount(const float second_difference_length,
+                                                       const float degree_factor,
+                                                       const float tolerance)
+{
+    //Wang's formula: the distance between a Bézier curve of degree n and the line segments
+    //connecting the points at uniform parameter steps stays below the tolerance if the number
+    //of segments is at least sqrt(n * (n - 1) / 8 * second_difference_length / tolerance)
+    const float segments = std::ceil(std::sqrt(degree_factor * second_difference_length / tolerance));
+
+    if(!(segments >= 1.0f))
+        return 1;
+
+    return static_cast<unsigned int>(std::min(segments, static_cast<float>(MaxPathCurveSegments)));
+}
+
+//----------------------------------------------------------------------------//
+void SVGTesselator::flattenQuadraticBezier(const glm::vec2& start_point,
+                                           const glm::vec2& control_point,
+                                           const glm::vec2& end_point,
+                                           const float tolerance,
+                                           std::vector<FlattenedSubpath>& subpaths)
+{
+    const float second_difference = glm::length(start_point - 2.0f * control_point + end_point);
+    const unsigned int segments = calculateCurveSegmentCount(second_difference, 0.25f, tolerance);
+
+    for(unsigned int i = 1; i < segments; ++i)
+    {
+        const float t = static_cast<float>(i) / segments;
+        const float one_minus_t = 1.0f - t;
+
+        addPathPoint(subpaths, one_minus_t * one_minus_t * start_point +
+                               2.0f * one_minus_t * t * control_point +
+                               t * t * end_point);
+    }
+
+    addPathPoint(subpaths, end_point);
+}
+
+//----------------------------------------------------------------------------//
+void SVGTesselator::flattenCubicBezier(const glm::vec2& start_point,
+                                       const glm::vec2& control_point1,
+                                       const glm::vec2& control_point2,
+                                       const glm::vec2& end_point,
+                                       const float tolerance,
+                                       std::vector<FlattenedSubpath>& subpaths)
+{
+    const float second_difference = std::max(
+        glm::length(start_point - 2.0f * control_point1 + control_point2),
+        glm::length(control_point1 - 2.0f * control_point2 + end_point));
+    const unsigned int segments = calculateCurveSegmentCount(second_difference, 0.75f, tolerance);
+
+    for(unsigned int i = 1; i < segments; ++i)
+    {
+        const float t = static_cast<float>(i) / segments;
+        const float one_minus_t = 1.0f - t;
+
+        addPathPoint(subpaths, one_minus_t * one_minus_t * one_minus_t * start_point +
+                               3.0f * one_minus_t * one_minus_t * t * control_point1 +
+                               3.0f * one_minus_t * t * t * control_point2 +
+                               t * t * t * end_point);
+    }
+
+    addPathPoint(subpaths, end_point);
+}
+
+//----------------------------------------------------------------------------//
+void SVGTesselator::flattenArc(const glm::vec2& start_point,
+                               const SVGPath::Command& arc,
+                               const float tolerance,
+                               std::vector<FlattenedSubpath>& subpaths)
+{
+    //The conversion from the endpoint to the center parameterisation follows the
+    //implementation notes of the SVG 1.1 standard (F.6.5 and F.6.6)
+    const glm::vec2& end_point = arc.d_point;
+    glm::vec2 radii(std::abs(arc.d_radii.x), std::abs(arc.d_radii.y));
+
+    if(start_point == end_point)
+        return;
+
+    if(radii.x == 0.0f || radii.y == 0.0f)
+    {
+        addPathPoint(subpaths, end_point);
+        return;
+    }
+
+    const float rotation = glm::radians(arc.d_xAxisRotation);
+    const float cos_rotation = std::cos(rotation);
+    const float sin_rotation = std::sin(rotation);
+
+    //The start point in the coordinate system of the ellipse, relative to the middle of the chord
+    const glm::vec2 half_chord = (start_point - end_point) * 0.5f;
+    const glm::vec2 start_prime(cos_rotation * half_chord.x + sin_rotation * half_chord.y,
+                                -sin_rotation * half_chord.x + cos_rotation * half_chord.y);
+
+    //Scale the radii up if the ellipse is too small to reach the end point
+    const float radii_check = (start_prime.x * start_prime.x) / (radii.x * radii.x) +
+                              (start_prime.y * start_prime.y) / (radii.y * radii.y);
+    if(radii_check > 1.0f)
+        radii *= std::sqrt(radii_check);
+
+    const float rx_sq = radii.x * radii.x;
+    const float ry_sq = radii.y * radii.y;
+    const float numerator = rx_sq * ry_sq - rx_sq * start_prime.y * start_prime.y - ry_sq * start_prime.x * start_prime.x;
+    const float denominator = rx_sq * start_prime.y * start_prime.y + ry_sq * start_prime.x * start_prime.x;
+
+    float center_factor = std::sqrt(std::max(0.0f, numerator / denominator));
+    if(arc.d_largeArc == arc.d_sweep)
+        center_factor = -center_factor;
+
+    const glm::vec2 center_prime(center_factor * radii.x * start_prime.y / radii.y,
+                                 -center_factor * radii.y * start_prime.x / radii.x);
+
+    const glm::vec2 center(cos_rotation * center_prime.x - sin_rotation * center_prime.y + (start_point.x + end_point.x) * 0.5f,
+                           sin_rotation * center_prime.x + cos_rotation * center_prime.y + (start_point.y + end_point.y) * 0.5f);
+
+    //Determine the start angle and the angle spanned by the arc
+    const glm::vec2 start_dir((start_prime.x - center_prime.x) / radii.x, (start_prime.y - center_prime.y) / radii.y);
+    const glm::vec2 end_dir((-start_prime.x - center_prime.x) / radii.x, (-start_prime.y - center_prime.y) / radii.y);
+
+    static const float two_pi = 2.0f * glm::pi<float>();
+    const float start_angle = std::atan2(start_dir.y, start_dir.x);
+    float arc_angle = std::atan2(end_dir.y, end_dir.x) - start_angle;
+
+    if(arc.d_sweep && arc_angle < 0.0f)
+        arc_angle += two_pi;
+    else if(!arc.d_sweep && arc_angle > 0.0f)
+        arc_angle -= two_pi;
+
+    //Choose the angle step so that the sagitta of each segment stays below the tolerance
+    const float max_radius = std::max(radii.x, radii.y);
+    const float step = (tolerance < max_radius) ?
+        2.0f * std::acos(1.0f - tolerance / max_radius) : glm::half_pi<float>();
+
+    const float segment_count = std::ceil(std::abs(arc_angle) / std::min(step, glm::half_pi<float>()));
+    const unsigned int segments = static_cast<unsigned int>(
+        std::max(1.0f, std::min(segment_count, static_cast<float>(MaxPathCurveSegments))));
+
+    for(unsigned int i = 1; i < segments; ++i)
+    {
+        const float angle = start_angle + arc_angle * i / segments;
+        const glm::vec2 ellipse_point(radii.x * std::cos(angle), radii.y * std::sin(angle));
+
+        addPathPoint(subpaths, glm::vec2(cos_rotation * ellipse_point.x - sin_rotation * ellipse_point.y + center.x,
+                                         sin_rotation * ellipse_point.x + cos_rotation * ellipse_point.y + center.y));
+    }
+
+    addPathPoint(subpaths, end_point);
+}
+
 //----------------------------------------------------------------------------//
 void SVGTesselator::calculateMinMax(const std::vector<glm::vec2>& points,
                                     glm::vec2& min,
@@ -29,6 +29,7 @@
 #include "CEGUI/text/FreeTypeFont.h"
 #include "CEGUI/text/Font_xmlHandler.h"
 #include "CEGUI/Texture.h"
+#include "CEGUI/TextureResidencyManager.h"
 #include "CEGUI/InputEvent.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Renderer.h"
@@ -313,6 +314,9 @@ void FreeTypeFont::createGlyphAtlasTexture()
     Texture& texture = System::getSingleton().getRenderer()->createTexture(
         texture_name, newTextureSize);
     d_glyphTextures.push_back(&texture);
+    // glyphs are rendered on demand and not kept, the texture can't be evicted
+    TextureResidencyManager::getSingleton().registerTexture(
+        texture, TextureResidencyManager::Category::Font);
 
     d_lastTextureBuffer = std::vector<argb_t>(d_lastTextureSize * d_lastTextureSize, 0);
 
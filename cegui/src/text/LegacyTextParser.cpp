@@ -263,14 +263,13 @@ void LegacyTextParser::processControlString(const std::u32string& ctrlStr, std::
     if (valueValid && key == ImageTagName)
     {
         const String val = ctrlStr.substr(valueStart, valueEnd - valueStart);
-        if (!ImageManager::getSingleton().isDefined(val))
-        {
-            ImageManager::getSingleton().addBitmapImageFromFile(val, val);
-        }
-
-        //!!!TODO TEXT: try to find the same image first!
+        ImageManager& imgr = ImageManager::getSingleton();
+        if (imgr.getHandle(val).isNull())
+            imgr.addBitmapImageFromFile(val, val);
 
-        auto element = std::make_unique<RenderedTextImage>( PropertyHelper<Image*>::fromString(val) );
+        // The element keeps the name and a cached handle rather than a raw
+        // pointer, so it survives the image being destroyed and recreated.
+        auto element = std::make_unique<RenderedTextImage>(val);
         element->setColour(d_colours);
         element->setBackgroundColour(d_bgColours);
         element->setUseModulateColour(false);
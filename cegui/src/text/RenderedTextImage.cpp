@@ -47,11 +47,11 @@ void RenderedTextImage::setupGlyph(RenderedGlyph& glyph, uint32_t /*codePoint*/)
 Sizef RenderedTextImage::updateMetrics(const Window* /*hostWindow*/)
 {
     const Sizef oldSize = d_effectiveSize;
-    if (d_image)
+    if (const Image* image = getImage())
     {
-        d_effectiveSize.d_width = ((d_size.d_width > 0.f) ? d_size.d_width : d_image->getRenderedSize().d_width)
+        d_effectiveSize.d_width = ((d_size.d_width > 0.f) ? d_size.d_width : image->getRenderedSize().d_width)
             + getLeftPadding() + getRightPadding();
-        d_effectiveSize.d_height = ((d_size.d_height > 0.f) ? d_size.d_height : d_image->getRenderedSize().d_height)
+        d_effectiveSize.d_height = ((d_size.d_height > 0.f) ? d_size.d_height : image->getRenderedSize().d_height)
             + getTopPadding() + getBottomPadding();
     }
     else
@@ -101,9 +101,10 @@ static Sizef getRespectRatioSize(const Sizef& reqSize, const Sizef& orgSize)
 
 void RenderedTextImage::setSize(const Sizef& size, bool aspectLock)
 {
-    if (aspectLock)
+    const Image* image = getImage();
+    if (aspectLock && image)
     {
-        d_size = getRespectRatioSize(size, d_image->getRenderedSize());
+        d_size = getRespectRatioSize(size, image->getRenderedSize());
     }
     else
     {
@@ -116,15 +117,16 @@ void RenderedTextImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     size_t count, glm::vec2& penPosition, const ColourRect* modColours, const Rectf* clipRect,
     float lineHeight, float justifySpaceSize, size_t canCombineFromIdx, const SelectionInfo* /*selection*/) const
 {
-    if (!d_image)
+    const Image* image = getImage();
+    if (!image)
         return;
 
     glm::vec2 pos = penPosition;
     float heightScale = 1.f;
     applyVerticalFormatting(lineHeight, pos.y, heightScale);
 
-    const float imgWidth = (d_size.d_width > 0.f) ? d_size.d_width : d_image->getRenderedSize().d_width;
-    const float imgHeight = (d_size.d_height > 0.f) ? d_size.d_height : d_image->getRenderedSize().d_height;
+    const float imgWidth = (d_size.d_width > 0.f) ? d_size.d_width : image->getRenderedSize().d_width;
+    const float imgHeight = (d_size.d_height > 0.f) ? d_size.d_height : image->getRenderedSize().d_height;
     const Sizef imgSize(imgWidth, imgHeight * heightScale);
 
     ImageRenderSettings settings(Rectf(), clipRect, d_colours);
@@ -135,7 +137,7 @@ void RenderedTextImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     for (auto glyph = begin; glyph != end; ++glyph)
     {
         settings.d_destArea.set(pos + glyph->offset, imgSize);
-        d_image->createRenderGeometry(out, settings, canCombineFromIdx);
+        image->createRenderGeometry(out, settings, canCombineFromIdx);
 
         pos.x += glyph->advance;
         if (glyph->isJustifiable)
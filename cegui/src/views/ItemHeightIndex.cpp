@@ -0,0 +1,155 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+
+    purpose:    Prefix sums over the heights of view items
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/views/ItemHeightIndex.h"
+
+namespace CEGUI
+{
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::build(std::vector<float> heights)
+{
+    d_heights = std::move(heights);
+    rebuildTree();
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::rebuildTree()
+{
+    const size_t count = d_heights.size();
+    d_tree.assign(count + 1, 0.0);
+
+    // linear time construction: push each node's sum to its parent once.
+    for (size_t i = 1; i <= count; ++i)
+    {
+        d_tree[i] += d_heights[i - 1];
+
+        const size_t parent = i + (i & (~i + 1));
+        if (parent <= count)
+            d_tree[parent] += d_tree[i];
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::clear()
+{
+    d_heights.clear();
+    d_tree.clear();
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::setHeight(size_t position, float height)
+{
+    const double delta = static_cast<double>(height) - d_heights[position];
+    d_heights[position] = height;
+
+    if (delta == 0.0)
+        return;
+
+    for (size_t i = position + 1; i < d_tree.size(); i += i & (~i + 1))
+        d_tree[i] += delta;
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::insert(size_t position, float height)
+{
+    if (position != d_heights.size())
+    {
+        d_heights.insert(d_heights.begin() + position, height);
+        rebuildTree();
+        return;
+    }
+
+    // A new last node covers itself and the (already complete) nodes in the
+    // range (i - lowbit(i), i), whose sum is a difference of two prefixes.
+    const size_t i = d_heights.size() + 1;
+    const size_t range_start = i - (i & (~i + 1));
+    const double covered = getPrefixSum(i - 1) - getPrefixSum(range_start);
+
+    d_heights.push_back(height);
+    if (d_tree.empty())
+        d_tree.push_back(0.0);
+    d_tree.push_back(covered + height);
+}
+
+//----------------------------------------------------------------------------//
+void ItemHeightIndex::erase(size_t position, size_t count)
+{
+    d_heights.erase(d_heights.begin() + position, d_heights.begin() + position + count);
+
+    // no node includes items after itself, so trailing nodes can simply be
+    // dropped.
+    if (position == d_heights.size())
+        d_tree.resize(d_heights.empty() ? 0 : d_heights.size() + 1);
+    else
+        rebuildTree();
+}
+
+//----------------------------------------------------------------------------//
+float ItemHeightIndex::getOffset(size_t position) const
+{
+    return static_cast<float>(getPrefixSum(position));
+}
+
+//----------------------------------------------------------------------------//
+double ItemHeightIndex::getPrefixSum(size_t count) const
+{
+    double sum = 0.0;
+    for (size_t i = count; i > 0; i -= i & (~i + 1))
+        sum += d_tree[i];
+
+    return sum;
+}
+
+//----------------------------------------------------------------------------//
+size_t ItemHeightIndex::getPositionAtOffset(float offset) const
+{
+    const size_t count = d_heights.size();
+    if (count == 0)
+        return 0;
+
+    size_t step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+
+    // find the number of leading items that end at or before offset.
+    size_t position = 0;
+    double remaining = offset;
+    for (; step > 0; step /= 2)
+    {
+        if (position + step <= count && d_tree[position + step] <= remaining)
+        {
+            position += step;
+            remaining -= d_tree[position];
+        }
+    }
+
+    return position < count ? position : count - 1;
+}
+
+}
@@ -25,6 +25,9 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/views/ItemModel.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Image.h"
+#include "CEGUI/PropertyHelper.h"
 
 #include <ostream>
 
@@ -35,7 +38,7 @@ const String ItemModel::EventChildrenWillBeAdded("ChildrenWillBeAdded");
 const String ItemModel::EventChildrenAdded("ChildrenAdded");
 const String ItemModel::EventChildrenWillBeRemoved("ChildrenWillBeRemoved");
 const String ItemModel::EventChildrenRemoved("ChildrenRemoved");
-const String ItemModel::EventChildrenDataWillChange;
+const String ItemModel::EventChildrenDataWillChange("ChildrenDataWillChange");
 const String ItemModel::EventChildrenDataChanged("ChildrenDataChanged");
 
 //----------------------------------------------------------------------------//
@@ -59,6 +62,89 @@ ModelIndex::ModelIndex(void* model_data /*= 0*/) :
 {
 }
 
+//----------------------------------------------------------------------------//
+ItemData::ItemData() :
+    d_type(Type::None),
+    d_stringRef(nullptr),
+    d_number(0.0)
+{
+}
+
+//----------------------------------------------------------------------------//
+ItemData::ItemData(const String& text) :
+    d_type(Type::String),
+    d_string(text),
+    d_stringRef(nullptr),
+    d_number(0.0)
+{
+}
+
+//----------------------------------------------------------------------------//
+ItemData::ItemData(double number) :
+    d_type(Type::Number),
+    d_stringRef(nullptr),
+    d_number(number)
+{
+}
+
+//----------------------------------------------------------------------------//
+ItemData::ItemData(ImageHandle image) :
+    d_type(Type::Image),
+    d_stringRef(nullptr),
+    d_number(0.0),
+    d_image(image)
+{
+}
+
+//----------------------------------------------------------------------------//
+ItemData ItemData::fromStringRef(const String& text)
+{
+    ItemData data;
+    data.d_type = Type::String;
+    data.d_stringRef = &text;
+    return data;
+}
+
+//----------------------------------------------------------------------------//
+const String& ItemData::getString() const
+{
+    return d_stringRef ? *d_stringRef : d_string;
+}
+
+//----------------------------------------------------------------------------//
+ImageHandle ItemData::getImageHandle() const
+{
+    if (d_type == Type::Image)
+        return d_image;
+
+    if (d_type == Type::String && !getString().empty())
+        return ImageManager::getSingleton().getHandle(getString());
+
+    return ImageHandle();
+}
+
+//----------------------------------------------------------------------------//
+String ItemData::toString() const
+{
+    switch (d_type)
+    {
+        case Type::String:
+            return getString();
+
+        case Type::Number:
+            return PropertyHelper<double>::toString(d_number);
+
+        case Type::Image:
+        {
+            const Image* image = ImageManager::getSingleton().getImage(d_image);
+            return image ? image->getName() : String();
+        }
+
+        default:
+            return String();
+    }
+}
+
 //----------------------------------------------------------------------------//
 ItemModel::~ItemModel()
 {
@@ -106,9 +192,33 @@ void ItemModel::notifyChildrenDataChanged(ModelIndex parent_index, size_t start_
     fireEvent(EventChildrenDataChanged, args);
 }
 
+//----------------------------------------------------------------------------//
+ItemData ItemModel::getItemData(const ModelIndex& model_index, ItemDataRole role)
+{
+    return ItemData(getData(model_index, role));
+}
+
+//----------------------------------------------------------------------------//
+void ItemModel::getItemDataRange(const ModelIndex& parent_index, size_t start_id,
+    size_t count, ItemDataRole role, std::vector<ItemData>& data)
+{
+    data.clear();
+    data.resize(count);
+
+    const size_t child_count = getChildCount(parent_index);
+    for (size_t i = 0; i < count && start_id + i < child_count; ++i)
+        data[i] = getItemData(makeIndex(start_id + i, parent_index), role);
+}
+
 //----------------------------------------------------------------------------//
 bool ItemModel::areIndicesEqual(const ModelIndex& index1, const ModelIndex& index2) const
 {
     return compareIndices(index1, index2) == 0;
 }
+
+//----------------------------------------------------------------------------//
+ModelIndexStability ItemModel::getIndexStability() const
+{
+    return ModelIndexStability::Volatile;
+}
 }
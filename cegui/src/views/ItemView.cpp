@@ -32,6 +32,9 @@
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/text/Font.h"
+#include <algorithm>
+#include <functional>
 
 namespace CEGUI
 {
@@ -122,6 +125,8 @@ const String ItemView::EventSelectionChanged("SelectionChanged");
 const String ItemView::EventMultiselectModeChanged("MultiselectModeChanged");
 const String ItemView::EventSortModeChanged("SortModeChanged");
 const String ItemView::EventViewContentsChanged("ViewContentsChanged");
+//! Upper limit of RenderedText objects kept for reuse by virtualized views.
+static const size_t MaxPooledRenderedTexts = 128;
 
 //----------------------------------------------------------------------------//
 ItemView::ItemView(const String& type, const String& name) :
@@ -140,6 +145,8 @@ ItemView::ItemView(const String& type, const String& name) :
     d_sortMode(ViewSortMode::NoSorting),
     d_isAutoResizeHeightEnabled(false),
     d_isAutoResizeWidthEnabled(false),
+    d_isVirtualizationEnabled(false),
+    d_estimatedItemHeight(0),
     d_renderedMaxWidth(0),
     d_renderedTotalHeight(0),
     d_eventChildrenAddedConnection(nullptr),
@@ -244,6 +251,23 @@ void ItemView::addItemViewProperties()
         &ItemView::setAutoResizeWidthEnabled,
         &ItemView::isAutoResizeWidthEnabled, false
         )
+
+    CEGUI_DEFINE_PROPERTY(ItemView, bool,
+        "VirtualizationEnabled",
+        "Property to get/set whether the item view only lays out the items "
+        "in or near its visible area. Value is either \"true\" or \"false\".",
+        &ItemView::setVirtualizationEnabled,
+        &ItemView::isVirtualizationEnabled, false
+        )
+
+    CEGUI_DEFINE_PROPERTY(ItemView, float,
+        "EstimatedItemHeight",
+        "Property to get/set the height assumed for items that were not laid "
+        "out yet when virtualization is enabled. Value is a float; 0 means the "
+        "line spacing of the font.",
+        &ItemView::setEstimatedItemHeight,
+        &ItemView::getEstimatedItemHeight, 0.0f
+        )
 }
 
 //----------------------------------------------------------------------------//
@@ -331,6 +355,8 @@ bool ItemView::onChildrenAdded(const EventArgs& args)
         }
     }
 
+    adjustDirtyRanges(model_args.d_parentIndex, model_args.d_startId, model_args.d_count, true);
+
     invalidateView(false);
     WindowEventArgs evt_args(this);
     onViewContentsChanged(evt_args);
@@ -368,8 +394,10 @@ bool ItemView::onChildrenWillBeRemoved(const EventArgs& args)
 }
 
 //----------------------------------------------------------------------------//
-bool ItemView::onChildrenRemoved(const EventArgs&)
+bool ItemView::onChildrenRemoved(const EventArgs& args)
 {
+    const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
+    adjustDirtyRanges(model_args.d_parentIndex, model_args.d_startId, model_args.d_count, false);
 
     ItemViewEventArgs wargs(this);
     onSelectionChanged(wargs);
@@ -386,12 +414,94 @@ bool ItemView::onChildrenDataWillChange(const EventArgs&)
 }
 
 //----------------------------------------------------------------------------//
-bool ItemView::onChildrenDataChanged(const EventArgs&)
+bool ItemView::onChildrenDataChanged(const EventArgs& args)
 {
-    invalidateView(false);
+    const ModelEventArgs& model_args = static_cast<const ModelEventArgs&>(args);
+    markRangeDirty(model_args.d_parentIndex, model_args.d_startId, model_args.d_count);
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::markRangeDirty(const ModelIndex& parent_index, size_t start_id, size_t count)
+{
+    if (!count)
+        return;
+
+    // Extending the last range catches the common case of consecutive updates
+    // without growing the list; the rest is merged in prepareForRender
+    if (!d_dirtyRanges.empty())
+    {
+        ModelIndexRange& last = d_dirtyRanges.back();
+        if (last.d_parentIndex.d_modelData == parent_index.d_modelData &&
+            start_id <= last.d_startId + last.d_count &&
+            last.d_startId <= start_id + count)
+        {
+            const size_t end = std::max(last.d_startId + last.d_count, start_id + count);
+            last.d_startId = std::min(last.d_startId, start_id);
+            last.d_count = end - last.d_startId;
+            invalidate(false);
+            return;
+        }
+    }
+
+    d_dirtyRanges.push_back(ModelIndexRange(parent_index, start_id, count));
+    invalidate(false);
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::adjustDirtyRanges(const ModelIndex& parent_index, size_t start_id,
+    size_t count, bool added)
+{
+    for (auto itor = d_dirtyRanges.begin(); itor != d_dirtyRanges.end();)
+    {
+        ModelIndexRange& range = *itor;
+        if (range.d_parentIndex.d_modelData != parent_index.d_modelData ||
+            range.d_startId + range.d_count <= start_id)
+        {
+            ++itor;
+            continue;
+        }
+
+        if (added)
+        {
+            // Children inserted inside the range are new and get updated anyway
+            if (range.d_startId >= start_id)
+                range.d_startId += count;
+            else
+                range.d_count += count;
+        }
+        else if (range.d_startId >= start_id + count)
+        {
+            range.d_startId -= count;
+        }
+        else
+        {
+            // Drop the removed children from the range
+            const size_t end = range.d_startId + range.d_count;
+            const size_t new_start = std::min(range.d_startId, start_id);
+            const size_t new_end = (end > start_id + count) ? end - count : start_id;
+            if (new_end <= new_start)
+            {
+                itor = d_dirtyRanges.erase(itor);
+                continue;
+            }
+
+            range.d_startId = new_start;
+            range.d_count = new_end - new_start;
+        }
+
+        ++itor;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::updateDirtyRanges(const ModelIndexRangeVector&)
+{
+    updateScrollbars();
+    resizeToContent();
+    setIsDirty(true);
+}
+
 //----------------------------------------------------------------------------//
 void ItemView::onSelectionChanged(ItemViewEventArgs& args)
 {
@@ -439,7 +549,7 @@ void ItemView::onCursorMove(CursorMoveEventArgs& e)
 
     d_lastHoveredIndex = index;
 
-    setTooltipText(d_itemModel->isValidIndex(index) ? d_itemModel->getData(index, ItemDataRole::Tooltip) : "");
+    setTooltipText(d_itemModel->isValidIndex(index) ? d_itemModel->getItemData(index, ItemDataRole::Tooltip).toString() : "");
 
     if (d_guiContext)
         d_guiContext->positionTooltip();
@@ -514,6 +624,43 @@ ItemModel* ItemView::getModel() const
 //----------------------------------------------------------------------------//
 void ItemView::prepareForRender()
 {
+    if (d_dirtyRanges.empty())
+        return;
+
+    ModelIndexRangeVector ranges;
+    ranges.swap(d_dirtyRanges);
+
+    // A full render lays out every item anyway
+    if (d_needsFullRender || d_itemModel == nullptr)
+        return;
+
+    std::sort(ranges.begin(), ranges.end(),
+        [](const ModelIndexRange& a, const ModelIndexRange& b)
+        {
+            if (a.d_parentIndex.d_modelData != b.d_parentIndex.d_modelData)
+                return std::less<void*>()(a.d_parentIndex.d_modelData, b.d_parentIndex.d_modelData);
+            return a.d_startId < b.d_startId;
+        });
+
+    size_t merged = 0;
+    for (size_t i = 1; i < ranges.size(); ++i)
+    {
+        ModelIndexRange& last = ranges[merged];
+        const ModelIndexRange& range = ranges[i];
+        if (range.d_parentIndex.d_modelData == last.d_parentIndex.d_modelData &&
+            range.d_startId <= last.d_startId + last.d_count)
+        {
+            last.d_count = std::max(last.d_startId + last.d_count,
+                range.d_startId + range.d_count) - last.d_startId;
+        }
+        else
+        {
+            ranges[++merged] = range;
+        }
+    }
+    ranges.resize(merged + 1);
+
+    updateDirtyRanges(ranges);
 }
 
 //----------------------------------------------------------------------------//
@@ -911,6 +1058,74 @@ void ItemView::clearSelections()
     d_indexSelectionStates.clear();
 }
 
+//----------------------------------------------------------------------------//
+void ItemView::setVirtualizationEnabled(bool enabled)
+{
+    if (d_isVirtualizationEnabled == enabled)
+        return;
+
+    d_isVirtualizationEnabled = enabled;
+    d_needsFullRender = true;
+    invalidateView(false);
+}
+
+//----------------------------------------------------------------------------//
+bool ItemView::isVirtualizationEnabled() const
+{
+    return d_isVirtualizationEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::setEstimatedItemHeight(float height)
+{
+    if (d_estimatedItemHeight == height)
+        return;
+
+    d_estimatedItemHeight = height;
+
+    if (d_isVirtualizationEnabled)
+    {
+        d_needsFullRender = true;
+        invalidateView(false);
+    }
+}
+
+//----------------------------------------------------------------------------//
+float ItemView::getEstimatedItemHeight() const
+{
+    return d_estimatedItemHeight;
+}
+
+//----------------------------------------------------------------------------//
+float ItemView::getEffectiveEstimatedItemHeight() const
+{
+    if (d_estimatedItemHeight > 0.0f)
+        return d_estimatedItemHeight;
+
+    const Font* font = getEffectiveFont();
+    return font ? font->getLineSpacing() : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+RenderedText ItemView::acquireRenderedText()
+{
+    if (d_renderedTextPool.empty())
+        return RenderedText();
+
+    RenderedText text(std::move(d_renderedTextPool.back()));
+    d_renderedTextPool.pop_back();
+    return text;
+}
+
+//----------------------------------------------------------------------------//
+void ItemView::releaseRenderedText(RenderedText& text)
+{
+    if (d_renderedTextPool.size() < MaxPooledRenderedTexts)
+        d_renderedTextPool.push_back(std::move(text));
+
+    text = RenderedText();
+}
+
 //----------------------------------------------------------------------------//
 float ItemView::getRenderedMaxWidth() const
 {
@@ -29,7 +29,7 @@
 #include "CEGUI/views/ListView.h"
 #include "CEGUI/falagard/XMLEnumHelper.h"
 #include "CEGUI/widgets/Scrollbar.h"
-#include <algorithm> // sort
+#include <algorithm> // sort, upper_bound, equal_range
 
 namespace CEGUI
 {
@@ -126,41 +126,134 @@ void ListView::setWordWrapEnabled(bool wrap)
 void ListView::prepareForRender()
 {
     ItemView::prepareForRender();
-    if (d_itemModel == nullptr || !isDirty())
+    if (d_itemModel == nullptr)
         return;
 
-    if (d_needsFullRender)
+    if (isDirty())
     {
-        d_renderedMaxWidth = d_renderedTotalHeight = 0;
-        d_items.clear();
-    }
-
-    ModelIndex root_index = d_itemModel->getRootIndex();
-    size_t child_count = d_itemModel->getChildCount(root_index);
+        if (d_needsFullRender)
+        {
+            d_renderedMaxWidth = d_renderedTotalHeight = 0;
+            d_laidOutBegin = d_laidOutEnd = 0;
+            d_items.clear();
+        }
 
-    for (size_t child = 0; child < child_count; ++child)
-    {
-        ModelIndex index = d_itemModel->makeIndex(child, root_index);
+        ModelIndex root_index = d_itemModel->getRootIndex();
+        size_t child_count = d_itemModel->getChildCount(root_index);
 
-        if (d_needsFullRender)
+        if (d_isVirtualizationEnabled && !d_needsFullRender)
         {
-            ListViewItemRenderingState state = ListViewItemRenderingState(this);
-            updateItem(state, index, d_renderedMaxWidth, d_renderedTotalHeight);
-            d_items.push_back(std::move(state));
+            // Existing items keep their last known size; the visible ones are
+            // laid out again by layoutVisibleItems.
+            if (++d_layoutGeneration == 0)
+                ++d_layoutGeneration;
         }
         else
         {
-            ListViewItemRenderingState& item = d_items.at(child);
-            d_renderedTotalHeight -= item.d_size.d_height;
+            if (d_needsFullRender)
+                d_items.reserve(child_count);
+
+            for (size_t child = 0; child < child_count; ++child)
+            {
+                ModelIndex index = d_itemModel->makeIndex(child, root_index);
+
+                if (d_needsFullRender)
+                {
+                    d_items.push_back(std::make_unique<ListViewItemRenderingState>(this));
+                    ListViewItemRenderingState& item = *d_items.back();
+                    if (d_isVirtualizationEnabled)
+                        updateItemEstimate(item, index, d_renderedTotalHeight);
+                    else
+                        updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+                }
+                else
+                {
+                    ListViewItemRenderingState& item = *d_items.at(child);
+                    d_renderedTotalHeight -= item.d_size.d_height;
+
+                    updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+                }
+            }
+        }
+
+        updateScrollbars();
+        setIsDirty(false);
+
+        // Changes to the order of the items are applied as the model reports
+        // them, so only a full render needs to sort.
+        if (d_needsFullRender)
+            resortListView();
+        else if (!d_isVirtualizationEnabled)
+            rebuildHeightIndex();
 
-            updateItem(item, index, d_renderedMaxWidth, d_renderedTotalHeight);
+        d_needsFullRender = false;
+    }
+
+    if (d_isVirtualizationEnabled)
+        layoutVisibleItems();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::layoutVisibleItems()
+{
+    const Rectf render_area(getViewRenderer()->getViewRenderArea());
+    const float margin = render_area.getHeight() * 0.5f;
+    const float scroll_position = getVertScrollbar()->getScrollPosition();
+    const float bottom = scroll_position + render_area.getHeight() + margin;
+
+    const size_t first = d_heightIndex.getPositionAtOffset(scroll_position - margin);
+    float offset = d_heightIndex.getOffset(first);
+    bool extents_changed = false;
+
+    size_t position = first;
+    for (; position < d_sortedItems.size() && offset < bottom; ++position)
+    {
+        ListViewItemRenderingState& item = *d_sortedItems[position];
+
+        if (item.d_layoutGeneration != d_layoutGeneration)
+        {
+            const float old_height = item.d_size.d_height;
+
+            if (item.d_layoutGeneration == 0)
+                item.d_renderedText = acquireRenderedText();
+
+            updateItem(item, item.d_index, d_renderedMaxWidth, d_renderedTotalHeight);
+            d_renderedTotalHeight -= old_height;
+            item.d_layoutGeneration = d_layoutGeneration;
+
+            if (item.d_size.d_height != old_height)
+            {
+                d_heightIndex.setHeight(position, item.d_size.d_height);
+                extents_changed = true;
+            }
         }
+
+        offset += item.d_size.d_height;
     }
 
-    updateScrollbars();
-    setIsDirty(false);
-    resortListView();
-    d_needsFullRender = false;
+    for (size_t i = d_laidOutBegin; i < d_laidOutEnd; ++i)
+    {
+        if (i < first || i >= position)
+            releaseItemLayout(*d_sortedItems[i]);
+    }
+
+    d_laidOutBegin = first;
+    d_laidOutEnd = position;
+
+    if (extents_changed)
+        updateScrollbars();
+}
+
+//----------------------------------------------------------------------------//
+void ListView::releaseItemLayout(ListViewItemRenderingState& item)
+{
+    if (item.d_layoutGeneration == 0)
+        return;
+
+    releaseRenderedText(item.d_renderedText);
+    item.d_text.clear();
+    item.d_icon = ImageHandle();
+    item.d_layoutGeneration = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -173,24 +266,27 @@ ModelIndex ListView::indexAtLocal(const glm::vec2& localPos)
     prepareForRender();
 
     Rectf render_area(getViewRenderer()->getViewRenderArea());
-    if (!render_area.isPointInRectf(localPos))
+    if (!render_area.isPointInRectf(localPos) || d_sortedItems.empty())
         return ModelIndex();
 
-    float cur_height = render_area.d_min.y - getVertScrollbar()->getScrollPosition();
-    //TODO: start only on the visible area
-    for (size_t index = 0; index < d_sortedItems.size(); ++index)
-    {
-        ListViewItemRenderingState* item = d_sortedItems.at(index);
-        Sizef size = item->d_size;
-        float next_height = cur_height + size.d_height;
+    const float offset = localPos.y - render_area.d_min.y +
+        getVertScrollbar()->getScrollPosition();
+    if (offset < 0 || offset > d_heightIndex.getTotalHeight())
+        return ModelIndex();
 
-        if (localPos.y >= cur_height && localPos.y <= next_height)
-            return item->d_index;
+    return d_sortedItems[d_heightIndex.getPositionAtOffset(offset)]->d_index;
+}
 
-        cur_height = next_height;
-    }
+//----------------------------------------------------------------------------//
+float ListView::getItemOffset(size_t position) const
+{
+    return d_heightIndex.getOffset(position);
+}
 
-    return ModelIndex();
+//----------------------------------------------------------------------------//
+size_t ListView::getItemPositionAtOffset(float offset) const
+{
+    return d_heightIndex.getPositionAtOffset(offset);
 }
 
 //----------------------------------------------------------------------------//
@@ -203,15 +299,39 @@ const std::vector<ListViewItemRenderingState*>& ListView::getItems() const
 void ListView::resortListView()
 {
     d_sortedItems.clear();
+    d_sortedItems.reserve(d_items.size());
 
     for (auto& item : d_items)
-        d_sortedItems.push_back(&item);
+        d_sortedItems.push_back(item.get());
 
-    if (d_sortMode == ViewSortMode::NoSorting)
-        return;
+    if (d_sortMode != ViewSortMode::NoSorting)
+    {
+        sort(d_sortedItems.begin(), d_sortedItems.end(),
+            d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    }
 
-    sort(d_sortedItems.begin(), d_sortedItems.end(),
-        d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+    d_itemsChangingData.clear();
+    rebuildHeightIndex();
+
+    // positions changed, so the laid out range is no longer known.
+    if (d_laidOutBegin != d_laidOutEnd)
+    {
+        for (auto& item : d_items)
+            releaseItemLayout(*item);
+
+        d_laidOutBegin = d_laidOutEnd = 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ListView::rebuildHeightIndex()
+{
+    std::vector<float> heights;
+    heights.reserve(d_sortedItems.size());
+    for (const auto item : d_sortedItems)
+        heights.push_back(item->d_size.d_height);
+
+    d_heightIndex.build(std::move(heights));
 }
 
 //----------------------------------------------------------------------------//
@@ -221,10 +341,104 @@ void ListView::resortView()
     invalidateView(false);
 }
 
+//----------------------------------------------------------------------------//
+size_t ListView::getSortedInsertPosition(const ListViewItemRenderingState& item,
+    size_t model_position) const
+{
+    if (d_sortMode == ViewSortMode::NoSorting)
+        return model_position;
+
+    // upper_bound keeps items that compare equal in model order.
+    const auto position = std::upper_bound(d_sortedItems.begin(),
+        d_sortedItems.end(), &item,
+        d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+
+    return static_cast<size_t>(position - d_sortedItems.begin());
+}
+
+//----------------------------------------------------------------------------//
+size_t ListView::getSortedPosition(const ListViewItemRenderingState& item,
+    size_t model_position) const
+{
+    if (d_sortMode == ViewSortMode::NoSorting)
+        return model_position;
+
+    const auto range = std::equal_range(d_sortedItems.begin(),
+        d_sortedItems.end(), &item,
+        d_sortMode == ViewSortMode::Ascending ? &listViewItemPointerLess : &listViewItemPointerGreater);
+
+    auto position = std::find(range.first, range.second, &item);
+
+    // the model changed the data without telling us; look everywhere.
+    if (position == range.second)
+        position = std::find(d_sortedItems.begin(), d_sortedItems.end(), &item);
+
+    return static_cast<size_t>(position - d_sortedItems.begin());
+}
+
+//----------------------------------------------------------------------------//
+void ListView::insertSortedItem(ListViewItemRenderingState& item, size_t sorted_position)
+{
+    d_sortedItems.insert(d_sortedItems.begin() + sorted_position, &item);
+    d_heightIndex.insert(sorted_position, item.d_size.d_height);
+
+    if (sorted_position < d_laidOutBegin)
+    {
+        ++d_laidOutBegin;
+        ++d_laidOutEnd;
+    }
+    else if (sorted_position < d_laidOutEnd)
+        ++d_laidOutEnd;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::eraseSortedItem(size_t sorted_position)
+{
+    releaseItemLayout(*d_sortedItems[sorted_position]);
+
+    d_sortedItems.erase(d_sortedItems.begin() + sorted_position);
+    d_heightIndex.erase(sorted_position);
+
+    if (sorted_position < d_laidOutBegin)
+    {
+        --d_laidOutBegin;
+        --d_laidOutEnd;
+    }
+    else if (sorted_position < d_laidOutEnd)
+        --d_laidOutEnd;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::refreshItemIndices(size_t first)
+{
+    switch (d_itemModel->getIndexStability())
+    {
+    case ModelIndexStability::Stable:
+        return;
+    case ModelIndexStability::Volatile:
+        first = 0;
+        break;
+    default:
+        break;
+    }
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    for (size_t child = first; child < d_items.size(); ++child)
+        d_items[child]->d_index = d_itemModel->makeIndex(child, root_index);
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateExtentsAndInvalidate()
+{
+    updateScrollbars();
+    resizeToContent();
+    invalidate(false);
+}
+
 //----------------------------------------------------------------------------//
 void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index, float& max_width, float& total_height)
 {
-    item.d_text = d_itemModel->getData(index);
+    item.d_text = d_itemModel->getItemData(index).toString();
 
     TextParser* parser = getTextParser();
     item.d_renderedText.renderText(item.d_text, getTextParser(), getEffectiveFont(), DefaultParagraphDirection::LeftToRight);
@@ -241,7 +455,7 @@ void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index, fl
     item.d_renderedText.updateFormatting(itemsAreaSize.d_width);
 
     item.d_index = index;
-    item.d_icon = d_itemModel->getData(index, ItemDataRole::Icon);
+    item.d_icon = d_itemModel->getItemData(index, ItemDataRole::Icon).getImageHandle();
     item.d_size = item.d_renderedText.getExtents();
 
     max_width = std::max(item.d_size.d_width, max_width);
@@ -251,72 +465,273 @@ void ListView::updateItem(ListViewItemRenderingState &item, ModelIndex index, fl
     item.d_isSelected = isIndexSelected(index);
 }
 
+//----------------------------------------------------------------------------//
+void ListView::updateItemEstimate(ListViewItemRenderingState& item,
+    ModelIndex index, float& total_height)
+{
+    item.d_index = index;
+    item.d_size = Sizef(0.0f, getEffectiveEstimatedItemHeight());
+
+    total_height += item.d_size.d_height;
+}
+
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenAdded(const EventArgs& args)
 {
+    const bool was_dirty = isDirty();
     ItemView::onChildrenAdded(args);
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
-    if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+    // items not built yet are all created by the next full render.
+    if (d_needsFullRender ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
-    std::vector<ListViewItemRenderingState> items;
+    std::vector<std::unique_ptr<ListViewItemRenderingState>> items;
+    items.reserve(margs.d_count);
     for (size_t i = 0; i < margs.d_count; ++i)
     {
-        ListViewItemRenderingState item(this);
+        items.push_back(std::make_unique<ListViewItemRenderingState>(this));
+        ModelIndex index = d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex);
 
-        updateItem(item,
-            d_itemModel->makeIndex(margs.d_startId + i, margs.d_parentIndex),
-            d_renderedMaxWidth, d_renderedTotalHeight);
+        if (d_isVirtualizationEnabled)
+            updateItemEstimate(*items.back(), index, d_renderedTotalHeight);
+        else
+            updateItem(*items.back(), index, d_renderedMaxWidth, d_renderedTotalHeight);
+    }
 
-        items.push_back(std::move(item));
+    d_items.insert(d_items.begin() + margs.d_startId,
+        std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+
+    // the new items already have fresh indices.
+    refreshItemIndices(margs.d_startId + margs.d_count);
+
+    for (size_t i = 0; i < margs.d_count; ++i)
+    {
+        const size_t child = margs.d_startId + i;
+        ListViewItemRenderingState& item = *d_items[child];
+        insertSortedItem(item, getSortedInsertPosition(item, child));
     }
 
-    d_items.insert(d_items.begin() + margs.d_startId, std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    // only the new items needed a layout; the others are still valid.
+    setIsDirty(was_dirty);
+    updateExtentsAndInvalidate();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::onChildrenWillBeRemoved(const EventArgs& args)
+{
+    if (!ItemView::onChildrenWillBeRemoved(args))
+        return false;
+
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (d_needsFullRender || d_sortMode == ViewSortMode::NoSorting ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        return true;
+
+    // the items have to be located while their data can still be compared.
+    for (size_t i = 0; i < margs.d_count; ++i)
+    {
+        const size_t child = margs.d_startId + i;
+        if (child >= d_items.size())
+            break;
+
+        eraseSortedItem(getSortedPosition(*d_items[child], child));
+    }
 
-    //TODO: insert in the right place directly!
-    resortListView();
-    invalidateView(false);
     return true;
 }
 
 //----------------------------------------------------------------------------//
 bool ListView::onChildrenRemoved(const EventArgs& args)
 {
+    const bool was_dirty = isDirty();
     ItemView::onChildrenRemoved(args);
     const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
 
-    if (!d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+    if (d_needsFullRender ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
         return true;
 
     auto begin = d_items.begin() + margs.d_startId;
     auto end = begin + margs.d_count;
     for (auto itor = begin; itor < end; ++itor)
-        d_renderedTotalHeight -= (*itor).d_size.d_height;
+    {
+        d_renderedTotalHeight -= (*itor)->d_size.d_height;
+        d_itemsChangingData.erase(std::remove(d_itemsChangingData.begin(),
+            d_itemsChangingData.end(), itor->get()), d_itemsChangingData.end());
+    }
+
+    if (d_sortMode == ViewSortMode::NoSorting && d_sortedItems.size() == d_items.size())
+    {
+        for (size_t i = margs.d_count; i > 0; --i)
+            eraseSortedItem(margs.d_startId + i - 1);
+    }
+
+    const bool sorted_items_removed =
+        d_sortedItems.size() + margs.d_count == d_items.size();
 
     d_items.erase(begin, end);
+    refreshItemIndices(margs.d_startId);
 
-    resortListView();
-    invalidateView(false);
+    // without a prior ChildrenWillBeRemoved the removed items are unknown.
+    if (!sorted_items_removed)
+        resortListView();
+
+    setIsDirty(was_dirty);
+    updateExtentsAndInvalidate();
     return true;
 }
 
 //----------------------------------------------------------------------------//
-Rectf ListView::getIndexRect(const ModelIndex& index)
+bool ListView::onChildrenDataWillChange(const EventArgs& args)
 {
-    int child_id = d_itemModel->getChildId(index);
-    if (child_id == -1)
+    ItemView::onChildrenDataWillChange(args);
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (d_needsFullRender || d_sortMode == ViewSortMode::NoSorting ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        return true;
+
+    // take the items out of the sorted order while their old data is there
+    // to find them; they are put back once the new data is known.
+    for (size_t i = 0; i < margs.d_count; ++i)
     {
-        return Rectf(0, 0, 0, 0);
+        const size_t child = margs.d_startId + i;
+        if (child >= d_items.size())
+            break;
+
+        ListViewItemRenderingState& item = *d_items[child];
+        if (std::find(d_itemsChangingData.begin(), d_itemsChangingData.end(), &item) !=
+            d_itemsChangingData.end())
+            continue;
+
+        eraseSortedItem(getSortedPosition(item, child));
+        d_itemsChangingData.push_back(&item);
     }
 
-    glm::vec2 pos(0, 0);
+    return true;
+}
 
-    for (size_t i = 0; i < static_cast<size_t>(child_id); ++i)
+//----------------------------------------------------------------------------//
+bool ListView::onChildrenDataChanged(const EventArgs& args)
+{
+    const ModelEventArgs& margs = static_cast<const ModelEventArgs&>(args);
+
+    if (d_needsFullRender ||
+        !d_itemModel->areIndicesEqual(margs.d_parentIndex, d_itemModel->getRootIndex()))
+        return ItemView::onChildrenDataChanged(args);
+
+    for (size_t i = 0; i < margs.d_count; ++i)
+    {
+        const size_t child = margs.d_startId + i;
+        if (child >= d_items.size())
+            break;
+
+        ListViewItemRenderingState& item = *d_items[child];
+
+        if (d_sortMode != ViewSortMode::NoSorting)
+        {
+            auto changing = std::find(d_itemsChangingData.begin(),
+                d_itemsChangingData.end(), &item);
+
+            if (changing != d_itemsChangingData.end())
+                d_itemsChangingData.erase(changing);
+            else
+            {
+                auto position = std::find(d_sortedItems.begin(), d_sortedItems.end(), &item);
+                eraseSortedItem(static_cast<size_t>(position - d_sortedItems.begin()));
+            }
+        }
+        else
+        {
+            releaseItemLayout(item);
+        }
+
+        // the item is measured again by updateDirtyRanges, or when it
+        // becomes visible if virtualization is enabled.
+        item.d_index = d_itemModel->makeIndex(child, margs.d_parentIndex);
+
+        if (d_sortMode != ViewSortMode::NoSorting)
+            insertSortedItem(item, getSortedInsertPosition(item, child));
+    }
+
+    if (d_isVirtualizationEnabled)
+        invalidate(false);
+    else
+        markRangeDirty(margs.d_parentIndex, margs.d_startId, margs.d_count);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void ListView::updateDirtyRanges(const ModelIndexRangeVector& ranges)
+{
+    // virtualized views lay out the changed items once they are visible.
+    if (d_isVirtualizationEnabled)
+        return;
+
+    const ModelIndex root_index = d_itemModel->getRootIndex();
+    bool extents_changed = false;
+
+    for (const ModelIndexRange& range : ranges)
     {
-        pos.y += d_items.at(i).d_size.d_height;
+        // only direct children of the root are shown by a list.
+        if (!d_itemModel->areIndicesEqual(range.d_parentIndex, root_index))
+            continue;
+
+        const size_t end = std::min(range.d_startId + range.d_count, d_items.size());
+        for (size_t child = range.d_startId; child < end; ++child)
+        {
+            ListViewItemRenderingState& item = *d_items[child];
+            const Sizef old_size = item.d_size;
+
+            d_renderedTotalHeight -= old_size.d_height;
+            updateItem(item, item.d_index, d_renderedMaxWidth, d_renderedTotalHeight);
+
+            if (item.d_size == old_size)
+                continue;
+
+            const size_t sorted_position = getSortedPosition(item, child);
+            if (sorted_position < d_sortedItems.size())
+                d_heightIndex.setHeight(sorted_position, item.d_size.d_height);
+
+            extents_changed = true;
+        }
+    }
+
+    if (extents_changed)
+    {
+        updateScrollbars();
+        resizeToContent();
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool ListView::onScrollPositionChanged(const EventArgs&)
+{
+    // Scrolling doesn't change the layout of the items, so there's no need
+    // to mark the view dirty; just redraw it.
+    invalidate(false);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ListView::getIndexRect(const ModelIndex& index)
+{
+    int child_id = d_itemModel->getChildId(index);
+    if (child_id == -1 || static_cast<size_t>(child_id) >= d_items.size())
+    {
+        return Rectf(0, 0, 0, 0);
     }
 
-    return Rectf(pos, d_items.at(static_cast<size_t>(child_id)).d_size);
+    const ListViewItemRenderingState& item = *d_items[static_cast<size_t>(child_id)];
+    const size_t position = getSortedPosition(item, static_cast<size_t>(child_id));
+    if (position >= d_sortedItems.size())
+        return Rectf(0, 0, 0, 0);
+
+    return Rectf(glm::vec2(0, d_heightIndex.getOffset(position)), item.d_size);
 }
 }
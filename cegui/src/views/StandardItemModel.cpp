@@ -54,12 +54,14 @@ GenericItemModel<StandardItem>(new StandardItem)
 //----------------------------------------------------------------------------//
 void StandardItemModel::updateItemText(StandardItem* item, const String& new_text)
 {
-    ModelIndex parent_index = getParentIndex(getIndexForItem(item));
+    const ModelIndex index = getIndexForItem(item);
+    const ModelIndex parent_index = getParentIndex(index);
+    const size_t child_id = static_cast<size_t>(getChildId(index));
 
-    notifyChildrenDataWillChange(parent_index, 0, 1);
+    notifyChildrenDataWillChange(parent_index, child_id, 1);
 
     item->setText(new_text);
 
-    notifyChildrenDataChanged(parent_index, 0, 1);
+    notifyChildrenDataChanged(parent_index, child_id, 1);
 }
 }
@@ -71,6 +71,7 @@ TreeViewItemRenderingState::TreeViewItemRenderingState(TreeView* attached_tree_v
     d_childId(0),
     d_subtreeIsExpanded(false),
     d_nestedLevel(0),
+    d_layoutGeneration(0),
     d_attachedTreeView(attached_tree_view)
 {
 }
@@ -120,7 +121,8 @@ bool TreeViewItemRenderingState::operator>(const TreeViewItemRenderingState& oth
 TreeView::TreeView(const String& type, const String& name) :
     ItemView(type, name),
     d_rootItemState(this),
-    d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin)
+    d_subtreeExpanderMargin(DefaultSubtreeExpanderMargin),
+    d_layoutGeneration(1)
 {
     addTreeViewProperties();
 }
@@ -165,32 +167,118 @@ void TreeView::prepareForRender()
 {
     ItemView::prepareForRender();
     //TODO: better way of ignoring the null item model? E.g.: warn? Throw an exception?
-    if (d_itemModel == nullptr || !isDirty())
+    if (d_itemModel == nullptr)
         return;
 
-    if (d_needsFullRender)
+    if (isDirty())
     {
-        ModelIndex root_index = d_itemModel->getRootIndex();
-        d_renderedMaxWidth = 0;
-        d_renderedTotalHeight = 0;
+        if (d_needsFullRender)
+        {
+            ModelIndex root_index = d_itemModel->getRootIndex();
+            d_renderedMaxWidth = 0;
+            d_renderedTotalHeight = 0;
 
-        d_rootItemState = TreeViewItemRenderingState(this);
-        // root item isn't a proper item so it does not have a nested level.
-        d_rootItemState.d_nestedLevel = -1;
-        d_rootItemState.d_subtreeIsExpanded = true;
+            d_rootItemState = TreeViewItemRenderingState(this);
+            // root item isn't a proper item so it does not have a nested level.
+            d_rootItemState.d_nestedLevel = -1;
+            d_rootItemState.d_subtreeIsExpanded = true;
 
-        computeRenderedChildrenForItem(d_rootItemState, root_index,
-            d_renderedMaxWidth, d_renderedTotalHeight);
+            computeRenderedChildrenForItem(d_rootItemState, root_index,
+                d_renderedMaxWidth, d_renderedTotalHeight);
+        }
+        else
+        {
+            // with virtualization, rows keep their last known size and the
+            // visible ones are laid out again by layoutVisibleItems.
+            if (d_isVirtualizationEnabled && ++d_layoutGeneration == 0)
+                ++d_layoutGeneration;
+
+            updateRenderingStateForItem(d_rootItemState,
+                d_renderedMaxWidth, d_renderedTotalHeight);
+        }
+
+        updateScrollbars();
+        setIsDirty(false);
+        d_needsFullRender = false;
     }
-    else
+
+    if (d_isVirtualizationEnabled)
+        layoutVisibleItems();
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::layoutVisibleItems()
+{
+    const Rectf render_area(getViewRenderer()->getViewRenderArea());
+    const float margin = render_area.getHeight() * 0.5f;
+    const float scroll_position = getVertScrollbar()->getScrollPosition();
+
+    float offset = 0;
+    bool extents_changed = false;
+    layoutVisibleItems(d_rootItemState, offset, scroll_position - margin,
+        scroll_position + render_area.getHeight() + margin, extents_changed);
+
+    if (extents_changed)
+        updateScrollbars();
+}
+
+//----------------------------------------------------------------------------//
+void TreeView::layoutVisibleItems(TreeViewItemRenderingState& item,
+    float& offset, float top, float bottom, bool& extents_changed)
+{
+    // rows are as tall as FalagardTreeView renders them
+    const float expander_height = getViewRenderer()->getSubtreeExpanderSize().d_height;
+
+    for (TreeViewItemRenderingState* const child : item.d_renderedChildren)
     {
-        updateRenderingStateForItem(d_rootItemState,
-            d_renderedMaxWidth, d_renderedTotalHeight);
+        float row_height = std::max(child->d_size.d_height, expander_height);
+
+        if (offset + row_height > top && offset < bottom)
+        {
+            if (child->d_layoutGeneration != d_layoutGeneration)
+            {
+                const Sizef old_size(child->d_size);
+
+                if (child->d_layoutGeneration == 0)
+                    child->d_renderedText = acquireRenderedText();
+
+                layoutItem(*child,
+                    d_itemModel->makeIndex(child->d_childId, child->d_parentIndex));
+                child->d_layoutGeneration = d_layoutGeneration;
+
+                if (child->d_size != old_size)
+                {
+                    const float indent = getViewRenderer()->getSubtreeExpanderXIndent(child->d_nestedLevel) +
+                        getViewRenderer()->getSubtreeExpanderSize().d_width;
+                    d_renderedMaxWidth = std::max(d_renderedMaxWidth, child->d_size.d_width + indent);
+                    d_renderedTotalHeight += child->d_size.d_height - old_size.d_height;
+                    row_height = std::max(child->d_size.d_height, expander_height);
+                    extents_changed = true;
+                }
+            }
+        }
+        else
+        {
+            releaseItemLayout(*child);
+        }
+
+        offset += row_height;
+
+        if (child->d_subtreeIsExpanded)
+            layoutVisibleItems(*child, offset, top, bottom, extents_changed);
     }
+}
 
-    updateScrollbars();
-    setIsDirty(false);
-    d_needsFullRender = false;
+//----------------------------------------------------------------------------//
+void TreeView::releaseItemLayout(TreeViewItemRenderingState& item)
+{
+    if (item.d_layoutGeneration == 0)
+        return;
+
+    releaseRenderedText(item.d_renderedText);
+    item.d_text.clear();
+    item.d_icon = ImageHandle();
+    item.d_layoutGeneration = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -263,18 +351,15 @@ void TreeView::updateRenderingStateForItem(TreeViewItemRenderingState& item,
 void TreeView::fillRenderingState(TreeViewItemRenderingState& item,
     const ModelIndex& index, float& rendered_max_width, float& rendered_total_height)
 {
-    item.d_text = d_itemModel->getData(index);
-    item.d_icon = d_itemModel->getData(index, ItemDataRole::Icon);
-
-    // The root item is never rendered in a tree, so we don't waste time and also keep its extents empty
-    if (&item != &d_rootItemState)
+    if (d_isVirtualizationEnabled && &item != &d_rootItemState)
     {
-        item.d_renderedText.renderText(item.d_text, getTextParser(), getEffectiveFont(), DefaultParagraphDirection::LeftToRight);
-        item.d_renderedText.setHorizontalFormatting(HorizontalTextFormatting::LeftAligned);
-        item.d_renderedText.setWordWrapEnabled(false);
-        item.d_renderedText.updateDynamicObjectExtents(this);
-        item.d_renderedText.updateFormatting(getPixelSize().d_width);
-        item.d_size = item.d_renderedText.getExtents();
+        // laid out by layoutVisibleItems once it gets close to the visible area
+        if (item.d_size.d_height == 0)
+            item.d_size.d_height = getEffectiveEstimatedItemHeight();
+    }
+    else
+    {
+        layoutItem(item, index);
     }
 
     const float indent = getViewRenderer()->getSubtreeExpanderXIndent(item.d_nestedLevel) +
@@ -285,6 +370,24 @@ void TreeView::fillRenderingState(TreeViewItemRenderingState& item,
     item.d_isSelected = isIndexSelected(index);
 }
 
+//----------------------------------------------------------------------------//
+void TreeView::layoutItem(TreeViewItemRenderingState& item, const ModelIndex& index)
+{
+    item.d_text = d_itemModel->getItemData(index).toString();
+    item.d_icon = d_itemModel->getItemData(index, ItemDataRole::Icon).getImageHandle();
+
+    // The root item is never rendered in a tree, so we don't waste time and also keep its extents empty
+    if (&item == &d_rootItemState)
+        return;
+
+    item.d_renderedText.renderText(item.d_text, getTextParser(), getEffectiveFont(), DefaultParagraphDirection::LeftToRight);
+    item.d_renderedText.setHorizontalFormatting(HorizontalTextFormatting::LeftAligned);
+    item.d_renderedText.setWordWrapEnabled(false);
+    item.d_renderedText.updateDynamicObjectExtents(this);
+    item.d_renderedText.updateFormatting(getPixelSize().d_width);
+    item.d_size = item.d_renderedText.getExtents();
+}
+
 //----------------------------------------------------------------------------//
 ModelIndex TreeView::indexAtLocal(const glm::vec2& localPos)
 {
@@ -477,6 +580,15 @@ bool TreeView::onChildrenAdded(const EventArgs& args)
     return true;
 }
 
+//----------------------------------------------------------------------------//
+bool TreeView::onScrollPositionChanged(const EventArgs&)
+{
+    // Scrolling doesn't change the layout of the items, so there's no need
+    // to mark the view dirty; just redraw it.
+    invalidate(false);
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void TreeView::onSubtreeExpanded(ItemViewEventArgs& args)
 {
@@ -64,6 +64,7 @@ void GridLayoutContainer::setGridDimensions(size_t width, size_t height)
 
     // Too many things may change, so drop the cache
     d_freeSearchStart = 0;
+    invalidateCellSizes();
 
     const size_t oldWidth = d_gridWidth;
     const size_t oldHeight = d_gridHeight;
@@ -183,6 +184,7 @@ void GridLayoutContainer::setRowMajor(bool rowMajor)
     if (d_rowMajor == rowMajor) return;
 
     d_rowMajor = rowMajor;
+    invalidateCellSizes();
     markNeedsLayouting();
 }
 
@@ -367,57 +369,199 @@ void GridLayoutContainer::layout_impl()
     const float absWidth = childContentArea.getWidth();
     const float absHeight = childContentArea.getHeight();
 
+    // Maximums of mixed relative and absolute sizes are chosen in pixels of
+    // the current area, so cached sizes are only valid while it is the same.
+    // When many cells changed at once it is cheaper to measure everything.
+    const size_t cellCount = d_gridWidth * d_gridHeight;
+    if (d_cellSizesArea != childContentArea.getSize() ||
+        d_cellSizes.size() != cellCount ||
+        d_children.size() != cellCount ||
+        d_dirtyCells.size() > d_gridWidth + d_gridHeight)
+    {
+        d_cellSizesValid = false;
+    }
+
+    // Everything in columns starting from firstCol and in rows starting from
+    // firstRow must be repositioned, other cells keep their positions
+    size_t firstCol = 0;
+    size_t firstRow = 0;
+    std::vector<size_t> movedCells;
+
+    if (!d_cellSizesValid)
+    {
+        measureAllCells(absWidth, absHeight);
+        d_cellSizesArea = childContentArea.getSize();
+        d_cellSizesValid = true;
+    }
+    else
+    {
+        firstCol = d_gridWidth;
+        firstRow = d_gridHeight;
+
+        for (Window* window : d_dirtyCells)
+        {
+            auto it = std::find(d_children.begin(), d_children.end(), window);
+            if (it == d_children.end())
+                continue;
+
+            const size_t idx = static_cast<size_t>(std::distance(d_children.begin(), it));
+            size_t x, y;
+            mapIndexToCell(idx, x, y);
+
+            // Margin may have changed even if the bounding size is the same
+            movedCells.push_back(idx);
+
+            const UVector2 size = getBoundingSizeForWindow(window);
+            if (size == d_cellSizes[idx])
+                continue;
+
+            d_cellSizes[idx] = size;
+
+            if (updateColumnSize(x, absWidth))
+                firstCol = std::min(firstCol, x + 1);
+
+            if (updateRowSize(y, absHeight))
+                firstRow = std::min(firstRow, y + 1);
+        }
+    }
+
+    d_dirtyCells.clear();
+
+    // Column and row offsets only change after the first resized line
+    d_colOffsets.resize(d_gridWidth + 1);
+    d_rowOffsets.resize(d_gridHeight + 1);
+    d_colOffsets[0] = UDim(0.f, 0.f);
+    d_rowOffsets[0] = UDim(0.f, 0.f);
+    for (size_t x = (firstCol ? firstCol - 1 : 0); x < d_gridWidth; ++x)
+        d_colOffsets[x + 1] = d_colOffsets[x] + d_colSizes[x];
+    for (size_t y = (firstRow ? firstRow - 1 : 0); y < d_gridHeight; ++y)
+        d_rowOffsets[y + 1] = d_rowOffsets[y] + d_rowSizes[y];
+
+    for (size_t y = 0; y < d_gridHeight; ++y)
+        for (size_t x = (y < firstRow ? firstCol : 0); x < d_gridWidth; ++x)
+            positionCell(x, y);
+
+    for (size_t idx : movedCells)
+    {
+        size_t x, y;
+        mapIndexToCell(idx, x, y);
+        positionCell(x, y);
+    }
+
+    // Now we just need to set the total width and height
+    setSize(USize(d_colOffsets[d_gridWidth], d_rowOffsets[d_gridHeight]));
+}
+
+//----------------------------------------------------------------------------//
+void GridLayoutContainer::measureAllCells(float absWidth, float absHeight)
+{
     // First, we need to determine rowSizes and colSizes, this is
     // needed before any layouting work takes place
-    std::vector<UDim> colSizes(d_gridWidth, UDim(0, 0));
-    std::vector<UDim> rowSizes(d_gridHeight, UDim(0, 0));
+    d_cellSizes.resize(d_gridWidth * d_gridHeight);
+    d_colSizes.assign(d_gridWidth, UDim(0, 0));
+    d_rowSizes.assign(d_gridHeight, UDim(0, 0));
     for (size_t y = 0; y < d_gridHeight; ++y)
     {
         for (size_t x = 0; x < d_gridWidth; ++x)
         {
-            Window* window = getChildAtIndex(mapCellToIndex(x, y));
-            const UVector2 size = getBoundingSizeForWindow(window);
+            const size_t idx = mapCellToIndex(x, y);
+            const UVector2 size = getBoundingSizeForWindow(getChildAtIndex(idx));
+            d_cellSizes[idx] = size;
 
-            if (CoordConverter::asAbsolute(colSizes[x], absWidth) <
+            if (CoordConverter::asAbsolute(d_colSizes[x], absWidth) <
                 CoordConverter::asAbsolute(size.d_x, absWidth))
             {
-                colSizes[x] = size.d_x;
+                d_colSizes[x] = size.d_x;
             }
 
-            if (CoordConverter::asAbsolute(rowSizes[y], absHeight) <
+            if (CoordConverter::asAbsolute(d_rowSizes[y], absHeight) <
                 CoordConverter::asAbsolute(size.d_y, absHeight))
             {
-                rowSizes[y] = size.d_y;
+                d_rowSizes[y] = size.d_y;
             }
         }
     }
 
-    // OK, now rowSizes[y] is the height of y-th row
-    //         colSizes[x] is the width of x-th column
+    // OK, now d_rowSizes[y] is the height of y-th row
+    //         d_colSizes[x] is the width of x-th column
+}
 
-    // Second layouting phase starts now
-    UDim cellX;
-    UDim cellY(0.f, 0.f);
+//----------------------------------------------------------------------------//
+bool GridLayoutContainer::updateColumnSize(size_t gridX, float absWidth)
+{
+    UDim colSize(0, 0);
     for (size_t y = 0; y < d_gridHeight; ++y)
     {
-        cellX.d_scale = 0.f;
-        cellX.d_offset = 0.f;
-        
-        for (size_t x = 0; x < d_gridWidth; ++x)
+        const UDim& width = d_cellSizes[mapCellToIndex(gridX, y)].d_x;
+        if (CoordConverter::asAbsolute(colSize, absWidth) <
+            CoordConverter::asAbsolute(width, absWidth))
         {
-            Window* window = getChildAtIndex(mapCellToIndex(x, y));
-            const UVector2 offset = getOffsetForWindow(window);
-            window->setPosition(UVector2(cellX, cellY) + offset);
-
-            cellX += colSizes[x];
+            colSize = width;
         }
+    }
+
+    if (colSize == d_colSizes[gridX])
+        return false;
 
-        cellY += rowSizes[y];
+    d_colSizes[gridX] = colSize;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool GridLayoutContainer::updateRowSize(size_t gridY, float absHeight)
+{
+    UDim rowSize(0, 0);
+    for (size_t x = 0; x < d_gridWidth; ++x)
+    {
+        const UDim& height = d_cellSizes[mapCellToIndex(x, gridY)].d_y;
+        if (CoordConverter::asAbsolute(rowSize, absHeight) <
+            CoordConverter::asAbsolute(height, absHeight))
+        {
+            rowSize = height;
+        }
     }
 
-    // Now we just need to set the total width and height
+    if (rowSize == d_rowSizes[gridY])
+        return false;
+
+    d_rowSizes[gridY] = rowSize;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void GridLayoutContainer::positionCell(size_t gridX, size_t gridY)
+{
+    Window* window = getChildAtIndex(mapCellToIndex(gridX, gridY));
+    const UVector2 position =
+        UVector2(d_colOffsets[gridX], d_rowOffsets[gridY]) + getOffsetForWindow(window);
+
+    if (window->getPosition() != position)
+        window->setPosition(position);
+}
 
-    setSize(USize(cellX, cellY));
+//----------------------------------------------------------------------------//
+void GridLayoutContainer::invalidateCellSizes()
+{
+    d_cellSizesValid = false;
+    d_dirtyCells.clear();
+}
+
+//----------------------------------------------------------------------------//
+bool GridLayoutContainer::handleChildSized(const EventArgs& e)
+{
+    if (d_cellSizesValid)
+        d_dirtyCells.push_back(static_cast<Window*>(static_cast<const ElementEventArgs&>(e).element));
+
+    return LayoutContainer::handleChildSized(e);
+}
+
+//----------------------------------------------------------------------------//
+bool GridLayoutContainer::handleChildMarginChanged(const EventArgs& e)
+{
+    if (d_cellSizesValid)
+        d_dirtyCells.push_back(static_cast<const WindowEventArgs&>(e).window);
+
+    return LayoutContainer::handleChildMarginChanged(e);
 }
 
 //----------------------------------------------------------------------------//
@@ -425,6 +569,7 @@ void GridLayoutContainer::onChildOrderChanged(ElementEventArgs& e)
 {
     // TODO: could optimize if e would contain the first affected index
     d_freeSearchStart = 0;
+    invalidateCellSizes();
     LayoutContainer::onChildOrderChanged(e);
 }
 
@@ -504,6 +649,9 @@ void GridLayoutContainer::addChild_impl(Element* element)
     // Skips LayoutContainer's subscriptions on child resizing and draw list
     // maintaining because dummies have no size and are invisible.
     // Skips already existing child name check because we guarantee uniqueness.
+    if (d_cellSizesValid)
+        d_dirtyCells.push_back(static_cast<Window*>(element));
+
     if (isDummy(*element))
     {
         Element::addChild_impl(element);
@@ -598,6 +746,8 @@ void GridLayoutContainer::removeChild_impl(Element* element)
         // Free cells may shift towards the beginning of the child list
         if (d_freeSearchStart > 0)
             --d_freeSearchStart;
+
+        invalidateCellSizes();
     }
 
     LayoutContainer::removeChild_impl(element);
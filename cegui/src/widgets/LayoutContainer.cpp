@@ -31,6 +31,7 @@
 #endif
 
 #include "CEGUI/widgets/LayoutContainer.h"
+#include "CEGUI/GUIContext.h"
 
 namespace CEGUI
 {
@@ -51,6 +52,18 @@ LayoutContainer::LayoutContainer(const String& type, const String& name):
                    Event::Subscriber(&LayoutContainer::handleChildRemoved, this));
 }
 
+//----------------------------------------------------------------------------//
+void LayoutContainer::markNeedsLayouting()
+{
+    if (d_needsLayouting)
+        return;
+
+    d_needsLayouting = true;
+
+    if (d_guiContext)
+        d_guiContext->requestLayout(this);
+}
+
 //----------------------------------------------------------------------------//
 void LayoutContainer::layoutIfNecessary()
 {
@@ -68,7 +81,16 @@ void LayoutContainer::layoutIfNecessary()
 void LayoutContainer::update(float elapsed)
 {
     Window::update(elapsed);
-    layoutIfNecessary();
+
+    if (!d_needsLayouting)
+        return;
+
+    // The context lays out all pending containers at once after the update.
+    // Requesting again covers containers marked before they were attached.
+    if (d_guiContext)
+        d_guiContext->requestLayout(this);
+    else
+        layoutIfNecessary();
 }
 
 //----------------------------------------------------------------------------//
@@ -83,7 +83,9 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(nullptr),
     d_columnCount(0),
-    d_autoSizeColumnUsesHeader(false)
+    d_autoSizeColumnUsesHeader(false),
+    d_rowOffsetsValid(false),
+    d_rowHeightsValid(true)
 {
 	// add properties
 	addMultiColumnListProperties();
@@ -798,6 +800,7 @@ void MultiColumnList::removeColumn(unsigned int col_idx)
 		// remove header segment
 		getListHeader()->removeColumn(col_idx);
         --d_columnCount;
+        invalidateRowHeights();
 
 		// signal a change to the list contents
 		WindowEventArgs args(this);
@@ -865,6 +868,7 @@ unsigned int MultiColumnList::addRow(ListboxItem* item, unsigned int col_id, uns
 		// establish item ownership & enter item into column
 		item->setOwnerWindow(this);
 		row[col_idx] = item;
+		row.d_height = item->getPixelSize().d_height;
 	}
 
 	unsigned int pos;
@@ -1018,6 +1022,7 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 		item->setOwnerWindow(this);
 
 	d_grid[position.row][position.column] = item;
+	d_grid[position.row].d_height = getHighestRowItemHeight(position.row);
 
 
 	// signal a change to the list contents
@@ -1318,6 +1323,7 @@ void MultiColumnList::setItemSelectState(const MCLGridRef& grid_ref, bool state)
 *************************************************************************/
 void MultiColumnList::handleUpdatedItemData(void)
 {
+    invalidateRowHeights();
     resortList();
 	configureScrollbars();
 	invalidate();
@@ -1455,14 +1461,89 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
-	float height = 0.0f;
+    updateRowOffsets();
+    return d_rowOffsets.back();
+}
 
-	for (unsigned int i = 0; i < getRowCount(); ++i)
-	{
-		height += getHighestRowItemHeight(i);
-	}
 
-	return height;
+/*************************************************************************
+	Return the distance from the top of the first row to the given row
+*************************************************************************/
+float MultiColumnList::getRowOffset(unsigned int row_idx) const
+{
+    if (row_idx > getRowCount())
+        throw InvalidRequestException("specified row is out of range.");
+
+    updateRowOffsets();
+    return d_rowOffsets[row_idx];
+}
+
+
+/*************************************************************************
+	Return the row at the given distance from the top of the first row
+*************************************************************************/
+unsigned int MultiColumnList::getRowAtOffset(float offset) const
+{
+    updateRowOffsets();
+
+    // d_rowOffsets[0] is always 0, so the first offset greater than the
+    // requested one is the start of the row following the one we want.
+    const auto next_row = std::upper_bound(d_rowOffsets.begin(), d_rowOffsets.end(), offset);
+    if (next_row == d_rowOffsets.begin())
+        return 0;
+
+    return std::min(getRowCount(),
+        static_cast<unsigned int>(std::distance(d_rowOffsets.begin(), next_row) - 1));
+}
+
+
+/*************************************************************************
+	Mark the cached row offsets as out of date
+*************************************************************************/
+void MultiColumnList::invalidateRowOffsets()
+{
+    d_rowOffsetsValid = false;
+}
+
+
+/*************************************************************************
+	Mark the cached height of every row as out of date
+*************************************************************************/
+void MultiColumnList::invalidateRowHeights()
+{
+    d_rowHeightsValid = false;
+    d_rowOffsetsValid = false;
+}
+
+
+/*************************************************************************
+	Recalculate the cached row offsets if needed
+*************************************************************************/
+void MultiColumnList::updateRowOffsets() const
+{
+    if (d_rowOffsetsValid)
+        return;
+
+    const unsigned int row_count = getRowCount();
+    d_rowOffsets.resize(row_count + 1);
+
+    if (!d_rowHeightsValid)
+    {
+        for (unsigned int i = 0; i < row_count; ++i)
+            d_grid[i].d_height = getHighestRowItemHeight(i);
+
+        d_rowHeightsValid = true;
+    }
+
+    float offset = 0.0f;
+    for (unsigned int i = 0; i < row_count; ++i)
+    {
+        d_rowOffsets[i] = offset;
+        offset += d_grid[i].d_height;
+    }
+    d_rowOffsets[row_count] = offset;
+
+    d_rowOffsetsValid = true;
 }
 
 
@@ -1595,26 +1676,22 @@ ListboxItem* MultiColumnList::getItemAtPoint(const glm::vec2& localPos) const
     if(y > localPos.y)
         return nullptr;
 
-    for (unsigned int i = 0; i < getRowCount(); ++i)
+    // locate the row from the cached row offsets
+    const unsigned int row = getRowAtOffset(localPos.y - y);
+    if (row >= getRowCount())
+        return nullptr;
+
+    // scan across to find column that was clicked
+    for (unsigned int j = 0; j < getColumnCount(); ++j)
     {
-        y += getHighestRowItemHeight(i);
+        const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
+        x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
 
-        // have we located the row?
-        if (localPos.y < y)
+        // was this the column?
+        if (localPos.x < x)
         {
-            // scan across to find column that was clicked
-            for (unsigned int j = 0; j < getColumnCount(); ++j)
-            {
-                const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
-                x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
-
-                // was this the column?
-                if (localPos.x < x)
-                {
-                    // return contents of grid element that was clicked.
-                    return d_grid[i][j];
-                }
-            }
+            // return contents of grid element that was clicked.
+            return d_grid[row][j];
         }
     }
 
@@ -1833,6 +1910,7 @@ void MultiColumnList::onSelectionChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onListContentsChanged(WindowEventArgs& e)
 {
+    invalidateRowOffsets();
 	configureScrollbars();
 	invalidate();
 	fireEvent(EventListContentsChanged, e, EventNamespace);
@@ -1886,6 +1964,12 @@ bool MultiColumnList::handleFontRenderSizeChange(const Font& font)
             if (auto item = d_grid[i][j])
                 handled |= item->handleFontRenderSizeChange(&font);
 
+    if (handled)
+    {
+        invalidateRowHeights();
+        configureScrollbars();
+    }
+
     for (unsigned int col = 0; col < getColumnCount(); ++col)
     {
         if (getHeaderSegmentForColumn(col).getFont() == &font)
@@ -1909,6 +1993,9 @@ void MultiColumnList::onFontChanged(WindowEventArgs& e)
     for (unsigned int col = 0; col < getColumnCount(); ++col)
         getHeaderSegmentForColumn(col).setFont(d_font);
 
+    // items without their own font use ours, so row heights may change.
+    invalidateRowHeights();
+
     // Call base class handler
     Window::onFontChanged(e);
 }
@@ -2308,6 +2395,7 @@ bool MultiColumnList::resetList_impl(void)
 
 		// clear all items from the grid.
 		d_grid.clear();
+        invalidateRowOffsets();
 
 		// reset other affected fields
 		d_nominatedSelectRow = 0;
@@ -2521,16 +2609,12 @@ void MultiColumnList::ensureRowIsVisible(unsigned int row_idx)
     else
     {
         float bottom;
-        float top = 0.0f;
+        float top;
         float listHeight = getListRenderArea().getHeight();
 
-        // get distance to top of item
-        unsigned int row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
-
-        // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        // get distance to top and bottom of item
+        top = getRowOffset(row_idx);
+        bottom = getRowOffset(row_idx + 1);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2678,15 +2762,46 @@ void MultiColumnList::resortList()
     // re-sort list according to direction
     ListHeaderSegment::SortDirection dir = getSortDirection();
 
+    if (dir == ListHeaderSegment::SortDirection::NoSorting || d_grid.size() < 2)
+        return;
+
+    // Sort compact (key, row) pairs rather than the rows themselves, so that
+    // each row is moved exactly once, when the final order is applied.
+    struct SortKey
+    {
+        const ListboxItem* d_item;
+        unsigned int d_row;
+    };
+
+    const unsigned int sort_column = d_grid.front().d_sortColumn;
+    std::vector<SortKey> keys;
+    keys.reserve(d_grid.size());
+    for (unsigned int i = 0; i < getRowCount(); ++i)
+        keys.push_back({ d_grid[i][sort_column], i });
+
+    // empty slots sort before any item, as with ListRow::operator<.
     if (dir == ListHeaderSegment::SortDirection::Descending)
     {
-        std::sort(d_grid.begin(), d_grid.end(), pred_descend);
+        std::sort(keys.begin(), keys.end(), [](const SortKey& a, const SortKey& b)
+        {
+            return a.d_item && (!b.d_item || *a.d_item > *b.d_item);
+        });
     }
-    else if (dir == ListHeaderSegment::SortDirection::Ascending)
+    else
     {
-        std::sort(d_grid.begin(), d_grid.end());
+        std::sort(keys.begin(), keys.end(), [](const SortKey& a, const SortKey& b)
+        {
+            return b.d_item && (!a.d_item || *a.d_item < *b.d_item);
+        });
     }
-    // else no (or invalid) direction, so do not sort.
+
+    ListItemGrid sorted;
+    sorted.reserve(d_grid.size());
+    for (const SortKey& key : keys)
+        sorted.push_back(std::move(d_grid[key.d_row]));
+
+    d_grid.swap(sorted);
+    invalidateRowOffsets();
 }
 
 //////////////////////////////////////////////////////////////////////////
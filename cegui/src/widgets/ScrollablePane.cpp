@@ -96,6 +96,7 @@ Rectf ScrollablePane::getContentPixelRect(void) const
 //----------------------------------------------------------------------------//
 USize ScrollablePane::getContentPaneSize(void) const
 {
+    getScrolledContainer()->adjustSizeToContentIfNecessary();
     return getScrolledContainer()->getSize();
 }
 
@@ -187,12 +188,15 @@ void ScrollablePane::setHorizontalOverlapSize(float overlap)
 //----------------------------------------------------------------------------//
 float ScrollablePane::getHorizontalScrollPosition(void) const
 {
+    getScrolledContainer()->adjustSizeToContentIfNecessary();
     return getHorzScrollbar()->getUnitIntervalScrollPosition();
 }
 
 //----------------------------------------------------------------------------//
 void ScrollablePane::setHorizontalScrollPosition(float position)
 {
+    // clamp against the extents of the current children
+    getScrolledContainer()->adjustSizeToContentIfNecessary();
     getHorzScrollbar()->setUnitIntervalScrollPosition(position);
 }
 
@@ -225,12 +229,15 @@ void ScrollablePane::setVerticalOverlapSize(float overlap)
 //----------------------------------------------------------------------------//
 float ScrollablePane::getVerticalScrollPosition(void) const
 {
+    getScrolledContainer()->adjustSizeToContentIfNecessary();
     return getVertScrollbar()->getUnitIntervalScrollPosition();
 }
 
 //----------------------------------------------------------------------------//
 void ScrollablePane::setVerticalScrollPosition(float position)
 {
+    // clamp against the extents of the current children
+    getScrolledContainer()->adjustSizeToContentIfNecessary();
     getVertScrollbar()->setUnitIntervalScrollPosition(position);
 }
 
@@ -349,6 +356,8 @@ void ScrollablePane::configureScrollbars()
 //----------------------------------------------------------------------------//
 void ScrollablePane::scrollContentPane(float dx, float dy, ScrollablePane::ScrollSource /*source*/)
 {
+    getScrolledContainer()->adjustSizeToContentIfNecessary();
+
     Scrollbar* vertScrollbar = getVertScrollbar();
     Scrollbar* horzScrollbar = getHorzScrollbar();
 
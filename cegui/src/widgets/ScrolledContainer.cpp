@@ -26,6 +26,7 @@
  ***************************************************************************/
 #include "CEGUI/widgets/ScrolledContainer.h"
 #include "CEGUI/CoordConverter.h"
+#include <algorithm>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -41,7 +42,10 @@ const String ScrolledContainer::EventNamespace("ScrolledContainer");
 //----------------------------------------------------------------------------//
 ScrolledContainer::ScrolledContainer(const String& type, const String& name) :
     Window(type, name),
-    d_childContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getChildContentArea_impl))
+    d_childContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getChildContentArea_impl)),
+    d_cachedExtents(0.f, 0.f, 0.f, 0.f),
+    d_cachedExtentsValid(false),
+    d_needsSizeAdjustment(false)
 {
     setCursorPassThroughEnabled(true); // Improves swipe scrolling experience in a ScrollablePane
     setCursorInputPropagationEnabled(true);
@@ -55,6 +59,8 @@ ScrolledContainer::ScrolledContainer(const String& type, const String& name) :
 //----------------------------------------------------------------------------//
 void ScrolledContainer::adjustSizeToContent()
 {
+    d_needsSizeAdjustment = false;
+
     if (!isSizeAdjustedToContent())
         return;
 
@@ -78,37 +84,51 @@ void ScrolledContainer::adjustSizeToContent()
 //----------------------------------------------------------------------------//
 Rectf ScrolledContainer::getContentPixelRect() const
 {
+    // callers must not see the size from before pending child changes
+    const_cast<ScrolledContainer*>(this)->adjustSizeToContentIfNecessary();
     return Rectf(d_contentOffset, d_pixelSize);
 }
 
 //----------------------------------------------------------------------------//
-Rectf ScrolledContainer::getChildExtentsArea() const
+void ScrolledContainer::adjustSizeToContentIfNecessary()
 {
-    Rectf extents(0.f, 0.f, 0.f, 0.f);
+    if (d_needsSizeAdjustment)
+        adjustSizeToContent();
+}
 
+//----------------------------------------------------------------------------//
+void ScrolledContainer::update(float elapsed)
+{
+    Window::update(elapsed);
+    adjustSizeToContentIfNecessary();
+}
+
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::getChildExtentsArea() const
+{
     const size_t childCount = getChildCount();
     if (childCount == 0)
-        return extents;
+        return Rectf(0.f, 0.f, 0.f, 0.f);
 
-    Sizef baseSize = d_pixelSize;
+    const Sizef baseSize = getChildBaseSize();
 
-    const auto& parentRect = d_parent->getChildContentArea().get();
-    if (isWidthAdjustedToContent())
-        baseSize.d_width = parentRect.getWidth();
-    if (isHeightAdjustedToContent())
-        baseSize.d_height = parentRect.getHeight();
+    // Child area changes are only tracked while auto-sizing.
+    const bool useCache = isSizeAdjustedToContent();
+    if (useCache && d_cachedExtentsValid && d_cachedExtentsBaseSize == baseSize)
+        return d_cachedExtents;
+
+    Rectf extents(0.f, 0.f, 0.f, 0.f);
+
+    if (useCache)
+        d_cachedChildAreas.clear();
 
     for (size_t i = 0; i < childCount; ++i)
     {
         const Window* const child = getChildAtIndex(i);
-        Rectf area(
-            CoordConverter::asAbsolute(child->getPosition(), baseSize),
-            child->getPixelSize());
+        const Rectf area(getChildArea(*child, baseSize));
 
-        if (child->getHorizontalAlignment() == HorizontalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - baseSize.d_width * 0.5f, 0.0f));
-        if (child->getVerticalAlignment() == VerticalAlignment::Centre)
-            area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - baseSize.d_height * 0.5f));
+        if (useCache)
+            d_cachedChildAreas[child] = area;
 
         if (area.d_min.x < extents.d_min.x)
             extents.d_min.x = area.d_min.x;
@@ -123,13 +143,116 @@ Rectf ScrolledContainer::getChildExtentsArea() const
             extents.d_max.y = area.d_max.y;
     }
 
+    if (useCache)
+    {
+        d_cachedExtents = extents;
+        d_cachedExtentsBaseSize = baseSize;
+        d_cachedExtentsValid = true;
+    }
+
     return extents;
 }
 
 //----------------------------------------------------------------------------//
-bool ScrolledContainer::handleChildAreaChanged(const EventArgs& /*e*/)
+Sizef ScrolledContainer::getChildBaseSize() const
 {
-    adjustSizeToContent();
+    Sizef baseSize = d_pixelSize;
+
+    const auto& parentRect = d_parent->getChildContentArea().get();
+    if (isWidthAdjustedToContent())
+        baseSize.d_width = parentRect.getWidth();
+    if (isHeightAdjustedToContent())
+        baseSize.d_height = parentRect.getHeight();
+
+    return baseSize;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::getChildArea(const Window& child, const Sizef& base_size)
+{
+    Rectf area(
+        CoordConverter::asAbsolute(child.getPosition(), base_size),
+        child.getPixelSize());
+
+    if (child.getHorizontalAlignment() == HorizontalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(area.getWidth() * 0.5f - base_size.d_width * 0.5f, 0.0f));
+    if (child.getVerticalAlignment() == VerticalAlignment::Centre)
+        area.setPosition(area.getPosition() - glm::vec2(0.0f, area.getHeight() * 0.5f - base_size.d_height * 0.5f));
+
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::isOnCachedExtentsEdge(const Rectf& area) const
+{
+    // The extents always include the origin, so an edge at 0 can't shrink.
+    return (d_cachedExtents.d_min.x < 0.f && area.d_min.x <= d_cachedExtents.d_min.x) ||
+        (d_cachedExtents.d_min.y < 0.f && area.d_min.y <= d_cachedExtents.d_min.y) ||
+        (d_cachedExtents.d_max.x > 0.f && area.d_max.x >= d_cachedExtents.d_max.x) ||
+        (d_cachedExtents.d_max.y > 0.f && area.d_max.y >= d_cachedExtents.d_max.y);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::updateCachedChildExtents(const Window& child)
+{
+    if (!d_cachedExtentsValid || !d_parent)
+        return;
+
+    const Sizef baseSize = getChildBaseSize();
+    if (baseSize != d_cachedExtentsBaseSize)
+    {
+        d_cachedExtentsValid = false;
+        return;
+    }
+
+    const Rectf area(getChildArea(child, baseSize));
+
+    auto it = d_cachedChildAreas.find(&child);
+    if (it != d_cachedChildAreas.end())
+    {
+        const Rectf& oldArea = it->second;
+
+        // the child may have been the one defining an edge that now moves in
+        if ((area.d_min.x > oldArea.d_min.x || area.d_min.y > oldArea.d_min.y ||
+            area.d_max.x < oldArea.d_max.x || area.d_max.y < oldArea.d_max.y) &&
+            isOnCachedExtentsEdge(oldArea))
+        {
+            d_cachedExtentsValid = false;
+            return;
+        }
+
+        it->second = area;
+    }
+    else
+    {
+        d_cachedChildAreas.emplace(&child, area);
+    }
+
+    d_cachedExtents.d_min.x = std::min(d_cachedExtents.d_min.x, area.d_min.x);
+    d_cachedExtents.d_min.y = std::min(d_cachedExtents.d_min.y, area.d_min.y);
+    d_cachedExtents.d_max.x = std::max(d_cachedExtents.d_max.x, area.d_max.x);
+    d_cachedExtents.d_max.y = std::max(d_cachedExtents.d_max.y, area.d_max.y);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::removeCachedChildExtents(const Window& child)
+{
+    auto it = d_cachedChildAreas.find(&child);
+    if (it == d_cachedChildAreas.end())
+        return;
+
+    if (d_cachedExtentsValid && isOnCachedExtentsEdge(it->second))
+        d_cachedExtentsValid = false;
+
+    d_cachedChildAreas.erase(it);
+}
+
+//----------------------------------------------------------------------------//
+bool ScrolledContainer::handleChildAreaChanged(const EventArgs& e)
+{
+    updateCachedChildExtents(*static_cast<const Window*>(
+        static_cast<const ElementEventArgs&>(e).element));
+    d_needsSizeAdjustment = true;
     return true;
 }
 
@@ -142,6 +265,12 @@ void ScrolledContainer::subscribeOnChildAreaEvents(Window* child)
     d_childAreaChangeConnections.emplace(child,
         child->subscribeEvent(Window::EventMoved,
             Event::Subscriber(&ScrolledContainer::handleChildAreaChanged, this)));
+    d_childAreaChangeConnections.emplace(child,
+        child->subscribeEvent(Window::EventHorizontalAlignmentChanged,
+            Event::Subscriber(&ScrolledContainer::handleChildAreaChanged, this)));
+    d_childAreaChangeConnections.emplace(child,
+        child->subscribeEvent(Window::EventVerticalAlignmentChanged,
+            Event::Subscriber(&ScrolledContainer::handleChildAreaChanged, this)));
 }
 
 //----------------------------------------------------------------------------//
@@ -161,6 +290,10 @@ void ScrolledContainer::onIsSizeAdjustedToContentChanged(ElementEventArgs& e)
         d_childAreaChangeConnections.clear();
     }
 
+    // child areas weren't tracked while not auto-sizing.
+    d_cachedChildAreas.clear();
+    d_cachedExtentsValid = false;
+
     Window::onIsSizeAdjustedToContentChanged(e);
 }
 
@@ -230,7 +363,8 @@ void ScrolledContainer::onChildAdded(ElementEventArgs& e)
     if (isSizeAdjustedToContent())
     {
         subscribeOnChildAreaEvents(static_cast<Window*>(e.element));
-        adjustSizeToContent();
+        updateCachedChildExtents(*static_cast<Window*>(e.element));
+        d_needsSizeAdjustment = true;
     }
 }
 
@@ -249,7 +383,8 @@ void ScrolledContainer::onChildRemoved(ElementEventArgs& e)
         d_childAreaChangeConnections.erase(range.first, range.second);
 
         // recalculate pane size if auto-sized
-        adjustSizeToContent();
+        removeCachedChildExtents(*static_cast<Window*>(e.element));
+        d_needsSizeAdjustment = isSizeAdjustedToContent();
     }
 }
 
@@ -259,6 +394,8 @@ void ScrolledContainer::cleanupChildren(void)
     for (auto& windowToConnection : d_childAreaChangeConnections)
         windowToConnection.second->disconnect();
     d_childAreaChangeConnections.clear();
+    d_cachedChildAreas.clear();
+    d_cachedExtentsValid = false;
 
     Window::cleanupChildren();
 }
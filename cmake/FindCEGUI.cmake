@@ -561,6 +561,7 @@ if ("${CEGUI_VERSION}" VERSION_GREATER "0.8.0")
     cegui_register_module(IMAGECODEC STBImageCodec ImageCodecModules/STB/ImageCodec.h "")
     cegui_register_module(IMAGECODEC TGAImageCodec ImageCodecModules/TGA/ImageCodec.h "")
     cegui_register_module(IMAGECODEC PVRImageCodec ImageCodecModules/PVR/ImageCodec.h "")
+    cegui_register_module(IMAGECODEC CompressedImageCodec ImageCodecModules/Compressed/ImageCodec.h "")
 
     # Parser
     cegui_register_module(PARSER ExpatParser XMLParserModules/Expat/XMLParser.h "")
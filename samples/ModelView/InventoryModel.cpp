@@ -147,13 +147,14 @@ void InventoryModel::addRandomItemWithChildren(const ModelIndex& parent, size_t
 void InventoryModel::updateItemName(const ModelIndex& index, const String& newName)
 {
     ModelIndex parent_index = getParentIndex(index);
+    const size_t child_id = static_cast<size_t>(getChildId(index));
 
-    notifyChildrenDataWillChange(parent_index, 0, 1);
+    notifyChildrenDataWillChange(parent_index, child_id, 1);
 
     InventoryItem* item = static_cast<InventoryItem*>(index.d_modelData);
     item->setText(newName);
 
-    notifyChildrenDataChanged(parent_index, 0, 1);
+    notifyChildrenDataChanged(parent_index, child_id, 1);
 }
 
 //----------------------------------------------------------------------------//
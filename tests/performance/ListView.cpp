@@ -103,4 +103,12 @@ BOOST_AUTO_TEST_CASE(Test)
     listview_test.execute();
 }
 
+BOOST_AUTO_TEST_CASE(Virtualized)
+{
+    ListViewPerformanceTest listview_test("TaharezLook/ListView", "Core/ListView");
+    listview_test.d_testName += " (virtualized)";
+    listview_test.d_window->setVirtualizationEnabled(true);
+    listview_test.execute();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
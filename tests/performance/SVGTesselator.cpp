@@ -0,0 +1,114 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <cmath>
+
+/*!
+\brief
+    Tesselates all shapes of an SVGData at a range of scales, the way an
+    uncached SVGImage does when it is drawn at different sizes.
+*/
+class SVGTesselationPerformanceTest : public PerformanceTest
+{
+public:
+    SVGTesselationPerformanceTest(CEGUI::String test_name, const CEGUI::String& element,
+                                  const CEGUI::String& attribute, const CEGUI::String& value) :
+        PerformanceTest(test_name),
+        d_data("SVGTesselationPerformanceTest")
+    {
+        CEGUI::XMLAttributes attributes;
+        attributes.add(attribute, value);
+        attributes.add("fill", "#336699");
+        attributes.add("stroke", "#000000");
+        attributes.add("stroke-width", "2");
+
+        for (unsigned int i = 0; i < 50; ++i)
+            d_data.elementStart(element, attributes);
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+        std::vector<CEGUI::GeometryBuffer*> buffers;
+
+        for (unsigned int i = 0; i < 200; ++i)
+        {
+            const float scale = 0.5f + (i % 8) * 0.5f;
+            const CEGUI::SVGImage::SVGImageRenderSettings settings(
+                CEGUI::ImageRenderSettings(CEGUI::Rectf(0.f, 0.f, 100.f * scale, 100.f * scale)),
+                glm::vec2(scale, scale), true);
+
+            for (const CEGUI::SVGBasicShape* shape : d_data.getShapes())
+                shape->createRenderGeometry(buffers, settings);
+
+            for (CEGUI::GeometryBuffer* buffer : buffers)
+                renderer.destroyGeometryBuffer(*buffer);
+            buffers.clear();
+        }
+    }
+
+    CEGUI::SVGData d_data;
+};
+
+BOOST_AUTO_TEST_SUITE(SVGTesselationPerformance)
+
+BOOST_AUTO_TEST_CASE(Polygon)
+{
+    // A 48 sided polygon, roughly the size of the flattened path below
+    CEGUI::String points;
+    for (unsigned int i = 0; i < 48; ++i)
+    {
+        const float angle = i * 2.f * 3.14159265f / 48.f;
+        points += CEGUI::PropertyHelper<float>::toString(50.f + 40.f * std::cos(angle)) + "," +
+                  CEGUI::PropertyHelper<float>::toString(50.f + 40.f * std::sin(angle)) + " ";
+    }
+
+    SVGTesselationPerformanceTest test("SVG polygon tesselation", "polygon", "points", points);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(PathWithCurves)
+{
+    // An icon-like outline with cubic and quadratic Béziers, an arc and a hole
+    SVGTesselationPerformanceTest test("SVG path tesselation", "path", "d",
+        "M10,50 C10,20 40,10 50,10 S90,20 90,50 Q90,90 50,90 T10,50 Z "
+        "M35,50 A15,15 0 1,0 65,50 A15,15 0 1,0 35,50 Z");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
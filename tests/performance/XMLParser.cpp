@@ -0,0 +1,118 @@
+/***********************************************************************
+ *    created:    19/10/2026
+ *    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "PerformanceTest.h"
+#include "CEGUI/System.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLAttributes.h"
+
+#include <vector>
+
+/*!
+\brief
+    Handler that inspects attributes the way the Falagard and layout handlers
+    do: a few lookups by name per element, without touching the rest.
+*/
+class AttributeReadingHandler : public CEGUI::XMLHandler
+{
+public:
+    AttributeReadingHandler() : d_elementCount(0), d_foundCount(0) {}
+
+    const CEGUI::String& getDefaultResourceGroup() const override
+    {
+        static const CEGUI::String group("looknfeels");
+        return group;
+    }
+
+    void elementStart(const CEGUI::String& /*element*/, const CEGUI::XMLAttributes& attributes) override
+    {
+        ++d_elementCount;
+
+        if (!attributes.getValueAsString("name").empty())
+            ++d_foundCount;
+        if (attributes.exists("type"))
+            ++d_foundCount;
+        if (attributes.exists("value"))
+            ++d_foundCount;
+    }
+
+    size_t d_elementCount;
+    size_t d_foundCount;
+};
+
+class XMLParserPerformanceTest : public PerformanceTest
+{
+public:
+    XMLParserPerformanceTest(CEGUI::String test_name, size_t iterations)
+        : PerformanceTest(test_name), d_iterations(iterations)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::ResourceProvider* rp =
+            CEGUI::System::getSingleton().getResourceProvider();
+        CEGUI::XMLParser* parser = CEGUI::System::getSingleton().getXMLParser();
+
+        std::vector<CEGUI::String> files;
+        rp->getResourceGroupFileNames(files, "*.looknfeel", "looknfeels");
+        BOOST_REQUIRE(!files.empty());
+
+        // load the raw data up front so only the parsing is measured
+        std::vector<CEGUI::RawDataContainer> data(files.size());
+        for (size_t i = 0; i < files.size(); ++i)
+            rp->loadRawDataContainer(files[i], data[i], "looknfeels");
+
+        AttributeReadingHandler handler;
+        for (size_t iteration = 0; iteration < d_iterations; ++iteration)
+        {
+            for (const CEGUI::RawDataContainer& source : data)
+                parser->parseXML(handler, source, "", false);
+        }
+
+        BOOST_CHECK(handler.d_elementCount > 0);
+
+        for (CEGUI::RawDataContainer& source : data)
+            rp->unloadRawDataContainer(source);
+    }
+
+    size_t d_iterations;
+};
+
+BOOST_AUTO_TEST_SUITE(XMLParserPerformance)
+
+BOOST_AUTO_TEST_CASE(LookNFeelParse)
+{
+    XMLParserPerformanceTest test("20x parse of all datafiles/looknfeel files", 20);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,198 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <cstring>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct CompactVertexDataFixture
+{
+    CompactVertexDataFixture() :
+        d_renderer(*System::getSingleton().getRenderer()),
+        d_coloured(d_renderer.createGeometryBufferColoured()),
+        d_textured(d_renderer.createGeometryBufferTextured())
+    {
+    }
+
+    ~CompactVertexDataFixture()
+    {
+        d_renderer.destroyGeometryBuffer(d_coloured);
+        d_renderer.destroyGeometryBuffer(d_textured);
+    }
+
+    static float readFloat(const std::vector<std::uint8_t>& data, size_t offset)
+    {
+        float value;
+        std::memcpy(&value, &data[offset], sizeof(value));
+        return value;
+    }
+
+    static std::uint16_t readShort(const std::vector<std::uint8_t>& data, size_t offset)
+    {
+        std::uint16_t value;
+        std::memcpy(&value, &data[offset], sizeof(value));
+        return value;
+    }
+
+    Renderer& d_renderer;
+    GeometryBuffer& d_coloured;
+    GeometryBuffer& d_textured;
+};
+
+BOOST_FIXTURE_TEST_SUITE(CompactVertexData, CompactVertexDataFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SolidRectsAreStoredAsQuads)
+{
+    d_coloured.appendSolidRect(Rectf(1.f, 2.f, 11.f, 22.f), ColourRect(Colour(1.f, 0.f, 0.f, 1.f)));
+    d_coloured.appendSolidRect(Rectf(5.f, 5.f, 6.f, 6.f), ColourRect(Colour(0.f, 0.5f, 1.f, 0.25f)));
+
+    BOOST_CHECK(d_coloured.getCompactVertexLayout() == CompactVertexLayout::Quads);
+    BOOST_CHECK_EQUAL(d_coloured.getCompactVertexStride(), 12u);
+
+    const std::vector<std::uint8_t>& data = d_coloured.getCompactVertexData();
+    BOOST_REQUIRE_EQUAL(data.size(), 8u * 12u);
+
+    // v0 v1 v2 v3 of the first quad
+    BOOST_CHECK_EQUAL(readFloat(data, 0), 1.f);
+    BOOST_CHECK_EQUAL(readFloat(data, 4), 2.f);
+    BOOST_CHECK_EQUAL(readFloat(data, 12 + 4), 22.f);
+    BOOST_CHECK_EQUAL(readFloat(data, 24), 11.f);
+    BOOST_CHECK_EQUAL(readFloat(data, 36 + 4), 2.f);
+    BOOST_CHECK_EQUAL(data[8], 255);
+    BOOST_CHECK_EQUAL(data[9], 0);
+    BOOST_CHECK_EQUAL(data[11], 255);
+
+    // The second quad starts at compact vertex 4
+    BOOST_CHECK_EQUAL(readFloat(data, 48), 5.f);
+    BOOST_CHECK_EQUAL(data[48 + 8], 0);
+    BOOST_CHECK_EQUAL(data[48 + 9], 128);
+    BOOST_CHECK_EQUAL(data[48 + 10], 255);
+    BOOST_CHECK_EQUAL(data[48 + 11], 64);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(TexturedVerticesAreQuantised)
+{
+    const glm::vec4 white(1.f, 1.f, 1.f, 1.f);
+    const TexturedColouredVertex vertices[] = {
+        TexturedColouredVertex(glm::vec3(0.f, 0.f, 0.f), white, glm::vec2(0.f, 0.f)),
+        TexturedColouredVertex(glm::vec3(0.f, 8.f, 0.f), white, glm::vec2(0.f, 1.f)),
+        TexturedColouredVertex(glm::vec3(8.f, 8.f, 0.f), white, glm::vec2(0.5f, 1.f)),
+        TexturedColouredVertex(glm::vec3(8.f, 0.f, 0.f), white, glm::vec2(0.5f, 0.f)),
+        TexturedColouredVertex(glm::vec3(0.f, 0.f, 0.f), white, glm::vec2(0.f, 0.f)),
+        TexturedColouredVertex(glm::vec3(8.f, 8.f, 0.f), white, glm::vec2(0.5f, 1.f))
+    };
+    d_textured.appendGeometry(vertices, 6);
+
+    BOOST_CHECK(d_textured.getCompactVertexLayout() == CompactVertexLayout::Quads);
+    BOOST_CHECK_EQUAL(d_textured.getCompactVertexStride(), 16u);
+
+    const std::vector<std::uint8_t>& data = d_textured.getCompactVertexData();
+    BOOST_REQUIRE_EQUAL(data.size(), 4u * 16u);
+    BOOST_CHECK_EQUAL(readShort(data, 16 + 12), 0);
+    BOOST_CHECK_EQUAL(readShort(data, 16 + 14), 65535);
+    BOOST_CHECK_EQUAL(readShort(data, 32 + 12), 32768);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(TrianglesAreKept)
+{
+    const glm::vec4 white(1.f, 1.f, 1.f, 1.f);
+    const ColouredVertex vertices[] = {
+        ColouredVertex(glm::vec3(0.f, 0.f, 0.f), white),
+        ColouredVertex(glm::vec3(0.f, 8.f, 0.f), white),
+        ColouredVertex(glm::vec3(8.f, 8.f, 0.f), white)
+    };
+    d_coloured.appendGeometry(vertices, 3);
+
+    BOOST_CHECK(d_coloured.getCompactVertexLayout() == CompactVertexLayout::Triangles);
+    BOOST_CHECK_EQUAL(d_coloured.getCompactVertexData().size(), 3u * 12u);
+
+    // 6 vertices that are not a quad
+    d_coloured.appendGeometry(vertices, 3);
+    BOOST_CHECK(d_coloured.getCompactVertexLayout() == CompactVertexLayout::Triangles);
+    BOOST_CHECK_EQUAL(d_coloured.getCompactVertexData().size(), 6u * 12u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(UnrepresentableGeometry)
+{
+    const glm::vec4 white(1.f, 1.f, 1.f, 1.f);
+    const ColouredVertex deep[] = {
+        ColouredVertex(glm::vec3(0.f, 0.f, 0.f), white),
+        ColouredVertex(glm::vec3(0.f, 8.f, 1.f), white),
+        ColouredVertex(glm::vec3(8.f, 8.f, 0.f), white)
+    };
+    d_coloured.appendGeometry(deep, 3);
+    BOOST_CHECK(d_coloured.getCompactVertexLayout() == CompactVertexLayout::None);
+    BOOST_CHECK(d_coloured.getCompactVertexData().empty());
+
+    const TexturedColouredVertex tiled[] = {
+        TexturedColouredVertex(glm::vec3(0.f, 0.f, 0.f), white, glm::vec2(0.f, 0.f)),
+        TexturedColouredVertex(glm::vec3(0.f, 8.f, 0.f), white, glm::vec2(0.f, 2.f)),
+        TexturedColouredVertex(glm::vec3(8.f, 8.f, 0.f), white, glm::vec2(2.f, 2.f))
+    };
+    d_textured.appendGeometry(tiled, 3);
+    BOOST_CHECK(d_textured.getCompactVertexLayout() == CompactVertexLayout::None);
+
+    // Clearing the geometry makes the data valid again
+    d_textured.reset();
+    d_textured.appendGeometry(tiled, 1);
+    BOOST_CHECK(d_textured.getCompactVertexLayout() == CompactVertexLayout::Triangles);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(QuadIndices)
+{
+    std::uint16_t indices[12];
+    GeometryBuffer::fillQuadIndices(indices, 2);
+
+    const std::uint16_t expected[12] = { 0, 1, 2, 3, 0, 2, 4, 5, 6, 7, 4, 6 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(indices, indices + 12, expected, expected + 12);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(UnsupportedRendererIgnoresSetting)
+{
+    if (d_renderer.isCompactVertexFormatSupported())
+        return;
+
+    d_renderer.setCompactVertexFormatEnabled(true);
+    BOOST_CHECK(!d_renderer.isCompactVertexFormatEnabled());
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
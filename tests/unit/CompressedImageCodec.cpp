@@ -0,0 +1,280 @@
+/***********************************************************************
+ *    created:    19/10/2026
+ *    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_IMAGECODEC_COMPRESSED
+
+#include "CEGUI/ImageCodecModules/Compressed/ImageCodec.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/TextureDecompressor.h"
+#include "CEGUI/Sizef.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace CEGUI;
+
+namespace
+{
+//! Texture recording the data it is loaded with.
+class RecordingTexture : public Texture
+{
+public:
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&) override {}
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size, PixelFormat pixel_format) override
+    {
+        const std::uint8_t* bytes = static_cast<const std::uint8_t*>(buffer);
+        d_data.assign(bytes, bytes + TextureDecompressor::getDataSize(pixel_format,
+            static_cast<std::uint32_t>(buffer_size.d_width),
+            static_cast<std::uint32_t>(buffer_size.d_height)));
+        d_size = buffer_size;
+        d_format = pixel_format;
+        ++d_loadCount;
+    }
+
+    void blitFromMemory(const void*, const Rectf&) override {}
+    void blitToMemory(void*) override {}
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const override
+    {
+        return d_compressedSupported || !TextureDecompressor::isCompressed(fmt);
+    }
+
+    String d_name = "CompressedImageCodecTest";
+    Sizef d_size = Sizef(0.f, 0.f);
+    glm::vec2 d_texelScaling = glm::vec2(0.f, 0.f);
+    bool d_compressedSupported = true;
+    PixelFormat d_format = PixelFormat::Rgba;
+    std::vector<std::uint8_t> d_data;
+    int d_loadCount = 0;
+};
+
+void writeLE32(std::vector<std::uint8_t>& blob, std::size_t offset, std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        blob[offset + i] = static_cast<std::uint8_t>(value >> (i * 8));
+}
+
+void writeLE64(std::vector<std::uint8_t>& blob, std::size_t offset, std::uint64_t value)
+{
+    writeLE32(blob, offset, static_cast<std::uint32_t>(value));
+    writeLE32(blob, offset + 4, static_cast<std::uint32_t>(value >> 32));
+}
+
+std::uint32_t makeFourCC(const char* code)
+{
+    return static_cast<std::uint32_t>(code[0]) | (static_cast<std::uint32_t>(code[1]) << 8) |
+        (static_cast<std::uint32_t>(code[2]) << 16) | (static_cast<std::uint32_t>(code[3]) << 24);
+}
+
+//! DDS file with a FourCC pixel format, followed by \a payload.
+std::vector<std::uint8_t> makeDDS(const char* four_cc, std::uint32_t width, std::uint32_t height,
+                                  const std::vector<std::uint8_t>& payload)
+{
+    std::vector<std::uint8_t> blob(4 + 124);
+    std::copy_n("DDS ", 4, blob.begin());
+    writeLE32(blob, 4, 124);            // header size
+    writeLE32(blob, 4 + 8, height);
+    writeLE32(blob, 4 + 12, width);
+    writeLE32(blob, 4 + 72, 32);        // pixel format size
+    writeLE32(blob, 4 + 76, 0x4);       // DDPF_FOURCC
+    writeLE32(blob, 4 + 80, makeFourCC(four_cc));
+
+    blob.insert(blob.end(), payload.begin(), payload.end());
+    return blob;
+}
+
+// identifier, 9 header fields, 4 index fields, 2 64 bit index fields
+const std::size_t KTX2LevelIndexOffset = 12 + 9 * 4 + 4 * 4 + 2 * 8;
+const std::size_t KTX2DataOffset = KTX2LevelIndexOffset + 3 * 8;
+
+//! KTX2 file with a single level holding \a payload.
+std::vector<std::uint8_t> makeKTX2(std::uint32_t vk_format, std::uint32_t width, std::uint32_t height,
+                                   const std::vector<std::uint8_t>& payload)
+{
+    static const std::uint8_t magic[12] =
+        { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    std::vector<std::uint8_t> blob(KTX2DataOffset);
+    std::copy_n(magic, 12, blob.begin());
+    writeLE32(blob, 12, vk_format);
+    writeLE32(blob, 12 + 4, 1);         // type size
+    writeLE32(blob, 12 + 8, width);
+    writeLE32(blob, 12 + 12, height);
+    writeLE32(blob, 12 + 24, 1);        // face count
+    writeLE32(blob, 12 + 28, 1);        // level count
+    writeLE64(blob, KTX2LevelIndexOffset, KTX2DataOffset);
+    writeLE64(blob, KTX2LevelIndexOffset + 8, payload.size());
+    writeLE64(blob, KTX2LevelIndexOffset + 16, payload.size());
+
+    blob.insert(blob.end(), payload.begin(), payload.end());
+    return blob;
+}
+
+// red / blue end points, indices 0, 1, 2, 3 (see the TextureDecompressor tests)
+const std::vector<std::uint8_t> BC1Block = { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0x00, 0x00, 0x00 };
+const std::vector<std::uint8_t> ETC2Block = { 0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const std::uint32_t VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK = 147;
+}
+
+//----------------------------------------------------------------------------//
+struct CompressedImageCodecFixture
+{
+    Texture* load(const std::vector<std::uint8_t>& blob)
+    {
+        RawDataContainer data;
+        data.setData(new std::uint8_t[blob.size()]);
+        data.setSize(blob.size());
+        std::copy(blob.begin(), blob.end(), data.getDataPtr());
+
+        return d_codec.load(data, &d_texture);
+    }
+
+    CompressedImageCodec d_codec;
+    RecordingTexture d_texture;
+};
+
+BOOST_FIXTURE_TEST_SUITE(CompressedImageCodecTestSuite, CompressedImageCodecFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DDSBC1IsUploadedAsIs)
+{
+    BOOST_REQUIRE(load(makeDDS("DXT1", 4, 4, BC1Block)) == &d_texture);
+
+    BOOST_CHECK(d_texture.d_format == Texture::PixelFormat::RgbaDxt1);
+    BOOST_CHECK(d_texture.d_size == Sizef(4.f, 4.f));
+    BOOST_CHECK(d_texture.d_data == BC1Block);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DDSBC1IsDecodedWhenUnsupported)
+{
+    d_texture.d_compressedSupported = false;
+    BOOST_REQUIRE(load(makeDDS("DXT1", 4, 4, BC1Block)) == &d_texture);
+
+    BOOST_CHECK(d_texture.d_format == Texture::PixelFormat::Rgba);
+    BOOST_REQUIRE_EQUAL(d_texture.d_data.size(), 4u * 4u * 4u);
+    BOOST_CHECK_EQUAL(d_texture.d_data[0], 255);
+    BOOST_CHECK_EQUAL(d_texture.d_data[1], 0);
+    BOOST_CHECK_EQUAL(d_texture.d_data[2], 0);
+    BOOST_CHECK_EQUAL(d_texture.d_data[3], 255);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(KTX2ETC2IsUploadedAsIs)
+{
+    BOOST_REQUIRE(load(makeKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, ETC2Block)) == &d_texture);
+
+    BOOST_CHECK(d_texture.d_format == Texture::PixelFormat::RgbEtc2);
+    BOOST_CHECK(d_texture.d_size == Sizef(4.f, 4.f));
+    BOOST_CHECK(d_texture.d_data == ETC2Block);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(KTX2ETC2IsDecodedWhenUnsupported)
+{
+    d_texture.d_compressedSupported = false;
+    BOOST_REQUIRE(load(makeKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, ETC2Block)) == &d_texture);
+
+    BOOST_CHECK(d_texture.d_format == Texture::PixelFormat::Rgba);
+    BOOST_CHECK_EQUAL(d_texture.d_data.size(), 4u * 4u * 4u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(TruncatedHeadersAreRejected)
+{
+    std::vector<std::uint8_t> dds = makeDDS("DXT1", 4, 4, BC1Block);
+    dds.resize(4 + 100);
+    BOOST_CHECK(!load(dds));
+
+    // the DX10 extension header is missing
+    dds = makeDDS("DX10", 4, 4, {});
+    BOOST_CHECK(!load(dds));
+
+    std::vector<std::uint8_t> ktx2 = makeKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, ETC2Block);
+    ktx2.resize(KTX2LevelIndexOffset);
+    BOOST_CHECK(!load(ktx2));
+
+    BOOST_CHECK_EQUAL(d_texture.d_loadCount, 0);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(BadMagicIsRejected)
+{
+    BOOST_CHECK(!load({}));
+    BOOST_CHECK(!load({ 'D', 'D', 'S' }));
+
+    std::vector<std::uint8_t> dds = makeDDS("DXT1", 4, 4, BC1Block);
+    dds[3] = 'X';
+    BOOST_CHECK(!load(dds));
+
+    std::vector<std::uint8_t> ktx2 = makeKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, ETC2Block);
+    ktx2[7] = 0;
+    BOOST_CHECK(!load(ktx2));
+
+    BOOST_CHECK_EQUAL(d_texture.d_loadCount, 0);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(LevelsPastTheEndAreRejected)
+{
+    // 8x8 BC1 needs four blocks
+    BOOST_CHECK(!load(makeDDS("DXT1", 8, 8, BC1Block)));
+
+    std::vector<std::uint8_t> ktx2 = makeKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, ETC2Block);
+    writeLE64(ktx2, KTX2LevelIndexOffset + 8, ETC2Block.size() + 1);
+    BOOST_CHECK(!load(ktx2));
+
+    writeLE64(ktx2, KTX2LevelIndexOffset, ktx2.size() + 1);
+    writeLE64(ktx2, KTX2LevelIndexOffset + 8, 0);
+    BOOST_CHECK(!load(ktx2));
+
+    // offset + length wraps around
+    writeLE64(ktx2, KTX2LevelIndexOffset, KTX2DataOffset);
+    writeLE64(ktx2, KTX2LevelIndexOffset + 8, ~std::uint64_t(0));
+    BOOST_CHECK(!load(ktx2));
+
+    // the level is valid but too small for the texture size
+    ktx2 = makeKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 8, 4, ETC2Block);
+    BOOST_CHECK(!load(ktx2));
+
+    BOOST_CHECK_EQUAL(d_texture.d_loadCount, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
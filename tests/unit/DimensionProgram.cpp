@@ -0,0 +1,133 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/falagard/Dimensions.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/falagard/PropertyDefinition.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+namespace
+{
+    struct DimensionWindowFixture
+    {
+        DimensionWindowFixture() :
+            d_window(WindowManager::getSingleton().createWindow("DefaultWindow")),
+            d_property("Inset", "{0.5,4}", "", "Test", false, false, "", "")
+        {
+            d_window->setSize(USize(UDim(0, 200), UDim(0, 100)));
+            d_window->addProperty(&d_property);
+            d_property.initialisePropertyReceiver(d_window);
+        }
+
+        ~DimensionWindowFixture()
+        {
+            WindowManager::getSingleton().destroyWindow(d_window);
+        }
+
+        Window* d_window;
+        PropertyDefinition<UDim> d_property;
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(DimensionProgramTestSuite, DimensionWindowFixture)
+
+BOOST_AUTO_TEST_CASE(ConstantFolding)
+{
+    const AbsoluteDim ten(10.0f);
+    const AbsoluteDim zeroValue(0.0f);
+    const UnifiedDim five(UDim(0, 5), DimensionType::Width);
+
+    OperatorDim sum(DimensionOperator::Add);
+    sum.setLeftOperand(&ten);
+    sum.setRightOperand(&five);
+
+    OperatorDim divide(DimensionOperator::Divide);
+    divide.setLeftOperand(&sum);
+    divide.setRightOperand(&zeroValue);
+
+    const Dimension folded(sum, DimensionType::Width);
+    BOOST_CHECK(folded.getProgram().isConstant());
+    BOOST_CHECK_EQUAL(folded.getValue(*d_window), 15.0f);
+
+    // division by zero gives zero, as with OperatorDim
+    const Dimension zero(divide, DimensionType::Width);
+    BOOST_CHECK(zero.getProgram().isConstant());
+    BOOST_CHECK_EQUAL(zero.getValue(*d_window), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesTree)
+{
+    // max(width * 0.5 - 3, inset height) within a container and without
+    const UnifiedDim width(UDim(1, 0), DimensionType::Width);
+    const AbsoluteDim half(0.5f);
+    const AbsoluteDim three(3.0f);
+    const PropertyDim inset("", "Inset", DimensionType::Height);
+
+    OperatorDim product(DimensionOperator::Multiply);
+    product.setLeftOperand(&width);
+    product.setRightOperand(&half);
+
+    OperatorDim difference(DimensionOperator::Subtract);
+    difference.setLeftOperand(&product);
+    difference.setRightOperand(&three);
+
+    OperatorDim maximum(DimensionOperator::Max);
+    maximum.setLeftOperand(&difference);
+    maximum.setRightOperand(&inset);
+
+    const Dimension dim(maximum, DimensionType::Width);
+    BOOST_CHECK(!dim.getProgram().isConstant());
+
+    const Rectf container(0, 0, 40, 300);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), maximum.getValue(*d_window));
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window, container),
+                      maximum.getValue(*d_window, container));
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), 97.0f);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window, container), 54.0f);
+
+    // a changed property value is picked up by the cached accessor
+    d_window->setProperty("Inset", "{0,120}");
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), 120.0f);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), maximum.getValue(*d_window));
+}
+
+BOOST_AUTO_TEST_CASE(Copies)
+{
+    Dimension dim(WidgetDim("", DimensionType::Height), DimensionType::Height);
+    const Dimension copy(dim);
+    dim.setBaseDimension(AbsoluteDim(7.0f));
+
+    BOOST_CHECK_EQUAL(copy.getValue(*d_window), 100.0f);
+    BOOST_CHECK_EQUAL(dim.getValue(*d_window), 7.0f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
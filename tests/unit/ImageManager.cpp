@@ -0,0 +1,186 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TextureAtlas.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Image.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+BOOST_AUTO_TEST_SUITE(ImageManagerTestSuite)
+
+BOOST_AUTO_TEST_CASE(Handles)
+{
+    ImageManager& imgr = ImageManager::getSingleton();
+
+    BOOST_CHECK(imgr.getHandle("ImageManagerTest/Missing").isNull());
+
+    Image& image = imgr.create("BitmapImage", "ImageManagerTest/Handle");
+    const ImageHandle handle = imgr.getHandle("ImageManagerTest/Handle");
+
+    BOOST_REQUIRE(!handle.isNull());
+    BOOST_CHECK_EQUAL(imgr.getImage(handle), &image);
+    BOOST_CHECK(imgr.getHandle("ImageManagerTest/Handle",
+        ImageManager::hashImageName("ImageManagerTest/Handle")) == handle);
+
+    imgr.destroy("ImageManagerTest/Handle");
+    BOOST_CHECK(imgr.getImage(handle) == nullptr);
+
+    // a new image reusing the slot must not be reachable via the old handle
+    Image& other = imgr.create("BitmapImage", "ImageManagerTest/Other");
+    BOOST_CHECK(imgr.getImage(handle) == nullptr);
+    BOOST_CHECK_EQUAL(imgr.getImage(imgr.getHandle("ImageManagerTest/Other")), &other);
+
+    imgr.destroy(other);
+}
+
+BOOST_AUTO_TEST_CASE(LookupTableGrowth)
+{
+    ImageManager& imgr = ImageManager::getSingleton();
+    const unsigned int initialCount = imgr.getImageCount();
+
+    for (std::uint32_t i = 0; i < 500; ++i)
+        imgr.create("BitmapImage", "ImageManagerTest/Grow/" + PropertyHelper<std::uint32_t>::toString(i));
+
+    for (std::uint32_t i = 0; i < 500; i += 2)
+        imgr.destroy("ImageManagerTest/Grow/" + PropertyHelper<std::uint32_t>::toString(i));
+
+    for (std::uint32_t i = 0; i < 500; ++i)
+    {
+        const String name("ImageManagerTest/Grow/" + PropertyHelper<std::uint32_t>::toString(i));
+        BOOST_CHECK_EQUAL(imgr.isDefined(name), i % 2 == 1);
+    }
+
+    imgr.destroyImageCollection("ImageManagerTest/Grow", false);
+    BOOST_CHECK_EQUAL(imgr.getImageCount(), initialCount);
+}
+
+BOOST_AUTO_TEST_CASE(References)
+{
+    ImageManager& imgr = ImageManager::getSingleton();
+
+    ImageReference ref("ImageManagerTest/Reference");
+    BOOST_CHECK(ref.get() == nullptr);
+
+    Image& first = imgr.create("BitmapImage", "ImageManagerTest/Reference");
+    BOOST_CHECK_EQUAL(ref.get(), &first);
+
+    imgr.destroy(first);
+    BOOST_CHECK(ref.get() == nullptr);
+
+    // recreating an image of the same name is picked up again
+    Image& second = imgr.create("BitmapImage", "ImageManagerTest/Reference");
+    BOOST_CHECK_EQUAL(ref.get(), &second);
+
+    imgr.destroy(second);
+}
+
+BOOST_AUTO_TEST_CASE(AtlasedImageFiles)
+{
+    ImageManager& imgr = ImageManager::getSingleton();
+    const ImageAtlasingMode previousMode = imgr.getAtlasingMode();
+    const std::size_t initialAtlasCount = imgr.getAtlasCount();
+    imgr.setAtlasingMode(ImageAtlasingMode::LooseImages);
+
+    const String files[] = { "ic_launcher.png", "logo.png", "WindowsLook.png" };
+    const Sizef sizes[] = { Sizef(100.0f, 100.0f), Sizef(183.0f, 89.0f), Sizef(128.0f, 128.0f) };
+    const std::size_t count = sizeof(files) / sizeof(files[0]);
+
+    for (std::size_t i = 0; i < count; ++i)
+        imgr.addBitmapImageFromFile("ImageManagerTest/Atlased/" + files[i], files[i]);
+
+    // all files are small enough to share a single atlas
+    BOOST_REQUIRE_EQUAL(imgr.getAtlasCount(), initialAtlasCount + 1);
+    const TextureAtlas& atlas = imgr.getAtlas(initialAtlasCount);
+    BOOST_CHECK_EQUAL(atlas.getImageCount(), count);
+
+    std::vector<Rectf> areas;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const String name("ImageManagerTest/Atlased/" + files[i]);
+        const BitmapImage& image = static_cast<const BitmapImage&>(imgr.get(name));
+
+        BOOST_CHECK(imgr.isImageAtlased(name));
+        BOOST_CHECK_EQUAL(image.getTexture(), &atlas.getTexture());
+        BOOST_CHECK(image.getImageArea().getSize() == sizes[i]);
+
+        for (const Rectf& other : areas)
+        {
+            const Rectf overlap(image.getImageArea().getIntersection(other));
+            BOOST_CHECK(overlap.getWidth() == 0.0f || overlap.getHeight() == 0.0f);
+        }
+
+        areas.push_back(image.getImageArea());
+    }
+
+    // the atlas lives for as long as any image in it
+    imgr.destroy("ImageManagerTest/Atlased/" + files[0]);
+    imgr.destroy("ImageManagerTest/Atlased/" + files[1]);
+    BOOST_CHECK_EQUAL(imgr.getAtlasCount(), initialAtlasCount + 1);
+
+    imgr.destroy("ImageManagerTest/Atlased/" + files[2]);
+    BOOST_CHECK_EQUAL(imgr.getAtlasCount(), initialAtlasCount);
+
+    imgr.setAtlasingMode(previousMode);
+}
+
+BOOST_AUTO_TEST_CASE(AtlasingModeSelection)
+{
+    ImageManager& imgr = ImageManager::getSingleton();
+    const ImageAtlasingMode previousMode = imgr.getAtlasingMode();
+    const Sizef previousMaxImageSize = imgr.getAtlasMaxImageSize();
+    const std::size_t initialAtlasCount = imgr.getAtlasCount();
+
+    // with atlasing disabled the image gets a texture of its own
+    imgr.setAtlasingMode(ImageAtlasingMode::Disabled);
+    imgr.addBitmapImageFromFile("ImageManagerTest/Loose", "ic_launcher.png");
+    BOOST_CHECK(!imgr.isImageAtlased("ImageManagerTest/Loose"));
+    BOOST_CHECK_EQUAL(imgr.getAtlasCount(), initialAtlasCount);
+    imgr.destroy("ImageManagerTest/Loose");
+    System::getSingleton().getRenderer()->destroyTexture("ImageManagerTest/Loose");
+
+    // files larger than the atlas image size limit are not packed either
+    imgr.setAtlasingMode(ImageAtlasingMode::LooseImages);
+    imgr.setAtlasMaxImageSize(Sizef(64.0f, 64.0f));
+    imgr.addBitmapImageFromFile("ImageManagerTest/TooBig", "ic_launcher.png");
+    BOOST_CHECK(!imgr.isImageAtlased("ImageManagerTest/TooBig"));
+    BOOST_CHECK_EQUAL(imgr.getAtlasCount(), initialAtlasCount);
+    BOOST_CHECK(imgr.get("ImageManagerTest/TooBig").getImageArea().getSize() == Sizef(100.0f, 100.0f));
+    imgr.destroy("ImageManagerTest/TooBig");
+    System::getSingleton().getRenderer()->destroyTexture("ImageManagerTest/TooBig");
+
+    imgr.setAtlasMaxImageSize(previousMaxImageSize);
+    imgr.setAtlasingMode(previousMode);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,113 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/views/ItemHeightIndex.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace CEGUI;
+
+BOOST_AUTO_TEST_SUITE(ItemHeightIndexTestSuite)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Empty)
+{
+    ItemHeightIndex index;
+
+    BOOST_CHECK_EQUAL(0u, index.size());
+    BOOST_CHECK_EQUAL(0.0f, index.getTotalHeight());
+    BOOST_CHECK_EQUAL(0u, index.getPositionAtOffset(10.0f));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(OffsetsAndPositions)
+{
+    ItemHeightIndex index;
+    index.build({ 10.0f, 20.0f, 5.0f, 15.0f, 10.0f });
+
+    BOOST_CHECK_EQUAL(0.0f, index.getOffset(0));
+    BOOST_CHECK_EQUAL(10.0f, index.getOffset(1));
+    BOOST_CHECK_EQUAL(35.0f, index.getOffset(3));
+    BOOST_CHECK_EQUAL(60.0f, index.getTotalHeight());
+
+    BOOST_CHECK_EQUAL(0u, index.getPositionAtOffset(-5.0f));
+    BOOST_CHECK_EQUAL(0u, index.getPositionAtOffset(0.0f));
+    BOOST_CHECK_EQUAL(0u, index.getPositionAtOffset(9.5f));
+    BOOST_CHECK_EQUAL(1u, index.getPositionAtOffset(10.0f));
+    BOOST_CHECK_EQUAL(2u, index.getPositionAtOffset(32.0f));
+    BOOST_CHECK_EQUAL(4u, index.getPositionAtOffset(59.0f));
+    BOOST_CHECK_EQUAL(4u, index.getPositionAtOffset(1000.0f));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SetHeight)
+{
+    ItemHeightIndex index;
+    index.build(std::vector<float>(1000, 10.0f));
+
+    index.setHeight(500, 110.0f);
+
+    BOOST_CHECK_EQUAL(110.0f, index.getHeight(500));
+    BOOST_CHECK_EQUAL(5000.0f, index.getOffset(500));
+    BOOST_CHECK_EQUAL(5110.0f, index.getOffset(501));
+    BOOST_CHECK_EQUAL(10100.0f, index.getTotalHeight());
+    BOOST_CHECK_EQUAL(500u, index.getPositionAtOffset(5100.0f));
+    BOOST_CHECK_EQUAL(501u, index.getPositionAtOffset(5110.0f));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(InsertAndErase)
+{
+    ItemHeightIndex index;
+    for (size_t i = 0; i < 100; ++i)
+        index.insert(i, 10.0f);
+
+    BOOST_CHECK_EQUAL(100u, index.size());
+    BOOST_CHECK_EQUAL(1000.0f, index.getTotalHeight());
+    BOOST_CHECK_EQUAL(370.0f, index.getOffset(37));
+
+    index.insert(10, 50.0f);
+    BOOST_CHECK_EQUAL(50.0f, index.getHeight(10));
+    BOOST_CHECK_EQUAL(10.0f, index.getHeight(11));
+    BOOST_CHECK_EQUAL(150.0f, index.getOffset(11));
+    BOOST_CHECK_EQUAL(1050.0f, index.getTotalHeight());
+
+    index.erase(0, 5);
+    BOOST_CHECK_EQUAL(96u, index.size());
+    BOOST_CHECK_EQUAL(50.0f, index.getHeight(5));
+    BOOST_CHECK_EQUAL(1000.0f, index.getTotalHeight());
+
+    index.erase(95);
+    BOOST_CHECK_EQUAL(95u, index.size());
+    BOOST_CHECK_EQUAL(990.0f, index.getTotalHeight());
+
+    index.insert(95, 20.0f);
+    BOOST_CHECK_EQUAL(1010.0f, index.getTotalHeight());
+    BOOST_CHECK_EQUAL(95u, index.getPositionAtOffset(995.0f));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -41,3 +41,36 @@ BOOST_AUTO_TEST_CASE(Ctor_Default_InitialisesDefaultValues)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(ItemDataTestSuite)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Ctor_Default_IsNull)
+{
+    ItemData data;
+    BOOST_CHECK(data.isNull());
+    BOOST_CHECK(data.getString().empty());
+    BOOST_CHECK(data.getImageHandle().isNull());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Number_ConvertsToString)
+{
+    ItemData data(2.5);
+    BOOST_CHECK(data.getType() == ItemData::Type::Number);
+    BOOST_CHECK_EQUAL(2.5, data.getNumber());
+    BOOST_CHECK_EQUAL("2.5", data.toString());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(StringRef_IsNotCopied)
+{
+    const String text("referenced");
+    const ItemData data = ItemData::fromStringRef(text);
+    const ItemData copy(data);
+
+    BOOST_CHECK_EQUAL(&text, &copy.getString());
+    BOOST_CHECK_EQUAL("referenced", copy.toString());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,228 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/widgets/VerticalLayoutContainer.h"
+#include "CEGUI/widgets/GridLayoutContainer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct LayoutContainerFixture
+{
+    LayoutContainerFixture() :
+        d_context(&System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget()))
+    {
+        d_root = WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_context->setRootWindow(d_root);
+
+        d_outer = static_cast<VerticalLayoutContainer*>(
+            WindowManager::getSingleton().createWindow(VerticalLayoutContainer::WidgetTypeName));
+        d_root->addChild(d_outer);
+        d_context->performPendingLayouts();
+    }
+
+    ~LayoutContainerFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(d_root);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    Window* createChild(float height)
+    {
+        Window* child = WindowManager::getSingleton().createWindow("DefaultWindow");
+        child->setSize(USize(cegui_absdim(50), cegui_absdim(height)));
+        return child;
+    }
+
+    GUIContext* d_context;
+    Window* d_root;
+    VerticalLayoutContainer* d_outer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(LayoutContainerTestSuite, LayoutContainerFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(AddingChildren_LayoutIsDeferredToContext)
+{
+    for (int i = 0; i < 10; ++i)
+        d_outer->addChild(createChild(10.0f));
+
+    BOOST_CHECK(d_outer->needsLayouting());
+    BOOST_CHECK(d_context->hasPendingLayouts());
+    BOOST_CHECK_EQUAL(0.0f, d_outer->getChildAtIndex(9)->getPixelPosition().y);
+
+    BOOST_CHECK(d_context->performPendingLayouts());
+
+    BOOST_CHECK(!d_outer->needsLayouting());
+    BOOST_CHECK(!d_context->hasPendingLayouts());
+    BOOST_CHECK_EQUAL(90.0f, d_outer->getChildAtIndex(9)->getPixelPosition().y);
+    BOOST_CHECK_EQUAL(100.0f, d_outer->getPixelSize().d_height);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(NestedContainers_LaidOutInOnePass)
+{
+    auto inner = static_cast<VerticalLayoutContainer*>(
+        WindowManager::getSingleton().createWindow(VerticalLayoutContainer::WidgetTypeName));
+    d_outer->addChild(createChild(10.0f));
+    d_outer->addChild(inner);
+    d_outer->addChild(createChild(10.0f));
+    for (int i = 0; i < 3; ++i)
+        inner->addChild(createChild(20.0f));
+
+    d_context->performPendingLayouts();
+
+    // The inner container is sized before the outer one arranges it
+    BOOST_CHECK_EQUAL(60.0f, inner->getPixelSize().d_height);
+    BOOST_CHECK_EQUAL(70.0f, d_outer->getChildAtIndex(2)->getPixelPosition().y);
+    BOOST_CHECK_EQUAL(80.0f, d_outer->getPixelSize().d_height);
+    BOOST_CHECK(!d_context->hasPendingLayouts());
+
+    // Resizing a nested child relayouts both containers
+    inner->getChildAtIndex(0)->setHeight(cegui_absdim(30.0f));
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK_EQUAL(70.0f, inner->getPixelSize().d_height);
+    BOOST_CHECK_EQUAL(80.0f, d_outer->getChildAtIndex(2)->getPixelPosition().y);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DestroyedContainer_IsNotLaidOut)
+{
+    auto inner = WindowManager::getSingleton().createWindow(VerticalLayoutContainer::WidgetTypeName);
+    d_outer->addChild(inner);
+    inner->addChild(createChild(10.0f));
+    BOOST_CHECK(d_context->hasPendingLayouts());
+
+    WindowManager::getSingleton().destroyWindow(inner);
+    WindowManager::getSingleton().cleanDeadPool();
+
+    d_context->performPendingLayouts();
+    BOOST_CHECK_EQUAL(0u, d_outer->getChildCount());
+    BOOST_CHECK_EQUAL(0.0f, d_outer->getPixelSize().d_height);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DetachedContainer_LaidOutByUpdate)
+{
+    auto detached = static_cast<VerticalLayoutContainer*>(
+        WindowManager::getSingleton().createWindow(VerticalLayoutContainer::WidgetTypeName));
+    detached->addChild(createChild(10.0f));
+    detached->addChild(createChild(10.0f));
+
+    BOOST_CHECK(!d_context->hasPendingLayouts());
+
+    detached->update(0.0f);
+    BOOST_CHECK_EQUAL(10.0f, detached->getChildAtIndex(1)->getPixelPosition().y);
+
+    WindowManager::getSingleton().destroyWindow(detached);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GridCellResized_LinesAfterItAreMoved)
+{
+    auto grid = static_cast<GridLayoutContainer*>(
+        WindowManager::getSingleton().createWindow(GridLayoutContainer::WidgetTypeName));
+    d_root->addChild(grid);
+    grid->setGridDimensions(3, 3);
+    for (size_t i = 0; i < 9; ++i)
+        grid->addChild(createChild(10.0f));
+    for (size_t i = 0; i < 9; ++i)
+        grid->getChildAtIndex(i)->setWidth(cegui_absdim(10.0f));
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK_EQUAL(Sizef(30.0f, 30.0f), grid->getPixelSize());
+    BOOST_CHECK(glm::vec2(20.0f, 20.0f) == grid->getChildAtCell(2, 2)->getPixelPosition());
+
+    // Growing the centre cell widens its column and row
+    grid->getChildAtCell(1, 1)->setSize(USize(cegui_absdim(20.0f), cegui_absdim(15.0f)));
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK_EQUAL(Sizef(40.0f, 35.0f), grid->getPixelSize());
+    BOOST_CHECK(glm::vec2(0.0f, 0.0f) == grid->getChildAtCell(0, 0)->getPixelPosition());
+    BOOST_CHECK(glm::vec2(10.0f, 0.0f) == grid->getChildAtCell(1, 0)->getPixelPosition());
+    BOOST_CHECK(glm::vec2(30.0f, 0.0f) == grid->getChildAtCell(2, 0)->getPixelPosition());
+    BOOST_CHECK(glm::vec2(30.0f, 25.0f) == grid->getChildAtCell(2, 2)->getPixelPosition());
+
+    // Shrinking it back restores the column and row from the other cells
+    grid->getChildAtCell(1, 1)->setSize(USize(cegui_absdim(10.0f), cegui_absdim(10.0f)));
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK_EQUAL(Sizef(30.0f, 30.0f), grid->getPixelSize());
+    BOOST_CHECK(glm::vec2(20.0f, 20.0f) == grid->getChildAtCell(2, 2)->getPixelPosition());
+
+    // A margin only moves its own cell unless the line grows
+    grid->getChildAtCell(0, 0)->setMargin(UBox(cegui_absdim(0.0f), cegui_absdim(5.0f),
+                                               cegui_absdim(0.0f), cegui_absdim(0.0f)));
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK(glm::vec2(5.0f, 0.0f) == grid->getChildAtCell(0, 0)->getPixelPosition());
+    BOOST_CHECK(glm::vec2(15.0f, 0.0f) == grid->getChildAtCell(1, 0)->getPixelPosition());
+    BOOST_CHECK_EQUAL(Sizef(35.0f, 30.0f), grid->getPixelSize());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GridCellReplaced_SizesFollow)
+{
+    auto grid = static_cast<GridLayoutContainer*>(
+        WindowManager::getSingleton().createWindow(GridLayoutContainer::WidgetTypeName));
+    d_root->addChild(grid);
+    grid->setGridDimensions(2, 2);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        Window* child = createChild(10.0f);
+        child->setWidth(cegui_absdim(10.0f));
+        grid->addChild(child);
+    }
+    d_context->performPendingLayouts();
+
+    Window* big = createChild(30.0f);
+    big->setWidth(cegui_absdim(30.0f));
+    grid->addChildToCell(big, 0, 0, true);
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK_EQUAL(Sizef(40.0f, 40.0f), grid->getPixelSize());
+    BOOST_CHECK(glm::vec2(30.0f, 30.0f) == grid->getChildAtCell(1, 1)->getPixelPosition());
+
+    grid->removeChildFromCell(0, 0);
+    WindowManager::getSingleton().destroyWindow(big);
+    d_context->performPendingLayouts();
+
+    BOOST_CHECK_EQUAL(Sizef(20.0f, 20.0f), grid->getPixelSize());
+    BOOST_CHECK(glm::vec2(10.0f, 10.0f) == grid->getChildAtCell(1, 1)->getPixelPosition());
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
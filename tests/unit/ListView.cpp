@@ -283,4 +283,158 @@ BOOST_AUTO_TEST_CASE(SortEnabled_IsEnabled_ListIsSorted)
     BOOST_REQUIRE_EQUAL(ITEM3, *(static_cast<String*>(index.d_modelData)));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_OnlyItemsNearVisibleAreaAreLaidOut)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    const float line_spacing = view->getFont()->getLineSpacing();
+    BOOST_REQUIRE_CLOSE(1000 * line_spacing, view->getRenderedTotalHeight(), 0.01f);
+    BOOST_REQUIRE_EQUAL(1, view->getItems().at(0)->d_renderedText.getLineCount());
+    BOOST_REQUIRE_EQUAL(model.d_items.at(5), view->getItems().at(5)->d_text);
+    BOOST_REQUIRE(view->getItems().at(999)->d_text.empty());
+    BOOST_REQUIRE(view->getItems().at(999)->d_renderedText.empty());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_Scrolled_LaysOutNewItemsAndReleasesOldOnes)
+{
+    for (std::int32_t i = 0; i < 1000; ++i)
+        model.d_items.push_back("item " + PropertyHelper<std::int32_t>::toString(i));
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(font_height * 10)));
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+    view->prepareForRender();
+
+    BOOST_REQUIRE(view->getItems().at(0)->d_text.empty());
+    BOOST_REQUIRE_EQUAL(model.d_items.at(999), view->getItems().at(999)->d_text);
+
+    const Rectf render_area(
+        static_cast<ItemViewWindowRenderer*>(view->getWindowRenderer())->getViewRenderArea());
+    ModelIndex index = view->indexAt(glm::vec2(1, render_area.bottom() - 1));
+    BOOST_REQUIRE(index.d_modelData != nullptr);
+    BOOST_REQUIRE_EQUAL(model.d_items.at(999), *(static_cast<String*>(index.d_modelData)));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_ItemHeightDiffersFromEstimate_TotalHeightIsCorrected)
+{
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM_WITH_6LINES);
+    view->setSize(USize(cegui_absdim(100), cegui_absdim(100)));
+    view->setEstimatedItemHeight(1.0f);
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_CLOSE(view->getItems().at(0)->d_size.d_height +
+        view->getItems().at(1)->d_size.d_height, view->getRenderedTotalHeight(), 0.01f);
+    BOOST_REQUIRE_EQUAL(6, view->getItems().at(1)->d_renderedText.getLineCount());
+    BOOST_REQUIRE_CLOSE(view->getItems().at(0)->d_size.d_height, view->getItemOffset(1), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_ItemAdded_IsInsertedInSortedPosition)
+{
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    model.d_items.push_back(ITEM2);
+    model.notifyChildrenAdded(model.getRootIndex(), 2, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(3, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(ITEM1, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM2, view->getItems().at(1)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM3, view->getItems().at(2)->d_text);
+    BOOST_REQUIRE_CLOSE(view->getItems().at(0)->d_size.d_height, view->getItemOffset(1), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_ItemRemoved_RemainingItemsStaySorted)
+{
+    model.d_items.push_back(ITEM2);
+    model.d_items.push_back(ITEM3);
+    model.d_items.push_back(ITEM1);
+    view->setSortMode(ViewSortMode::Descending);
+    view->prepareForRender();
+
+    model.notifyChildrenWillBeRemoved(model.getRootIndex(), 1, 1);
+    model.d_items.erase(model.d_items.begin() + 1);
+    model.notifyChildrenRemoved(model.getRootIndex(), 1, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(2, view->getItems().size());
+    BOOST_REQUIRE_EQUAL(ITEM2, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM1, view->getItems().at(1)->d_text);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortEnabled_ItemDataChanged_ItemIsMovedToNewPosition)
+{
+    model.d_items.push_back(ITEM1);
+    model.d_items.push_back(ITEM2);
+    model.d_items.push_back(ITEM3);
+    view->setSortMode(ViewSortMode::Ascending);
+    view->prepareForRender();
+
+    model.notifyChildrenDataWillChange(model.getRootIndex(), 0, 1);
+    model.d_items.at(0) = ITEM_WITH_6LINES;
+    model.notifyChildrenDataChanged(model.getRootIndex(), 0, 1);
+    view->prepareForRender();
+
+    BOOST_REQUIRE_EQUAL(ITEM2, view->getItems().at(0)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM3, view->getItems().at(1)->d_text);
+    BOOST_REQUIRE_EQUAL(ITEM_WITH_6LINES, view->getItems().at(2)->d_text);
+    BOOST_REQUIRE_CLOSE(view->getItems().at(0)->d_size.d_height +
+        view->getItems().at(1)->d_size.d_height, view->getItemOffset(2), 0.01f);
+    BOOST_REQUIRE_CLOSE(view->getItemOffset(3), view->getRenderedTotalHeight(), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ItemDataChanged_UpdatesAreCoalescedUntilRender)
+{
+    for (int i = 0; i < 10; ++i)
+        model.d_items.push_back(ITEM1);
+    view->prepareForRender();
+    const float total_height = view->getRenderedTotalHeight();
+
+    for (size_t i = 3; i < 6; ++i)
+    {
+        model.notifyChildrenDataWillChange(model.getRootIndex(), i, 1);
+        model.d_items.at(i) = ITEM_WITH_6LINES;
+        model.notifyChildrenDataChanged(model.getRootIndex(), i, 1);
+    }
+    model.notifyChildrenDataChanged(model.getRootIndex(), 8, 1);
+
+    BOOST_REQUIRE_EQUAL(2, view->d_dirtyRanges.size());
+    BOOST_CHECK_EQUAL(3, view->d_dirtyRanges[0].d_startId);
+    BOOST_CHECK_EQUAL(3, view->d_dirtyRanges[0].d_count);
+    BOOST_CHECK(!view->isDirty());
+
+    // removing an item before the changed ones shifts the recorded ranges
+    model.notifyChildrenWillBeRemoved(model.getRootIndex(), 0, 1);
+    model.d_items.erase(model.d_items.begin());
+    model.notifyChildrenRemoved(model.getRootIndex(), 0, 1);
+
+    BOOST_CHECK_EQUAL(2, view->d_dirtyRanges[0].d_startId);
+    BOOST_CHECK_EQUAL(7, view->d_dirtyRanges[1].d_startId);
+
+    view->prepareForRender();
+
+    BOOST_CHECK(view->d_dirtyRanges.empty());
+    const float line_height = total_height / 10;
+    BOOST_CHECK_EQUAL(6, view->getItems().at(2)->d_renderedText.getLineCount());
+    BOOST_CHECK_EQUAL(6, view->getItems().at(4)->d_renderedText.getLineCount());
+    BOOST_CHECK_CLOSE(line_height * 9 + 3 * 5 * line_height, view->getRenderedTotalHeight(), 0.01f);
+    BOOST_CHECK_CLOSE(view->getItemOffset(9), view->getRenderedTotalHeight(), 0.01f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
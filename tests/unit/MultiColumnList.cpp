@@ -0,0 +1,123 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/widgets/ListHeader.h"
+#include "CEGUI/WindowManager.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture()
+    {
+        d_list = static_cast<MultiColumnList*>(
+            WindowManager::getSingleton().createWindow("TaharezLook/MultiColumnList"));
+        d_list->setFont("DejaVuSans-12");
+        d_list->addColumn("A", 0, cegui_reldim(0.5f));
+        d_list->addColumn("B", 1, cegui_reldim(0.5f));
+    }
+
+    ~MultiColumnListFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(d_list);
+    }
+
+    unsigned int addRow(const String& a, const String& b)
+    {
+        const unsigned int row = d_list->addRow(new ListboxTextItem(a), 0);
+        d_list->setItem(new ListboxTextItem(b), 1, row);
+        return row;
+    }
+
+    MultiColumnList* d_list;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnListTestSuite, MultiColumnListFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(RowOffsets)
+{
+    BOOST_CHECK_EQUAL(0.0f, d_list->getTotalRowsHeight());
+    BOOST_CHECK_EQUAL(0u, d_list->getRowAtOffset(10.0f));
+
+    addRow("1", "2");
+    addRow("3", "4\nand more");
+    addRow("5", "6");
+
+    const float row0 = d_list->getHighestRowItemHeight(0);
+    const float row1 = d_list->getHighestRowItemHeight(1);
+    BOOST_REQUIRE(row1 > row0);
+
+    BOOST_CHECK_EQUAL(0.0f, d_list->getRowOffset(0));
+    BOOST_CHECK_EQUAL(row0, d_list->getRowOffset(1));
+    BOOST_CHECK_EQUAL(row0 + row1, d_list->getRowOffset(2));
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), d_list->getRowOffset(3), 0.001f);
+
+    BOOST_CHECK_EQUAL(0u, d_list->getRowAtOffset(-5.0f));
+    BOOST_CHECK_EQUAL(0u, d_list->getRowAtOffset(row0 * 0.5f));
+    BOOST_CHECK_EQUAL(1u, d_list->getRowAtOffset(row0));
+    BOOST_CHECK_EQUAL(1u, d_list->getRowAtOffset(row0 + row1 * 0.5f));
+    BOOST_CHECK_EQUAL(2u, d_list->getRowAtOffset(row0 + row1 + 1.0f));
+    BOOST_CHECK_EQUAL(3u, d_list->getRowAtOffset(d_list->getTotalRowsHeight() + 1.0f));
+
+    d_list->removeRow(1);
+    BOOST_CHECK_CLOSE(row0 + d_list->getHighestRowItemHeight(1),
+        d_list->getTotalRowsHeight(), 0.001f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SortByColumn)
+{
+    addRow("b", "1");
+    addRow("c", "2");
+    d_list->setItem(nullptr, 0, addRow("x", "3"));
+    addRow("a", "4");
+
+    d_list->setSortColumn(0);
+    d_list->setSortDirection(ListHeaderSegment::SortDirection::Ascending);
+
+    BOOST_CHECK(d_list->getItemAtGridReference(MCLGridRef(0, 0)) == nullptr);
+    BOOST_CHECK_EQUAL("3", d_list->getItemAtGridReference(MCLGridRef(0, 1))->getText());
+    BOOST_CHECK_EQUAL("a", d_list->getItemAtGridReference(MCLGridRef(1, 0))->getText());
+    BOOST_CHECK_EQUAL("4", d_list->getItemAtGridReference(MCLGridRef(1, 1))->getText());
+    BOOST_CHECK_EQUAL("c", d_list->getItemAtGridReference(MCLGridRef(3, 0))->getText());
+
+    d_list->setSortDirection(ListHeaderSegment::SortDirection::Descending);
+
+    BOOST_CHECK_EQUAL("c", d_list->getItemAtGridReference(MCLGridRef(0, 0))->getText());
+    BOOST_CHECK_EQUAL("2", d_list->getItemAtGridReference(MCLGridRef(0, 1))->getText());
+    BOOST_CHECK(d_list->getItemAtGridReference(MCLGridRef(3, 0)) == nullptr);
+
+    // a row added to a sorted list goes straight to its sorted position
+    BOOST_CHECK_EQUAL(1u, d_list->addRow(new ListboxTextItem("bb"), 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,238 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/OcclusionCuller.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/WindowFactoryManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct OcclusionCullerFixture
+{
+    OcclusionCullerFixture() :
+        d_context(createContext()),
+        d_culler(d_context->getOcclusionCuller())
+    {
+        d_root = WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_context->setRootWindow(d_root);
+
+        d_back = createChild(d_root, Rectf(10.f, 10.f, 110.f, 60.f));
+        d_front = createChild(d_root, Rectf(0.f, 0.f, 200.f, 100.f));
+    }
+
+    ~OcclusionCullerFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(d_root);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    static GUIContext* createContext()
+    {
+        System::getSingleton().notifyDisplaySizeChanged(Sizef(800.f, 600.f));
+        return &System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget());
+    }
+
+    Window* createChild(Window* parent, const Rectf& area,
+                        const String& type = "DefaultWindow")
+    {
+        Window* wnd = WindowManager::getSingleton().createWindow(type);
+        wnd->setArea(URect(cegui_absdim(area.left()), cegui_absdim(area.top()),
+                           cegui_absdim(area.right()), cegui_absdim(area.bottom())));
+        parent->addChild(wnd);
+        return wnd;
+    }
+
+    void setOpaque(Window* wnd)
+    {
+        wnd->setOpaqueArea(URect(cegui_reldim(0.f), cegui_reldim(0.f),
+                                 cegui_reldim(1.f), cegui_reldim(1.f)));
+    }
+
+    void draw()
+    {
+        d_context->markAsDirty();
+        d_context->draw();
+    }
+
+    GUIContext* d_context;
+    OcclusionCuller& d_culler;
+    Window* d_root;
+    Window* d_back;
+    Window* d_front;
+};
+
+BOOST_FIXTURE_TEST_SUITE(OcclusionCullerTestSuite, OcclusionCullerFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Coverage)
+{
+    const Rectf rect(10.f, 10.f, 50.f, 30.f);
+    std::vector<Rectf> occluders;
+    BOOST_CHECK(!OcclusionCuller::isCovered(rect, occluders));
+
+    occluders.push_back(Rectf(0.f, 0.f, 30.f, 40.f));
+    BOOST_CHECK(!OcclusionCuller::isCovered(rect, occluders));
+
+    occluders.push_back(Rectf(29.f, 5.f, 60.f, 29.f));
+    BOOST_CHECK(!OcclusionCuller::isCovered(rect, occluders));
+
+    occluders.push_back(Rectf(29.f, 28.f, 51.f, 31.f));
+    BOOST_CHECK(OcclusionCuller::isCovered(rect, occluders));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DisabledByDefault)
+{
+    setOpaque(d_front);
+    draw();
+
+    BOOST_CHECK(!d_culler.isEnabled());
+    BOOST_CHECK(!d_back->isOccluded());
+    BOOST_CHECK_EQUAL(d_culler.getStatistics().d_culledWindows, 0u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(OpaqueWindowsHideWindowsBehind)
+{
+    d_culler.setEnabled(true);
+
+    draw();
+    BOOST_CHECK(!d_back->isOccluded());
+
+    setOpaque(d_front);
+    Window* child = createChild(d_back, Rectf(0.f, 0.f, 10.f, 10.f));
+    Window* frontChild = createChild(d_front, Rectf(0.f, 0.f, 10.f, 10.f));
+    draw();
+
+    BOOST_CHECK(d_back->isOccluded());
+    BOOST_CHECK(child->isOccluded());
+    BOOST_CHECK(!d_front->isOccluded());
+    BOOST_CHECK(!frontChild->isOccluded());
+    BOOST_CHECK(!d_root->isOccluded());
+
+    const OcclusionCuller::Statistics& stats = d_culler.getStatistics();
+    BOOST_CHECK_EQUAL(stats.d_culledWindows, 2u);
+    BOOST_CHECK_EQUAL(stats.d_testedWindows, 5u);
+    BOOST_CHECK_EQUAL(stats.d_occluders, 1u);
+    BOOST_CHECK_EQUAL(d_culler.getCulledWindows().size(), 2u);
+
+    // moving the back window in front uncovers it
+    d_back->moveToFront();
+    draw();
+    BOOST_CHECK(!d_back->isOccluded());
+    BOOST_CHECK(!child->isOccluded());
+
+    // disabling draws everything again
+    d_front->moveToFront();
+    draw();
+    BOOST_CHECK(d_back->isOccluded());
+    d_culler.setEnabled(false);
+    BOOST_CHECK(!d_back->isOccluded());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(PartialAndTranslucentOccluders)
+{
+    d_culler.setEnabled(true);
+
+    // two windows covering one half of the back window each
+    d_front->setArea(URect(cegui_absdim(0.f), cegui_absdim(0.f),
+                           cegui_absdim(60.f), cegui_absdim(100.f)));
+    Window* right = createChild(d_root, Rectf(60.f, 0.f, 200.f, 100.f));
+    setOpaque(d_front);
+    draw();
+    BOOST_CHECK(!d_back->isOccluded());
+
+    setOpaque(right);
+    draw();
+    BOOST_CHECK(d_back->isOccluded());
+
+    // a translucent window does not hide anything
+    right->setAlpha(0.5f);
+    draw();
+    BOOST_CHECK(!d_back->isOccluded());
+
+    right->setAlpha(1.f);
+    right->setOpaqueArea(URect(cegui_absdim(0.f), cegui_absdim(0.f),
+                               cegui_absdim(10.f), cegui_absdim(10.f)));
+    draw();
+    BOOST_CHECK(!d_back->isOccluded());
+
+    // a destroyed culled window is forgotten
+    right->setOpaqueArea(URect(cegui_reldim(0.f), cegui_reldim(0.f),
+                               cegui_reldim(1.f), cegui_reldim(1.f)));
+    draw();
+    BOOST_REQUIRE(d_back->isOccluded());
+    WindowManager::getSingleton().destroyWindow(d_back);
+    BOOST_CHECK(d_culler.getCulledWindows().empty());
+    draw();
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(OpaqueStateImagery)
+{
+    WidgetLookManager::getSingleton().parseLookNFeelSpecificationFromString(
+        "<Falagard version=\"7\">"
+        "<WidgetLook name=\"OcclusionTest/Opaque\">"
+        "<StateImagery name=\"Enabled\" opaque=\"true\" />"
+        "<StateImagery name=\"Disabled\" />"
+        "</WidgetLook>"
+        "</Falagard>");
+    WindowFactoryManager::getSingleton().addFalagardWindowMapping(
+        "OcclusionTest/Opaque", "DefaultWindow", "OcclusionTest/Opaque", "Core/Default");
+
+    d_culler.setEnabled(true);
+
+    Window* opaque = createChild(d_root, Rectf(0.f, 0.f, 200.f, 100.f), "OcclusionTest/Opaque");
+    BOOST_CHECK(opaque->getOpaqueRect().empty());
+
+    // the imagery is known to be opaque once it has been built
+    draw();
+    BOOST_CHECK(opaque->getOpaqueRect() == Rectf(0.f, 0.f, 200.f, 100.f));
+    draw();
+    BOOST_CHECK(d_back->isOccluded());
+    BOOST_CHECK(d_front->isOccluded());
+
+    opaque->setEnabled(false);
+    draw();
+    BOOST_CHECK(!d_back->isOccluded());
+
+    WindowManager::getSingleton().destroyWindow(opaque);
+    WindowManager::getSingleton().cleanDeadPool();
+    WindowFactoryManager::getSingleton().removeFalagardWindowMapping("OcclusionTest/Opaque");
+    WidgetLookManager::getSingleton().eraseWidgetLook("OcclusionTest/Opaque");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,295 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/RenderCachePolicy.h"
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/Renderer.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct RenderCachePolicyFixture
+{
+    RenderCachePolicyFixture() :
+        d_context(&System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget())),
+        d_policy(d_context->getRenderCachePolicy())
+    {
+        d_root = WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_context->setRootWindow(d_root);
+
+        d_first = createChild(d_root);
+        d_second = createChild(d_root);
+
+        // DefaultWindows have no imagery, so don't require any geometry
+        d_policy.setMinimumVertexCount(0);
+        d_policy.setMinimumStaticFrames(3);
+        d_policy.setEvaluationInterval(1);
+    }
+
+    ~RenderCachePolicyFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(d_root);
+        System::getSingleton().destroyGUIContext(*d_context);
+    }
+
+    Window* createChild(Window* parent)
+    {
+        Window* wnd = WindowManager::getSingleton().createWindow("DefaultWindow");
+        wnd->setSize(USize(cegui_absdim(100.f), cegui_absdim(50.f)));
+        parent->addChild(wnd);
+        return wnd;
+    }
+
+    void drawFrames(int count, Window* invalidated = nullptr)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (invalidated)
+                invalidated->invalidate();
+
+            d_context->draw();
+        }
+    }
+
+    GUIContext* d_context;
+    RenderCachePolicy& d_policy;
+    Window* d_root;
+    Window* d_first;
+    Window* d_second;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderCachePolicyTestSuite, RenderCachePolicyFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DisabledByDefault)
+{
+    BOOST_CHECK(!d_policy.isEnabled());
+
+    drawFrames(10);
+
+    BOOST_CHECK(!d_first->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_policy.getCacheEntries().empty());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(StaticWindowsArePromoted)
+{
+    d_policy.setEnabled(true);
+
+    drawFrames(2);
+    BOOST_CHECK(!d_policy.isCached(d_first));
+
+    drawFrames(5);
+    BOOST_CHECK(d_policy.isCached(d_first));
+    BOOST_CHECK(d_policy.isCached(d_second));
+    BOOST_CHECK(d_first->isUsingRenderCacheSurface());
+    BOOST_CHECK(!d_first->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_first->getRenderingSurface() != nullptr);
+    BOOST_CHECK(!d_policy.isCached(d_root));
+
+    const std::vector<RenderCachePolicy::Entry> entries = d_policy.getCacheEntries();
+    BOOST_REQUIRE_EQUAL(entries.size(), 2u);
+    BOOST_CHECK_EQUAL(entries[0].d_textureBytes, 100u * 50u * 4u);
+    BOOST_CHECK_EQUAL(d_policy.getUsedMemory(), 2u * 100u * 50u * 4u);
+    BOOST_CHECK_EQUAL(d_policy.getPromotionCount(), 2u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(TopmostStaticSubtreeIsPromoted)
+{
+    Window* grandChild = createChild(d_first);
+    Window* busyChild = createChild(d_second);
+    Window* quietChild = createChild(d_second);
+    d_policy.setEnabled(true);
+
+    drawFrames(10, busyChild);
+
+    BOOST_CHECK(d_policy.isCached(d_first));
+    BOOST_CHECK(!d_policy.isCached(grandChild));
+
+    BOOST_CHECK(!d_policy.isCached(d_second));
+    BOOST_CHECK(!d_policy.isCached(busyChild));
+    BOOST_CHECK(d_policy.isCached(quietChild));
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChurningWindowsAreDemoted)
+{
+    d_policy.setEnabled(true);
+    drawFrames(5);
+    BOOST_REQUIRE(d_policy.isCached(d_first));
+
+    drawFrames(5, d_first);
+
+    BOOST_CHECK(!d_policy.isCached(d_first));
+    BOOST_CHECK(!d_first->getRenderingSurface());
+    BOOST_CHECK(d_policy.getInvalidationRate(d_first) > d_policy.getMaximumInvalidationRate());
+    BOOST_CHECK(d_policy.isCached(d_second));
+    BOOST_CHECK_EQUAL(d_policy.getDemotionCount(), 1u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(MemoryBudgetIsRespected)
+{
+    d_policy.setMemoryBudget(100 * 50 * 4 + 1);
+    d_policy.setEnabled(true);
+
+    drawFrames(10);
+
+    BOOST_CHECK_EQUAL(d_policy.getCacheEntries().size(), 1u);
+    BOOST_CHECK(d_policy.getUsedMemory() <= d_policy.getMemoryBudget());
+
+    // Growing the cached window past the budget releases its texture
+    d_first->setSize(USize(cegui_absdim(200.f), cegui_absdim(50.f)));
+    drawFrames(1);
+
+    BOOST_CHECK(!d_policy.isCached(d_first));
+    BOOST_CHECK(d_policy.getUsedMemory() <= d_policy.getMemoryBudget());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ApplicationSurfacesAreLeftAlone)
+{
+    d_first->setUsingAutoRenderingSurface(true);
+    d_policy.setEnabled(true);
+
+    drawFrames(10);
+    BOOST_CHECK(!d_policy.isCached(d_first));
+    BOOST_CHECK(d_policy.isCached(d_second));
+
+    d_policy.setEnabled(false);
+
+    BOOST_CHECK(d_first->isUsingAutoRenderingSurface());
+    BOOST_CHECK(!d_second->getRenderingSurface());
+    BOOST_CHECK(d_policy.getCacheEntries().empty());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ApplicationTakesOverCachedSurfaces)
+{
+    d_policy.setEnabled(true);
+    drawFrames(5);
+    BOOST_REQUIRE(d_policy.isCached(d_first));
+    RenderingSurface* surface = d_first->getRenderingSurface();
+
+    d_first->setUsingAutoRenderingSurface(true);
+    drawFrames(1);
+
+    BOOST_CHECK(!d_policy.isCached(d_first));
+    BOOST_CHECK(!d_first->isUsingRenderCacheSurface());
+    BOOST_CHECK(d_first->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_first->getRenderingSurface() == surface);
+
+    d_policy.setEnabled(false);
+
+    BOOST_CHECK(d_first->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_first->getRenderingSurface() == surface);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DemotionKeepsApplicationSurfaces)
+{
+    d_policy.setEnabled(true);
+    drawFrames(5);
+    BOOST_REQUIRE(d_policy.isCached(d_first));
+
+    // enabled between two evaluations, while the policy still caches it
+    d_first->setUsingAutoRenderingSurface(true);
+    d_policy.clear();
+
+    BOOST_CHECK(!d_first->isUsingRenderCacheSurface());
+    BOOST_CHECK(d_first->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_first->getRenderingSurface() != nullptr);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DetachedWindowsReleaseTheirSurface)
+{
+    d_policy.setEnabled(true);
+    drawFrames(5);
+    BOOST_REQUIRE(d_policy.isCached(d_first));
+
+    d_root->removeChild(d_first);
+
+    BOOST_CHECK(!d_policy.isCached(d_first));
+    BOOST_CHECK(!d_first->isUsingRenderCacheSurface());
+    BOOST_CHECK(!d_first->getRenderingSurface());
+
+    d_root->addChild(d_first);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DestroyedWindowsAreForgotten)
+{
+    d_policy.setEnabled(true);
+    drawFrames(5);
+    BOOST_REQUIRE(d_policy.isCached(d_first));
+
+    WindowManager::getSingleton().destroyWindow(d_first);
+    drawFrames(1);
+
+    BOOST_CHECK_EQUAL(d_policy.getCacheEntries().size(), 1u);
+    BOOST_CHECK(d_policy.getCacheEntries()[0].d_window == d_second);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ResidencyManagerEvictsCachedWindows)
+{
+    TextureResidencyManager& residency = TextureResidencyManager::getSingleton();
+    residency.resetStatistics();
+    d_policy.setEnabled(true);
+
+    drawFrames(5);
+    BOOST_REQUIRE(d_policy.isCached(d_first));
+    BOOST_REQUIRE(d_policy.isCached(d_second));
+
+    residency.setEnabled(true);
+    residency.setBudget(0);
+    residency.update();
+
+    BOOST_CHECK(!d_policy.isCached(d_first));
+    BOOST_CHECK(!d_policy.isCached(d_second));
+    BOOST_CHECK(!d_first->getRenderingSurface());
+    BOOST_CHECK_EQUAL(residency.getStatistics(
+        TextureResidencyManager::Category::RenderTarget).d_evictionCount, 2u);
+
+    // No promotions while the textures don't fit
+    drawFrames(10);
+    BOOST_CHECK(!d_policy.isCached(d_first));
+
+    residency.setEnabled(false);
+    residency.setBudget(64 * 1024 * 1024);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
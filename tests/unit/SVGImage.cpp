@@ -0,0 +1,231 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <algorithm>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct SVGImageFixture
+{
+    SVGImageFixture() :
+        d_data("SVGImageTestData"),
+        d_image("SVGImageTestImage", d_data),
+        d_previousBudget(SVGImage::getGeometryCacheBudget())
+    {
+        SVGPaintStyle style;
+        style.d_fill.d_none = false;
+        style.d_fill.d_colour = glm::vec3(1.f, 0.f, 0.f);
+        style.d_stroke.d_none = false;
+        style.d_stroke.d_colour = glm::vec3(0.f, 0.f, 1.f);
+
+        // The translation of the circle (SVG matrices are row major) ends up
+        // baked into the cached vertices
+        const glm::mat3x3 translation(1.f, 0.f, 20.f, 0.f, 1.f, 10.f, 0.f, 0.f, 1.f);
+        d_data.addShape(new SVGRect(style, glm::mat3x3(1.f), 0.f, 0.f, 50.f, 40.f));
+        d_data.addShape(new SVGCircle(style, translation, 30.f, 30.f, 15.f));
+        d_data.setWidth(100.f);
+        d_data.setHeight(100.f);
+
+        d_image.setImageArea(Rectf(0.f, 0.f, 100.f, 100.f));
+    }
+
+    ~SVGImageFixture()
+    {
+        d_image.clearGeometryCache();
+        SVGImage::setGeometryCacheBudget(d_previousBudget);
+    }
+
+    //! Render the image and return the concatenated vertices of the output.
+    std::vector<float> render(float size, size_t* bufferCount = nullptr)
+    {
+        return render(d_image, size, bufferCount);
+    }
+
+    static std::vector<float> render(const SVGImage& image, float size, size_t* bufferCount = nullptr)
+    {
+        std::vector<GeometryBuffer*> buffers;
+        image.createRenderGeometry(buffers, ImageRenderSettings(Rectf(0.f, 0.f, size, size)), 0);
+
+        std::vector<float> vertices;
+        for (GeometryBuffer* buffer : buffers)
+        {
+            vertices.insert(vertices.end(), buffer->getVertexData().begin(), buffer->getVertexData().end());
+            System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+        }
+
+        if (bufferCount)
+            *bufferCount = buffers.size();
+
+        return vertices;
+    }
+
+    static void checkClose(const std::vector<float>& a, const std::vector<float>& b)
+    {
+        BOOST_REQUIRE_EQUAL(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); ++i)
+            BOOST_CHECK_SMALL(a[i] - b[i], 0.001f);
+    }
+
+    SVGData d_data;
+    SVGImage d_image;
+    size_t d_previousBudget;
+};
+
+BOOST_FIXTURE_TEST_SUITE(SVGImageGeometryCache, SVGImageFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(CachedGeometryMatchesTessellation)
+{
+    SVGImage::setGeometryCacheBudget(0);
+    size_t uncachedBuffers = 0;
+    const std::vector<float> uncached = render(100.f, &uncachedBuffers);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 0u);
+    BOOST_REQUIRE(!uncached.empty());
+
+    // The circle is translated to (50, 40), beyond the right edge of the rect
+    float maxX = 0.f;
+    for (size_t i = 0; i < uncached.size(); i += GeometryBuffer::COLORED_VERTEX_FLOAT_COUNT)
+        maxX = std::max(maxX, uncached[i]);
+    BOOST_CHECK_GT(maxX, 60.f);
+
+    SVGImage::setGeometryCacheBudget(4 * 1024 * 1024);
+    size_t cachedBuffers = 0;
+    checkClose(render(100.f, &cachedBuffers), uncached);
+    checkClose(render(100.f), uncached);
+
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 1u);
+    BOOST_CHECK_LE(cachedBuffers, uncachedBuffers);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(EachScaleHasItsOwnEntry)
+{
+    const std::vector<float> small = render(50.f);
+    const std::vector<float> large = render(200.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 2u);
+
+    checkClose(render(50.f), small);
+    checkClose(render(200.f), large);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 2u);
+
+    d_image.setUseGeometryAntialiasing(false);
+    render(50.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 3u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChangingTheShapesInvalidatesTheCache)
+{
+    const std::vector<float> before = render(100.f);
+    render(50.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 2u);
+
+    SVGPaintStyle style;
+    style.d_fill.d_none = false;
+    d_data.addShape(new SVGRect(style, glm::mat3x3(1.f), 60.f, 60.f, 10.f, 10.f));
+
+    BOOST_CHECK_GT(render(100.f).size(), before.size());
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 1u);
+
+    d_data.getShapes().front()->d_paintStyle.d_fill.d_colour = glm::vec3(0.f, 1.f, 0.f);
+    d_data.notifyShapesChanged();
+    render(100.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 1u);
+
+    d_data.destroyShapes();
+    BOOST_CHECK(render(100.f).empty());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(BudgetIsRespected)
+{
+    const size_t usageBefore = SVGImage::getGeometryCacheMemoryUsage();
+
+    render(100.f);
+    const size_t entryBytes = SVGImage::getGeometryCacheMemoryUsage() - usageBefore;
+    BOOST_REQUIRE_GT(entryBytes, 0u);
+
+    // Room for a single entry, so the least recently used one is evicted
+    SVGImage::setGeometryCacheBudget(usageBefore + entryBytes + entryBytes / 2);
+    render(101.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 1u);
+    BOOST_CHECK_LE(SVGImage::getGeometryCacheMemoryUsage(), SVGImage::getGeometryCacheBudget());
+
+    d_image.clearGeometryCache();
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 0u);
+    BOOST_CHECK_EQUAL(SVGImage::getGeometryCacheMemoryUsage(), usageBefore);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ImagesShareTheBudget)
+{
+    SVGImage other("SVGImageTestOtherImage", d_data);
+    other.setImageArea(Rectf(0.f, 0.f, 100.f, 100.f));
+    const size_t usageBefore = SVGImage::getGeometryCacheMemoryUsage();
+
+    render(100.f);
+    const size_t entryBytes = SVGImage::getGeometryCacheMemoryUsage() - usageBefore;
+    BOOST_REQUIRE_GT(entryBytes, 0u);
+
+    // Room for a single entry, so drawing the other image evicts the older
+    // entry of the first one
+    SVGImage::setGeometryCacheBudget(usageBefore + entryBytes + entryBytes / 2);
+    render(other, 100.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 0u);
+    BOOST_CHECK_EQUAL(other.getGeometryCacheEntryCount(), 1u);
+
+    render(100.f);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 1u);
+    BOOST_CHECK_EQUAL(other.getGeometryCacheEntryCount(), 0u);
+
+    // Lowering the budget trims the least recently used entries right away
+    SVGImage::setGeometryCacheBudget(usageBefore + 2 * entryBytes + entryBytes / 2);
+    render(other, 100.f);
+    BOOST_CHECK_EQUAL(SVGImage::getGeometryCacheMemoryUsage(), usageBefore + 2 * entryBytes);
+
+    SVGImage::setGeometryCacheBudget(usageBefore + entryBytes + entryBytes / 2);
+    BOOST_CHECK_EQUAL(d_image.getGeometryCacheEntryCount(), 0u);
+    BOOST_CHECK_EQUAL(other.getGeometryCacheEntryCount(), 1u);
+    BOOST_CHECK_LE(SVGImage::getGeometryCacheMemoryUsage(), SVGImage::getGeometryCacheBudget());
+
+    other.clearGeometryCache();
+    BOOST_CHECK_EQUAL(SVGImage::getGeometryCacheMemoryUsage(), usageBefore);
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,258 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/svg/SVGTesselator.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct SVGPathFixture
+{
+    SVGPathFixture() :
+        d_data("SVGPathTestData")
+    {
+    }
+
+    //! Parse \a path_data as the 'd' attribute of a 'path' element
+    const SVGPath& parse(const String& path_data)
+    {
+        XMLAttributes attributes;
+        attributes.add("d", path_data);
+        attributes.add("fill", "#ff0000");
+        d_data.elementStart("path", attributes);
+
+        return *static_cast<const SVGPath*>(d_data.getShapes().back());
+    }
+
+    static void checkPoint(const glm::vec2& point, float x, float y)
+    {
+        BOOST_CHECK_SMALL(point.x - x, 0.0001f);
+        BOOST_CHECK_SMALL(point.y - y, 0.0001f);
+    }
+
+    SVGData d_data;
+};
+
+BOOST_FIXTURE_TEST_SUITE(SVGPathElement, SVGPathFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(RelativeAndShorthandCommandsAreResolved)
+{
+    const SVGPath& path = parse("M10-5l5 5 h10v-2.5H0 m.5.5 1e1,0");
+    const std::vector<SVGPath::Command>& commands = path.d_commands;
+
+    BOOST_REQUIRE_EQUAL(commands.size(), 7u);
+    BOOST_CHECK(commands[0].d_type == SVGPath::CommandType::MoveTo);
+    checkPoint(commands[0].d_point, 10.f, -5.f);
+    BOOST_CHECK(commands[1].d_type == SVGPath::CommandType::LineTo);
+    checkPoint(commands[1].d_point, 15.f, 0.f);
+    checkPoint(commands[2].d_point, 25.f, 0.f);
+    checkPoint(commands[3].d_point, 25.f, -2.5f);
+    checkPoint(commands[4].d_point, 0.f, -2.5f);
+    BOOST_CHECK(commands[5].d_type == SVGPath::CommandType::MoveTo);
+    checkPoint(commands[5].d_point, 0.5f, -2.f);
+    // Further coordinates of a 'moveto' are implicit 'lineto' commands
+    BOOST_CHECK(commands[6].d_type == SVGPath::CommandType::LineTo);
+    checkPoint(commands[6].d_point, 10.5f, -2.f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SmoothCurvesReflectTheirControlPoint)
+{
+    const SVGPath& path = parse("M0,0 C0,10 10,10 10,0 s10,-10 10,0 Q25,5 30,0 T40,0");
+    const std::vector<SVGPath::Command>& commands = path.d_commands;
+
+    BOOST_REQUIRE_EQUAL(commands.size(), 5u);
+    BOOST_CHECK(commands[2].d_type == SVGPath::CommandType::CubicTo);
+    checkPoint(commands[2].d_control1, 10.f, -10.f);
+    checkPoint(commands[2].d_control2, 20.f, -10.f);
+    checkPoint(commands[2].d_point, 20.f, 0.f);
+    BOOST_CHECK(commands[4].d_type == SVGPath::CommandType::QuadraticTo);
+    checkPoint(commands[4].d_control1, 35.f, -5.f);
+    checkPoint(commands[4].d_point, 40.f, 0.f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ArcsAreParsed)
+{
+    const SVGPath& path = parse("M0 50a50 50 0 1150 0");
+    const std::vector<SVGPath::Command>& commands = path.d_commands;
+
+    BOOST_REQUIRE_EQUAL(commands.size(), 2u);
+    BOOST_CHECK(commands[1].d_type == SVGPath::CommandType::ArcTo);
+    checkPoint(commands[1].d_radii, 50.f, 50.f);
+    BOOST_CHECK(commands[1].d_largeArc);
+    BOOST_CHECK(commands[1].d_sweep);
+    checkPoint(commands[1].d_point, 50.f, 50.f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(InvalidPathDataThrows)
+{
+    BOOST_CHECK_THROW(parse("L10 10"), SVGParsingException);
+    BOOST_CHECK_THROW(parse("M10 10 L20"), SVGParsingException);
+    BOOST_CHECK_THROW(parse("M10 10 X20 20"), SVGParsingException);
+    BOOST_CHECK_THROW(parse("M10 10 A5 5 0 2 0 20 20"), SVGParsingException);
+    BOOST_CHECK_THROW(parse("M10 10 L20 20 Z 30 30"), SVGParsingException);
+
+    BOOST_CHECK(parse("  ").d_commands.empty());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(CubicCurvesStayWithinTolerance)
+{
+    const SVGPath& path = parse("M0,0 C0,100 100,100 100,0");
+    const glm::vec2 p0(0.f, 0.f), p1(0.f, 100.f), p2(100.f, 100.f), p3(100.f, 0.f);
+
+    std::vector<SVGTesselator::FlattenedSubpath> coarse;
+    SVGTesselator::flattenPath(&path, 1.f, coarse);
+    std::vector<SVGTesselator::FlattenedSubpath> fine;
+    SVGTesselator::flattenPath(&path, 0.01f, fine);
+
+    BOOST_REQUIRE_EQUAL(coarse.size(), 1u);
+    BOOST_REQUIRE_EQUAL(fine.size(), 1u);
+    BOOST_CHECK(!fine[0].d_closed);
+    BOOST_CHECK_GT(fine[0].d_points.size(), coarse[0].d_points.size());
+    checkPoint(coarse[0].d_points.back(), 100.f, 0.f);
+
+    // Sample the curve and check its distance to the flattened polyline
+    const std::vector<glm::vec2>& points = coarse[0].d_points;
+    for (int i = 0; i <= 100; ++i)
+    {
+        const float t = i / 100.f;
+        const float u = 1.f - t;
+        const glm::vec2 curve = u * u * u * p0 + 3.f * u * u * t * p1 + 3.f * u * t * t * p2 + t * t * t * p3;
+
+        float distance = 1000.f;
+        for (size_t j = 1; j < points.size(); ++j)
+        {
+            const glm::vec2 segment = points[j] - points[j - 1];
+            const float s = glm::clamp(glm::dot(curve - points[j - 1], segment) / glm::dot(segment, segment), 0.f, 1.f);
+            distance = std::min(distance, glm::length(points[j - 1] + s * segment - curve));
+        }
+
+        BOOST_CHECK_LE(distance, 1.f);
+    }
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ArcPointsLieOnTheEllipse)
+{
+    // Half circle from the left to the right side, passing through the top
+    const SVGPath& path = parse("M0 50 A50 50 0 0 1 100 50");
+
+    std::vector<SVGTesselator::FlattenedSubpath> subpaths;
+    SVGTesselator::flattenPath(&path, 0.1f, subpaths);
+
+    BOOST_REQUIRE_EQUAL(subpaths.size(), 1u);
+    const std::vector<glm::vec2>& points = subpaths[0].d_points;
+    BOOST_REQUIRE_GT(points.size(), 8u);
+
+    float minY = 50.f;
+    for (const glm::vec2& point : points)
+    {
+        BOOST_CHECK_SMALL(glm::length(point - glm::vec2(50.f, 50.f)) - 50.f, 0.01f);
+        minY = std::min(minY, point.y);
+    }
+
+    BOOST_CHECK_LT(minY, 0.5f);
+    checkPoint(points.front(), 0.f, 50.f);
+    checkPoint(points.back(), 100.f, 50.f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ClosedSubpathsDropTheirClosingPoint)
+{
+    const SVGPath& path = parse("M0 0 L10 0 L10 10 L0 0 Z l0 10 L-10 0 z");
+
+    std::vector<SVGTesselator::FlattenedSubpath> subpaths;
+    SVGTesselator::flattenPath(&path, 0.25f, subpaths);
+
+    BOOST_REQUIRE_EQUAL(subpaths.size(), 2u);
+    BOOST_CHECK(subpaths[0].d_closed);
+    BOOST_CHECK_EQUAL(subpaths[0].d_points.size(), 3u);
+
+    // The second subpath starts where the first one was closed
+    BOOST_CHECK(subpaths[1].d_closed);
+    BOOST_REQUIRE_EQUAL(subpaths[1].d_points.size(), 3u);
+    checkPoint(subpaths[1].d_points[0], 0.f, 0.f);
+    checkPoint(subpaths[1].d_points[1], 0.f, 10.f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(FillIsTriangulated)
+{
+    const SVGPath& path = parse("M0 0 H100 V100 H0 Z M25 25 V75 H75 V25 Z");
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    std::vector<GeometryBuffer*> buffers;
+    const SVGImage::SVGImageRenderSettings settings(
+        ImageRenderSettings(Rectf(0.f, 0.f, 100.f, 100.f)), glm::vec2(1.f, 1.f), false);
+    path.createRenderGeometry(buffers, settings);
+
+    // The square with a hole is triangulated and shares a buffer with the stroke
+    BOOST_REQUIRE_EQUAL(buffers.size(), 1u);
+    BOOST_CHECK(buffers[0]->getPolygonFillRule() == PolygonFillRule::NoFilling);
+    BOOST_CHECK_EQUAL(buffers[0]->getVertexCount(), 24u);
+
+    for (GeometryBuffer* buffer : buffers)
+        renderer.destroyGeometryBuffer(*buffer);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SelfIntersectingFillUsesTheStencil)
+{
+    const SVGPath& path = parse("M0 0 L100 100 H0 L100 0 Z");
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    std::vector<GeometryBuffer*> buffers;
+    const SVGImage::SVGImageRenderSettings settings(
+        ImageRenderSettings(Rectf(0.f, 0.f, 100.f, 100.f)), glm::vec2(1.f, 1.f), false);
+    path.createRenderGeometry(buffers, settings);
+
+    BOOST_REQUIRE(!buffers.empty());
+    BOOST_CHECK(buffers[0]->getPolygonFillRule() != PolygonFillRule::NoFilling);
+    BOOST_CHECK_EQUAL(buffers[0]->getStencilPostRenderingVertexCount(), 6u);
+    // A fan of two triangles, plus the covering quad
+    BOOST_CHECK_EQUAL(buffers[0]->getVertexCount(), 12u);
+
+    for (GeometryBuffer* buffer : buffers)
+        renderer.destroyGeometryBuffer(*buffer);
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
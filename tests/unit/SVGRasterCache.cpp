@@ -0,0 +1,194 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/svg/SVGRasterCache.h"
+#include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct SVGRasterCacheFixture
+{
+    SVGRasterCacheFixture() :
+        d_cache(SVGDataManager::getSingleton().getRasterCache()),
+        d_data("SVGRasterCacheTestData"),
+        d_image("SVGRasterCacheTestImage", d_data),
+        d_previousBudget(d_cache.getMemoryBudget())
+    {
+        SVGPaintStyle style;
+        style.d_fill.d_none = false;
+        style.d_fill.d_colour = glm::vec3(1.f, 0.f, 0.f);
+
+        d_data.addShape(new SVGRect(style, glm::mat3x3(1.f), 0.f, 0.f, 50.f, 40.f));
+        d_data.addShape(new SVGCircle(style, glm::mat3x3(1.f), 60.f, 60.f, 30.f));
+        d_data.setWidth(100.f);
+        d_data.setHeight(100.f);
+
+        d_image.setImageArea(Rectf(0.f, 0.f, 100.f, 100.f));
+        d_image.setUseRasterCache(true);
+    }
+
+    ~SVGRasterCacheFixture()
+    {
+        d_image.setUseRasterCache(false);
+        d_cache.setMemoryBudget(d_previousBudget);
+    }
+
+    //! Render the image and return the number of vertices of the output.
+    size_t render(float size, bool* textured = nullptr)
+    {
+        std::vector<GeometryBuffer*> buffers;
+        d_image.createRenderGeometry(buffers, ImageRenderSettings(Rectf(0.f, 0.f, size, size)), 0);
+
+        size_t vertexCount = 0;
+        if (textured)
+            *textured = !buffers.empty();
+
+        for (GeometryBuffer* buffer : buffers)
+        {
+            vertexCount += buffer->getVertexCount();
+            if (textured)
+                *textured = *textured && buffer->getMainTexture() &&
+                            buffer->getBlendMode() == BlendMode::RttPremultiplied;
+
+            System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+        }
+
+        return vertexCount;
+    }
+
+    SVGRasterCache& d_cache;
+    SVGData d_data;
+    SVGImage d_image;
+    size_t d_previousBudget;
+};
+
+BOOST_FIXTURE_TEST_SUITE(SVGRasterCacheTests, SVGRasterCacheFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ScaleLevels)
+{
+    BOOST_CHECK_EQUAL(SVGRasterCache::getScaleLevel(1.f, 4), 0);
+    BOOST_CHECK_EQUAL(SVGRasterCache::getScaleLevel(1.01f, 4), 1);
+    BOOST_CHECK_EQUAL(SVGRasterCache::getScaleLevel(2.f, 4), 4);
+    BOOST_CHECK_EQUAL(SVGRasterCache::getScaleLevel(0.5f, 4), -4);
+    BOOST_CHECK_EQUAL(SVGRasterCache::getScaleLevel(0.45f, 4), -4);
+    BOOST_CHECK_EQUAL(SVGRasterCache::getScaleLevel(3.f, 1), 2);
+
+    // The rasterised image is never smaller than the displayed one
+    for (float scale = 0.1f; scale < 8.f; scale *= 1.07f)
+        BOOST_CHECK_GE(SVGRasterCache::getLevelScale(
+            SVGRasterCache::getScaleLevel(scale, 4), 4), scale * 0.999f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(RasterisedImageIsDrawnAsTexturedQuad)
+{
+    const size_t rasterisations = d_cache.getRasterisationCount();
+
+    bool textured = false;
+    BOOST_CHECK_EQUAL(render(100.f, &textured), 6u);
+    BOOST_CHECK(textured);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 1u);
+    BOOST_CHECK_EQUAL(d_cache.getRasterisationCount(), rasterisations + 1);
+    BOOST_CHECK_GE(d_cache.getPageCount(), 1u);
+
+    d_image.setUseRasterCache(false);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 0u);
+    BOOST_CHECK_GT(render(100.f, &textured), 6u);
+    BOOST_CHECK(!textured);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(RasterisedAgainOnlyWhenTheLevelChanges)
+{
+    const size_t rasterisations = d_cache.getRasterisationCount();
+
+    render(100.f);
+    render(101.f);
+    render(110.f);
+    render(118.f);
+    BOOST_CHECK_EQUAL(d_cache.getRasterisationCount(), rasterisations + 2);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 2u);
+
+    // Going back to a level that was rasterised before reuses it
+    render(100.f);
+    render(125.f);
+    BOOST_CHECK_EQUAL(d_cache.getRasterisationCount(), rasterisations + 3);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 3u);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChangingTheShapesRasterisesAgain)
+{
+    render(100.f);
+    render(50.f);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 2u);
+    const size_t rasterisations = d_cache.getRasterisationCount();
+
+    d_data.getShapes().front()->d_paintStyle.d_fill.d_colour = glm::vec3(0.f, 1.f, 0.f);
+    d_data.notifyShapesChanged();
+
+    render(100.f);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 1u);
+    BOOST_CHECK_EQUAL(d_cache.getRasterisationCount(), rasterisations + 1);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(FallsBackToGeometryWithoutBudget)
+{
+    d_cache.clear();
+    d_cache.setMemoryBudget(0);
+
+    bool textured = true;
+    BOOST_CHECK_GT(render(100.f, &textured), 6u);
+    BOOST_CHECK(!textured);
+    BOOST_CHECK_EQUAL(d_cache.getEntryCount(d_image), 0u);
+    BOOST_CHECK_EQUAL(d_cache.getPageCount(), 0u);
+    BOOST_CHECK_EQUAL(d_cache.getUsedMemory(), 0u);
+
+    // Images larger than a page are drawn as geometry as well
+    d_cache.setMemoryBudget(d_previousBudget);
+    BOOST_CHECK_GT(render(d_cache.getPageSize().d_width * 2.f, &textured), 6u);
+    BOOST_CHECK(!textured);
+
+    BOOST_CHECK_EQUAL(render(100.f, &textured), 6u);
+    BOOST_CHECK(textured);
+    BOOST_CHECK_LE(d_cache.getUsedMemory(), d_cache.getMemoryBudget());
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
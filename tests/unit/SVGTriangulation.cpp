@@ -0,0 +1,202 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/svg/SVGTesselator.h"
+#include "CEGUI/GeometryBuffer.h"
+
+#include <cmath>
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+//! Returns the points of an axis aligned square, clockwise on screen if \a positive
+static std::vector<glm::vec2> square(float left, float top, float size, bool positive = true)
+{
+    std::vector<glm::vec2> points;
+    points.push_back(glm::vec2(left, top));
+    points.push_back(glm::vec2(left + size, top));
+    points.push_back(glm::vec2(left + size, top + size));
+    points.push_back(glm::vec2(left, top + size));
+
+    if (!positive)
+        std::reverse(points.begin(), points.end());
+
+    return points;
+}
+
+//----------------------------------------------------------------------------//
+//! Triangulates the contours and returns the area covered by the triangles
+static float triangulatedArea(const std::vector<std::vector<glm::vec2>>& contours,
+                              PolygonFillRule fillRule)
+{
+    std::vector<glm::vec2> triangles;
+    BOOST_REQUIRE(SVGTesselator::triangulateFill(contours, fillRule, triangles));
+    BOOST_REQUIRE_EQUAL(triangles.size() % 3, 0u);
+
+    float area = 0.f;
+    for (size_t i = 0; i < triangles.size(); i += 3)
+    {
+        const glm::vec2 ab = triangles[i + 1] - triangles[i];
+        const glm::vec2 ac = triangles[i + 2] - triangles[i];
+        const float triangleArea = (ab.x * ac.y - ab.y * ac.x) * 0.5f;
+
+        // All triangles keep the orientation of the outer contours
+        BOOST_CHECK_GT(triangleArea, 0.f);
+        area += triangleArea;
+    }
+
+    return area;
+}
+
+BOOST_AUTO_TEST_SUITE(SVGFillTriangulation)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ConcavePolygons)
+{
+    std::vector<glm::vec2> lShape;
+    lShape.push_back(glm::vec2(0.f, 0.f));
+    lShape.push_back(glm::vec2(10.f, 0.f));
+    lShape.push_back(glm::vec2(10.f, 30.f));
+    lShape.push_back(glm::vec2(30.f, 30.f));
+    lShape.push_back(glm::vec2(30.f, 40.f));
+    lShape.push_back(glm::vec2(0.f, 40.f));
+
+    const std::vector<std::vector<glm::vec2>> contours(1, lShape);
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::NonZero), 600.f, 0.01f);
+
+    // The orientation of a single contour makes no difference
+    std::reverse(lShape.begin(), lShape.end());
+    BOOST_CHECK_CLOSE(triangulatedArea(std::vector<std::vector<glm::vec2>>(1, lShape),
+                                       PolygonFillRule::EvenOdd), 600.f, 0.01f);
+
+    // A star with 16 spikes, which has many reflex vertices
+    std::vector<glm::vec2> star;
+    float expectedArea = 0.f;
+    const float pi = 3.14159265f;
+    for (int i = 0; i < 32; ++i)
+    {
+        const float radius = (i % 2) ? 20.f : 100.f;
+        const float angle = i * pi / 16.f;
+        star.push_back(glm::vec2(std::cos(angle), std::sin(angle)) * radius);
+    }
+    for (size_t i = 0; i < star.size(); ++i)
+    {
+        const glm::vec2& a = star[i];
+        const glm::vec2& b = star[(i + 1) % star.size()];
+        expectedArea += (a.x * b.y - b.x * a.y) * 0.5f;
+    }
+
+    BOOST_CHECK_CLOSE(triangulatedArea(std::vector<std::vector<glm::vec2>>(1, star),
+                                       PolygonFillRule::NonZero), expectedArea, 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(FillRulesDecideAboutHoles)
+{
+    std::vector<std::vector<glm::vec2>> contours;
+    contours.push_back(square(0.f, 0.f, 100.f));
+    contours.push_back(square(25.f, 25.f, 50.f));
+
+    // Both contours have the same orientation, so the inner one is only a
+    // hole with the even-odd rule
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::EvenOdd), 7500.f, 0.01f);
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::NonZero), 10000.f, 0.01f);
+
+    contours[1] = square(25.f, 25.f, 50.f, false);
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::EvenOdd), 7500.f, 0.01f);
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::NonZero), 7500.f, 0.01f);
+
+    // An island inside the hole
+    contours.push_back(square(40.f, 40.f, 20.f));
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::EvenOdd), 7900.f, 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SeveralHoles)
+{
+    std::vector<std::vector<glm::vec2>> contours;
+    contours.push_back(square(0.f, 0.f, 100.f));
+    contours.push_back(square(10.f, 10.f, 20.f, false));
+    contours.push_back(square(60.f, 10.f, 20.f, false));
+    contours.push_back(square(10.f, 60.f, 20.f, false));
+    contours.push_back(square(50.f, 50.f, 40.f, false));
+    // Separate shape next to the first one
+    contours.push_back(square(200.f, 0.f, 10.f));
+
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::NonZero),
+                      10000.f - 3 * 400.f - 1600.f + 100.f, 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DegenerateInputIsIgnored)
+{
+    std::vector<glm::vec2> points = square(0.f, 0.f, 10.f);
+    // Repeated and closing points, and a collinear one
+    points.insert(points.begin() + 1, points[0]);
+    points.insert(points.begin() + 2, glm::vec2(5.f, 0.f));
+    points.push_back(points[0]);
+
+    std::vector<std::vector<glm::vec2>> contours(1, points);
+    // A contour without area
+    contours.push_back(std::vector<glm::vec2>(3, glm::vec2(50.f, 50.f)));
+
+    BOOST_CHECK_CLOSE(triangulatedArea(contours, PolygonFillRule::NonZero), 100.f, 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(IntersectingContoursAreRejected)
+{
+    std::vector<glm::vec2> triangles(3, glm::vec2(1.f, 1.f));
+
+    std::vector<glm::vec2> bowtie;
+    bowtie.push_back(glm::vec2(0.f, 0.f));
+    bowtie.push_back(glm::vec2(10.f, 10.f));
+    bowtie.push_back(glm::vec2(0.f, 10.f));
+    bowtie.push_back(glm::vec2(10.f, 0.f));
+    BOOST_CHECK(!SVGTesselator::triangulateFill(std::vector<std::vector<glm::vec2>>(1, bowtie),
+                                                PolygonFillRule::NonZero, triangles));
+
+    std::vector<std::vector<glm::vec2>> overlapping;
+    overlapping.push_back(square(0.f, 0.f, 10.f));
+    overlapping.push_back(square(5.f, 5.f, 10.f));
+    BOOST_CHECK(!SVGTesselator::triangulateFill(overlapping, PolygonFillRule::EvenOdd, triangles));
+
+    // Touching in a single vertex
+    std::vector<std::vector<glm::vec2>> touching;
+    touching.push_back(square(0.f, 0.f, 10.f));
+    touching.push_back(square(10.f, 10.f, 10.f));
+    BOOST_CHECK(!SVGTesselator::triangulateFill(touching, PolygonFillRule::NonZero, triangles));
+
+    // Nothing was added to the output
+    BOOST_CHECK_EQUAL(triangles.size(), 3u);
+}
+
+//----------------------------------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE_END()
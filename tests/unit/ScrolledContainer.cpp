@@ -0,0 +1,117 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/widgets/ScrollablePane.h"
+#include "CEGUI/widgets/ScrolledContainer.h"
+#include "CEGUI/WindowManager.h"
+
+using namespace CEGUI;
+
+//----------------------------------------------------------------------------//
+struct ScrolledContainerFixture
+{
+    ScrolledContainerFixture()
+    {
+        d_pane = static_cast<ScrollablePane*>(
+            WindowManager::getSingleton().createWindow("TaharezLook/ScrollablePane"));
+        d_pane->setSize(USize(cegui_absdim(100), cegui_absdim(100)));
+        d_container = const_cast<ScrolledContainer*>(d_pane->getContentPane());
+    }
+
+    ~ScrolledContainerFixture()
+    {
+        WindowManager::getSingleton().destroyWindow(d_pane);
+    }
+
+    Window* addChild(float x, float y, float w, float h)
+    {
+        Window* child = WindowManager::getSingleton().createWindow("DefaultWindow");
+        child->setPosition(UVector2(cegui_absdim(x), cegui_absdim(y)));
+        child->setSize(USize(cegui_absdim(w), cegui_absdim(h)));
+        d_pane->addChild(child);
+        return child;
+    }
+
+    ScrollablePane* d_pane;
+    ScrolledContainer* d_container;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ScrolledContainerTestSuite, ScrolledContainerFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChildrenAdded_SizeIsAdjustedOnUpdate)
+{
+    for (int i = 0; i < 50; ++i)
+        addChild(0.0f, i * 20.0f, 50.0f, 20.0f);
+
+    d_pane->update(0.0f);
+
+    BOOST_CHECK_EQUAL(Rectf(0.0f, 0.0f, 50.0f, 1000.0f), d_container->getChildExtentsArea());
+    BOOST_CHECK_EQUAL(Sizef(50.0f, 1000.0f), d_container->getPixelSize());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChildrenAdded_QueriesSeePendingSize)
+{
+    for (int i = 0; i < 50; ++i)
+        addChild(0.0f, i * 20.0f, 50.0f, 20.0f);
+
+    BOOST_CHECK_EQUAL(Sizef(50.0f, 1000.0f), d_pane->getContentPixelRect().getSize());
+
+    d_pane->setVerticalScrollPosition(1.0f);
+    BOOST_CHECK_CLOSE(1.0f, d_pane->getVerticalScrollPosition(), 0.01f);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ChildMovedAndRemoved_ExtentsFollow)
+{
+    addChild(0.0f, 0.0f, 50.0f, 20.0f);
+    Window* edge = addChild(-30.0f, 200.0f, 10.0f, 20.0f);
+    d_container->adjustSizeToContentIfNecessary();
+    BOOST_CHECK_EQUAL(Rectf(-30.0f, 0.0f, 50.0f, 220.0f), d_container->getChildExtentsArea());
+
+    // growing
+    edge->setPosition(UVector2(cegui_absdim(-40.0f), cegui_absdim(300.0f)));
+    BOOST_CHECK_EQUAL(Rectf(-40.0f, 0.0f, 50.0f, 320.0f), d_container->getChildExtentsArea());
+
+    // shrinking
+    edge->setPosition(UVector2(cegui_absdim(10.0f), cegui_absdim(10.0f)));
+    BOOST_CHECK_EQUAL(Rectf(0.0f, 0.0f, 50.0f, 30.0f), d_container->getChildExtentsArea());
+
+    edge->setSize(USize(cegui_absdim(100.0f), cegui_absdim(20.0f)));
+    BOOST_CHECK_EQUAL(Rectf(0.0f, 0.0f, 110.0f, 30.0f), d_container->getChildExtentsArea());
+
+    d_pane->removeChild(edge);
+    WindowManager::getSingleton().destroyWindow(edge);
+    BOOST_CHECK_EQUAL(Rectf(0.0f, 0.0f, 50.0f, 20.0f), d_container->getChildExtentsArea());
+
+    d_container->adjustSizeToContentIfNecessary();
+    BOOST_CHECK_EQUAL(Sizef(50.0f, 20.0f), d_container->getPixelSize());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
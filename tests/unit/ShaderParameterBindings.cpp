@@ -0,0 +1,80 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/ShaderParameterBindings.h"
+
+using namespace CEGUI;
+
+BOOST_AUTO_TEST_SUITE(ShaderParameterBindingsTestSuite)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(HandlesAreSharedByName)
+{
+    const ShaderParameterBindings::ParameterHandle alpha =
+        ShaderParameterBindings::getParameterHandle("ShaderParameterBindingsTest/alpha");
+    const ShaderParameterBindings::ParameterHandle matrix =
+        ShaderParameterBindings::getParameterHandle("ShaderParameterBindingsTest/matrix");
+
+    BOOST_CHECK_NE(alpha, matrix);
+    BOOST_CHECK_EQUAL(alpha, ShaderParameterBindings::getParameterHandle("ShaderParameterBindingsTest/alpha"));
+    BOOST_CHECK_EQUAL(ShaderParameterBindings::getParameterName(matrix), "ShaderParameterBindingsTest/matrix");
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(HandleAndNameAccessMatch)
+{
+    const ShaderParameterBindings::ParameterHandle alpha =
+        ShaderParameterBindings::getParameterHandle("ShaderParameterBindingsTest/alpha");
+
+    ShaderParameterBindings bindings;
+    BOOST_CHECK(bindings.getParameter(alpha) == nullptr);
+
+    bindings.setParameter(alpha, 0.5f);
+    ShaderParameter* parameter = bindings.getParameter(alpha);
+    BOOST_REQUIRE(parameter);
+    BOOST_CHECK(parameter == bindings.getParameter("ShaderParameterBindingsTest/alpha"));
+    BOOST_CHECK(bindings.getParametersByHandle()[alpha] == parameter);
+
+    // same type values are updated in place
+    bindings.setParameter("ShaderParameterBindingsTest/alpha", 0.25f);
+    BOOST_CHECK(bindings.getParameter(alpha) == parameter);
+    BOOST_CHECK_EQUAL(static_cast<ShaderParameterFloat*>(parameter)->d_parameterValue, 0.25f);
+
+    // a different type replaces the parameter for both accessors
+    bindings.setParameter(alpha, 3);
+    parameter = bindings.getParameter(alpha);
+    BOOST_REQUIRE(parameter);
+    BOOST_CHECK(parameter->getType() == ShaderParamType::Int);
+    BOOST_CHECK(bindings.getParameter("ShaderParameterBindingsTest/alpha") == parameter);
+
+    bindings.removeParameter("ShaderParameterBindingsTest/alpha");
+    BOOST_CHECK(bindings.getParameter(alpha) == nullptr);
+    BOOST_CHECK(bindings.getShaderParameterBindings().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
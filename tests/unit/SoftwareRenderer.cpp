@@ -0,0 +1,306 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/FrameBuffer.h"
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace CEGUI;
+
+namespace
+{
+const argb_t Black = 0xFF000000;
+const argb_t Red = 0xFFFF0000;
+const argb_t Blue = 0xFF0000FF;
+
+struct SoftwareRendererFixture
+{
+    SoftwareRendererFixture() :
+        d_renderer(SoftwareRenderer::create(Sizef(256.0f, 256.0f)))
+    {
+        d_renderer.setThreadCount(1);
+        d_renderer.beginRendering();
+        d_renderer.getDefaultRenderTarget().activate();
+    }
+
+    ~SoftwareRendererFixture()
+    {
+        SoftwareRenderer::destroy(d_renderer);
+    }
+
+    GeometryBuffer& createSolidBuffer()
+    {
+        return d_renderer.createGeometryBufferColoured(
+            d_renderer.createRenderMaterial(DefaultShaderType::Solid));
+    }
+
+    //! draw the buffer and return the number of pixels written.
+    std::size_t draw(const GeometryBuffer& buffer)
+    {
+        const std::size_t before = d_renderer.getStatistics().d_fragments;
+        buffer.draw();
+        return d_renderer.getStatistics().d_fragments - before;
+    }
+
+    argb_t pixel(unsigned int x, unsigned int y) const
+    {
+        return d_renderer.getFrameBuffer().getPixel(x, y);
+    }
+
+    SoftwareRenderer& d_renderer;
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(SoftwareRendererTestSuite, SoftwareRendererFixture)
+
+BOOST_AUTO_TEST_CASE(SolidRectangle)
+{
+    GeometryBuffer& buffer = createSolidBuffer();
+    buffer.appendSolidRect(Rectf(8.0f, 8.0f, 24.0f, 16.0f), ColourRect(Colour(Red)));
+
+    BOOST_CHECK_EQUAL(draw(buffer), 16u * 8u);
+    BOOST_CHECK_EQUAL(pixel(8, 8), Red);
+    BOOST_CHECK_EQUAL(pixel(23, 15), Red);
+    BOOST_CHECK_EQUAL(pixel(7, 8), Black);
+    BOOST_CHECK_EQUAL(pixel(24, 8), Black);
+    BOOST_CHECK_EQUAL(pixel(8, 16), Black);
+}
+
+BOOST_AUTO_TEST_CASE(FillConvention)
+{
+    // Pixel centres on the left and top edges are inside, those on the right
+    // and bottom edges are not.
+    GeometryBuffer& offset = createSolidBuffer();
+    offset.appendSolidRect(Rectf(0.5f, 0.5f, 10.5f, 10.5f), ColourRect(Colour(Red)));
+    BOOST_CHECK_EQUAL(draw(offset), 100u);
+    BOOST_CHECK_EQUAL(pixel(0, 0), Red);
+    BOOST_CHECK_EQUAL(pixel(9, 9), Red);
+    BOOST_CHECK_EQUAL(pixel(10, 9), Black);
+
+    // Edges shared by adjacent triangles are drawn exactly once, so half
+    // transparent geometry has no seams.
+    GeometryBuffer& halves = createSolidBuffer();
+    const ColourRect half(Colour(1.0f, 1.0f, 1.0f, 0.5f));
+    halves.appendSolidRect(Rectf(20.0f, 20.0f, 36.3f, 37.7f), half);
+    halves.appendSolidRect(Rectf(36.3f, 20.0f, 52.0f, 37.7f), half);
+    draw(halves);
+
+    for (unsigned int y = 20; y < 38; ++y)
+        for (unsigned int x = 20; x < 52; ++x)
+            BOOST_REQUIRE_EQUAL(pixel(x, y), 0xFF808080);
+}
+
+BOOST_AUTO_TEST_CASE(Blending)
+{
+    GeometryBuffer& buffer = createSolidBuffer();
+    buffer.appendSolidRect(Rectf(0.0f, 0.0f, 4.0f, 4.0f), ColourRect(Colour(1.0f, 0.0f, 0.0f)));
+    buffer.setAlpha(0.25f);
+    draw(buffer);
+    BOOST_CHECK_EQUAL(pixel(0, 0), 0xFF400000);
+
+    // Premultiplied blending adds the colour as it is
+    GeometryBuffer& premultiplied = createSolidBuffer();
+    premultiplied.appendSolidRect(Rectf(8.0f, 0.0f, 12.0f, 4.0f),
+                                  ColourRect(Colour(0.0f, 0.5f, 0.0f, 0.5f)));
+    premultiplied.setBlendMode(BlendMode::RttPremultiplied);
+    draw(premultiplied);
+    BOOST_CHECK_EQUAL(pixel(8, 0), 0xFF008000);
+}
+
+BOOST_AUTO_TEST_CASE(Clipping)
+{
+    GeometryBuffer& buffer = createSolidBuffer();
+    buffer.appendSolidRect(Rectf(0.0f, 0.0f, 256.0f, 256.0f), ColourRect(Colour(Red)));
+    buffer.setClippingRegion(Rectf(4.0f, 6.0f, 12.0f, 14.0f));
+    buffer.setClippingActive(true);
+
+    BOOST_CHECK_EQUAL(draw(buffer), 64u);
+    BOOST_CHECK_EQUAL(pixel(4, 6), Red);
+    BOOST_CHECK_EQUAL(pixel(11, 13), Red);
+    BOOST_CHECK_EQUAL(pixel(3, 6), Black);
+    BOOST_CHECK_EQUAL(pixel(12, 6), Black);
+    BOOST_CHECK_EQUAL(pixel(4, 14), Black);
+
+    buffer.setClippingRegion(Rectf(4.0f, 6.0f, 4.0f, 14.0f));
+    BOOST_CHECK_EQUAL(draw(buffer), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(FillRules)
+{
+    // Two overlapping squares as stencil geometry, then a rectangle covering
+    // both drawn through the stencil.
+    GeometryBuffer& evenOdd = createSolidBuffer();
+    evenOdd.appendSolidRect(Rectf(0.0f, 0.0f, 32.0f, 8.0f), ColourRect(Colour(Red)));
+    evenOdd.appendSolidRect(Rectf(16.0f, 0.0f, 48.0f, 8.0f), ColourRect(Colour(Red)));
+    evenOdd.appendSolidRect(Rectf(0.0f, 0.0f, 64.0f, 8.0f), ColourRect(Colour(Blue)));
+    evenOdd.setStencilRenderingActive(PolygonFillRule::EvenOdd);
+    evenOdd.setStencilPostRenderingVertexCount(6);
+    draw(evenOdd);
+
+    BOOST_CHECK_EQUAL(pixel(8, 4), Blue);
+    BOOST_CHECK_EQUAL(pixel(24, 4), Black);
+    BOOST_CHECK_EQUAL(pixel(40, 4), Blue);
+    BOOST_CHECK_EQUAL(pixel(56, 4), Black);
+
+    GeometryBuffer& nonZero = createSolidBuffer();
+    nonZero.appendSolidRect(Rectf(0.0f, 16.0f, 32.0f, 24.0f), ColourRect(Colour(Red)));
+    nonZero.appendSolidRect(Rectf(16.0f, 16.0f, 48.0f, 24.0f), ColourRect(Colour(Red)));
+    nonZero.appendSolidRect(Rectf(0.0f, 16.0f, 64.0f, 24.0f), ColourRect(Colour(Blue)));
+    nonZero.setStencilRenderingActive(PolygonFillRule::NonZero);
+    nonZero.setStencilPostRenderingVertexCount(6);
+    draw(nonZero);
+
+    BOOST_CHECK_EQUAL(pixel(8, 20), Blue);
+    BOOST_CHECK_EQUAL(pixel(24, 20), Blue);
+    BOOST_CHECK_EQUAL(pixel(40, 20), Blue);
+    BOOST_CHECK_EQUAL(pixel(56, 20), Black);
+}
+
+BOOST_AUTO_TEST_CASE(Textures)
+{
+    // 2x2 texture drawn 1:1, pixel centres sample texel centres exactly
+    const std::uint8_t texels[] = { 0xFF, 0, 0, 0xFF,   0, 0xFF, 0, 0xFF,
+                                    0, 0, 0xFF, 0xFF,   0xFF, 0xFF, 0xFF, 0xFF };
+    Texture& texture = d_renderer.createTexture("SoftwareRendererTest_texture");
+    texture.loadFromMemory(texels, Sizef(2.0f, 2.0f), Texture::PixelFormat::Rgba);
+
+    GeometryBuffer& buffer = d_renderer.createGeometryBufferTextured(
+        d_renderer.createRenderMaterial(DefaultShaderType::Textured));
+    buffer.setMainTexture(&texture);
+
+    const glm::vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
+    const TexturedColouredVertex vertices[] = {
+        TexturedColouredVertex(glm::vec3(10.0f, 10.0f, 0.0f), white, glm::vec2(0.0f, 0.0f)),
+        TexturedColouredVertex(glm::vec3(10.0f, 12.0f, 0.0f), white, glm::vec2(0.0f, 1.0f)),
+        TexturedColouredVertex(glm::vec3(12.0f, 12.0f, 0.0f), white, glm::vec2(1.0f, 1.0f)),
+        TexturedColouredVertex(glm::vec3(12.0f, 12.0f, 0.0f), white, glm::vec2(1.0f, 1.0f)),
+        TexturedColouredVertex(glm::vec3(12.0f, 10.0f, 0.0f), white, glm::vec2(1.0f, 0.0f)),
+        TexturedColouredVertex(glm::vec3(10.0f, 10.0f, 0.0f), white, glm::vec2(0.0f, 0.0f))
+    };
+    buffer.appendGeometry(vertices, 6);
+
+    BOOST_CHECK_EQUAL(draw(buffer), 4u);
+    BOOST_CHECK_EQUAL(pixel(10, 10), Red);
+    BOOST_CHECK_EQUAL(pixel(11, 10), 0xFF00FF00);
+    BOOST_CHECK_EQUAL(pixel(10, 11), Blue);
+    BOOST_CHECK_EQUAL(pixel(11, 11), 0xFFFFFFFF);
+}
+
+BOOST_AUTO_TEST_CASE(TextureTargets)
+{
+    TextureTarget* target = d_renderer.createTextureTarget(false);
+    target->declareRenderSize(Sizef(16.0f, 8.0f));
+    BOOST_CHECK_EQUAL(target->getTexture().getSize(), Sizef(16.0f, 8.0f));
+    BOOST_CHECK(!d_renderer.isTexCoordSystemFlipped());
+
+    target->activate();
+    target->clear();
+    GeometryBuffer& buffer = createSolidBuffer();
+    buffer.appendSolidRect(Rectf(0.0f, 0.0f, 4.0f, 2.0f), ColourRect(Colour(Blue)));
+    draw(buffer);
+    target->deactivate();
+
+    // The first row of the texture is the top of the rendered area
+    const SoftwareFrameBuffer& pixels =
+        *static_cast<SoftwareTextureTarget*>(target)->getFrameBuffer();
+    BOOST_CHECK_EQUAL(pixels.getWidth(), 16u);
+    BOOST_CHECK_EQUAL(pixels.getPixel(0, 0), Blue);
+    BOOST_CHECK_EQUAL(pixels.getPixel(3, 1), Blue);
+    BOOST_CHECK_EQUAL(pixels.getPixel(4, 0), 0u);
+    BOOST_CHECK_EQUAL(pixels.getPixel(0, 2), 0u);
+
+    // nothing was drawn to the default target
+    BOOST_CHECK_EQUAL(pixel(0, 0), Black);
+
+    d_renderer.destroyTextureTarget(target);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadCountInvariance)
+{
+    // Overlapping, blended, non axis aligned triangles over the whole target
+    GeometryBuffer& buffer = createSolidBuffer();
+    std::vector<ColouredVertex> vertices;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 300; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const float x = static_cast<float>(seed % 2560) * 0.1f;
+        seed = seed * 1103515245u + 12345u;
+        const float y = static_cast<float>(seed % 2560) * 0.1f;
+        const glm::vec4 colour((i % 3) / 2.0f, (i % 5) / 4.0f, (i % 7) / 6.0f, 0.3f);
+
+        vertices.push_back(ColouredVertex(glm::vec3(x, y, 0.0f), colour));
+        vertices.push_back(ColouredVertex(glm::vec3(256.0f - y, x, 0.0f), colour));
+        vertices.push_back(ColouredVertex(glm::vec3(x * 0.5f, 256.0f - x, 0.0f), colour));
+    }
+    buffer.appendGeometry(vertices.data(), vertices.size());
+
+    const std::size_t fragments = draw(buffer);
+    const SoftwareFrameBuffer reference(d_renderer.getFrameBuffer());
+
+    d_renderer.setThreadCount(4);
+    BOOST_CHECK_EQUAL(d_renderer.getThreadCount(), 4u);
+    d_renderer.beginRendering();
+    BOOST_CHECK_EQUAL(draw(buffer), fragments);
+
+    const SoftwareFrameBuffer::Difference difference =
+        d_renderer.getFrameBuffer().compare(reference);
+    BOOST_CHECK_EQUAL(difference.d_differingPixels, 0u);
+    BOOST_CHECK_EQUAL(difference.d_maxChannelDifference, 0);
+}
+
+BOOST_AUTO_TEST_CASE(PNGEncoding)
+{
+    std::vector<std::uint8_t> data;
+    d_renderer.getFrameBuffer().encodePNG(data);
+
+    const std::uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    BOOST_REQUIRE(data.size() > 8 + 256 * (256 * 4 + 1));
+    BOOST_CHECK(std::equal(signature, signature + 8, data.begin()));
+    // IHDR with the size, and IEND closing the file
+    BOOST_CHECK(std::equal(data.begin() + 12, data.begin() + 16, "IHDR"));
+    BOOST_CHECK_EQUAL(data[19], 0u);
+    BOOST_CHECK_EQUAL(data[18], 1u);
+    BOOST_CHECK(std::equal(data.end() - 8, data.end() - 4, "IEND"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -30,6 +30,24 @@
 
 using namespace CEGUI;
 
+namespace
+{
+//! Model decorating the text and providing its own tooltips.
+class OverridingItemModel : public StandardItemModel
+{
+public:
+    String getData(const ModelIndex& model_index, ItemDataRole role = ItemDataRole::Text) override
+    {
+        if (role == ItemDataRole::Text)
+            return "[" + StandardItemModel::getData(model_index, role) + "]";
+        if (role == ItemDataRole::Tooltip)
+            return "overridden";
+
+        return StandardItemModel::getData(model_index, role);
+    }
+};
+}
+
 BOOST_AUTO_TEST_SUITE(StandardItemModelTestSuite)
 
 //----------------------------------------------------------------------------//
@@ -76,4 +94,62 @@ BOOST_AUTO_TEST_CASE(Insert_ChildOfNode_InsertsBefore)
     BOOST_REQUIRE_EQUAL(i1_child1->getText(), model.getData(model.makeIndex(1, i1_index), ItemDataRole::Text));
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetItemData_ReferencesItemText)
+{
+    StandardItemModel model;
+    StandardItem* item = new StandardItem("i1", "TaharezLook/ListboxSelectionBrush");
+    model.addItem(item);
+
+    const ItemData text = model.getItemData(model.makeIndex(0, model.getRootIndex()));
+    BOOST_REQUIRE(text.getType() == ItemData::Type::String);
+    BOOST_CHECK_EQUAL(&item->getText(), &text.getString());
+
+    const ItemData icon = model.getItemData(model.makeIndex(0, model.getRootIndex()), ItemDataRole::Icon);
+    BOOST_CHECK_EQUAL("TaharezLook/ListboxSelectionBrush", icon.toString());
+    BOOST_CHECK(model.getItemData(ModelIndex()).isNull());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetItemDataRange_ReturnsConsecutiveChildren)
+{
+    StandardItemModel model;
+    model.addItem("i1");
+    model.addItem("i2");
+    model.addItem("i3");
+
+    std::vector<ItemData> data;
+    model.getItemDataRange(model.getRootIndex(), 1, 3, ItemDataRole::Text, data);
+
+    BOOST_REQUIRE_EQUAL(3, data.size());
+    BOOST_CHECK_EQUAL("i2", data[0].getString());
+    BOOST_CHECK_EQUAL("i3", data[1].getString());
+    BOOST_CHECK(data[2].isNull());
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(GetItemData_OverriddenGetData_IsUsed)
+{
+    OverridingItemModel model;
+    StandardItem* item = new StandardItem("i1", "TaharezLook/ListboxSelectionBrush");
+    model.addItem(item);
+    const ModelIndex index = model.makeIndex(0, model.getRootIndex());
+
+    BOOST_CHECK_EQUAL("[i1]", model.getItemData(index).toString());
+    BOOST_CHECK_EQUAL("overridden", model.getItemData(index, ItemDataRole::Tooltip).toString());
+
+    // roles forwarded to the base class still reference the item's data
+    const ItemData icon = model.getItemData(index, ItemDataRole::Icon);
+    BOOST_REQUIRE(icon.getType() == ItemData::Type::String);
+    BOOST_CHECK_EQUAL(&item->getIcon(), &icon.getString());
+
+    std::vector<ItemData> data;
+    model.getItemDataRange(model.getRootIndex(), 0, 1, ItemDataRole::Text, data);
+    BOOST_REQUIRE_EQUAL(1, data.size());
+    BOOST_CHECK_EQUAL("[i1]", data[0].toString());
+
+    // probing doesn't leak into direct calls
+    BOOST_CHECK_EQUAL("i1", model.StandardItemModel::getData(index, ItemDataRole::Text));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
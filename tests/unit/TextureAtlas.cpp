@@ -0,0 +1,92 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TextureAtlas.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace CEGUI;
+
+BOOST_AUTO_TEST_SUITE(TextureAtlasTestSuite)
+
+BOOST_AUTO_TEST_CASE(Packing)
+{
+    TextureAtlas atlas("TextureAtlasTest_packing", Sizef(64.0f, 64.0f));
+    const std::vector<std::uint8_t> pixels(14 * 14 * 4, 0xFF);
+
+    // 14x14 images take 16x16 with their gutter, so exactly 16 fit
+    std::vector<Rectf> areas;
+    Rectf area;
+    for (int i = 0; i < 16; ++i)
+    {
+        BOOST_REQUIRE(atlas.addImage(pixels.data(), Sizef(14.0f, 14.0f), area));
+        areas.push_back(area);
+    }
+
+    BOOST_CHECK(!atlas.addImage(pixels.data(), Sizef(14.0f, 14.0f), area));
+    BOOST_CHECK_EQUAL(atlas.getImageCount(), 16u);
+    BOOST_CHECK_CLOSE(atlas.getAllocatedRatio(), 1.0f, 0.001f);
+    BOOST_CHECK_CLOSE(atlas.getOccupancy(), 16.0f * 14.0f * 14.0f / (64.0f * 64.0f), 0.001f);
+
+    for (std::size_t i = 0; i < areas.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(areas[i].getSize(), Sizef(14.0f, 14.0f));
+        BOOST_CHECK(areas[i].left() >= 1.0f && areas[i].top() >= 1.0f);
+        BOOST_CHECK(areas[i].right() <= 63.0f && areas[i].bottom() <= 63.0f);
+
+        for (std::size_t j = i + 1; j < areas.size(); ++j)
+            BOOST_CHECK(areas[i].getIntersection(areas[j]) == Rectf(0.0f, 0.0f, 0.0f, 0.0f));
+    }
+
+    atlas.releaseImage(areas[0]);
+    BOOST_CHECK_EQUAL(atlas.getImageCount(), 15u);
+    BOOST_CHECK_CLOSE(atlas.getOccupancy(), 15.0f * 14.0f * 14.0f / (64.0f * 64.0f), 0.001f);
+}
+
+BOOST_AUTO_TEST_CASE(ShelfSelection)
+{
+    TextureAtlas atlas("TextureAtlasTest_shelves", Sizef(64.0f, 64.0f));
+    const std::vector<std::uint8_t> pixels(30 * 30 * 4, 0x80);
+
+    Rectf tall, small, smallSecond;
+    BOOST_REQUIRE(atlas.addImage(pixels.data(), Sizef(10.0f, 30.0f), tall));
+    // a much shorter image opens a new shelf rather than wasting the tall one
+    BOOST_REQUIRE(atlas.addImage(pixels.data(), Sizef(10.0f, 6.0f), small));
+    BOOST_CHECK(small.top() > tall.bottom());
+    // and the next short image goes beside it
+    BOOST_REQUIRE(atlas.addImage(pixels.data(), Sizef(10.0f, 6.0f), smallSecond));
+    BOOST_CHECK_EQUAL(smallSecond.top(), small.top());
+
+    // images too big for the atlas are rejected
+    Rectf area;
+    BOOST_CHECK(!atlas.addImage(pixels.data(), Sizef(63.0f, 10.0f), area));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
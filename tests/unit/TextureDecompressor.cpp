@@ -0,0 +1,130 @@
+/***********************************************************************
+ *    created:    19/10/2026
+ *    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/TextureDecompressor.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace CEGUI;
+
+namespace
+{
+void checkPixel(const std::uint8_t* pixels, std::size_t index,
+                int r, int g, int b, int a)
+{
+    BOOST_CHECK_EQUAL(pixels[index * 4 + 0], r);
+    BOOST_CHECK_EQUAL(pixels[index * 4 + 1], g);
+    BOOST_CHECK_EQUAL(pixels[index * 4 + 2], b);
+    BOOST_CHECK_EQUAL(pixels[index * 4 + 3], a);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(TextureDecompressorTestSuite)
+
+BOOST_AUTO_TEST_CASE(DataSize)
+{
+    BOOST_CHECK_EQUAL(TextureDecompressor::getDataSize(Texture::PixelFormat::Rgba, 3, 3), 36u);
+    BOOST_CHECK_EQUAL(TextureDecompressor::getDataSize(Texture::PixelFormat::Rgb, 3, 3), 27u);
+    BOOST_CHECK_EQUAL(TextureDecompressor::getDataSize(Texture::PixelFormat::RgbaDxt1, 5, 5), 32u);
+    BOOST_CHECK_EQUAL(TextureDecompressor::getDataSize(Texture::PixelFormat::RgbaDxt5, 4, 4), 16u);
+    BOOST_CHECK_EQUAL(TextureDecompressor::getDataSize(Texture::PixelFormat::RgbaBc7, 16, 16), 256u);
+    BOOST_CHECK_EQUAL(TextureDecompressor::getDataSize(Texture::PixelFormat::RgbEtc2, 8, 4), 16u);
+
+    BOOST_CHECK(TextureDecompressor::isCompressed(Texture::PixelFormat::RgbaEtc2));
+    BOOST_CHECK(!TextureDecompressor::isCompressed(Texture::PixelFormat::Rgba));
+    BOOST_CHECK(!TextureDecompressor::canDecompress(Texture::PixelFormat::RgbaBc7));
+}
+
+BOOST_AUTO_TEST_CASE(BC1)
+{
+    // red / blue end points in four colour mode, indices 0, 1, 2, 3
+    const std::uint8_t four_colour[8] = { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0x00, 0x00, 0x00 };
+    std::vector<std::uint8_t> pixels(4 * 4 * 4);
+
+    BOOST_REQUIRE(TextureDecompressor::decompress(Texture::PixelFormat::RgbaDxt1, four_colour, 4, 4, pixels.data()));
+    checkPixel(pixels.data(), 0, 255, 0, 0, 255);
+    checkPixel(pixels.data(), 1, 0, 0, 255, 255);
+    checkPixel(pixels.data(), 2, 170, 0, 85, 255);
+    checkPixel(pixels.data(), 3, 85, 0, 170, 255);
+    checkPixel(pixels.data(), 15, 255, 0, 0, 255);
+
+    // swapped end points select three colour mode with transparent black
+    const std::uint8_t three_colour[8] = { 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0x00, 0x00, 0x00 };
+
+    BOOST_REQUIRE(TextureDecompressor::decompress(Texture::PixelFormat::RgbaDxt1, three_colour, 4, 4, pixels.data()));
+    checkPixel(pixels.data(), 2, 127, 0, 127, 255);
+    checkPixel(pixels.data(), 3, 0, 0, 0, 0);
+
+    BOOST_REQUIRE(TextureDecompressor::decompress(Texture::PixelFormat::RgbDxt1, three_colour, 4, 4, pixels.data()));
+    checkPixel(pixels.data(), 3, 0, 0, 0, 255);
+}
+
+BOOST_AUTO_TEST_CASE(BC3)
+{
+    // alpha 255 / 0 with codes 0, 1, 2 followed by an all white colour block
+    const std::uint8_t block[16] =
+    {
+        0xFF, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
+    };
+    std::vector<std::uint8_t> pixels(4 * 4 * 4);
+
+    BOOST_REQUIRE(TextureDecompressor::decompress(Texture::PixelFormat::RgbaDxt5, block, 4, 4, pixels.data()));
+    checkPixel(pixels.data(), 0, 255, 255, 255, 255);
+    checkPixel(pixels.data(), 1, 255, 255, 255, 0);
+    checkPixel(pixels.data(), 2, 255, 255, 255, 218);
+}
+
+BOOST_AUTO_TEST_CASE(ETC2Individual)
+{
+    // individual mode, red 0x8 / 0x4, tables 0 and 7, pixel (0, 0) uses -large
+    const std::uint8_t block[8] = { 0x84, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x01 };
+    std::vector<std::uint8_t> pixels(4 * 4 * 4);
+
+    BOOST_REQUIRE(TextureDecompressor::decompress(Texture::PixelFormat::RgbEtc2, block, 4, 4, pixels.data()));
+    checkPixel(pixels.data(), 0, 128, 0, 0, 255);
+    checkPixel(pixels.data(), 1, 138, 2, 2, 255);
+    checkPixel(pixels.data(), 2, 115, 47, 47, 255);
+    checkPixel(pixels.data(), 15, 115, 47, 47, 255);
+}
+
+BOOST_AUTO_TEST_CASE(PartialBlocks)
+{
+    // a 2x2 image still uses a whole block, only 2x2 pixels may be written
+    const std::uint8_t block[8] = { 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+    std::vector<std::uint8_t> pixels(2 * 2 * 4 + 4, 0x55);
+
+    BOOST_REQUIRE(TextureDecompressor::decompress(Texture::PixelFormat::RgbaDxt1, block, 2, 2, pixels.data()));
+    for (std::size_t i = 0; i < 4; ++i)
+        checkPixel(pixels.data(), i, 255, 0, 0, 255);
+    checkPixel(pixels.data(), 4, 0x55, 0x55, 0x55, 0x55);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,364 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/TextureFilter.h"
+#include "CEGUI/TextureFilterEffect.h"
+#include "CEGUI/RenderEffectManager.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+#   include "CEGUI/RendererModules/Software/Renderer.h"
+#   include "CEGUI/RendererModules/Software/FrameBuffer.h"
+#   include "CEGUI/RendererModules/Software/TextureTarget.h"
+#   include "CEGUI/GeometryBuffer.h"
+#   include "CEGUI/RenderMaterial.h"
+#   include "CEGUI/ColourRect.h"
+#endif
+
+#include <vector>
+#include <cstdint>
+
+using namespace CEGUI;
+
+namespace
+{
+//! RGBA8 image in memory, as filtered by TextureFilter::apply.
+struct Pixels
+{
+    Pixels(unsigned int width, unsigned int height) :
+        d_width(width),
+        d_height(height),
+        d_data(width * height * 4, 0)
+    {}
+
+    std::uint8_t* at(unsigned int x, unsigned int y) { return &d_data[(y * d_width + x) * 4]; }
+
+    void fill(unsigned int left, unsigned int top, unsigned int right, unsigned int bottom,
+              std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+    {
+        for (unsigned int y = top; y < bottom; ++y)
+            for (unsigned int x = left; x < right; ++x)
+            {
+                std::uint8_t* p = at(x, y);
+                p[0] = r; p[1] = g; p[2] = b; p[3] = a;
+            }
+    }
+
+    void apply(const TextureFilter& filter) { filter.apply(d_data.data(), d_width, d_height, d_width * 4); }
+
+    unsigned int d_width;
+    unsigned int d_height;
+    std::vector<std::uint8_t> d_data;
+};
+
+//! BlurEffect counting the times the content was handed to it.
+class CountingBlurEffect : public BlurEffect
+{
+public:
+    CountingBlurEffect(Window* window) : BlurEffect(window) {}
+
+    void processRenderedContent(RenderingWindow& window) override
+    {
+        ++d_processCount;
+        BlurEffect::processRenderedContent(window);
+    }
+
+    int d_processCount = 0;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(TextureFilterTestSuite)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DownsampleFactor)
+{
+    BOOST_CHECK_EQUAL(TextureFilter::getDownsampleFactor(0.f), 1);
+    BOOST_CHECK_EQUAL(TextureFilter::getDownsampleFactor(4.f), 1);
+    BOOST_CHECK_EQUAL(TextureFilter::getDownsampleFactor(8.f), 2);
+    BOOST_CHECK_EQUAL(TextureFilter::getDownsampleFactor(16.f), 4);
+    BOOST_CHECK_EQUAL(TextureFilter::getDownsampleFactor(500.f), 8);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(BlurKeepsUniformImages)
+{
+    // edges are clamped, so a uniform image stays uniform at every radius
+    for (float radius : { 2.f, 8.f, 40.f })
+    {
+        Pixels image(37, 23);
+        image.fill(0, 0, 37, 23, 40, 80, 120, 200);
+        image.apply(TextureFilter::createBlur(radius));
+
+        for (unsigned int y = 0; y < 23; ++y)
+            for (unsigned int x = 0; x < 37; ++x)
+            {
+                const std::uint8_t* p = image.at(x, y);
+                BOOST_REQUIRE(p[0] == 40 && p[1] == 80 && p[2] == 120 && p[3] == 200);
+            }
+    }
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(BlurSoftensEdges)
+{
+    for (float radius : { 4.f, 16.f })
+    {
+        Pixels image(64, 8);
+        image.fill(0, 0, 32, 8, 255, 255, 255, 255);
+        image.apply(TextureFilter::createBlur(radius));
+
+        // far from the edge nothing changes, next to it the alpha is halfway
+        BOOST_CHECK_EQUAL(image.at(0, 4)[3], 255);
+        BOOST_CHECK_EQUAL(image.at(63, 4)[3], 0);
+        BOOST_CHECK_GT(image.at(31, 4)[3], 128 - 40);
+        BOOST_CHECK_LT(image.at(31, 4)[3], 128 + 40);
+        BOOST_CHECK_GT(image.at(32, 4)[3], 0);
+
+        // the result stays premultiplied, and is monotonic across the edge
+        for (unsigned int x = 0; x < 64; ++x)
+        {
+            const std::uint8_t* p = image.at(x, 4);
+            BOOST_CHECK_LE(p[0], p[3]);
+            if (x > 0)
+                BOOST_CHECK_LE(p[3], image.at(x - 1, 4)[3]);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(ColourMatrix)
+{
+    float matrix[TextureFilter::ColourMatrixSize];
+
+    TextureFilter::getIdentityMatrix(matrix);
+    Pixels identity(4, 1);
+    identity.fill(0, 0, 4, 1, 100, 50, 20, 128);
+    const std::vector<std::uint8_t> original(identity.d_data);
+    identity.apply(TextureFilter::createColourMatrix(matrix));
+    for (std::size_t i = 0; i < original.size(); ++i)
+        BOOST_CHECK_LE(std::abs(original[i] - identity.d_data[i]), 1);
+
+    // the matrix works on unpremultiplied colours: half transparent red
+    // becomes half transparent grey.
+    TextureFilter::getSaturationMatrix(matrix, 0.f);
+    Pixels grey(1, 1);
+    grey.fill(0, 0, 1, 1, 128, 0, 0, 128);
+    grey.apply(TextureFilter::createColourMatrix(matrix));
+    const std::uint8_t* p = grey.at(0, 0);
+    BOOST_CHECK_EQUAL(p[3], 128);
+    BOOST_CHECK_EQUAL(p[0], p[1]);
+    BOOST_CHECK_EQUAL(p[1], p[2]);
+    BOOST_CHECK_LE(std::abs(p[0] - static_cast<int>(0.2126f * 128 + 0.5f)), 1);
+
+    // the offset column can make transparent pixels visible
+    TextureFilter::getIdentityMatrix(matrix);
+    matrix[19] = 1.f;
+    Pixels opaque(1, 1);
+    opaque.apply(TextureFilter::createColourMatrix(matrix));
+    BOOST_CHECK_EQUAL(opaque.at(0, 0)[3], 255);
+    BOOST_CHECK_EQUAL(opaque.at(0, 0)[0], 0);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DropShadow)
+{
+    Pixels image(32, 32);
+    image.fill(8, 8, 16, 16, 255, 255, 255, 255);
+    image.apply(TextureFilter::createDropShadow(glm::vec2(4.f, 6.f), 0.f,
+                                                Colour(1.f, 0.f, 0.f, 0.5f)));
+
+    // the content is drawn over the shadow
+    BOOST_CHECK_EQUAL(image.at(8, 8)[0], 255);
+    BOOST_CHECK_EQUAL(image.at(15, 15)[1], 255);
+
+    // the shadow is moved by the offset and tinted
+    const std::uint8_t* shadow = image.at(18, 20);
+    BOOST_CHECK_EQUAL(shadow[0], 128);
+    BOOST_CHECK_EQUAL(shadow[1], 0);
+    BOOST_CHECK_EQUAL(shadow[3], 128);
+    BOOST_CHECK_EQUAL(image.at(20, 22)[3], 0);
+    BOOST_CHECK_EQUAL(image.at(13, 21)[3], 128);
+    BOOST_CHECK_EQUAL(image.at(13, 22)[3], 0);
+
+    // a blurred shadow extends past the hard one
+    Pixels blurred(32, 32);
+    blurred.fill(8, 8, 16, 16, 255, 255, 255, 255);
+    blurred.apply(TextureFilter::createDropShadow(glm::vec2(4.f, 6.f), 4.f,
+                                                  Colour(0.f, 0.f, 0.f, 1.f)));
+    BOOST_CHECK_GT(blurred.at(13, 22)[3], 0);
+    BOOST_CHECK_EQUAL(blurred.at(11, 11)[3], 255);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(SoftwareRendererFiltersTextureTargets)
+{
+    SoftwareRenderer& renderer = SoftwareRenderer::create(Sizef(64.f, 64.f));
+    renderer.setThreadCount(1);
+    renderer.beginRendering();
+
+    TextureTarget* target = renderer.createTextureTarget(false);
+    target->declareRenderSize(Sizef(32.f, 32.f));
+    target->activate();
+
+    GeometryBuffer& buffer = renderer.createGeometryBufferColoured(
+        renderer.createRenderMaterial(DefaultShaderType::Solid));
+    buffer.appendSolidRect(Rectf(4.f, 4.f, 12.f, 12.f), ColourRect(Colour(0xFFFFFFFF)));
+    buffer.draw();
+    target->deactivate();
+
+    BOOST_CHECK(renderer.applyTextureFilter(*target, Sizef(32.f, 32.f),
+        TextureFilter::createDropShadow(glm::vec2(8.f, 8.f), 0.f, Colour(0.f, 0.f, 0.f, 1.f))));
+
+    const SoftwareFrameBuffer& pixels =
+        *static_cast<SoftwareTextureTarget*>(target)->getFrameBuffer();
+    BOOST_CHECK_EQUAL(pixels.getPixel(4, 4), 0xFFFFFFFFu);
+    BOOST_CHECK_EQUAL(pixels.getPixel(19, 19), 0xFF000000u);
+    BOOST_CHECK_EQUAL(pixels.getPixel(20, 20), 0u);
+
+    // pixels outside of the given size are not touched
+    float matrix[TextureFilter::ColourMatrixSize];
+    TextureFilter::getIdentityMatrix(matrix);
+    matrix[19] = 1.f;
+    BOOST_CHECK(renderer.applyTextureFilter(*target, Sizef(16.f, 16.f),
+        TextureFilter::createColourMatrix(matrix)));
+    BOOST_CHECK_EQUAL(pixels.getPixel(1, 1), 0xFF000000u);
+    BOOST_CHECK_EQUAL(pixels.getPixel(4, 4), 0xFFFFFFFFu);
+    BOOST_CHECK_EQUAL(pixels.getPixel(24, 24), 0u);
+
+    renderer.destroyGeometryBuffer(buffer);
+    renderer.destroyTextureTarget(target);
+    renderer.endRendering();
+    SoftwareRenderer::destroy(renderer);
+}
+
+#endif
+
+//----------------------------------------------------------------------------//
+struct TextureFilterEffectFixture
+{
+    TextureFilterEffectFixture() :
+        d_context(&System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget()))
+    {
+        RenderEffectManager::getSingleton().addEffect<CountingBlurEffect>("Test/CountingBlur");
+
+        d_root = WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_context->setRootWindow(d_root);
+
+        d_window = WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_window->setSize(USize(cegui_absdim(100.f), cegui_absdim(50.f)));
+        d_root->addChild(d_window);
+    }
+
+    ~TextureFilterEffectFixture()
+    {
+        d_context->setRootWindow(nullptr);
+        WindowManager::getSingleton().destroyWindow(d_root);
+        System::getSingleton().destroyGUIContext(*d_context);
+        RenderEffectManager::getSingleton().removeEffect("Test/CountingBlur");
+    }
+
+    RenderingWindow& getRenderingWindow()
+    {
+        return *static_cast<RenderingWindow*>(d_window->getRenderingSurface());
+    }
+
+    GUIContext* d_context;
+    Window* d_root;
+    Window* d_window;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TextureFilterEffectTestSuite, TextureFilterEffectFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(BuiltInEffectsAreRegistered)
+{
+    RenderEffectManager& manager = RenderEffectManager::getSingleton();
+    BOOST_CHECK(manager.isEffectAvailable(BlurEffect::EffectName));
+    BOOST_CHECK(manager.isEffectAvailable(ColourMatrixEffect::EffectName));
+    BOOST_CHECK(manager.isEffectAvailable(DropShadowEffect::EffectName));
+
+    RenderEffect& effect = manager.create(DropShadowEffect::EffectName, d_window);
+    DropShadowEffect* shadow = dynamic_cast<DropShadowEffect*>(&effect);
+    BOOST_REQUIRE(shadow);
+    BOOST_CHECK(shadow->getFilter().getType() == TextureFilter::Type::DropShadow);
+
+    shadow->setOffset(glm::vec2(2.f, 3.f));
+    BOOST_CHECK(shadow->getFilter().getOffset() == glm::vec2(2.f, 3.f));
+    BOOST_CHECK_EQUAL(shadow->getRadius(), 8.f);
+
+    manager.destroy(effect);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(FilterRunsOnlyWhenContentIsRendered)
+{
+    d_window->setUsingAutoRenderingSurface(true);
+    RenderingWindow& surface = getRenderingWindow();
+
+    RenderEffect& effect = RenderEffectManager::getSingleton().create("Test/CountingBlur", d_window);
+    CountingBlurEffect& blur = static_cast<CountingBlurEffect&>(effect);
+    surface.setRenderEffect(&effect);
+
+    d_context->draw();
+    BOOST_CHECK_EQUAL(blur.d_processCount, 1);
+
+    // the filtered content is reused while nothing changes
+    d_context->draw();
+    d_context->draw();
+    BOOST_CHECK_EQUAL(blur.d_processCount, 1);
+
+    d_window->invalidate();
+    d_context->draw();
+    BOOST_CHECK_EQUAL(blur.d_processCount, 2);
+
+    // changing a parameter renders and filters the content again
+    blur.setRadius(3.f);
+    d_context->draw();
+    BOOST_CHECK_EQUAL(blur.d_processCount, 3);
+
+    // the null renderer does not filter, the window is drawn unfiltered
+    BOOST_CHECK(!blur.isFilterApplied());
+    BOOST_CHECK_EQUAL(blur.getFilterCount(), 0u);
+
+    surface.setRenderEffect(nullptr);
+    RenderEffectManager::getSingleton().destroy(effect);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
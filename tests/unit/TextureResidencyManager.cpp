@@ -0,0 +1,256 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/TextureResidencyManager.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Sizef.h"
+
+using namespace CEGUI;
+
+namespace
+{
+//! Texture counting the releases and reloads of its data.
+class CountingTexture : public Texture
+{
+public:
+    CountingTexture(const String& name, float size) :
+        d_name(name),
+        d_size(size, size),
+        d_texelScaling(1.f / size, 1.f / size)
+    {}
+
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+
+    void loadFromFile(const String& filename, const String&) override
+    {
+        d_lastFilename = filename;
+        d_hasData = true;
+        ++d_loadCount;
+    }
+
+    void loadFromMemory(const void*, const Sizef&, PixelFormat) override {}
+    void blitFromMemory(const void*, const Rectf&) override {}
+    void blitToMemory(void*) override {}
+    bool isPixelFormatSupported(const PixelFormat) const override { return true; }
+
+    bool releaseData() override
+    {
+        d_hasData = false;
+        ++d_releaseCount;
+        return true;
+    }
+
+    String d_name;
+    Sizef d_size;
+    glm::vec2 d_texelScaling;
+    String d_lastFilename;
+    bool d_hasData = true;
+    int d_loadCount = 0;
+    int d_releaseCount = 0;
+};
+
+//! Evictor destroying the texture it is asked to evict.
+class DestroyingEvictor : public TextureResidencyManager::Evictor
+{
+public:
+    void evictTexture(Texture& texture) override
+    {
+        d_evicted = &texture;
+        delete &texture;
+    }
+
+    const Texture* d_evicted = nullptr;
+};
+
+// 64 x 64 pixels at 32bpp
+const std::size_t TextureBytes = 64 * 64 * 4;
+}
+
+//----------------------------------------------------------------------------//
+struct TextureResidencyManagerFixture
+{
+    TextureResidencyManagerFixture() :
+        d_residency(TextureResidencyManager::getSingleton())
+    {
+        d_residency.resetStatistics();
+    }
+
+    ~TextureResidencyManagerFixture()
+    {
+        d_residency.setEnabled(false);
+        d_residency.setBudget(64 * 1024 * 1024);
+    }
+
+    CountingTexture* createTexture(const String& name, bool reloadable)
+    {
+        CountingTexture* texture = new CountingTexture(name, 64.f);
+        d_residency.registerTexture(*texture, TextureResidencyManager::Category::Imageset);
+        if (reloadable)
+            d_residency.setReloadSource(*texture, name + ".png", "");
+
+        return texture;
+    }
+
+    void useAndAdvance(const Texture& texture)
+    {
+        d_residency.notifyTextureUsed(texture);
+        d_residency.update();
+    }
+
+    TextureResidencyManager& d_residency;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TextureResidencyManagerTestSuite, TextureResidencyManagerFixture)
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(TracksBytesPerCategory)
+{
+    const TextureResidencyManager::CategoryStatistics before =
+        d_residency.getStatistics(TextureResidencyManager::Category::Font);
+
+    CountingTexture* texture = new CountingTexture("TextureResidencyTest/font", 64.f);
+    d_residency.registerTexture(*texture, TextureResidencyManager::Category::Font);
+    BOOST_CHECK(d_residency.isTextureRegistered(*texture));
+
+    TextureResidencyManager::CategoryStatistics stats =
+        d_residency.getStatistics(TextureResidencyManager::Category::Font);
+    BOOST_CHECK_EQUAL(stats.d_textureCount, before.d_textureCount + 1);
+    BOOST_CHECK_EQUAL(stats.d_residentBytes, before.d_residentBytes + TextureBytes);
+
+    // Destroying the texture unregisters it
+    delete texture;
+    stats = d_residency.getStatistics(TextureResidencyManager::Category::Font);
+    BOOST_CHECK_EQUAL(stats.d_textureCount, before.d_textureCount);
+    BOOST_CHECK_EQUAL(stats.d_residentBytes, before.d_residentBytes);
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(EvictsLeastRecentlyUsedAndReloadsOnUse)
+{
+    CountingTexture* older = createTexture("TextureResidencyTest/older", true);
+    CountingTexture* newer = createTexture("TextureResidencyTest/newer", true);
+
+    d_residency.setEnabled(true);
+    useAndAdvance(*older);
+    useAndAdvance(*newer);
+
+    // Only one of the two textures fits
+    d_residency.setBudget(d_residency.getResidentBytes() - TextureBytes);
+    d_residency.update();
+
+    BOOST_CHECK(d_residency.isEvicted(*older));
+    BOOST_CHECK(!older->d_hasData);
+    BOOST_CHECK(!d_residency.isEvicted(*newer));
+    BOOST_CHECK_EQUAL(newer->d_releaseCount, 0);
+
+    d_residency.notifyTextureUsed(*older);
+    BOOST_CHECK(!d_residency.isEvicted(*older));
+    BOOST_CHECK_EQUAL(older->d_loadCount, 1);
+    BOOST_CHECK_EQUAL(older->d_lastFilename, "TextureResidencyTest/older.png");
+
+    // Used in this frame, so the other texture goes
+    d_residency.update();
+    BOOST_CHECK(!d_residency.isEvicted(*older));
+    BOOST_CHECK(d_residency.isEvicted(*newer));
+
+    const TextureResidencyManager::CategoryStatistics stats =
+        d_residency.getStatistics(TextureResidencyManager::Category::Imageset);
+    BOOST_CHECK_EQUAL(stats.d_evictionCount, 2u);
+    BOOST_CHECK_EQUAL(stats.d_reloadCount, 1u);
+    BOOST_CHECK(stats.d_evictedBytes >= TextureBytes);
+
+    delete older;
+    delete newer;
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(KeepsTexturesWithoutReloadSource)
+{
+    CountingTexture* texture = createTexture("TextureResidencyTest/fixed", false);
+
+    d_residency.setEnabled(true);
+    d_residency.setBudget(0);
+    d_residency.update();
+
+    BOOST_CHECK(!d_residency.isEvicted(*texture));
+    BOOST_CHECK_EQUAL(texture->d_releaseCount, 0);
+    BOOST_CHECK(!d_residency.canAccommodate(1));
+
+    delete texture;
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(DisablingReloadsEvictedTextures)
+{
+    CountingTexture* texture = createTexture("TextureResidencyTest/disable", true);
+
+    d_residency.setEnabled(true);
+    d_residency.setBudget(0);
+    d_residency.update();
+    BOOST_REQUIRE(d_residency.isEvicted(*texture));
+
+    d_residency.setEnabled(false);
+    BOOST_CHECK(!d_residency.isEvicted(*texture));
+    BOOST_CHECK(texture->d_hasData);
+
+    // Nothing is evicted while disabled
+    d_residency.update();
+    BOOST_CHECK(!d_residency.isEvicted(*texture));
+
+    delete texture;
+}
+
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(EvictorReleasesTexture)
+{
+    DestroyingEvictor evictor;
+    CountingTexture* texture = createTexture("TextureResidencyTest/evictor", false);
+    d_residency.setEvictor(*texture, &evictor);
+
+    d_residency.setEnabled(true);
+    d_residency.setBudget(0);
+    d_residency.update();
+
+    BOOST_CHECK(evictor.d_evicted == texture);
+    BOOST_CHECK_EQUAL(d_residency.getStatistics(
+        TextureResidencyManager::Category::Imageset).d_evictionCount, 1u);
+
+    // Without an evictor the texture stays
+    CountingTexture* other = createTexture("TextureResidencyTest/evictor2", false);
+    d_residency.setEvictor(*other, &evictor);
+    d_residency.removeEvictor(evictor);
+    d_residency.update();
+    BOOST_CHECK(evictor.d_evicted == texture);
+
+    delete other;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,7 @@
 #include "CEGUI/Event.h"
 #include "CEGUI/Font.h"
 #include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/Scrollbar.h"
 
 // Yup. We need this in order to easily inject/call event handlers without having
 // to go through GUIContext, or inherit from widgets in order to test them.
@@ -567,4 +568,31 @@ BOOST_AUTO_TEST_CASE(MultipleLevelsHierarchy_RenderedMaxWidthGreaterThanViewSize
     BOOST_REQUIRE(view->getRenderedMaxWidth() > 100);
 }
 
+//----------------------------------------------------------------------------//
+BOOST_AUTO_TEST_CASE(Virtualization_OnlyRowsNearVisibleAreaAreLaidOut)
+{
+    for (size_t i = 0; i < 500; ++i)
+        model.addRandomItemWithChildren(model.getRootIndex(), i, 0);
+    view->setSize(USize(cegui_absdim(200), cegui_absdim(font_height * 10)));
+    view->setVirtualizationEnabled(true);
+    view->prepareForRender();
+
+    const std::vector<TreeViewItemRenderingState*>& children =
+        view->getRootItemState().d_renderedChildren;
+    BOOST_REQUIRE_EQUAL(500, children.size());
+    BOOST_REQUIRE(!children.at(0)->d_text.empty());
+    BOOST_REQUIRE(children.at(499)->d_text.empty());
+
+    view->getVertScrollbar()->setUnitIntervalScrollPosition(1.0f);
+    view->prepareForRender();
+
+    size_t laid_out_count = 0;
+    for (const TreeViewItemRenderingState* child : children)
+        laid_out_count += child->d_text.empty() ? 0 : 1;
+
+    BOOST_REQUIRE(children.at(0)->d_text.empty());
+    BOOST_REQUIRE(laid_out_count > 0);
+    BOOST_REQUIRE(laid_out_count < 100);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+/***********************************************************************
+    created:    19/10/2026
+    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace CEGUI;
+
+BOOST_AUTO_TEST_SUITE(XMLAttributesTestSuite)
+
+BOOST_AUTO_TEST_CASE(Views)
+{
+    char name[] = "width";
+    char value[] = "42";
+
+    XMLAttributes attrs;
+    attrs.addView("name", "Frame");
+    attrs.addView(name, value);
+    attrs.addView("alpha", "0.5");
+    attrs.addView("visible", "True");
+
+    BOOST_CHECK_EQUAL(attrs.getCount(), 4u);
+    BOOST_CHECK(attrs.exists("width"));
+    BOOST_CHECK(!attrs.exists("widt"));
+    BOOST_CHECK(!attrs.exists("widths"));
+
+    // attributes keep the order they were added in
+    BOOST_CHECK_EQUAL(attrs.getName(1), "width");
+    BOOST_CHECK_EQUAL(attrs.getValue(0), "Frame");
+
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("width"), 42);
+    BOOST_CHECK_EQUAL(attrs.getValueAsFloat("alpha"), 0.5f);
+    BOOST_CHECK(attrs.getValueAsBool("visible"));
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("height", 7), 7);
+
+    // a copy owns its strings and does not see later changes to the buffers
+    XMLAttributes copy(attrs);
+    value[0] = '1';
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("width"), 12);
+    BOOST_CHECK_EQUAL(copy.getValueAsInteger("width"), 42);
+    BOOST_CHECK_EQUAL(copy.getValue("width"), "42");
+
+    // a repeated attribute replaces the earlier value
+    attrs.addView("width", "3");
+    BOOST_CHECK_EQUAL(attrs.getCount(), 4u);
+    BOOST_CHECK_EQUAL(attrs.getValue("width"), "3");
+
+    attrs.remove("name");
+    BOOST_CHECK_EQUAL(attrs.getCount(), 3u);
+    BOOST_CHECK(!attrs.exists("name"));
+}
+
+BOOST_AUTO_TEST_CASE(OwnedAndViewMixed)
+{
+    XMLAttributes attrs;
+    attrs.addView("type", "TaharezLook/Button");
+    attrs.add("type", "Generic/Image");
+    attrs.add("name", "Label");
+    attrs.addView("name", "Other");
+
+    BOOST_CHECK_EQUAL(attrs.getCount(), 2u);
+    BOOST_CHECK_EQUAL(attrs.getValue("type"), "Generic/Image");
+    BOOST_CHECK_EQUAL(attrs.getValueAsString("name"), "Other");
+    BOOST_CHECK_EQUAL(attrs.getValueAsString("missing", "def"), "def");
+
+    attrs.clear();
+    BOOST_CHECK_EQUAL(attrs.getCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(Conversions)
+{
+    XMLAttributes attrs;
+    attrs.addView("int", " -12");
+    attrs.addView("trailing", "12px");
+    attrs.addView("overflow", "99999999999999999999");
+    attrs.addView("empty", "");
+    attrs.addView("bool", "yes");
+    attrs.add("owned", "0");
+
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("int"), -12);
+    BOOST_CHECK_THROW(attrs.getValueAsInteger("trailing"), InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValueAsInteger("overflow"), InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValueAsInteger("empty"), InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValueAsBool("bool"), InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValue("missing"), UnknownObjectException);
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("owned"), 0);
+    BOOST_CHECK(!attrs.getValueAsBool("owned", true));
+}
+
+BOOST_AUTO_TEST_SUITE_END()